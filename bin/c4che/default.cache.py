@@ -0,0 +1,1257 @@
+ABI_CHECK = False
+AD_DC_BUILD_IS_ENABLED = 1
+AR = '/usr/bin/ar'
+ARFLAGS = 'rcs'
+AUTH_SHARED = ['auth_script']
+AUTH_STATIC = ['auth_domain', 'auth_builtin', 'auth_sam', 'auth_winbind', 'auth_unix', 'auth_wbc', 'auth_samba4']
+AUTOCONF_BUILD = ''
+AUTOCONF_HOST = ''
+AUTOCONF_PROGRAM_PREFIX = ''
+AWK = '/usr/bin/awk'
+BINDIR = '/usr/local/samba/bin'
+BROKEN_NISPLUS_INCLUDE_FILES = 1
+BSD_STYLE_STATVFS = ()
+BUILD_DIRECTORY = '/root/repo/bin'
+BUILD_SYSTEM = 'Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux'
+BUILTIN_LIBRARIES = ['NONE']
+BUNDLED_LIBS = ['']
+CACHEDIR = '/usr/local/samba/var/cache'
+CC = ['/usr/bin/gcc']
+CCDEFINES = ['_SAMBA_BUILD_=4', 'HAVE_CONFIG_H=1', '_GNU_SOURCE=1', '_XOPEN_SOURCE_EXTENDED=1', 'HAVE_CONFIG_H=1']
+CCDEFINES_NCURSES = ['_DEFAULT_SOURCE', '_XOPEN_SOURCE=600']
+CCDEFINES_ST = '-D%s'
+CCFLAGS = ['-I/usr/include/tirpc']
+CCFLAGS_CEPHFS = '-D_FILE_OFFSET_BITS=64'
+CCFLAGS_DEBUG = ['-g']
+CCFLAGS_MACBUNDLE = ['-fPIC']
+CCFLAGS_PYEMBED = ['-fno-strict-aliasing']
+CCFLAGS_PYEXT = ['-fno-strict-aliasing']
+CCFLAGS_RELEASE = ['-O2']
+CCFLAGS_crypt = []
+CCFLAGS_crypto = []
+CCFLAGS_form = []
+CCFLAGS_gnutls = []
+CCFLAGS_menu = []
+CCFLAGS_ncurses = []
+CCFLAGS_nsl = []
+CCFLAGS_panel = []
+CCFLAGS_pthread = []
+CCFLAGS_readline = []
+CCFLAGS_resolv = []
+CCFLAGS_rt = []
+CCFLAGS_z = []
+CCLNK_SRC_F = ''
+CCLNK_TGT_F = ['-o', '']
+CC_NAME = 'gcc'
+CC_SRC_F = ''
+CC_TGT_F = ['-c', '-o', '']
+CC_VERSION = ('12', '2', '0')
+CHARSET_SHARED = []
+CHARSET_STATIC = []
+CLUSTER_SUPPORT = 1
+CODEPAGEDIR = '/usr/local/samba/share/codepages'
+COMPILER_CC = 'gcc'
+COMPILER_SUPPORTS_LL = 1
+CONFIGDIR = '/usr/local/samba/etc'
+CONFIGFILE = '/usr/local/samba/etc/smb4.conf'
+CONFIG_H_IS_FROM_SAMBA = 1
+CPP = '/usr/bin/cpp'
+CPPPATH = ['/usr/local/include', '/usr/local/include']
+CPPPATH_GNUTLS = ['/usr/include/p11-kit-1']
+CPPPATH_GPFS = '/usr/lpp/mmfs/include/'
+CPPPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/include/python2.7']
+CPPPATH_PYEXT = ['/root/.pyenv/versions/2.7.18/include/python2.7']
+CPPPATH_ST = '-I%s'
+CROSS_ANSWERS = ''
+CROSS_COMPILE = False
+CROSS_EXECUTE = ''
+CTDB_BINDIR = '/usr/local/samba/bin'
+CTDB_ETCDIR = '/usr/local/samba/etc/ctdb'
+CTDB_HELPER_BINDIR = '/usr/local/samba/libexec/ctdb'
+CTDB_LOGDIR = '/usr/local/samba/var/log'
+CTDB_RUNDIR = '/usr/local/samba/var/run/ctdb'
+CTDB_SOCKET = '/usr/local/samba/var/run/ctdb/ctdbd.socket'
+CTDB_SOCKPATH = '/usr/local/samba/var/run/ctdb/ctdbd.socket'
+CTDB_TEST_DATADIR = '/usr/local/samba/share/ctdb/tests'
+CTDB_TEST_LIBEXECDIR = '/usr/local/samba/libexec/ctdb/tests'
+CTDB_VARDIR = '/usr/local/samba/var/lib/ctdb'
+CUPS_CONFIG = ''
+CXXDEFINES_NCURSES = ['_DEFAULT_SOURCE', '_XOPEN_SOURCE=600']
+DATADIR = '/usr/local/samba/share'
+DATAROOTDIR = '/usr/local/samba/share'
+DEFAULT_DOS_CHARSET = 'CP850'
+DEFAULT_UNIX_CHARSET = 'UTF-8'
+DEST_BINFMT = 'elf'
+DEST_CPU = 'x86_64'
+DEST_OS = 'linux'
+DLOPEN_TAKES_UNSIGNED_FLAGS = ()
+DOCDIR = '/usr/local/samba/share/doc/samba'
+DVIDIR = '/usr/local/samba/share/doc/samba'
+ENABLE_GNUTLS = 1
+ENABLE_PIE = True
+ENABLE_RELRO = True
+EXEC_PREFIX = '/usr/local/samba'
+EXTRA_CFLAGS = ['-fPIC', '-D_REENTRANT', '-D_POSIX_PTHREAD_SEMANTICS', '-DCTDB_HELPER_BINDIR="/usr/local/samba/libexec/ctdb"', '-DLOGDIR="/usr/local/samba/var/log"', '-DCTDB_ETCDIR="/usr/local/samba/etc/ctdb"', '-DCTDB_VARDIR="/usr/local/samba/var/lib/ctdb"', '-DCTDB_RUNDIR="/usr/local/samba/var/run/ctdb"', '-fstack-protector']
+EXTRA_INCLUDES = ['#include/public', '#source4', '#lib', '#source4/lib', '#source4/include', '#include', '#lib/replace', '#include/public', '#ctdb/include', '#ctdb']
+EXTRA_LDFLAGS = ['-lpthread', '-Wl,-no-undefined', '-Wl,-no-undefined', '-Wl,-no-undefined', '-Wl,-no-undefined', '-Wl,--export-dynamic', '-Wl,-no-undefined', '-Wl,--as-needed', '-fstack-protector']
+EXTRA_PYTHON = None
+FOUND_SYSTEMLIB_popt = False
+FOUND_SYSTEMLIB_pyldb-util = False
+FOUND_SYSTEMLIB_pytalloc-util = False
+FOUND_SYSTEMLIB_talloc = False
+FOUND_SYSTEMLIB_tdb = False
+FOUND_SYSTEMLIB_tevent = False
+FOUND_SYSTEMLIB_z = True
+FULLSTATIC_MARKER = '-static'
+GETCWD_TAKES_NULL = 1
+GIT = '/usr/bin/git'
+GIT_LOCAL_CHANGES = False
+GPEXT_SHARED = []
+GPEXT_STATIC = []
+GPGME_CONFIG = ''
+HAVE_ADDR_TYPE_IN_KRB5_ADDRESS = 1
+HAVE_AIO_H = 1
+HAVE_ALLOCA_H = 1
+HAVE_AP_OPTS_USE_SUBKEY = 1
+HAVE_ARPA_INET_H = 1
+HAVE_ARPA_NAMESER_H = 1
+HAVE_ASM_TYPES_H = 1
+HAVE_ASM_UNISTD_H = 1
+HAVE_ASPRINTF = 1
+HAVE_ASSERT_H = 1
+HAVE_ATEXIT = 1
+HAVE_ATOMIC_ADD_32 = ()
+HAVE_AVAHI_CLIENT_NEW = ()
+HAVE_AVAHI_STRERROR = ()
+HAVE_BACKTRACE = 1
+HAVE_BACKTRACE_SYMBOLS = 1
+HAVE_BASENAME = 1
+HAVE_BIG_ENDIAN = ()
+HAVE_BINDTEXTDOMAIN = 1
+HAVE_BIND_TEXTDOMAIN_CODESET = 1
+HAVE_BLKCNT_T = 1
+HAVE_BLKSIZE_T = 1
+HAVE_BOOL = 1
+HAVE_BSD_STRTOLL = ()
+HAVE_BSWAP16 = ()
+HAVE_BSWAP32 = ()
+HAVE_BZERO = 1
+HAVE_C99_VSNPRINTF = 1
+HAVE_CAP_GET_PROC = ()
+HAVE_CC_MD5_INIT = ()
+HAVE_CGETENT = ()
+HAVE_CHARSET_CP850 = 1
+HAVE_CHARSET_UTF_8 = 1
+HAVE_CHECKSUM_IN_KRB5_CHECKSUM = 1
+HAVE_CHFLAGS = ()
+HAVE_CHMOD = 1
+HAVE_CHOWN = 1
+HAVE_CHROOT = 1
+HAVE_CHSIZE = ()
+HAVE_CLEARENV = 1
+HAVE_CLOCK_GETTIME = 1
+HAVE_CLOCK_MONOTONIC = 1
+HAVE_CLOCK_PROCESS_CPUTIME_ID = 1
+HAVE_CLOCK_REALTIME = 1
+HAVE_CLOSEFROM = 1
+HAVE_COMPARISON_FN_T = 1
+HAVE_COMPILER_WILL_OPTIMIZE_OUT_FNS = 1
+HAVE_COM_ERR_H = 1
+HAVE_CONFIG_H = ()
+HAVE_CONNECT = 1
+HAVE_CONSTRUCTOR_ATTRIBUTE = 1
+HAVE_CPPFUNCTION = 1
+HAVE_CRYPT = 1
+HAVE_CRYPT16 = ()
+HAVE_CRYPT_H = 1
+HAVE_CTYPE_H = 1
+HAVE_CUPS = ()
+HAVE_CURSES_H = 1
+HAVE_DARWIN_INITGROUPS = ()
+HAVE_DECL_ASPRINTF = 1
+HAVE_DECL_BINDTEXTDOMAIN = 1
+HAVE_DECL_BIND_TEXTDOMAIN_CODESET = 1
+HAVE_DECL_DGETTEXT = 1
+HAVE_DECL_DLOPEN = 1
+HAVE_DECL_EWOULDBLOCK = 1
+HAVE_DECL_FDATASYNC = 1
+HAVE_DECL_FS_COMPR_FL = 1
+HAVE_DECL_FS_IOC_GETFLAGS = 1
+HAVE_DECL_GETGRENT_R = 1
+HAVE_DECL_GETPWENT_R = 1
+HAVE_DECL_GETTEXT = 1
+HAVE_DECL_GETTIMEOFDAY = 1
+HAVE_DECL_GNUTLS_CERT_EXPIRED = 1
+HAVE_DECL_GNUTLS_CERT_NOT_ACTIVATED = 1
+HAVE_DECL_GNUTLS_CERT_UNEXPECTED_OWNER = 1
+HAVE_DECL_H_ERRNO = 1
+HAVE_DECL_KRB5_AUTH_CON_SET_REQ_CKSUMTYPE = 0
+HAVE_DECL_KRB5_GET_CREDENTIALS_FOR_USER = 0
+HAVE_DECL_MALLOC = 1
+HAVE_DECL_MEMALIGN = 1
+HAVE_DECL_PTHREAD_MUTEX_ROBUST = 1
+HAVE_DECL_READAHEAD = 1
+HAVE_DECL_RL_EVENT_HOOK = 1
+HAVE_DECL_SNPRINTF = 1
+HAVE_DECL_STRPTIME = 1
+HAVE_DECL_TEXTDOMAIN = 1
+HAVE_DECL_VASPRINTF = 1
+HAVE_DECL_VSNPRINTF = 1
+HAVE_DECL__RES = 1
+HAVE_DESTRUCTOR_ATTRIBUTE = 1
+HAVE_DES_PCBC_ENCRYPT = 1
+HAVE_DEVICE_MAJOR_FN = ()
+HAVE_DEVICE_MINOR_FN = ()
+HAVE_DEVNM = ()
+HAVE_DGETTEXT = 1
+HAVE_DIRENT_D_OFF = 1
+HAVE_DIRENT_H = 1
+HAVE_DIRFD = 1
+HAVE_DIRFD_DECL = 1
+HAVE_DIRNAME = 1
+HAVE_DIR_DD_FD = ()
+HAVE_DLCLOSE = 1
+HAVE_DLERROR = 1
+HAVE_DLFCN_H = 1
+HAVE_DLOPEN = 1
+HAVE_DLSYM = 1
+HAVE_DM_GET_EVENTLIST = ()
+HAVE_DNSSERVICEREGISTER = ()
+HAVE_DNS_SEARCH = ()
+HAVE_DN_EXPAND = 1
+HAVE_DPRINTF = 1
+HAVE_DQB_FSOFTLIMIT = ()
+HAVE_DUP2 = 1
+HAVE_ENCTYPE_AES128_CTS_HMAC_SHA1_96 = 1
+HAVE_ENCTYPE_AES256_CTS_HMAC_SHA1_96 = 1
+HAVE_ENCTYPE_ARCFOUR_HMAC = 1
+HAVE_ENCTYPE_ARCFOUR_HMAC_MD5 = 1
+HAVE_ENCTYPE_ARCFOUR_HMAC_MD5_56 = 1
+HAVE_ENDHOSTENT = 1
+HAVE_ENDIAN_H = 1
+HAVE_ENDMNTENT = 1
+HAVE_ENDNETGRENT = 1
+HAVE_ENDNETGRENT_PROTOTYPE = 1
+HAVE_ENVIRON_DECL = 1
+HAVE_EPOLL = 1
+HAVE_EPOLL_CREATE = 1
+HAVE_ERR = 1
+HAVE_ERRNO_DECL = 1
+HAVE_ERRNO_H = 1
+HAVE_ERRX = 1
+HAVE_ERR_H = 1
+HAVE_ETHTOOL = 1
+HAVE_ETIME = 1
+HAVE_ETYPE_IN_ENCRYPTEDDATA = 1
+HAVE_EXECINFO_H = 1
+HAVE_EXECL = 1
+HAVE_E_DATA_POINTER_IN_KRB5_ERROR = 1
+HAVE_FALLOCATE = 1
+HAVE_FALLOC_FL_PUNCH_HOLE = 1
+HAVE_FALLOC_FL_ZERO_RANGE = 1
+HAVE_FCHMOD = 1
+HAVE_FCHOWN = 1
+HAVE_FCNTL_H = 1
+HAVE_FCNTL_LOCK = 1
+HAVE_FCVT = 1
+HAVE_FCVTL = ()
+HAVE_FDATASYNC = 1
+HAVE_FDATASYNC_DECL = 1
+HAVE_FDOPENDIR = 1
+HAVE_FGETXATTR = 1
+HAVE_FLAGS_IN_KRB5_CREDS = 1
+HAVE_FLISTEA = ()
+HAVE_FLISTXATTR = 1
+HAVE_FLOAT_H = 1
+HAVE_FLOCK = 1
+HAVE_FNMATCH_H = 1
+HAVE_FORM_H = 1
+HAVE_FREEADDRINFO = 1
+HAVE_FREEHOSTENT = ()
+HAVE_FREEIFADDRS = 1
+HAVE_FREE_CHECKSUM = 1
+HAVE_FREMOVEXATTR = 1
+HAVE_FRSIZE = 1
+HAVE_FSEEKO = 1
+HAVE_FSETXATTR = 1
+HAVE_FSID_INT = 1
+HAVE_FSTATAT = 1
+HAVE_FSYNC = 1
+HAVE_FTRUNCATE = 1
+HAVE_FTRUNCATE_EXTEND = 1
+HAVE_FUNCTION_MACRO = 1
+HAVE_FUTIMENS = 1
+HAVE_FUTIMES = 1
+HAVE_F_SETLEASE_DECL = 1
+HAVE_GAI_STRERROR = 1
+HAVE_GETADDRINFO = 1
+HAVE_GETAUTHUID = ()
+HAVE_GETAUXVAL = 1
+HAVE_GETCWD = 1
+HAVE_GETDENTS = ()
+HAVE_GETDIRENTRIES = 1
+HAVE_GETGRENT = 1
+HAVE_GETGRENT_R = 1
+HAVE_GETGRENT_R_DECL = 1
+HAVE_GETGRGID_R = 1
+HAVE_GETGRNAM = 1
+HAVE_GETGRNAM_R = 1
+HAVE_GETGROUPLIST = 1
+HAVE_GETGRSET = ()
+HAVE_GETHOSTBYADDR = 1
+HAVE_GETHOSTBYNAME = 1
+HAVE_GETHOSTBYNAME_R = 1
+HAVE_GETHOSTENT = 1
+HAVE_GETHOSTENT_R = 1
+HAVE_GETHOSTNAME = 1
+HAVE_GETIFADDRS = 1
+HAVE_GETIPNODEBYADDR = ()
+HAVE_GETIPNODEBYNAME = ()
+HAVE_GETMNTENT = 1
+HAVE_GETNAMEINFO = 1
+HAVE_GETNETGRENT = 1
+HAVE_GETNETGRENT_PROTOTYPE = 1
+HAVE_GETOPT_H = 1
+HAVE_GETPAGESIZE = 1
+HAVE_GETPEEREID = ()
+HAVE_GETPGRP = 1
+HAVE_GETPROGNAME = ()
+HAVE_GETPWANAM = ()
+HAVE_GETPWENT_R = 1
+HAVE_GETPWENT_R_DECL = 1
+HAVE_GETPWNAM = 1
+HAVE_GETPWNAM_R = 1
+HAVE_GETPWUID_R = 1
+HAVE_GETQUOTA_RSLT_GETQUOTA_RSLT_U = 1
+HAVE_GETRLIMIT = 1
+HAVE_GETSPNAM = 1
+HAVE_GETTEXT = 1
+HAVE_GETTIMEOFDAY_TZ = ()
+HAVE_GETTIMEOFDAY_TZ_VOID = 1
+HAVE_GETUTMPX = 1
+HAVE_GETUTXENT = 1
+HAVE_GETXATTR = 1
+HAVE_GET_CURRENT_DIR_NAME = 1
+HAVE_GLOB = 1
+HAVE_GLOB_H = 1
+HAVE_GLUSTERFS = ()
+HAVE_GNUTLS = 1
+HAVE_GNUTLS3 = 1
+HAVE_GNUTLS_3_4_7 = 1
+HAVE_GNUTLS_CERTIFICATE_VERIFY_PEERS3 = 1
+HAVE_GNUTLS_DATUM = 1
+HAVE_GNUTLS_DATUM_T = 1
+HAVE_GNUTLS_GLOBAL_INIT = 1
+HAVE_GNUTLS_GNUTLS_H = 1
+HAVE_GNUTLS_X509_CRT_SET_SUBJECT_KEY_ID = 1
+HAVE_GNUTLS_X509_CRT_SET_VERSION = 1
+HAVE_GNUTLS_X509_H = 1
+HAVE_GPGME_NEW = ()
+HAVE_GRANTPT = 1
+HAVE_GRP_H = 1
+HAVE_GSSAPI = 1
+HAVE_GSSAPI_GSSAPI_H = 1
+HAVE_GSSAPI_GSSAPI_KRB5_H = 1
+HAVE_GSSAPI_GSSAPI_SPNEGO_H = 1
+HAVE_GSSKRB5_EXTRACT_AUTHZ_DATA_FROM_SEC_CONTEXT = 1
+HAVE_GSSKRB5_GET_SUBKEY = 1
+HAVE_GSS_DISPLAY_STATUS = 1
+HAVE_GSS_EXPORT_CRED = 1
+HAVE_GSS_IMPORT_CRED = 1
+HAVE_GSS_INQUIRE_SEC_CONTEXT_BY_OID = 1
+HAVE_GSS_KRB5_CRED_NO_CI_FLAGS_X = 1
+HAVE_GSS_KRB5_EXPORT_LUCID_SEC_CONTEXT = 1
+HAVE_GSS_KRB5_IMPORT_CRED = 1
+HAVE_GSS_OID_EQUAL = 1
+HAVE_GSS_WRAP_IOV = 1
+HAVE_HISTORY_LIST = 1
+HAVE_HSTRERROR = 1
+HAVE_HTTPCONNECT = ()
+HAVE_HTTPCONNECTENCRYPT = ()
+HAVE_H_ERRNO = 1
+HAVE_ICONV = 1
+HAVE_ICONV_H = 1
+HAVE_ICONV_OPEN = 1
+HAVE_IFACE_GETIFADDRS = 1
+HAVE_IFADDRS_H = 1
+HAVE_IF_NAMETOINDEX = 1
+HAVE_IMMEDIATE_STRUCTURES = 1
+HAVE_INCOHERENT_MMAP = ()
+HAVE_INET_ATON = 1
+HAVE_INET_NTOA = 1
+HAVE_INET_NTOP = 1
+HAVE_INET_PTON = 1
+HAVE_INITGROUPS = 1
+HAVE_INITIALIZE_KRB5_ERROR_TABLE = 1
+HAVE_INITSCR = 1
+HAVE_INNETGR = 1
+HAVE_INOTIFY = 1
+HAVE_INOTIFY_INIT = 1
+HAVE_INO_T = 1
+HAVE_INT16_T = 1
+HAVE_INT32_T = 1
+HAVE_INT64_T = 1
+HAVE_INT8_T = 1
+HAVE_INTPTR_T = 1
+HAVE_INTTYPES_H = 1
+HAVE_IO_SUBMIT = ()
+HAVE_IPV6 = 1
+HAVE_IPV6_V6ONLY = 1
+HAVE_IRUSEROK = 1
+HAVE_ISATTY = 1
+HAVE_ITEM_COUNT = 1
+HAVE_KERNEL_CHANGE_NOTIFY = 1
+HAVE_KERNEL_OPLOCKS_IRIX = ()
+HAVE_KERNEL_OPLOCKS_LINUX = 1
+HAVE_KERNEL_SHARE_MODES = 1
+HAVE_KRB5 = 1
+HAVE_KRB5_ADDRESSES = 1
+HAVE_KRB5_AUTH_CON_SETKEY = 1
+HAVE_KRB5_CC_COPY_CACHE = 1
+HAVE_KRB5_CC_GET_LIFETIME = 1
+HAVE_KRB5_CONFIG_GET_BOOL_DEFAULT = 1
+HAVE_KRB5_CREATE_CHECKSUM = 1
+HAVE_KRB5_CRYPTO = 1
+HAVE_KRB5_CRYPTO_DESTROY = 1
+HAVE_KRB5_CRYPTO_INIT = 1
+HAVE_KRB5_C_VERIFY_CHECKSUM = 1
+HAVE_KRB5_DATA_COPY = 1
+HAVE_KRB5_ENCTYPE_TO_STRING = 1
+HAVE_KRB5_ENCTYPE_TO_STRING_WITH_KRB5_CONTEXT_ARG = 1
+HAVE_KRB5_FREE_ERROR_CONTENTS = 1
+HAVE_KRB5_FREE_HOST_REALM = 1
+HAVE_KRB5_FWD_TGT_CREDS = 1
+HAVE_KRB5_GET_CREDS = 1
+HAVE_KRB5_GET_CREDS_OPT_ALLOC = 1
+HAVE_KRB5_GET_CREDS_OPT_SET_IMPERSONATE = 1
+HAVE_KRB5_GET_DEFAULT_IN_TKT_ETYPES = 1
+HAVE_KRB5_GET_HOST_REALM = 1
+HAVE_KRB5_GET_INIT_CREDS_KEYBLOCK = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_ALLOC = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_FREE = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_GET_ERROR = 1
+HAVE_KRB5_GET_INIT_CREDS_OPT_SET_PAC_REQUEST = 1
+HAVE_KRB5_GET_PW_SALT = 1
+HAVE_KRB5_GET_RENEWED_CREDS = 1
+HAVE_KRB5_H = 1
+HAVE_KRB5_KEYBLOCK_INIT = 1
+HAVE_KRB5_KEYBLOCK_KEYVALUE = 1
+HAVE_KRB5_KEYTAB_ENTRY_KEYBLOCK = 1
+HAVE_KRB5_KRBHST_GET_ADDRINFO = 1
+HAVE_KRB5_KRBHST_INIT = 1
+HAVE_KRB5_KT_COMPARE = 1
+HAVE_KRB5_KT_FREE_ENTRY = 1
+HAVE_KRB5_KU_OTHER_CKSUM = 1
+HAVE_KRB5_LOCATE_PLUGIN_H = 1
+HAVE_KRB5_MAKE_PRINCIPAL = 1
+HAVE_KRB5_MK_REQ_EXTENDED = 1
+HAVE_KRB5_PDU_NONE_DECL = 1
+HAVE_KRB5_PRINCIPAL_COMPARE_ANY_REALM = 1
+HAVE_KRB5_PRINCIPAL_GET_COMP_STRING = 1
+HAVE_KRB5_PRINCIPAL_GET_NUM_COMP = 1
+HAVE_KRB5_PRINCIPAL_GET_REALM = 1
+HAVE_KRB5_PRINCIPAL_GET_TYPE = 1
+HAVE_KRB5_PRINCIPAL_SET_REALM = 1
+HAVE_KRB5_PRINCIPAL_SET_TYPE = 1
+HAVE_KRB5_PROMPT_TYPE = 1
+HAVE_KRB5_REALM_TYPE = 1
+HAVE_KRB5_SET_DEFAULT_IN_TKT_ETYPES = 1
+HAVE_KRB5_SET_REAL_TIME = 1
+HAVE_KRB5_STRING_TO_KEY = 1
+HAVE_KRB5_STRING_TO_KEY_SALT = 1
+HAVE_KRB5_WARNX = 1
+HAVE_KRB_STRUCT_WINSIZE = 1
+HAVE_LANGINFO_H = 1
+HAVE_LARGEFILE = 1
+HAVE_LASTLOG_H = 1
+HAVE_LCHOWN = 1
+HAVE_LD_VERSION_SCRIPT = True
+HAVE_LIBCRYPT = 1
+HAVE_LIBCRYPTO = 1
+HAVE_LIBFORM = 1
+HAVE_LIBGEN_H = 1
+HAVE_LIBGNUTLS = 1
+HAVE_LIBINTL_H = 1
+HAVE_LIBKRB5 = 1
+HAVE_LIBMENU = 1
+HAVE_LIBNCURSES = 1
+HAVE_LIBNSL = 1
+HAVE_LIBPANEL = 1
+HAVE_LIBPTHREAD = 1
+HAVE_LIBREADLINE = 1
+HAVE_LIBREPLACE = 1
+HAVE_LIBRESOLV = 1
+HAVE_LIBRT = 1
+HAVE_LIBZ = 1
+HAVE_LIBZFS = '1'
+HAVE_LIMITS_H = 1
+HAVE_LINK = 1
+HAVE_LINUX_ETHTOOL_H = 1
+HAVE_LINUX_FALLOCATE = 1
+HAVE_LINUX_FALLOC_H = 1
+HAVE_LINUX_FCNTL_H = 1
+HAVE_LINUX_FICLONERANGE = 1
+HAVE_LINUX_FS_H = 1
+HAVE_LINUX_INOTIFY = 1
+HAVE_LINUX_IOCTL = '1'
+HAVE_LINUX_IOCTL_H = 1
+HAVE_LINUX_KERNEL_AIO = ()
+HAVE_LINUX_NETLINK_H = 1
+HAVE_LINUX_READAHEAD = 1
+HAVE_LINUX_RTNETLINK_H = 1
+HAVE_LINUX_SOCKIOS_H = 1
+HAVE_LINUX_SPLICE = 1
+HAVE_LINUX_TYPES_H = 1
+HAVE_LISTXATTR = 1
+HAVE_LITTLE_ENDIAN = 1
+HAVE_LLSEEK = ()
+HAVE_LOCALE_H = 1
+HAVE_LOFF_T = 1
+HAVE_LONG_LONG = 1
+HAVE_LSEEK_HOLE_DATA = 1
+HAVE_LSTAT = 1
+HAVE_LTTNG_TRACEF = ()
+HAVE_LUTIMES = 1
+HAVE_MAKEDEV = ()
+HAVE_MALLOC_H = 1
+HAVE_MD5INIT = ()
+HAVE_MEMALIGN = 1
+HAVE_MEMCPY = 1
+HAVE_MEMFD_CREATE = 1
+HAVE_MEMMEM = 1
+HAVE_MEMMOVE = 1
+HAVE_MEMORY_H = 1
+HAVE_MEMSET = 1
+HAVE_MENU_H = 1
+HAVE_MKDIR_MODE = 1
+HAVE_MKDTEMP = 1
+HAVE_MKNOD = 1
+HAVE_MKTIME = 1
+HAVE_MLOCK = 1
+HAVE_MLOCKALL = 1
+HAVE_MMAP = 1
+HAVE_MNTENT_H = 1
+HAVE_MREMAP = 1
+HAVE_MUNLOCK = 1
+HAVE_MUNLOCKALL = 1
+HAVE_NANOSLEEP = 1
+HAVE_NATIVE_ICONV = 1
+HAVE_NCURSES = '1'
+HAVE_NCURSES_H = 1
+HAVE_NETDB_H = 1
+HAVE_NETINET_IN_H = 1
+HAVE_NETINET_IN_SYSTM_H = 1
+HAVE_NETINET_IP_H = 1
+HAVE_NETINET_TCP_H = 1
+HAVE_NET_IF_H = 1
+HAVE_NEW_FIELD = 1
+HAVE_NEW_FORM = 1
+HAVE_NEW_LIBREADLINE = 1
+HAVE_NEW_PANEL = 1
+HAVE_NFS_QUOTAS = '1'
+HAVE_NSS_H = 1
+HAVE_NSS_XBYY_KEY_IPNODE = ()
+HAVE_OFD_LOCKS = 1
+HAVE_OFFSET_T = ()
+HAVE_OPENAT = 1
+HAVE_OPENPTY = 1
+HAVE_OPEN_O_DIRECT = 1
+HAVE_PAM_START = ()
+HAVE_PANEL_H = 1
+HAVE_PASSWD_PW_AGE = ()
+HAVE_PASSWD_PW_COMMENT = ()
+HAVE_PATHCONF = 1
+HAVE_PEERCRED = 1
+HAVE_PIPE = 1
+HAVE_POLL = 1
+HAVE_POLL_H = 1
+HAVE_PORT_CREATE = ()
+HAVE_POSIX_FADVISE = 1
+HAVE_POSIX_FALLOCATE = 1
+HAVE_POSIX_MEMALIGN = 1
+HAVE_POSIX_OPENPT = 1
+HAVE_PRCTL = 1
+HAVE_PREAD = 1
+HAVE_PREAD_DECL = 1
+HAVE_PRINTF = 1
+HAVE_PTHREAD = '1'
+HAVE_PTHREAD_ATTR_INIT = 1
+HAVE_PTHREAD_CREATE = 1
+HAVE_PTHREAD_H = 1
+HAVE_PTHREAD_MUTEXATTR_SETROBUST = 1
+HAVE_PTHREAD_MUTEX_CONSISTENT = 1
+HAVE_PTRDIFF_T = 1
+HAVE_PTY_H = 1
+HAVE_PUTENV = 1
+HAVE_PUTUTLINE = 1
+HAVE_PUTUTXLINE = 1
+HAVE_PWD_H = 1
+HAVE_PWRITE = 1
+HAVE_PWRITE_DECL = 1
+HAVE_PYTHON_H = 1
+HAVE_QUOTACTL_LINUX = '1'
+HAVE_RAND = 1
+HAVE_RANDOM = 1
+HAVE_RCMD = 1
+HAVE_RDCHK = ()
+HAVE_READAHEAD_DECL = 1
+HAVE_READLINE_HISTORY_H = 1
+HAVE_READLINE_READLINE_H = 1
+HAVE_READLINK = 1
+HAVE_READV = 1
+HAVE_REALPATH = 1
+HAVE_REMOVEXATTR = 1
+HAVE_RENAME = 1
+HAVE_RESOLV_H = 1
+HAVE_RES_NDESTROY = ()
+HAVE_RES_NSEARCH = 1
+HAVE_RES_SEARCH = 1
+HAVE_RL_COMPLETION_FUNC_T = ()
+HAVE_RL_COMPLETION_MATCHES = 1
+HAVE_ROBUST_MUTEXES = 1
+HAVE_RPCSVC_NIS_H = 1
+HAVE_RPCSVC_RQUOTA_H = 1
+HAVE_RPCSVC_YPCLNT_H = 1
+HAVE_RPCSVC_YP_PROT_H = 1
+HAVE_RPC_NETTYPE_H = 1
+HAVE_RPC_RPC_H = 1
+HAVE_SA_FAMILY_T = 1
+HAVE_SA_SIGINFO_DECL = 1
+HAVE_SCHED_H = 1
+HAVE_SCHED_SETSCHEDULER = 1
+HAVE_SECURE_MKSTEMP = 1
+HAVE_SELECT = 1
+HAVE_SENDFILE = '1'
+HAVE_SENDMSG = 1
+HAVE_SETBUFFER = 1
+HAVE_SETEGID = 1
+HAVE_SETENV = 1
+HAVE_SETENV_DECL = 1
+HAVE_SETEUID = 1
+HAVE_SETGID = 1
+HAVE_SETGIDX = ()
+HAVE_SETGROUPS = 1
+HAVE_SETHOSTENT = 1
+HAVE_SETITIMER = 1
+HAVE_SETJMP_H = 1
+HAVE_SETLINEBUF = 1
+HAVE_SETLOCALE = 1
+HAVE_SETLUID = ()
+HAVE_SETMNTENT = 1
+HAVE_SETNETGRENT = 1
+HAVE_SETNETGRENT_PROTOTYPE = 1
+HAVE_SETPGID = 1
+HAVE_SETPRIV = ()
+HAVE_SETPROCTITLE = ()
+HAVE_SETPROGNAME = ()
+HAVE_SETREGID = 1
+HAVE_SETRESGID = 1
+HAVE_SETRESGID_DECL = 1
+HAVE_SETRESUID = 1
+HAVE_SETRESUID_DECL = 1
+HAVE_SETREUID = 1
+HAVE_SETSID = 1
+HAVE_SETUID = 1
+HAVE_SETUIDX = ()
+HAVE_SETXATTR = 1
+HAVE_SET_MENU_ITEMS = 1
+HAVE_SHA1_UPDATE = ()
+HAVE_SHA256_UPDATE = ()
+HAVE_SHA512_UPDATE = ()
+HAVE_SHADOW_H = 1
+HAVE_SHARED_MMAP = 1
+HAVE_SHL_FINDSYM = ()
+HAVE_SHL_LOAD = ()
+HAVE_SHL_UNLOAD = ()
+HAVE_SHMGET = 1
+HAVE_SHM_OPEN = 1
+HAVE_SHOW_PANEL = 1
+HAVE_SIGACTION = 1
+HAVE_SIGBLOCK = 1
+HAVE_SIGGETMASK = 1
+HAVE_SIGNAL_H = 1
+HAVE_SIGPROCMASK = 1
+HAVE_SIGSET = 1
+HAVE_SIGSETMASK = 1
+HAVE_SIG_ATOMIC_T_TYPE = 1
+HAVE_SIMPLE_C_PROG = 1
+HAVE_SIZE_T = 1
+HAVE_SNPRINTF = 1
+HAVE_SOCKADDR_SA_LEN = ()
+HAVE_SOCKET = 1
+HAVE_SOCKETPAIR = 1
+HAVE_SOCKLEN_T = 1
+HAVE_SOCK_SIN_LEN = ()
+HAVE_SPLICE_DECL = 1
+HAVE_SRAND = 1
+HAVE_SRANDOM = 1
+HAVE_SSIZE_T = 1
+HAVE_SS_FAMILY = 1
+HAVE_STATFS_F_FSID = 1
+HAVE_STATVFS = 1
+HAVE_STATVFS_F_FLAG = 1
+HAVE_STATVFS_F_FLAGS = ()
+HAVE_STAT_HIRES_TIMESTAMPS = '1'
+HAVE_STAT_ST_BLKSIZE = 1
+HAVE_STAT_ST_BLOCKS = 1
+HAVE_STAT_ST_FLAGS = ()
+HAVE_STAT_TV_NSEC = 1
+HAVE_STDARG_H = 1
+HAVE_STDBOOL_H = 1
+HAVE_STDDEF_H = 1
+HAVE_STDINT_H = 1
+HAVE_STDIO_H = 1
+HAVE_STDLIB_H = 1
+HAVE_STRCASECMP = 1
+HAVE_STRCASESTR = 1
+HAVE_STRCHR = 1
+HAVE_STRCPY = 1
+HAVE_STRDUP = 1
+HAVE_STRERROR = 1
+HAVE_STRERROR_R = 1
+HAVE_STRFTIME = 1
+HAVE_STRINGS_H = 1
+HAVE_STRING_H = 1
+HAVE_STRLCAT = ()
+HAVE_STRLCPY = ()
+HAVE_STRLWR = ()
+HAVE_STRNCASECMP = 1
+HAVE_STRNCPY = 1
+HAVE_STRNDUP = 1
+HAVE_STRNLEN = 1
+HAVE_STRPBRK = 1
+HAVE_STRPTIME = 1
+HAVE_STRSEP = 1
+HAVE_STRSEP_COPY = ()
+HAVE_STRSIGNAL = 1
+HAVE_STRTOK_R = 1
+HAVE_STRTOL = 1
+HAVE_STRTOLL = 1
+HAVE_STRTOQ = 1
+HAVE_STRTOULL = 1
+HAVE_STRTOUQ = 1
+HAVE_STRUCT_ADDRINFO = 1
+HAVE_STRUCT_DQBLK_DQB_CURBYTES = ()
+HAVE_STRUCT_IFADDRS = 1
+HAVE_STRUCT_MSGHDR_MSG_ACCRIGHTS = ()
+HAVE_STRUCT_MSGHDR_MSG_CONTROL = 1
+HAVE_STRUCT_SIGEVENT = 1
+HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIGVAL_PTR = ()
+HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIVAL_PTR = 1
+HAVE_STRUCT_SOCKADDR = 1
+HAVE_STRUCT_SOCKADDR_IN6 = 1
+HAVE_STRUCT_SOCKADDR_STORAGE = 1
+HAVE_STRUCT_STAT_ST_BIRTHTIME = ()
+HAVE_STRUCT_STAT_ST_BIRTHTIMENSEC = ()
+HAVE_STRUCT_STAT_ST_BIRTHTIMESPEC_TV_NSEC = ()
+HAVE_STRUCT_STAT_ST_MTIMENSEC = ()
+HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC = ()
+HAVE_STRUCT_STAT_ST_MTIME_N = ()
+HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC = 1
+HAVE_STRUCT_STAT_ST_RDEV = 1
+HAVE_STRUCT_STAT_ST_UMTIME = ()
+HAVE_STRUCT_TIMESPEC = 1
+HAVE_STRUCT_WINSIZE = 1
+HAVE_STRUPR = ()
+HAVE_ST_RDEV = 1
+HAVE_SWAB = 1
+HAVE_SYMLINK = 1
+HAVE_SYSCALL = 1
+HAVE_SYSCALL_H = 1
+HAVE_SYSCONF = 1
+HAVE_SYSCTL = ()
+HAVE_SYSCTLBYNAME = ()
+HAVE_SYSLOG = 1
+HAVE_SYSLOG_H = 1
+HAVE_SYS_AUXV_H = 1
+HAVE_SYS_CDEFS_H = 1
+HAVE_SYS_DIR_H = 1
+HAVE_SYS_EPOLL_H = 1
+HAVE_SYS_EVENTFD_H = 1
+HAVE_SYS_FCNTL_H = 1
+HAVE_SYS_FILE_H = 1
+HAVE_SYS_INOTIFY_H = 1
+HAVE_SYS_IOCTL_H = 1
+HAVE_SYS_IPC_H = 1
+HAVE_SYS_KERNEL_PROC_CORE_PATTERN = '1'
+HAVE_SYS_MMAN_H = 1
+HAVE_SYS_MOUNT_H = 1
+HAVE_SYS_PARAM_H = 1
+HAVE_SYS_PRCTL_H = 1
+HAVE_SYS_QUOTAS = '1'
+HAVE_SYS_QUOTA_H = 1
+HAVE_SYS_RESOURCE_H = 1
+HAVE_SYS_SELECT_H = 1
+HAVE_SYS_SENDFILE_H = 1
+HAVE_SYS_SHM_H = 1
+HAVE_SYS_SOCKET_H = 1
+HAVE_SYS_STATFS_H = 1
+HAVE_SYS_STATVFS_H = 1
+HAVE_SYS_STAT_H = 1
+HAVE_SYS_SYSCALL_H = 1
+HAVE_SYS_SYSLOG_H = 1
+HAVE_SYS_SYSMACROS_H = 1
+HAVE_SYS_TERMIOS_H = 1
+HAVE_SYS_TIMEB_H = 1
+HAVE_SYS_TIMES_H = 1
+HAVE_SYS_TIME_H = 1
+HAVE_SYS_TYPES_H = 1
+HAVE_SYS_UCONTEXT_H = 1
+HAVE_SYS_UIO_H = 1
+HAVE_SYS_UNISTD_H = 1
+HAVE_SYS_UN_H = 1
+HAVE_SYS_UTSNAME_H = 1
+HAVE_SYS_VFS_H = 1
+HAVE_SYS_WAIT_H = 1
+HAVE_SYS_XATTR_H = 1
+HAVE_TERMCAP_H = 1
+HAVE_TERMIOS_H = 1
+HAVE_TERMIO_H = 1
+HAVE_TERM_H = 1
+HAVE_TEXTDOMAIN = 1
+HAVE_TGETENT = 1
+HAVE_TIMEGM = 1
+HAVE_TIME_H = 1
+HAVE_UCONTEXT_T = 1
+HAVE_UINT16_T = 1
+HAVE_UINT32_T = 1
+HAVE_UINT64_T = 1
+HAVE_UINT8_T = 1
+HAVE_UINTPTR_T = 1
+HAVE_UINT_T = ()
+HAVE_UMASK = 1
+HAVE_UNAME = 1
+HAVE_UNISTD_H = 1
+HAVE_UNIXSOCKET = 1
+HAVE_UNSETENV = 1
+HAVE_UPDWTMP = 1
+HAVE_UPDWTMPX = 1
+HAVE_USLEEP = 1
+HAVE_UTIMBUF = 1
+HAVE_UTIME = 1
+HAVE_UTIMENSAT = 1
+HAVE_UTIMES = 1
+HAVE_UTIME_H = 1
+HAVE_UTMPX_H = 1
+HAVE_UTMP_H = 1
+HAVE_UT_UT_EXIT = 1
+HAVE_UT_UT_HOST = 1
+HAVE_UT_UT_ID = 1
+HAVE_UT_UT_NAME = 1
+HAVE_UT_UT_PID = 1
+HAVE_UT_UT_TIME = 1
+HAVE_UT_UT_TV = 1
+HAVE_UT_UT_TYPE = 1
+HAVE_UT_UT_USER = 1
+HAVE_UX_UT_SYSLEN = ()
+HAVE_U_CHAR = 1
+HAVE_U_INT32_T = 1
+HAVE_VASPRINTF = 1
+HAVE_VA_COPY = 1
+HAVE_VDPRINTF = 1
+HAVE_VISIBILITY_ATTR = 1
+HAVE_VOLATILE = 1
+HAVE_VSNPRINTF = 1
+HAVE_VSYSLOG = 1
+HAVE_WAIT4 = 1
+HAVE_WAITPID = 1
+HAVE_WARN = 1
+HAVE_WARNX = 1
+HAVE_WORKING_STRPTIME = 1
+HAVE_WRITEV = 1
+HAVE_WS_XPIXEL = 1
+HAVE_WS_YPIXEL = 1
+HAVE_XATTR_SUPPORT = 1
+HAVE_XFS_QUOTAS = ()
+HAVE_YP_GET_DEFAULT_DOMAIN = 1
+HAVE_Z = 1
+HAVE_ZLIBVERSION = 1
+HAVE_ZLIB_H = 1
+HAVE__ACL = ()
+HAVE__Bool = 1
+HAVE__CHDIR = ()
+HAVE__CLOSE = ()
+HAVE__CLOSEDIR = ()
+HAVE__DN_EXPAND = ()
+HAVE__DUP = ()
+HAVE__DUP2 = ()
+HAVE__FACL = ()
+HAVE__FCHDIR = ()
+HAVE__FCNTL = ()
+HAVE__FORK = ()
+HAVE__FSTAT = ()
+HAVE__GETCWD = ()
+HAVE__LLSEEK = ()
+HAVE__LSEEK = ()
+HAVE__LSTAT = ()
+HAVE__OPEN = ()
+HAVE__OPENDIR = ()
+HAVE__PREAD = ()
+HAVE__PWRITE = ()
+HAVE__READ = ()
+HAVE__READDIR = ()
+HAVE__RES = 1
+HAVE__SEEKDIR = ()
+HAVE__STAT = ()
+HAVE__TELLDIR = ()
+HAVE__VA_ARGS__MACRO = 1
+HAVE__WRITE = ()
+HAVE___ACL = ()
+HAVE___ATTRIBUTE__ = 1
+HAVE___CHDIR = ()
+HAVE___CLOSE = 1
+HAVE___CLOSEDIR = ()
+HAVE___DN_EXPAND = ()
+HAVE___DUP = ()
+HAVE___DUP2 = 1
+HAVE___FACL = ()
+HAVE___FCHDIR = ()
+HAVE___FCNTL = 1
+HAVE___FORK = 1
+HAVE___FSTAT = ()
+HAVE___FXSTAT = 1
+HAVE___GETCWD = ()
+HAVE___GETDENTS = ()
+HAVE___LLSEEK = ()
+HAVE___LSEEK = 1
+HAVE___LSTAT = ()
+HAVE___LXSTAT = 1
+HAVE___OPEN = 1
+HAVE___OPENDIR = ()
+HAVE___PREAD = ()
+HAVE___PWRITE = ()
+HAVE___READ = 1
+HAVE___READDIR = ()
+HAVE___SEEKDIR = ()
+HAVE___SS_FAMILY = ()
+HAVE___STAT = ()
+HAVE___STRTOLL = ()
+HAVE___STRTOULL = ()
+HAVE___SYNC_FETCH_AND_ADD = 1
+HAVE___SYS_LLSEEK = ()
+HAVE___TELLDIR = ()
+HAVE___WRITE = 1
+HAVE___XSTAT = 1
+HEIMDAL_KRB5_CONFIG = ''
+HOSTCC = False
+HTMLDIR = '/usr/local/samba/share/doc/samba'
+IDMAP_SHARED = ['idmap_autorid', 'idmap_rid', 'idmap_hash', 'idmap_tdb2', 'idmap_script']
+IDMAP_STATIC = ['idmap_tdb', 'idmap_passdb', 'idmap_nss']
+INCLUDEDIR = '/usr/local/samba/include'
+INFODIR = '/usr/local/samba/share/info'
+INLINE_MACRO = 1
+KRB5_CREDS_OPT_FREE_REQUIRES_CONTEXT = 1
+KRB5_PRINC_REALM_RETURNS_REALM = 1
+LDB_MODULESDIR = '/usr/local/samba/lib/ldb'
+LIBDIR = '/usr/local/samba/lib'
+LIBEXECDIR = '/usr/local/samba/libexec'
+LIBPATH = ['/usr/local/lib', '/usr/local/lib']
+LIBPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_PYEXT = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_PYTHON2.7 = ['/root/.pyenv/versions/2.7.18/lib']
+LIBPATH_ST = '-L%s'
+LIBREPLACE_NETWORK_CHECKS = 1
+LIB_CRYPT = 'crypt'
+LIB_CRYPTO = 'crypto'
+LIB_FORM = 'form'
+LIB_GNUTLS = 'gnutls'
+LIB_MENU = 'menu'
+LIB_NCURSES = ['ncurses', 'ncurses', 'tinfo']
+LIB_NSL = 'nsl'
+LIB_PANEL = 'panel'
+LIB_PTHREAD = 'pthread'
+LIB_PYEMBED = ['m', 'dl', 'python2.7']
+LIB_PYEXT = ['m', 'dl', 'python2.7']
+LIB_PYTHON2.7 = ['python2.7']
+LIB_READLINE = 'readline'
+LIB_RESOLV = 'resolv'
+LIB_RT = 'rt'
+LIB_ST = '-l%s'
+LIB_Z = 'z'
+LIB_crypt = ['crypt']
+LIB_crypto = ['crypto']
+LIB_form = ['form']
+LIB_gnutls = ['gnutls']
+LIB_menu = ['menu']
+LIB_ncurses = ['ncurses']
+LIB_nsl = ['nsl']
+LIB_panel = ['panel']
+LIB_pthread = ['pthread']
+LIB_readline = ['readline']
+LIB_resolv = ['resolv']
+LIB_rt = ['rt']
+LIB_z = ['z']
+LINKFLAGS = ['-ltirpc']
+LINKFLAGS_MACBUNDLE = ['-bundle', '-undefined', 'dynamic_lookup']
+LINKFLAGS_PYEMBED = ['-L/root/.pyenv/versions/2.7.18/lib', '-Wl,-rpath,/root/.pyenv/versions/2.7.18/lib']
+LINK_CC = ['/usr/bin/gcc']
+LINUX = '1'
+LINUX_SENDFILE_API = '1'
+LMHOSTSFILE = '/usr/local/samba/etc/lmhosts'
+LOCALEDIR = '/usr/local/samba/share/locale'
+LOCALSTATEDIR = '/usr/local/samba/var'
+LOCKDIR = '/usr/local/samba/var/lock'
+LOGFILEBASE = '/usr/local/samba/var'
+MANDIR = '/usr/local/samba/share/man'
+MODULESDIR = '/usr/local/samba/lib'
+MODULE_PREFIXES = ['vfs', 'pdb', 'auth', 'nss_info', 'charset', 'idmap', 'gpext', 'perfcount', 'rpc']
+NCALRPCDIR = '/usr/local/samba/var/run/ncalrpc'
+NCURSES_CONFIG = '/usr/bin/ncurses5-config'
+NMBDSOCKETDIR = '/usr/local/samba/var/run/nmbd'
+NONSHARED_BINARIES = ['']
+NSS_INFO_SHARED = []
+NSS_INFO_STATIC = ['nss_info_template']
+NTP_SIGND_SOCKET_DIR = '/usr/local/samba/var/lib/ntp_signd'
+OLDINCLUDEDIR = '/usr/include'
+PACKAGE = 'samba'
+PAMMODULESDIR = '/usr/local/samba/lib/security'
+PDB_SHARED = ['pdb_freenas']
+PDB_STATIC = ['pdb_smbpasswd', 'pdb_tdbsam', 'pdb_wbc_sam', 'pdb_samba_dsdb']
+PDFDIR = '/usr/local/samba/share/doc/samba'
+PERFCOUNT_SHARED = []
+PERFCOUNT_STATIC = []
+PERL = '/usr/bin/perl'
+PERL_ARCH_INSTALL_DIR = '/usr/local/samba/lib/perl5'
+PERL_INC = ['/etc/perl', '/usr/local/lib/x86_64-linux-gnu/perl/5.36.0', '/usr/local/share/perl/5.36.0', '/usr/lib/x86_64-linux-gnu/perl5/5.36', '/usr/share/perl5', '/usr/lib/x86_64-linux-gnu/perl-base', '/usr/lib/x86_64-linux-gnu/perl/5.36', '/usr/share/perl/5.36', '/usr/local/lib/site_perl']
+PERL_LIB_INSTALL_DIR = '/usr/local/samba/share/perl5'
+PERL_SPECIFIED = False
+PERL_VERSION = '5.36.0'
+PIDDIR = '/usr/local/samba/var/run'
+PKGCONFIGDIR = '/usr/local/samba/lib/pkgconfig'
+PREFIX = '/usr/local/samba'
+PRIVATELIBDIR = '/usr/local/samba/lib/private'
+PRIVATE_DIR = '/usr/local/samba/private'
+PRIVATE_EXTENSION = 'samba4'
+PRIVATE_EXTENSION_EXCEPTION = ['']
+PRIVATE_LIBS = ['']
+PRIVILEGED_SOCKET_DIR = '/usr/local/samba/var/lib'
+PSDIR = '/usr/local/samba/share/doc/samba'
+PUTUTLINE_RETURNS_UTMP = 1
+PYC = 1
+PYCMD = '"import sys, py_compile;py_compile.compile(sys.argv[1], sys.argv[2])"'
+PYFLAGS = ''
+PYFLAGS_OPT = '-O'
+PYO = 1
+PYTHON = '/root/.pyenv/versions/2.7.18/bin/python'
+PYTHONARCHDIR = '/usr/local/samba/lib/python2.7/site-packages'
+PYTHONDIR = '/usr/local/samba/lib/python2.7/site-packages'
+PYTHON_CONFIG = '/root/.pyenv/versions/2.7.18/bin/python2.7-config'
+PYTHON_SO_ABI_FLAG = ''
+PYTHON_SPECIFIED = False
+PYTHON_VERSION = '2.7'
+RANLIB = '/usr/bin/ranlib'
+READLINE_TERMLIB = 'ncurses'
+REALPATH_TAKES_NULL = 1
+RETSIGTYPE = 'void'
+RETSIGTYPE_INT = ()
+RPATH_ON_BUILD = True
+RPATH_ON_INSTALL = True
+RPATH_ON_INSTALL_PRIVATE = True
+RPATH_PYEMBED = ['/root/.pyenv/versions/2.7.18/lib']
+RPATH_ST = '-Wl,-rpath,%s'
+RPC_SHARED = []
+RPC_STATIC = []
+SAMBA4_USES_HEIMDAL = 1
+SBINDIR = '/usr/local/samba/sbin'
+SCRIPTSBINDIR = '/usr/local/samba/sbin'
+SEEKDIR_RETURNS_VOID = 1
+SELFTEST_PREFIX = './st'
+SETUPDIR = '/usr/local/samba/share/setup'
+SHAREDSTATEDIR = '/usr/local/samba/com'
+SHLIBEXT = 'so'
+SHLIB_MARKER = '-Wl,-Bdynamic'
+SIZEOF_BLKCNT_T_4 = ()
+SIZEOF_BLKCNT_T_8 = 1
+SIZEOF_BOOL = 1
+SIZEOF_CHAR = 1
+SIZEOF_DEV_T = 8
+SIZEOF_INO_T = 8
+SIZEOF_INT = 4
+SIZEOF_INT16_T = 2
+SIZEOF_INT32_T = 4
+SIZEOF_INT64_T = 8
+SIZEOF_INT8_T = 1
+SIZEOF_LONG = 8
+SIZEOF_LONG_LONG = 8
+SIZEOF_OFF_T = 8
+SIZEOF_SHORT = 2
+SIZEOF_SIZE_T = 8
+SIZEOF_SSIZE_T = 8
+SIZEOF_TIME_T = 8
+SIZEOF_UINT16_T = 2
+SIZEOF_UINT32_T = 4
+SIZEOF_UINT64_T = 8
+SIZEOF_UINT8_T = 1
+SIZEOF_UTMP_UT_LINE = 32
+SIZEOF_VOID_P = 8
+SMB_PASSWD_FILE = '/usr/local/samba/private/smbpasswd'
+SOCKET_DIR = '/usr/local/samba/var/run'
+SOLARIS_GETGRENT_R = ()
+SOLARIS_GETPWENT_R = ()
+SONAME_ST = '-Wl,-h,%s'
+STANDARD_LIBPATH = ['/usr/lib/gcc/x86_64-linux-gnu/12', '/usr/x86_64-linux-gnu/lib/x86_64-linux-gnu/12', '/usr/x86_64-linux-gnu/lib/x86_64-linux-gnu', '/usr/x86_64-linux-gnu/lib', '/usr/lib/x86_64-linux-gnu/12', '/usr/lib/x86_64-linux-gnu', '/usr/lib', '/lib/x86_64-linux-gnu/12', '/lib/x86_64-linux-gnu', '/lib', '/usr/lib/x86_64-linux-gnu/12', '/usr/lib/x86_64-linux-gnu', '/usr/lib', '/usr/x86_64-linux-gnu/lib', '/usr/lib', '/lib', '/usr/lib']
+STATEDIR = '/usr/local/samba/var/locks'
+STATICLIBPATH_ST = '-L%s'
+STATICLIB_MARKER = '-Wl,-Bstatic'
+STATICLIB_ST = '-l%s'
+STAT_STATVFS = 1
+STAT_ST_BLOCKSIZE = '512'
+STDC_HEADERS = 1
+STRERROR_R_PROTO_COMPATIBLE = ()
+STRING_STATIC_MODULES = 'vfs_default auth_domain auth_builtin auth_sam auth_winbind pdb_smbpasswd pdb_tdbsam pdb_wbc_sam auth_unix auth_wbc nss_info_template idmap_tdb idmap_passdb idmap_nss pdb_samba_dsdb auth_samba4 vfs_dfs_samba4 vfs_zfs_space'
+SUMMARY_PASSES = 1
+SYSCONFDIR = '/usr/local/samba/etc'
+SYSCONF_SC_NGROUPS_MAX = 1
+SYSCONF_SC_NPROCESSORS_ONLN = 1
+SYSCONF_SC_NPROC_ONLN = ()
+SYSCONF_SC_PAGESIZE = 1
+SYSLIB_DEPS = {'z': 'replace'}
+SYSTEM_UNAME_MACHINE = 'x86_64'
+SYSTEM_UNAME_RELEASE = '6.18.44-fc-v139'
+SYSTEM_UNAME_SYSNAME = 'Linux'
+SYSTEM_UNAME_VERSION = '#1 SMP PREEMPT_DYNAMIC @0'
+TALLOC_COMPAT1 = False
+TARGET_TYPE = {'dm': 'EMPTY', 'nsl': 'SYSLIB', 'setproctitle': 'EMPTY', 'intl': 'EMPTY', 'zfs_core': 'EMPTY', 'uutil': 'EMPTY', 'crypto': 'SYSLIB', 'sunacl': 'EMPTY', 'logd': 'EMPTY', 'gcrypt': 'DISABLED', 'sec': 'EMPTY', 'pthread': 'SYSLIB', 'systemd-journal': 'EMPTY', 'cups': 'EMPTY', 'archive': 'EMPTY', 'panel': 'SYSLIB', 'gpgme': 'EMPTY', 'rt': 'SYSLIB', 'systemd': 'EMPTY', 'inotify': 'EMPTY', 'systemd-daemon': 'EMPTY', 'crypt': 'SYSLIB', 'xdsm': 'EMPTY', 'geom': 'EMPTY', 'ldap': 'EMPTY', 'md5': 'EMPTY', 'pam': 'EMPTY', 'inet': 'EMPTY', 'dl': 'EMPTY', 'execinfo': 'EMPTY', 'gfapi': 'EMPTY', 'form': 'SYSLIB', 'ncurses': 'SYSLIB', 'gpg-error': 'DISABLED', 'iconv': 'EMPTY', 'avahi-common': 'EMPTY', 'util': 'EMPTY', 'jfsdm': 'EMPTY', 'bsd': 'EMPTY', 'gnutls': 'SYSLIB', 'readline': 'SYSLIB', 'pcap': 'EMPTY', 'gen': 'EMPTY', 'socket': 'EMPTY', 'md': 'EMPTY', 'dns_sd': 'EMPTY', 'attr': 'EMPTY', 'zfs': 'EMPTY', 'avahi-client': 'EMPTY', 'dispatcherclient': 'EMPTY', 'cap': 'EMPTY', 'resolv': 'SYSLIB', 'dmapi': 'EMPTY', 'jansson': 'EMPTY', 'aio': 'EMPTY', 'lber': 'EMPTY', 'menu': 'SYSLIB', 'lttng-ust': 'EMPTY', 'security': 'EMPTY', 'z': 'SYSLIB'}
+TEVENT_NUM_SIGNALS = 68
+TIME_T_MAX = '67768036191676799ll'
+TIME_WITH_SYS_TIME = 1
+USE_LINUX_32BIT_SYSCALLS = ()
+USE_LINUX_THREAD_CREDENTIALS = 1
+USE_TDB_MUTEX_LOCKING = 1
+USING_SYSTEM_ZLIB = 1
+VALUEOF_NSIG = '65'
+VALUEOF_SIGRTMAX = '64'
+VALUEOF_SIGRTMIN = '34'
+VALUEOF__NSIG = '65'
+VFS_SHARED = ['vfs_recycle', 'vfs_audit', 'vfs_extd_audit', 'vfs_full_audit', 'vfs_netatalk', 'vfs_fake_perms', 'vfs_default_quota', 'vfs_readonly', 'vfs_cap', 'vfs_expand_msdfs', 'vfs_shadow_copy', 'vfs_shadow_copy2', 'vfs_readahead', 'vfs_xattr_tdb', 'vfs_posix_eadb', 'vfs_streams_xattr', 'vfs_streams_depot', 'vfs_acl_xattr', 'vfs_acl_tdb', 'vfs_preopen', 'vfs_catia', 'vfs_media_harmony', 'vfs_unityed_media', 'vfs_fruit', 'vfs_shell_snap', 'vfs_commit', 'vfs_worm', 'vfs_crossrename', 'vfs_linux_xfs_sgid', 'vfs_time_audit', 'vfs_offline', 'vfs_syncops', 'vfs_dirsort', 'vfs_fileid', 'vfs_aio_fork', 'vfs_aio_pthread', 'vfs_btrfs']
+VFS_STATIC = ['vfs_default', 'vfs_dfs_samba4', 'vfs_zfs_space']
+VISIBILITY_CFLAGS = '-fvisibility=hidden'
+VOID_RETSIGTYPE = 1
+WERROR_CFLAGS = ['-Werror']
+WINBINDD_PRIVILEGED_SOCKET_DIR = '/usr/local/samba/var/lib/winbindd_privileged'
+WINBINDD_SOCKET_DIR = '/usr/local/samba/var/run/winbindd'
+WITH_AUTOMOUNT = '1'
+WITH_DNS_UPDATES = 1
+WITH_PTHREADPOOL = '1'
+WITH_QUOTAS = '1'
+WITH_SENDFILE = '1'
+WITH_SYSLOG = '1'
+WITH_UTMP = 1
+WITH_WINBIND = '1'
+WORKING_GETCONF_LFS_CFLAGS = 1
+XATTR_ADDITIONAL_OPTIONS = ()
+XSLTPROC = ''
+_GNU_SOURCE = 1
+_HAVE_SENDFILE = 1
+_HAVE_UNBROKEN_POSIX_FALLOCATE = 1
+_SAMBA_BUILD_ = 4
+_XOPEN_SOURCE_EXTENDED = 1
+__TIME_T_MAX = 1
+asneeded_ldflags = ['-Wl,--as-needed']
+auth_script_init = 'samba_init_module'
+build_regedit = True
+build_winbind = True
+building_tdb = True
+cfg_files = ['include/config.h']
+ctdb_generate_manpages = False
+ctdb_prebuilt_manpages = []
+defines = {'SOLARIS_GETPWENT_R': (), 'HAVE_GSS_KRB5_IMPORT_CRED': 1, 'WITH_UTMP': 1, 'HAVE_SPLICE_DECL': 1, 'WITH_AUTOMOUNT': '1', 'HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIGVAL_PTR': (), 'HAVE_UT_UT_TV': 1, 'HAVE_F_SETLEASE_DECL': 1, 'HAVE_MENU_H': 1, 'HAVE_ERRNO_DECL': 1, 'HAVE_STDINT_H': 1, 'HAVE_POSIX_MEMALIGN': 1, 'HAVE_FALLOCATE': 1, 'PUTUTLINE_RETURNS_UTMP': 1, 'HAVE_PRINTF': 1, 'HAVE_PTHREAD_MUTEXATTR_SETROBUST': 1, 'SYSTEM_UNAME_SYSNAME': '"Linux"', 'HAVE_UINT32_T': 1, 'static_init_pdb': '{ pdb_smbpasswd_init();  pdb_tdbsam_init();  pdb_wbc_sam_init();  pdb_samba_dsdb_init(); }', 'HAVE_FREEIFADDRS': 1, 'HAVE_MNTENT_H': 1, 'HAVE_FDATASYNC_DECL': 1, 'HAVE_MMAP': 1, 'HAVE_STRTOLL': 1, 'HAVE_SYS_CDEFS_H': 1, 'HAVE_PREAD_DECL': 1, 'vfs_xattr_tdb_init': 'samba_init_module', 'HAVE_SYS_SYSCALL_H': 1, 'HAVE_DECL_PTHREAD_MUTEX_ROBUST': 1, 'HAVE_PWRITE_DECL': 1, 'HAVE_STRUCT_STAT_ST_MTIMENSEC': (), 'HAVE_LINUX_SOCKIOS_H': 1, 'HAVE_DIRNAME': 1, 'HAVE_SYS_SYSLOG_H': 1, 'HAVE_STAT_ST_FLAGS': (), 'SEEKDIR_RETURNS_VOID': 1, 'HAVE_TERMCAP_H': 1, 'HAVE_STRUCT_STAT_ST_BIRTHTIME': (), 'vfs_readonly_init': 'samba_init_module', 'HAVE_MALLOC_H': 1, 'HAVE_INET_NTOA': 1, 'SIZEOF_OFF_T': 8, 'vfs_readahead_init': 'samba_init_module', 'HAVE_CUPS': (), 'SIZEOF_LONG_LONG': 8, 'HAVE_BOOL': 1, 'vfs_crossrename_init': 'samba_init_module', 'HAVE_BLKSIZE_T': 1, 'HAVE_SETLUID': (), 'HAVE_INET_NTOP': 1, 'HAVE_LONG_LONG': 1, 'vfs_shell_snap_init': 'samba_init_module', 'HAVE_LIBGEN_H': 1, 'SIZEOF_INT': 4, 'vfs_default_quota_init': 'samba_init_module', 'HAVE_COM_ERR_H': 1, 'SAMBA4_USES_HEIMDAL': 1, 'static_decl_vfs': 'extern NTSTATUS vfs_default_init(void); extern NTSTATUS vfs_dfs_samba4_init(void); extern NTSTATUS vfs_zfs_space_init(void);', 'HAVE_STRCPY': 1, 'HAVE_STRUCT_SIGEVENT': 1, 'HAVE_GETNETGRENT': 1, 'HAVE_SETNETGRENT_PROTOTYPE': 1, 'HAVE_KRB5_PRINCIPAL_GET_NUM_COMP': 1, 'HAVE_SETNETGRENT': 1, 'HAVE_GNUTLS_DATUM': 1, 'HAVE_KRB5_CONFIG_GET_BOOL_DEFAULT': 1, 'HAVE_SYSCONF': 1, 'HAVE_STRUCT_STAT_ST_MTIMESPEC_TV_NSEC': (), 'HAVE_SIZE_T': 1, 'HAVE_STRUCT_IFADDRS': 1, 'HAVE_SCHED_H': 1, 'HAVE_SET_MENU_ITEMS': 1, 'DEFAULT_UNIX_CHARSET': '"UTF-8"', 'SYSTEM_UNAME_RELEASE': '"6.18.44-fc-v139"', 'HAVE_LSEEK_HOLE_DATA': 1, 'HAVE_STATVFS': 1, 'HAVE_GSSAPI_GSSAPI_H': 1, 'HAVE_DECL_FDATASYNC': 1, 'HAVE_KRB5_GET_HOST_REALM': 1, 'HAVE_SHA256_UPDATE': (), 'WITH_PTHREADPOOL': '1', 'vfs_shadow_copy2_init': 'samba_init_module', 'HAVE_ROBUST_MUTEXES': 1, 'HAVE_DLCLOSE': 1, 'HAVE_DECL_DLOPEN': 1, 'HAVE__LLSEEK': (), 'HAVE_IFACE_GETIFADDRS': 1, 'HAVE_FDOPENDIR': 1, 'HAVE_KRB5_KT_COMPARE': 1, 'HAVE_IRUSEROK': 1, 'HAVE_UTIME_H': 1, 'HAVE_MLOCKALL': 1, 'HAVE__READ': (), 'HAVE_GETADDRINFO': 1, 'HAVE_SETENV_DECL': 1, 'HAVE_IF_NAMETOINDEX': 1, 'HAVE_FGETXATTR': 1, 'HAVE_FREMOVEXATTR': 1, 'HAVE_USLEEP': 1, 'HAVE_STRSEP_COPY': (), 'HAVE_MEMALIGN': 1, 'SIZEOF_INT16_T': 2, 'vfs_commit_init': 'samba_init_module', 'HAVE_STRUCT_ADDRINFO': 1, 'INLINE_MACRO': 1, 'HAVE_DECL_BIND_TEXTDOMAIN_CODESET': 1, 'HAVE_DNSSERVICEREGISTER': (), 'HAVE_DECL_READAHEAD': 1, 'HAVE_KRB5_KT_FREE_ENTRY': 1, 'HAVE_DM_GET_EVENTLIST': (), 'HAVE_GNUTLS_GLOBAL_INIT': 1, 'HAVE_SYS_SYSMACROS_H': 1, 'XATTR_ADDITIONAL_OPTIONS': (), 'HAVE_STDBOOL_H': 1, 'HAVE_UNSETENV': 1, 'HAVE_SYS_XATTR_H': 1, 'HAVE_STRINGS_H': 1, 'TIME_T_MAX': '67768036191676799ll', 'HAVE___SYS_LLSEEK': (), 'HAVE_GETGRSET': (), 'vfs_recycle_init': 'samba_init_module', 'HAVE_KRB5': 1, 'HAVE_SHARED_MMAP': 1, 'HAVE_RES_NDESTROY': (), 'HAVE_GETGROUPLIST': 1, 'HAVE_SS_FAMILY': 1, 'HAVE_E_DATA_POINTER_IN_KRB5_ERROR': 1, 'HAVE_SYS_INOTIFY_H': 1, 'vfs_fake_perms_init': 'samba_init_module', 'HAVE_SIGNAL_H': 1, 'RETSIGTYPE': 'void', 'HAVE_FCNTL_LOCK': 1, 'HAVE_DEVICE_MINOR_FN': (), 'HAVE_GETIPNODEBYADDR': (), 'HAVE_STRTOULL': 1, 'HAVE_ENVIRON_DECL': 1, 'static_init_charset': '{}', 'HAVE_GSSAPI': 1, 'HAVE_SIMPLE_C_PROG': 1, 'HAVE_EPOLL': 1, 'vfs_cap_init': 'samba_init_module', 'HAVE_DES_PCBC_ENCRYPT': 1, 'HAVE_INT16_T': 1, 'HAVE_ASPRINTF': 1, 'HAVE_STRUPR': (), 'HAVE_SETRESUID': 1, 'HAVE_SETRESGID_DECL': 1, 'HAVE_KRB5_GET_DEFAULT_IN_TKT_ETYPES': 1, 'HAVE_KRB5_STRING_TO_KEY': 1, 'HAVE_INTTYPES_H': 1, 'HAVE_SYS_PARAM_H': 1, 'HAVE_SYS_SOCKET_H': 1, 'HAVE_STRNCPY': 1, 'HAVE_ITEM_COUNT': 1, 'HAVE_DECL__RES': 1, 'HAVE_UPDWTMPX': 1, 'HAVE_KRB5_FWD_TGT_CREDS': 1, 'HAVE_SYS_STAT_H': 1, 'HAVE___OPENDIR': (), 'HAVE_SETXATTR': 1, 'HAVE_OPENAT': 1, 'pdb_freenas_init': 'samba_init_module', 'HAVE_GETHOSTBYADDR': 1, 'HAVE_CHARSET_UTF_8': 1, 'HAVE_UTIMES': 1, 'HAVE_SYS_EVENTFD_H': 1, 'HAVE_GPGME_NEW': (), 'HAVE_RPC_NETTYPE_H': 1, 'HAVE_REALPATH': 1, 'HAVE_GETAUTHUID': (), 'HAVE_KRB5_H': 1, 'vfs_preopen_init': 'samba_init_module', 'HAVE_NETDB_H': 1, 'SIZEOF_UINT16_T': 2, 'HAVE_GETIFADDRS': 1, 'idmap_rid_init': 'samba_init_module', 'HAVE_PORT_CREATE': (), 'STDC_HEADERS': 1, 'HAVE_COMPARISON_FN_T': 1, 'HAVE_KRB5_PRINCIPAL_SET_REALM': 1, 'HAVE_SIGSETMASK': 1, 'HAVE_ICONV_H': 1, 'HAVE_LSTAT': 1, 'HAVE_LIBREADLINE': 1, 'HAVE_VASPRINTF': 1, 'HAVE_GETPEEREID': (), 'HAVE_RESOLV_H': 1, 'HAVE_BSWAP16': (), 'HAVE_KRB5_SET_DEFAULT_IN_TKT_ETYPES': 1, 'HAVE_LINUX_FICLONERANGE': 1, 'HAVE___GETCWD': (), 'CLUSTER_SUPPORT': 1, 'SYSTEM_UNAME_VERSION': '"#1 SMP PREEMPT_DYNAMIC @0"', 'HAVE_GLOB': 1, 'HAVE_SETGIDX': (), 'HAVE_RPCSVC_NIS_H': 1, 'HAVE_UT_UT_ID': 1, 'HAVE___FSTAT': (), 'HAVE___FORK': 1, 'HAVE_ENCTYPE_AES128_CTS_HMAC_SHA1_96': 1, 'HAVE_TERM_H': 1, 'HAVE_BIG_ENDIAN': (), 'HAVE_STRCASESTR': 1, 'HAVE_DIRFD_DECL': 1, 'HAVE_UPDWTMP': 1, 'HAVE_VA_COPY': 1, 'HAVE_SETENV': 1, 'HAVE_DECL_MEMALIGN': 1, 'SIZEOF_UTMP_UT_LINE': 32, 'HAVE_CHOWN': 1, 'HAVE_UNIXSOCKET': 1, 'HAVE_RES_NSEARCH': 1, 'HAVE_REMOVEXATTR': 1, 'HAVE_IMMEDIATE_STRUCTURES': 1, 'LINUX_SENDFILE_API': '1', 'HAVE_LUTIMES': 1, 'HAVE_SYS_UCONTEXT_H': 1, 'HAVE_LIBRESOLV': 1, 'HAVE_STRUCT_TIMESPEC': 1, 'HAVE_DECL_GETTIMEOFDAY': 1, 'HAVE_KRB5_CRYPTO_DESTROY': 1, 'vfs_unityed_media_init': 'samba_init_module', 'STAT_ST_BLOCKSIZE': '512', 'HAVE_FUTIMENS': 1, 'HAVE___FCNTL': 1, 'HAVE_PUTENV': 1, 'HAVE_SETSID': 1, 'HAVE_IFADDRS_H': 1, 'HAVE_LIBPANEL': 1, 'HAVE_INITGROUPS': 1, 'HAVE___FACL': (), 'HAVE_KRB5_ENCTYPE_TO_STRING': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_ALLOC': 1, 'HAVE_ICONV': 1, 'HAVE_GAI_STRERROR': 1, 'HAVE_DLSYM': 1, 'HAVE___GETDENTS': (), 'static_init_idmap': '{ idmap_tdb_init();  idmap_passdb_init();  idmap_nss_init(); }', 'HAVE_GETPWUID_R': 1, 'HAVE_BLKCNT_T': 1, 'HAVE_SOCKLEN_T': 1, 'HAVE_DNS_SEARCH': (), 'HAVE_SRAND': 1, 'WITH_WINBIND': '1', 'static_decl_idmap': 'extern NTSTATUS idmap_tdb_init(void); extern NTSTATUS idmap_passdb_init(void); extern NTSTATUS idmap_nss_init(void);', 'vfs_streams_depot_init': 'samba_init_module', 'BUILD_SYSTEM': '"Linux vm 6.18.44-fc-v139 #1 SMP PREEMPT_DYNAMIC @0 x86_64 GNU/Linux"', 'HAVE_DECL_GETTEXT': 1, 'HAVE_KRB5_C_VERIFY_CHECKSUM': 1, 'HAVE_DEVNM': (), 'HAVE___CLOSE': 1, 'DLOPEN_TAKES_UNSIGNED_FLAGS': (), 'HAVE_SYS_SHM_H': 1, 'HAVE_STDIO_H': 1, 'HAVE_SETRESGID': 1, 'HAVE_CLOCK_MONOTONIC': 1, 'HAVE_PTRDIFF_T': 1, 'HAVE_GNUTLS_DATUM_T': 1, 'HAVE_MEMMEM': 1, 'SYSTEM_UNAME_MACHINE': '"x86_64"', 'HAVE_STRUCT_STAT_ST_RDEV': 1, 'HAVE_MUNLOCKALL': 1, 'HAVE_SYS_MOUNT_H': 1, 'GETCWD_TAKES_NULL': 1, 'HAVE___LSTAT': (), 'HAVE__OPEN': (), 'HAVE_LIBINTL_H': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_FREE': 1, 'HAVE_SECURE_MKSTEMP': 1, 'SIZEOF_LONG': 8, 'HAVE_XATTR_SUPPORT': 1, 'USE_LINUX_32BIT_SYSCALLS': (), 'HAVE_BACKTRACE_SYMBOLS': 1, 'HAVE_MEMORY_H': 1, 'HAVE_LINUX_FCNTL_H': 1, 'HAVE_FCVTL': (), 'HAVE_READLINE_HISTORY_H': 1, 'HAVE_CLOCK_GETTIME': 1, 'HAVE_DLOPEN': 1, 'SIZEOF_SHORT': 2, 'HAVE_STRTOL': 1, 'HAVE_NSS_XBYY_KEY_IPNODE': (), '_SAMBA_BUILD_': 4, 'HAVE_FALLOC_FL_ZERO_RANGE': 1, 'HAVE_SETBUFFER': 1, 'HAVE_DECL_MALLOC': 1, 'HAVE_OFD_LOCKS': 1, 'CONFIG_H_IS_FROM_SAMBA': 1, 'vfs_extd_audit_init': 'samba_init_module', 'HAVE_AVAHI_STRERROR': (), 'HAVE_LARGEFILE': 1, 'HAVE_KRB5_MK_REQ_EXTENDED': 1, 'SIZEOF_CHAR': 1, 'vfs_worm_init': 'samba_init_module', 'CHECK_BUNDLED_SYSTEM_Z': 1, 'HAVE_SETLINEBUF': 1, 'SIZEOF_INT8_T': 1, 'HAVE_SYSLOG': 1, 'HAVE_RPCSVC_RQUOTA_H': 1, 'HAVE_GETHOSTENT': 1, 'static_decl_rpc': '', 'HAVE_NCURSES_H': 1, 'HAVE_SETLOCALE': 1, 'HAVE_PUTUTXLINE': 1, 'HAVE_ENDNETGRENT': 1, 'SYSCONF_SC_NGROUPS_MAX': 1, 'HAVE_GNUTLS3': 1, 'HAVE_LIBNSL': 1, 'HAVE_ARPA_INET_H': 1, 'HAVE_DECL_TEXTDOMAIN': 1, 'HAVE_DLFCN_H': 1, 'HAVE_GETHOSTBYNAME': 1, 'HAVE_GETOPT_H': 1, 'HAVE_HTTPCONNECTENCRYPT': (), 'HAVE_INITSCR': 1, 'HAVE_READLINE_READLINE_H': 1, 'HAVE_H_ERRNO': 1, 'HAVE_LINUX_READAHEAD': 1, 'HAVE_SYS_IPC_H': 1, 'HAVE_SHADOW_H': 1, 'HAVE_INET_PTON': 1, 'HAVE_GSSKRB5_EXTRACT_AUTHZ_DATA_FROM_SEC_CONTEXT': 1, 'vfs_acl_tdb_init': 'samba_init_module', 'HAVE_ENCTYPE_ARCFOUR_HMAC': 1, 'HAVE_INITIALIZE_KRB5_ERROR_TABLE': 1, 'HAVE_STDLIB_H': 1, 'HAVE_UT_UT_TYPE': 1, 'HAVE_GETGRNAM_R': 1, 'HAVE_FSYNC': 1, 'HAVE_NETINET_IN_H': 1, 'HAVE_BINDTEXTDOMAIN': 1, 'WITH_SYSLOG': '1', 'HAVE_GETAUXVAL': 1, 'HAVE_FALLOC_FL_PUNCH_HOLE': 1, 'KRB5_CREDS_OPT_FREE_REQUIRES_CONTEXT': 1, 'HAVE_IO_SUBMIT': (), 'HAVE_STDARG_H': 1, 'HAVE_DECL_STRPTIME': 1, 'HAVE_KRB5_CRYPTO': 1, 'SIZEOF_INO_T': 8, 'HAVE_AIO_H': 1, 'HAVE_LOCALE_H': 1, 'HAVE_DEVICE_MAJOR_FN': (), 'HAVE_UT_UT_EXIT': 1, 'HAVE___OPEN': 1, 'HAVE_DLERROR': 1, 'HAVE_CLOCK_PROCESS_CPUTIME_ID': 1, 'HAVE_UT_UT_TIME': 1, 'HAVE_RCMD': 1, 'HAVE_INT64_T': 1, 'HAVE__FACL': (), 'HAVE_GETXATTR': 1, 'HAVE_CONNECT': 1, 'HAVE_RANDOM': 1, 'HAVE_CPPFUNCTION': 1, 'vfs_fruit_init': 'samba_init_module', 'HAVE_LIBREPLACE': 1, 'VALUEOF__NSIG': '65', 'SIZEOF_VOID_P': 8, 'HAVE_VSYSLOG': 1, 'USE_TDB_MUTEX_LOCKING': 1, 'HAVE_STRING_H': 1, 'HAVE__PREAD': (), 'HAVE_NATIVE_ICONV': 1, 'WITH_DNS_UPDATES': 1, 'HAVE_POSIX_OPENPT': 1, 'HAVE_ADDR_TYPE_IN_KRB5_ADDRESS': 1, 'HAVE_STRUCT_SOCKADDR_STORAGE': 1, 'HAVE_ENDIAN_H': 1, 'HAVE_STRSIGNAL': 1, 'HAVE_GETNETGRENT_PROTOTYPE': 1, 'SIZEOF_UINT64_T': 8, 'HAVE_PIPE': 1, 'HAVE_CHMOD': 1, 'HAVE_GETQUOTA_RSLT_GETQUOTA_RSLT_U': 1, 'HAVE_BACKTRACE': 1, 'HAVE_DECL_KRB5_GET_CREDENTIALS_FOR_USER': 0, 'HAVE_FNMATCH_H': 1, 'HAVE__CHDIR': (), 'HAVE_LINUX_FALLOCATE': 1, 'HAVE_SHL_LOAD': (), 'HAVE_WAITPID': 1, 'HAVE_STRUCT_MSGHDR_MSG_CONTROL': 1, 'HAVE___READ': 1, 'HAVE_KRB5_KRBHST_GET_ADDRINFO': 1, 'WITH_SENDFILE': '1', 'HAVE_ENCTYPE_ARCFOUR_HMAC_MD5': 1, 'HAVE__FCNTL': (), 'HAVE_HISTORY_LIST': 1, 'vfs_btrfs_init': 'samba_init_module', 'vfs_shadow_copy_init': 'samba_init_module', 'HAVE_SYSCTLBYNAME': (), 'COMPILER_SUPPORTS_LL': 1, 'SIZEOF_SSIZE_T': 8, 'HAVE_SETJMP_H': 1, 'HAVE_FREE_CHECKSUM': 1, 'HAVE_KERNEL_CHANGE_NOTIFY': 1, 'vfs_media_harmony_init': 'samba_init_module', 'HAVE_STAT_HIRES_TIMESTAMPS': '1', 'HAVE_STRTOK_R': 1, 'HAVE_SETUIDX': (), 'SIZEOF_SIZE_T': 8, 'HAVE_STATVFS_F_FLAGS': (), 'HAVE___READDIR': (), 'HAVE___ATTRIBUTE__': 1, 'HAVE_SYS_QUOTAS': '1', 'HAVE_SYS_UTSNAME_H': 1, 'HAVE_CHECKSUM_IN_KRB5_CHECKSUM': 1, 'HAVE_UCONTEXT_T': 1, 'idmap_tdb2_init': 'samba_init_module', 'HAVE__RES': 1, 'HAVE_PASSWD_PW_COMMENT': (), 'HAVE_GRANTPT': 1, 'HAVE_SENDMSG': 1, 'SHLIBEXT': '"so"', 'SYSCONF_SC_PAGESIZE': 1, 'HAVE_GSSAPI_GSSAPI_SPNEGO_H': 1, 'HAVE_NETINET_IP_H': 1, 'auth_script_init': 'samba_init_module', 'HAVE_UX_UT_SYSLEN': (), 'HAVE_INNETGR': 1, 'HAVE_ATOMIC_ADD_32': (), 'HAVE_RL_COMPLETION_FUNC_T': (), 'HAVE_UMASK': 1, 'ENABLE_GNUTLS': 1, 'HAVE_INT8_T': 1, 'HAVE_KRB5_CREATE_CHECKSUM': 1, 'HAVE_LINUX_NETLINK_H': 1, 'HAVE_SYSLOG_H': 1, 'HAVE_LINUX_SPLICE': 1, 'HAVE_FREEHOSTENT': (), 'HAVE_DIR_DD_FD': (), 'HAVE_ARPA_NAMESER_H': 1, 'HAVE_DECL_GETPWENT_R': 1, 'HAVE_SA_FAMILY_T': 1, 'WITH_QUOTAS': '1', 'HAVE_SYS_STATVFS_H': 1, 'HAVE_KRB5_LOCATE_PLUGIN_H': 1, 'HAVE_STRUCT_STAT_ST_BIRTHTIMESPEC_TV_NSEC': (), 'HAVE_GSSKRB5_GET_SUBKEY': 1, 'HAVE_INTPTR_T': 1, '_XOPEN_SOURCE_EXTENDED': 1, 'SIZEOF_DEV_T': 8, 'HAVE_KRB5_PRINCIPAL_GET_REALM': 1, 'HAVE_SETPGID': 1, 'HAVE_PTHREAD_CREATE': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_SET_PAC_REQUEST': 1, 'HAVE_GETHOSTNAME': 1, 'HAVE_SCHED_SETSCHEDULER': 1, 'offset_t': 'loff_t', 'HAVE_GETPWNAM': 1, 'HAVE_CLOCK_REALTIME': 1, 'HAVE___FCHDIR': (), 'HAVE_KRB5_GET_RENEWED_CREDS': 1, 'HAVE_GETRLIMIT': 1, 'HAVE_DECL_VASPRINTF': 1, 'HAVE_VISIBILITY_ATTR': 1, 'HAVE_FSETXATTR': 1, 'HAVE_MKDIR_MODE': 1, 'HAVE_GET_CURRENT_DIR_NAME': 1, 'HAVE_DIRFD': 1, 'LINUX': '1', 'HAVE_KRB5_GET_CREDS': 1, '__TIME_T_MAX': 1, 'HAVE_U_INT32_T': 1, 'HAVE_SIG_ATOMIC_T_TYPE': 1, 'HAVE_GNUTLS_GNUTLS_H': 1, 'HAVE_UINT16_T': 1, 'HAVE_SHM_OPEN': 1, 'static_init_perfcount': '{}', 'HAVE___DUP2': 1, 'HAVE_PWD_H': 1, 'HAVE__Bool': 1, 'idmap_hash_init': 'samba_init_module', 'HAVE_GRP_H': 1, 'SIZEOF_TIME_T': 8, 'HAVE_GETCWD': 1, 'HAVE_RAND': 1, 'HAVE_KRB_STRUCT_WINSIZE': 1, 'HAVE___LLSEEK': (), 'HAVE_FSID_INT': 1, 'HAVE_UT_UT_PID': 1, 'HAVE_LINUX_ETHTOOL_H': 1, 'HAVE___STRTOULL': (), 'HAVE_XFS_QUOTAS': (), 'HAVE_SELECT': 1, 'HAVE_GETUTXENT': 1, 'HAVE_GSS_WRAP_IOV': 1, 'RETSIGTYPE_INT': (), 'HAVE__DN_EXPAND': (), 'HAVE_RPCSVC_YPCLNT_H': 1, 'SIZEOF_INT64_T': 8, 'HAVE___SYNC_FETCH_AND_ADD': 1, 'HAVE_DECL_VSNPRINTF': 1, 'HAVE_LTTNG_TRACEF': (), 'HAVE_SYS_UIO_H': 1, 'vfs_fileid_init': 'samba_init_module', 'HAVE___DUP': (), 'HAVE_GNUTLS_X509_CRT_SET_VERSION': 1, 'HAVE_CGETENT': (), 'HAVE_LOFF_T': 1, 'HAVE_PASSWD_PW_AGE': (), 'HAVE_SHOW_PANEL': 1, 'HAVE_ASM_UNISTD_H': 1, 'HAVE_UT_UT_NAME': 1, 'static_init_auth': '{ auth_domain_init();  auth_builtin_init();  auth_sam_init();  auth_winbind_init();  auth_unix_init();  auth_wbc_init();  auth_samba4_init(); }', 'AD_DC_BUILD_IS_ENABLED': 1, 'HAVE_ICONV_OPEN': 1, 'HAVE_MAKEDEV': (), 'HAVE__LSEEK': (), 'HAVE_GETPWANAM': (), 'HAVE__DUP2': (), 'HAVE_STRSEP': 1, 'HAVE_GSS_IMPORT_CRED': 1, 'HAVE_SYS_WAIT_H': 1, 'HAVE_SIGPROCMASK': 1, 'HAVE_FDATASYNC': 1, 'HAVE_FLAGS_IN_KRB5_CREDS': 1, 'HAVE__ACL': (), 'HAVE_KRB5_FREE_HOST_REALM': 1, 'HAVE_STRUCT_SOCKADDR_IN6': 1, 'HAVE_SETUID': 1, 'HAVE_GSS_OID_EQUAL': 1, 'vfs_linux_xfs_sgid_init': 'samba_init_module', 'HAVE_STRUCT_SIGEVENT_SIGEV_VALUE_SIVAL_PTR': 1, 'HAVE_CTYPE_H': 1, 'HAVE_SYS_FILE_H': 1, 'HAVE_MLOCK': 1, 'HAVE_LINUX_IOCTL_H': 1, 'HAVE_NEW_PANEL': 1, 'HAVE_GETNAMEINFO': 1, 'HAVE_KRB5_KRBHST_INIT': 1, 'HAVE_SYS_MMAN_H': 1, 'HAVE_FCNTL_H': 1, 'HAVE_AVAHI_CLIENT_NEW': (), 'HAVE_DECL_ASPRINTF': 1, 'HAVE_SYSCALL': 1, 'HAVE_LIBNCURSES': 1, 'HAVE_RES_SEARCH': 1, 'HAVE___STRTOLL': (), 'HAVE_STRNCASECMP': 1, 'HAVE_NETINET_TCP_H': 1, 'HAVE_GETHOSTBYNAME_R': 1, 'HAVE_SIGGETMASK': 1, 'HAVE___LXSTAT': 1, 'HAVE_STRNDUP': 1, 'HAVE_GSS_KRB5_CRED_NO_CI_FLAGS_X': 1, 'SOLARIS_GETGRENT_R': (), 'HAVE_DECL_RL_EVENT_HOOK': 1, 'HAVE_SIGBLOCK': 1, 'HAVE_KRB5_CC_GET_LIFETIME': 1, 'HAVE_QUOTACTL_LINUX': '1', 'HAVE_WS_YPIXEL': 1, 'HAVE___DN_EXPAND': (), 'HAVE_STATVFS_F_FLAG': 1, 'HAVE_POSIX_FADVISE': 1, 'HAVE_KRB5_CRYPTO_INIT': 1, 'HAVE_UTMP_H': 1, 'HAVE_TIME_H': 1, 'HAVE_Z': 1, 'HAVE_TGETENT': 1, 'HAVE_NSS_H': 1, 'HAVE_GLOB_H': 1, 'HAVE_KRB5_PDU_NONE_DECL': 1, 'HAVE_ENDHOSTENT': 1, 'HAVE__CLOSEDIR': (), 'HAVE_STRNLEN': 1, 'HAVE_SYS_EPOLL_H': 1, 'HAVE_IPV6_V6ONLY': 1, 'HAVE_GETMNTENT': 1, 'HAVE_ST_RDEV': 1, 'HAVE_DECL_GNUTLS_CERT_NOT_ACTIVATED': 1, 'HAVE_SETMNTENT': 1, 'HAVE_GSS_INQUIRE_SEC_CONTEXT_BY_OID': 1, 'HAVE_TERMIO_H': 1, 'HAVE_GLUSTERFS': (), 'HAVE_U_CHAR': 1, 'HAVE_SETEGID': 1, 'HAVE_KRB5_ADDRESSES': 1, 'HAVE_KRB5_STRING_TO_KEY_SALT': 1, 'HAVE_INOTIFY_INIT': 1, 'HAVE_FLOAT_H': 1, 'LIBREPLACE_NETWORK_CHECKS': 1, 'HAVE_NFS_QUOTAS': '1', 'HAVE_SETRESUID_DECL': 1, 'HAVE_GETUTMPX': 1, 'HAVE_LIBFORM': 1, 'HAVE_MEMCPY': 1, 'HAVE_STRFTIME': 1, 'HAVE_NETINET_IN_SYSTM_H': 1, 'HAVE_WORKING_STRPTIME': 1, 'HAVE_ENCTYPE_ARCFOUR_HMAC_MD5_56': 1, 'HAVE_GETIPNODEBYNAME': (), 'HAVE_PEERCRED': 1, 'vfs_syncops_init': 'samba_init_module', 'HAVE_GETPWENT_R': 1, 'HAVE_POLL_H': 1, 'HAVE_C99_VSNPRINTF': 1, 'HAVE_SWAB': 1, 'HAVE_STATFS_F_FSID': 1, 'HAVE_SHA1_UPDATE': (), 'SYSCONF_SC_NPROCESSORS_ONLN': 1, 'HAVE_HSTRERROR': 1, 'CTDB_SOCKET': '"/usr/local/samba/var/run/ctdb/ctdbd.socket"', 'HAVE_SETPRIV': (), 'HAVE_CRYPT_H': 1, 'TEVENT_NUM_SIGNALS': 68, 'HAVE_SYSCTL': (), 'HAVE_EPOLL_CREATE': 1, 'HAVE_KRB5_KEYBLOCK_INIT': 1, 'HAVE_READV': 1, 'HAVE_KRB5_PRINCIPAL_COMPARE_ANY_REALM': 1, 'HAVE_KRB5_REALM_TYPE': 1, 'HAVE_STRUCT_SOCKADDR': 1, 'HAVE__FORK': (), 'HAVE_DECL_DGETTEXT': 1, 'HAVE_GSS_KRB5_EXPORT_LUCID_SEC_CONTEXT': 1, 'HAVE_SOCKADDR_SA_LEN': (), 'HAVE_KERNEL_OPLOCKS_IRIX': (), 'HAVE_LASTLOG_H': 1, 'HAVE_PUTUTLINE': 1, 'HAVE_KRB5_MAKE_PRINCIPAL': 1, 'HAVE_MREMAP': 1, 'HAVE_SETHOSTENT': 1, 'HAVE_ERR_H': 1, 'HAVE_SYS_UNISTD_H': 1, 'HAVE_LINUX_TYPES_H': 1, 'HAVE___ACL': (), 'HAVE_LIBMENU': 1, 'static_decl_pdb': 'extern NTSTATUS pdb_smbpasswd_init(void); extern NTSTATUS pdb_tdbsam_init(void); extern NTSTATUS pdb_wbc_sam_init(void); extern NTSTATUS pdb_samba_dsdb_init(void);', 'HAVE_AP_OPTS_USE_SUBKEY': 1, 'HAVE_LIBGNUTLS': 1, 'HAVE__OPENDIR': (), 'HAVE_SYS_FCNTL_H': 1, 'static_decl_gpext': '', 'HAVE_DECL_H_ERRNO': 1, 'HAVE_GNUTLS_CERTIFICATE_VERIFY_PEERS3': 1, 'HAVE_FLISTEA': (), 'HAVE_EXECINFO_H': 1, 'HAVE_FRSIZE': 1, 'HAVE_PTHREAD_H': 1, 'HAVE_DECL_FS_IOC_GETFLAGS': 1, 'HAVE_KRB5_DATA_COPY': 1, 'HAVE_UNISTD_H': 1, 'uint_t': 'unsigned int', 'HAVE_SETREGID': 1, 'HAVE_SYS_UN_H': 1, 'HAVE_LIBCRYPTO': 1, 'HAVE_LINUX_RTNETLINK_H': 1, 'HAVE_SYS_KERNEL_PROC_CORE_PATTERN': '1', 'HAVE_LIBZFS': '1', 'BSD_STYLE_STATVFS': (), 'VALUEOF_SIGRTMAX': '64', 'HAVE_CRYPT16': (), 'HAVE_GSSAPI_GSSAPI_KRB5_H': 1, 'HAVE_FTRUNCATE': 1, 'HAVE_LINUX_FS_H': 1, 'HAVE_STAT_ST_BLOCKS': 1, 'HAVE_STRLCPY': (), 'SIZEOF_INT32_T': 4, 'vfs_expand_msdfs_init': 'samba_init_module', 'HAVE_CURSES_H': 1, 'HAVE_GETGRENT_R_DECL': 1, 'HAVE_DN_EXPAND': 1, 'HAVE___LSEEK': 1, 'HAVE_LIBCRYPT': 1, 'HAVE_STRUCT_STAT_ST_MTIM_TV_NSEC': 1, 'HAVE_GETDIRENTRIES': 1, 'HAVE_KRB5_KEYBLOCK_KEYVALUE': 1, 'HAVE_PTHREAD': '1', 'HAVE_DQB_FSOFTLIMIT': (), 'HAVE_DECL_GETGRENT_R': 1, 'HAVE_ETIME': 1, 'HAVE_VDPRINTF': 1, 'SIZEOF_BOOL': 1, 'HAVE_SYS_VFS_H': 1, 'HAVE_BZERO': 1, 'vfs_acl_xattr_init': 'samba_init_module', 'HAVE_UTMPX_H': 1, 'HAVE_STRERROR_R': 1, 'HAVE_GETPAGESIZE': 1, 'HAVE_RENAME': 1, 'VALUEOF_NSIG': '65', 'HAVE_MEMMOVE': 1, 'HAVE_STRUCT_STAT_ST_MTIME_N': (), 'HAVE_SYS_STATFS_H': 1, 'HAVE___SS_FAMILY': (), 'HAVE___WRITE': 1, 'DEFAULT_DOS_CHARSET': '"CP850"', 'static_decl_charset': '', 'HAVE_MD5INIT': (), 'HAVE_SETPROGNAME': (), 'HAVE_KRB5_KEYTAB_ENTRY_KEYBLOCK': 1, 'HAVE__WRITE': (), 'HAVE_UTIME': 1, 'USING_SYSTEM_ZLIB': 1, 'SUMMARY_PASSES': 1, '_GNU_SOURCE': 1, 'HAVE__PWRITE': (), 'HAVE_FORM_H': 1, 'HAVE_PTHREAD_ATTR_INIT': 1, 'HAVE_NEW_FORM': 1, 'HAVE_DIRENT_D_OFF': 1, 'HAVE_UTIMBUF': 1, 'HAVE_LIBPTHREAD': 1, 'HAVE__GETCWD': (), 'HAVE_FTRUNCATE_EXTEND': 1, 'HAVE_NET_IF_H': 1, 'HAVE_STRPTIME': 1, 'HAVE_IPV6': 1, 'HAVE_STRUCT_STAT_ST_UMTIME': (), 'SYSCONF_SC_NPROC_ONLN': (), 'HAVE__VA_ARGS__MACRO': 1, 'HAVE_ENDNETGRENT_PROTOTYPE': 1, 'vfs_catia_init': 'samba_init_module', 'VOID_RETSIGTYPE': 1, 'HAVE_PYTHON_H': 1, 'HAVE_ETYPE_IN_ENCRYPTEDDATA': 1, 'HAVE_SRANDOM': 1, 'HAVE_UINT_T': (), 'HAVE_SOCK_SIN_LEN': (), 'HAVE_CHARSET_CP850': 1, 'HAVE___XSTAT': 1, 'HAVE_SYS_SENDFILE_H': 1, 'HAVE_GNUTLS_X509_CRT_SET_SUBJECT_KEY_ID': 1, 'HAVE_WARNX': 1, 'HAVE___FXSTAT': 1, 'HAVE_ZLIB_H': 1, 'HAVE_OPEN_O_DIRECT': 1, 'HAVE_CAP_GET_PROC': (), 'HAVE_STRUCT_MSGHDR_MSG_ACCRIGHTS': (), 'HAVE_LIBKRB5': 1, 'HAVE_DECL_SNPRINTF': 1, 'HAVE_SETITIMER': 1, 'HAVE_PTHREAD_MUTEX_CONSISTENT': 1, 'HAVE_SYS_QUOTA_H': 1, 'HAVE_GNUTLS_3_4_7': 1, 'HAVE_SHL_UNLOAD': (), 'HAVE_KRB5_GET_PW_SALT': 1, 'HAVE_FCHOWN': 1, 'HAVE_NCURSES': '1', 'HAVE_LITTLE_ENDIAN': 1, 'HAVE_GETGRNAM': 1, 'HAVE_READAHEAD_DECL': 1, 'HAVE__FSTAT': (), 'HAVE___CHDIR': (), 'HAVE__READDIR': (), 'HAVE_LIBZ': 1, 'HAVE_ERRNO_H': 1, 'HAVE_SYS_IOCTL_H': 1, 'HAVE_POSIX_FALLOCATE': 1, 'HAVE_STRCASECMP': 1, 'idmap_script_init': 'samba_init_module', 'HAVE_KRB5_GET_CREDS_OPT_SET_IMPERSONATE': 1, 'HAVE_STRDUP': 1, 'HAVE_INCOHERENT_MMAP': (), 'SIZEOF_UINT8_T': 1, 'HAVE_TEXTDOMAIN': 1, 'STRERROR_R_PROTO_COMPATIBLE': (), 'WORKING_GETCONF_LFS_CFLAGS': 1, 'HAVE_INOTIFY': 1, 'HAVE__DUP': (), 'HAVE_OPENPTY': 1, 'HAVE_ATEXIT': 1, 'HAVE__LSTAT': (), 'HAVE_STRLWR': (), 'HAVE_SYS_RESOURCE_H': 1, 'HAVE_ETHTOOL': 1, 'HAVE_SHA512_UPDATE': (), 'HAVE_LIBRT': 1, 'HAVE_KRB5_GET_INIT_CREDS_OPT_GET_ERROR': 1, 'HAVE_CC_MD5_INIT': (), 'HAVE_SA_SIGINFO_DECL': 1, 'HAVE_GETPGRP': 1, 'HAVE_LINUX_FALLOC_H': 1, 'HAVE_GETGRENT': 1, 'HAVE_VOLATILE': 1, 'HAVE___CLOSEDIR': (), 'HAVE_GSS_DISPLAY_STATUS': 1, 'static_init_gpext': '{}', 'HAVE___PREAD': (), 'HAVE_GETHOSTENT_R': 1, 'HAVE_LINUX_INOTIFY': 1, 'TIME_WITH_SYS_TIME': 1, 'HAVE_UT_UT_HOST': 1, 'HAVE_ALLOCA_H': 1, 'HAVE_STAT_ST_BLKSIZE': 1, 'HAVE_DGETTEXT': 1, 'HAVE_SETEUID': 1, 'vfs_aio_pthread_init': 'samba_init_module', 'HAVE_WS_XPIXEL': 1, 'HAVE_LANGINFO_H': 1, 'HAVE_GETTIMEOFDAY_TZ_VOID': 1, 'HAVE_ZLIBVERSION': 1, 'HAVE_DARWIN_INITGROUPS': (), 'HAVE__CLOSE': (), 'HAVE_KERNEL_OPLOCKS_LINUX': 1, 'HAVE_SYSCALL_H': 1, 'HAVE_CHFLAGS': (), 'HAVE_SYS_TIME_H': 1, 'HAVE_FUTIMES': 1, 'HAVE_FCVT': 1, 'HAVE_STRUCT_DQBLK_DQB_CURBYTES': (), 'HAVE_SHL_FINDSYM': (), 'vfs_posix_eadb_init': 'samba_init_module', 'HAVE_PAM_START': (), 'HAVE_DUP2': 1, 'SIZEOF_BLKCNT_T_4': (), 'HAVE_FSEEKO': 1, 'SIZEOF_BLKCNT_T_8': 1, 'HAVE_SYS_PRCTL_H': 1, 'HAVE_BASENAME': 1, 'HAVE_ERRX': 1, 'HAVE_DESTRUCTOR_ATTRIBUTE': 1, 'HAVE_BIND_TEXTDOMAIN_CODESET': 1, 'HAVE__TELLDIR': (), 'HAVE_SOCKETPAIR': 1, 'HAVE_SYS_TERMIOS_H': 1, 'HAVE_INT32_T': 1, 'HAVE_DECL_EWOULDBLOCK': 1, 'vfs_aio_fork_init': 'samba_init_module', 'HAVE_DECL_GNUTLS_CERT_EXPIRED': 1, 'HAVE_WAIT4': 1, 'HAVE_GETDENTS': (), 'HAVE__STAT': (), 'idmap_autorid_init': 'samba_init_module', 'HAVE_KERNEL_SHARE_MODES': 1, 'HAVE_STRLCAT': (), 'HAVE__FCHDIR': (), 'HAVE_TIMEGM': 1, 'HAVE_FREEADDRINFO': 1, 'vfs_streams_xattr_init': 'samba_init_module', 'static_decl_auth': 'extern NTSTATUS auth_domain_init(void); extern NTSTATUS auth_builtin_init(void); extern NTSTATUS auth_sam_init(void); extern NTSTATUS auth_winbind_init(void); extern NTSTATUS auth_unix_init(void); extern NTSTATUS auth_wbc_init(void); extern NTSTATUS auth_samba4_init(void);', 'HAVE_KRB5_FREE_ERROR_CONTENTS': 1, 'HAVE_KRB5_WARNX': 1, 'USE_LINUX_THREAD_CREDENTIALS': 1, 'HAVE_GETSPNAM': 1, 'HAVE_MKTIME': 1, 'HAVE_KRB5_GET_INIT_CREDS_KEYBLOCK': 1, 'HAVE_SENDFILE': '1', 'HAVE_SOCKET': 1, 'HAVE_KRB5_PRINCIPAL_GET_TYPE': 1, 'HAVE_LISTXATTR': 1, 'HAVE_SYMLINK': 1, 'HAVE_STDDEF_H': 1, 'HAVE_HTTPCONNECT': (), 'HAVE__SEEKDIR': (), 'BROKEN_NISPLUS_INCLUDE_FILES': 1, 'HAVE_RL_COMPLETION_MATCHES': 1, 'HAVE_NEW_LIBREADLINE': 1, 'HAVE_STRTOQ': 1, 'HAVE_ENDMNTENT': 1, 'HAVE_PWRITE': 1, 'HAVE_MKNOD': 1, 'HAVE_MUNLOCK': 1, 'HAVE_ENCTYPE_AES256_CTS_HMAC_SHA1_96': 1, 'HAVE_GETTEXT': 1, 'static_init_nss_info': '{ nss_info_template_init(); }', 'HAVE_UINTPTR_T': 1, 'static_decl_perfcount': '', 'HAVE_GETGRGID_R': 1, 'HAVE_INO_T': 1, 'HAVE_CRYPT': 1, 'HAVE_DECL_GNUTLS_CERT_UNEXPECTED_OWNER': 1, 'static_init_vfs': '{ vfs_default_init();  vfs_dfs_samba4_init();  vfs_zfs_space_init(); }', 'HAVE_SETGID': 1, 'HAVE_SYS_TIMEB_H': 1, 'HAVE_SYS_AUXV_H': 1, 'HAVE_RDCHK': (), 'HAVE_WARN': 1, 'HAVE_LLSEEK': (), 'HAVE_DECL_KRB5_AUTH_CON_SET_REQ_CKSUMTYPE': 0, 'HAVE_ISATTY': 1, 'HAVE_LINK': 1, 'HAVE_KRB5_KU_OTHER_CKSUM': 1, 'HAVE___SEEKDIR': (), 'static_decl_nss_info': 'extern NTSTATUS nss_info_template_init(void);', 'HAVE_GETGRENT_R': 1, 'HAVE_FLISTXATTR': 1, 'STAT_STATVFS': 1, 'HAVE_STRPBRK': 1, 'HAVE_UT_UT_USER': 1, 'HAVE_CHSIZE': (), 'HAVE_NEW_FIELD': 1, 'HAVE_EXECL': 1, 'HAVE_KRB5_PRINCIPAL_SET_TYPE': 1, 'HAVE_KRB5_PRINCIPAL_GET_COMP_STRING': 1, 'HAVE_COMPILER_WILL_OPTIMIZE_OUT_FNS': 1, 'REALPATH_TAKES_NULL': 1, 'VALUEOF_SIGRTMIN': '34', 'HAVE_LIMITS_H': 1, 'HAVE_CONFIG_H': (), 'vfs_dirsort_init': 'samba_init_module', 'static_init_rpc': '{}', 'HAVE_NANOSLEEP': 1, 'HAVE___PWRITE': (), 'HAVE_CLOSEFROM': 1, 'HAVE_KRB5_AUTH_CON_SETKEY': 1, 'HAVE_GNUTLS': 1, 'HAVE_WRITEV': 1, 'vfs_full_audit_init': 'samba_init_module', 'HAVE_YP_GET_DEFAULT_DOMAIN': 1, 'HAVE_GETTIMEOFDAY_TZ': (), 'HAVE_TERMIOS_H': 1, 'HAVE_FUNCTION_MACRO': 1, 'HAVE_DECL_FS_COMPR_FL': 1, 'HAVE_PANEL_H': 1, 'HAVE_BSWAP32': (), 'HAVE_UTIMENSAT': 1, 'HAVE_KRB5_CC_COPY_CACHE': 1, 'HAVE_CONSTRUCTOR_ATTRIBUTE': 1, 'HAVE_KRB5_PROMPT_TYPE': 1, 'HAVE_KRB5_SET_REAL_TIME': 1, 'HAVE_STRCHR': 1, 'KRB5_PRINC_REALM_RETURNS_REALM': 1, 'HAVE_DPRINTF': 1, 'HAVE_OFFSET_T': (), 'HAVE_RPC_RPC_H': 1, 'HAVE_GSS_EXPORT_CRED': 1, 'HAVE_SYS_DIR_H': 1, 'HAVE_PTY_H': 1, 'HAVE_GNUTLS_X509_H': 1, 'HAVE_MEMSET': 1, 'HAVE_DECL_BINDTEXTDOMAIN': 1, 'HAVE_SIGSET': 1, 'HAVE_VSNPRINTF': 1, 'HAVE_STRTOUQ': 1, 'HAVE___STAT': (), 'HAVE_SNPRINTF': 1, 'HAVE_SYS_TYPES_H': 1, 'HAVE_CHROOT': 1, 'HAVE_SYS_SELECT_H': 1, 'HAVE_SSIZE_T': 1, 'HAVE_FCHMOD': 1, 'HAVE_DIRENT_H': 1, 'HAVE_STAT_TV_NSEC': 1, 'HAVE___TELLDIR': (), 'HAVE_KRB5_ENCTYPE_TO_STRING_WITH_KRB5_CONTEXT_ARG': 1, 'HAVE_PATHCONF': 1, 'HAVE_STRUCT_WINSIZE': 1, 'HAVE_MEMFD_CREATE': 1, 'HAVE_SETGROUPS': 1, 'vfs_audit_init': 'samba_init_module', 'HAVE_ASM_TYPES_H': 1, 'HAVE_LINUX_IOCTL': '1', 'HAVE_UNAME': 1, 'HAVE_ASSERT_H': 1, 'HAVE_SIGACTION': 1, 'HAVE_KRB5_GET_CREDS_OPT_ALLOC': 1, 'HAVE_MKDTEMP': 1, '_HAVE_SENDFILE': 1, 'HAVE_GETPROGNAME': (), 'HAVE_SHMGET': 1, 'HAVE_UINT64_T': 1, 'vfs_netatalk_init': 'samba_init_module', 'SIZEOF_UINT32_T': 4, 'HAVE_GETPWENT_R_DECL': 1, 'HAVE_CLEARENV': 1, 'HAVE_POLL': 1, 'HAVE_STRUCT_STAT_ST_BIRTHTIMENSEC': (), 'HAVE_STRERROR': 1, 'HAVE_UINT8_T': 1, 'STRING_STATIC_MODULES': '"vfs_default auth_domain auth_builtin auth_sam auth_winbind pdb_smbpasswd pdb_tdbsam pdb_wbc_sam auth_unix auth_wbc nss_info_template idmap_tdb idmap_passdb idmap_nss pdb_samba_dsdb auth_samba4 vfs_dfs_samba4 vfs_zfs_space"', 'HAVE_GETPWNAM_R': 1, 'HAVE_INET_ATON': 1, 'HAVE_LCHOWN': 1, 'HAVE_READLINK': 1, 'HAVE_SYS_TIMES_H': 1, 'HAVE_ERR': 1, 'HAVE_PREAD': 1, 'HAVE_RPCSVC_YP_PROT_H': 1, 'HAVE_FSTATAT': 1, 'HAVE_FLOCK': 1, 'HAVE_PRCTL': 1, 'HAVE_LINUX_KERNEL_AIO': (), '_HAVE_UNBROKEN_POSIX_FALLOCATE': 1, 'HAVE_BSD_STRTOLL': (), 'vfs_offline_init': 'samba_init_module', 'HAVE_SETPROCTITLE': (), 'HAVE_SETREUID': 1, 'vfs_time_audit_init': 'samba_init_module'}
+disable_python = False
+disable_tdb_mutex_locking = False
+dmapi_lib = ''
+enable_coverage = False
+enable_gnutls = True
+hlist = ['stdio.h', 'sys/types.h', 'sys/stat.h', 'stdlib.h', 'stddef.h', 'memory.h', 'string.h', 'strings.h', 'inttypes.h', 'stdint.h', 'unistd.h', 'ctype.h', 'stdbool.h', 'stdarg.h']
+idmap_autorid_init = 'samba_init_module'
+idmap_hash_init = 'samba_init_module'
+idmap_rid_init = 'samba_init_module'
+idmap_script_init = 'samba_init_module'
+idmap_tdb2_init = 'samba_init_module'
+in_compound = 0
+intl_libs = ''
+legacy_quota_libs = ''
+libtracker = ''
+macbundle_PATTERN = '%s.bundle'
+offset_t = 'loff_t'
+pdb_freenas_init = 'samba_init_module'
+program_PATTERN = '%s'
+pyext_PATTERN = '%s.so'
+python_headers_checked = 'yes'
+python_interpreters = ['/root/.pyenv/versions/2.7.18/bin/python']
+replace_add_global_pthread = True
+shared_modules = ['idmap_autorid', 'idmap_rid', 'idmap_hash', 'pdb_freenas', 'vfs_recycle', 'vfs_audit', 'vfs_extd_audit', 'vfs_full_audit', 'vfs_netatalk', 'vfs_fake_perms', 'vfs_default_quota', 'vfs_readonly', 'vfs_cap', 'vfs_expand_msdfs', 'vfs_shadow_copy', 'vfs_shadow_copy2', 'vfs_readahead', 'vfs_xattr_tdb', 'vfs_posix_eadb', 'vfs_streams_xattr', 'vfs_streams_depot', 'vfs_acl_xattr', 'vfs_acl_tdb', 'vfs_preopen', 'vfs_catia', 'vfs_media_harmony', 'vfs_unityed_media', 'vfs_fruit', 'vfs_shell_snap', 'vfs_commit', 'vfs_worm', 'vfs_crossrename', 'vfs_linux_xfs_sgid', 'vfs_time_audit', 'vfs_offline', 'auth_script', 'idmap_tdb2', 'idmap_script', 'vfs_syncops', 'vfs_dirsort', 'vfs_fileid', 'vfs_aio_fork', 'vfs_aio_pthread', 'vfs_btrfs']
+shlib_CCFLAGS = ['-fPIC', '-DPIC']
+shlib_LINKFLAGS = ['-shared']
+shlib_PATTERN = 'lib%s.so'
+srcdir = '/root/repo'
+standalone_ldb = False
+standalone_replace = False
+standalone_talloc = False
+standalone_tdb = False
+standalone_tevent = False
+static_decl_auth = 'extern NTSTATUS auth_domain_init(void); extern NTSTATUS auth_builtin_init(void); extern NTSTATUS auth_sam_init(void); extern NTSTATUS auth_winbind_init(void); extern NTSTATUS auth_unix_init(void); extern NTSTATUS auth_wbc_init(void); extern NTSTATUS auth_samba4_init(void);'
+static_decl_charset = ''
+static_decl_gpext = ''
+static_decl_idmap = 'extern NTSTATUS idmap_tdb_init(void); extern NTSTATUS idmap_passdb_init(void); extern NTSTATUS idmap_nss_init(void);'
+static_decl_nss_info = 'extern NTSTATUS nss_info_template_init(void);'
+static_decl_pdb = 'extern NTSTATUS pdb_smbpasswd_init(void); extern NTSTATUS pdb_tdbsam_init(void); extern NTSTATUS pdb_wbc_sam_init(void); extern NTSTATUS pdb_samba_dsdb_init(void);'
+static_decl_perfcount = ''
+static_decl_rpc = ''
+static_decl_vfs = 'extern NTSTATUS vfs_default_init(void); extern NTSTATUS vfs_dfs_samba4_init(void); extern NTSTATUS vfs_zfs_space_init(void);'
+static_init_auth = '{ auth_domain_init();  auth_builtin_init();  auth_sam_init();  auth_winbind_init();  auth_unix_init();  auth_wbc_init();  auth_samba4_init(); }'
+static_init_charset = '{}'
+static_init_gpext = '{}'
+static_init_idmap = '{ idmap_tdb_init();  idmap_passdb_init();  idmap_nss_init(); }'
+static_init_nss_info = '{ nss_info_template_init(); }'
+static_init_pdb = '{ pdb_smbpasswd_init();  pdb_tdbsam_init();  pdb_wbc_sam_init();  pdb_samba_dsdb_init(); }'
+static_init_perfcount = '{}'
+static_init_rpc = '{}'
+static_init_vfs = '{ vfs_default_init();  vfs_dfs_samba4_init();  vfs_zfs_space_init(); }'
+static_modules = ['vfs_default', 'auth_domain', 'auth_builtin', 'auth_sam', 'auth_winbind', 'pdb_smbpasswd', 'pdb_tdbsam', 'pdb_wbc_sam', 'auth_unix', 'auth_wbc', 'nss_info_template', 'idmap_tdb', 'idmap_passdb', 'idmap_nss', 'pdb_samba_dsdb', 'auth_samba4', 'vfs_dfs_samba4', 'vfs_zfs_space']
+staticlib_LINKFLAGS = ['-Wl,-Bstatic']
+staticlib_PATTERN = 'lib%s.a'
+uint_t = 'unsigned int'
+undefined_ldflags = ['-Wl,-no-undefined']
+vfs_acl_tdb_init = 'samba_init_module'
+vfs_acl_xattr_init = 'samba_init_module'
+vfs_aio_fork_init = 'samba_init_module'
+vfs_aio_pthread_init = 'samba_init_module'
+vfs_audit_init = 'samba_init_module'
+vfs_btrfs_init = 'samba_init_module'
+vfs_cap_init = 'samba_init_module'
+vfs_catia_init = 'samba_init_module'
+vfs_commit_init = 'samba_init_module'
+vfs_crossrename_init = 'samba_init_module'
+vfs_default_quota_init = 'samba_init_module'
+vfs_dirsort_init = 'samba_init_module'
+vfs_expand_msdfs_init = 'samba_init_module'
+vfs_extd_audit_init = 'samba_init_module'
+vfs_fake_perms_init = 'samba_init_module'
+vfs_fileid_init = 'samba_init_module'
+vfs_fruit_init = 'samba_init_module'
+vfs_full_audit_init = 'samba_init_module'
+vfs_linux_xfs_sgid_init = 'samba_init_module'
+vfs_media_harmony_init = 'samba_init_module'
+vfs_netatalk_init = 'samba_init_module'
+vfs_offline_init = 'samba_init_module'
+vfs_posix_eadb_init = 'samba_init_module'
+vfs_preopen_init = 'samba_init_module'
+vfs_readahead_init = 'samba_init_module'
+vfs_readonly_init = 'samba_init_module'
+vfs_recycle_init = 'samba_init_module'
+vfs_shadow_copy2_init = 'samba_init_module'
+vfs_shadow_copy_init = 'samba_init_module'
+vfs_shell_snap_init = 'samba_init_module'
+vfs_streams_depot_init = 'samba_init_module'
+vfs_streams_xattr_init = 'samba_init_module'
+vfs_syncops_init = 'samba_init_module'
+vfs_time_audit_init = 'samba_init_module'
+vfs_unityed_media_init = 'samba_init_module'
+vfs_worm_init = 'samba_init_module'
+vfs_xattr_tdb_init = 'samba_init_module'
+with_avahi = False
+with_ctdb = True
+with_dnssd = False
+with_iconv = True
+with_spotlight = False
+with_utmp = True
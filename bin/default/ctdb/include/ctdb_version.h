@@ -0,0 +1,2 @@
+#include "../version.h" 
+#define CTDB_VERSION_STRING SAMBA_VERSION_STRING
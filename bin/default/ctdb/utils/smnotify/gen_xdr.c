@@ -0,0 +1,18 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#include "../ctdb/utils/smnotify/smnotify.h"
+
+bool_t
+xdr_status (XDR *xdrs, status *objp)
+{
+	register int32_t *buf = buf;
+
+	 if (!xdr_string (xdrs, &objp->mon_name, SM_MAXSTRLEN))
+		 return FALSE;
+	 if (!xdr_int (xdrs, &objp->state))
+		 return FALSE;
+	return TRUE;
+}
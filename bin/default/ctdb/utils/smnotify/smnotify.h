@@ -0,0 +1,57 @@
+/*
+ * Please do not edit this file.
+ * It was generated using rpcgen.
+ */
+
+#ifndef _SMNOTIFY_H_RPCGEN
+#define _SMNOTIFY_H_RPCGEN
+
+#include <rpc/rpc.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef _AIX
+#include <rpc/rpc.h>
+#endif /* _AIX */
+#define SM_MAXSTRLEN 1024
+
+struct status {
+	char *mon_name;
+	int state;
+};
+typedef struct status status;
+
+#define SMNOTIFY 100024
+#define SMVERSION 1
+
+#if defined(__STDC__) || defined(__cplusplus)
+#define SM_NOTIFY 6
+extern  void * sm_notify_1(struct status *, CLIENT *);
+extern  void * sm_notify_1_svc(struct status *, struct svc_req *);
+extern int smnotify_1_freeresult (SVCXPRT *, xdrproc_t, caddr_t);
+
+#else /* K&R C */
+#define SM_NOTIFY 6
+extern  void * sm_notify_1();
+extern  void * sm_notify_1_svc();
+extern int smnotify_1_freeresult ();
+#endif /* K&R C */
+
+/* the xdr functions */
+
+#if defined(__STDC__) || defined(__cplusplus)
+extern  bool_t xdr_status (XDR *, status*);
+
+#else /* K&R C */
+extern bool_t xdr_status ();
+
+#endif /* K&R C */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* !_SMNOTIFY_H_RPCGEN */
@@ -0,0 +1,20 @@
+#ifndef __DEFAULT_FILE_SERVER_FILE_SERVER_PROTO_H__
+#define __DEFAULT_FILE_SERVER_FILE_SERVER_PROTO_H__
+
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2) PRINTF_ATTRIBUTE(a1, a2)
+/* This file was automatically generated by mkproto.pl. DO NOT EDIT */
+
+/* this file contains prototypes for functions that are private 
+ * to this subsystem or library. These functions should not be 
+ * used outside this particular subsystem! */
+
+
+/* The following definitions come from ../file_server/file_server.c  */
+
+NTSTATUS server_service_s3fs_init(void);
+#undef _PRINTF_ATTRIBUTE
+#define _PRINTF_ATTRIBUTE(a1, a2)
+
+#endif /* __DEFAULT_FILE_SERVER_FILE_SERVER_PROTO_H__ */
+
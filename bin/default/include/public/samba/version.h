@@ -0,0 +1,14 @@
+/* Autogenerated by waf */
+#define SAMBA_VERSION_MAJOR 4
+#define SAMBA_VERSION_MINOR 5
+#define SAMBA_VERSION_RELEASE 3
+#define SAMBA_VERSION_OFFICIAL_STRING "4.5.3"
+
+#ifdef SAMBA_VERSION_VENDOR_FUNCTION
+#  define SAMBA_VERSION_STRING SAMBA_VERSION_VENDOR_FUNCTION
+#else /* SAMBA_VERSION_VENDOR_FUNCTION */
+#  define SAMBA_VERSION_STRING "4.5.3"
+#endif
+/* Version for mkrelease.sh: 
+SAMBA_VERSION_STRING=4.5.3
+ */
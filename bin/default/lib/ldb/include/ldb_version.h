@@ -0,0 +1 @@
+#define LDB_VERSION "1.1.27"
@@ -0,0 +1,318 @@
+/* This file was automatically generated by generate_param.py. DO NOT EDIT */
+
+#ifndef __PARAM_GLOBAL_H__
+#define __PARAM_GLOBAL_H__
+
+/**
+ * This structure describes global (ie., server-wide) parameters.
+ */
+struct loadparm_global 
+{
+	TALLOC_CTX *ctx; /* Context for talloced members */
+	bool   bind_interfaces_only;
+	int   config_backend;
+	char *  dos_charset;
+	bool   enable_core_files;
+	const char **  interfaces;
+	bool   multicast_dns_register;
+	const char **  netbios_aliases;
+	char *  netbios_name;
+	char *  netbios_scope;
+	char *  realm;
+	const char **  server_services;
+	char *  server_string;
+	char *  share_backend;
+	char *  unix_charset;
+	char *  workgroup;
+	bool   browse_list;
+	int   _domain_master;
+	bool   enhanced_browsing;
+	int   lm_announce;
+	int   lm_interval;
+	bool   local_master;
+	int   os_level;
+	int   _preferred_master;
+	int   allow_dns_updates;
+	const char **  dns_forwarder;
+	const char **  dns_update_command;
+	int   machine_password_timeout;
+	const char **  nsupdate_command;
+	const char **  rndc_command;
+	const char **  spn_update_command;
+	int   mangle_prefix;
+	char *  mangling_method;
+	int   max_stat_cache_size;
+	bool   stat_cache;
+	int   client_ldap_sasl_wrapping;
+	char *  ldap_admin_dn;
+	int   ldap_connection_timeout;
+	bool   ldap_delete_dn;
+	int   ldap_deref;
+	int   ldap_follow_referral;
+	char *  _ldap_group_suffix;
+	char *  _ldap_idmap_suffix;
+	char *  _ldap_machine_suffix;
+	int   ldap_page_size;
+	int   ldap_passwd_sync;
+	int   ldap_replication_sleep;
+	int   ldap_server_require_strong_auth;
+	int   ldap_ssl;
+	bool   ldap_ssl_ads;
+	char *  ldap_suffix;
+	int   ldap_timeout;
+	char *  _ldap_user_suffix;
+	int   lock_spin_time;
+	int   oplock_break_wait_time;
+	bool   smb2_leases;
+	bool   debug_class;
+	bool   debug_hires_timestamp;
+	bool   debug_pid;
+	bool   debug_prefix_timestamp;
+	bool   debug_uid;
+	int   ldap_debug_level;
+	int   ldap_debug_threshold;
+	char *  logfile;
+	char *  logging;
+	char *  log_level;
+	int   max_log_size;
+	int   syslog;
+	bool   syslog_only;
+	bool   timestamp_logs;
+	char *  abort_shutdown_script;
+	char *  add_group_script;
+	char *  add_machine_script;
+	char *  add_user_script;
+	char *  add_user_to_group_script;
+	bool   allow_nt4_crypto;
+	char *  delete_group_script;
+	char *  delete_user_from_group_script;
+	char *  delete_user_script;
+	bool   _domain_logons;
+	bool   enable_privileges;
+	int   init_logon_delay;
+	const char **  init_logon_delayed_hosts;
+	char *  logon_drive;
+	char *  logon_home;
+	char *  logon_path;
+	char *  logon_script;
+	bool   reject_md5_clients;
+	char *  set_primary_group_script;
+	char *  shutdown_script;
+	char *  add_share_command;
+	int   afs_token_lifetime;
+	char *  afs_username_map;
+	bool   allow_insecure_wide_links;
+	bool   async_smb_echo_handler;
+	char *  auto_services;
+	char *  cache_directory;
+	bool   change_notify;
+	char *  change_share_command;
+	const char **  cluster_addresses;
+	bool   clustering;
+	char *  next_configfile;
+	char *  _ctdbd_socket;
+	int   ctdb_locktime_warn_threshold;
+	int   ctdb_timeout;
+	char *  defaultservice;
+	char *  delete_share_command;
+	char *  homedir_map;
+	bool   kernel_change_notify;
+	char *  lock_directory;
+	bool   log_writeable_files_on_exit;
+	char *  message_command;
+	char *  nbt_client_socket_address;
+	char *  ncalrpc_dir;
+	bool   nis_homedir;
+	bool   nmbd_bind_explicit_broadcast;
+	char *  panic_action;
+	char *  perfcount_module;
+	char *  pid_directory;
+	bool   registry_shares;
+	char *  remote_announce;
+	char *  remote_browse_sync;
+	bool   reset_on_zero_vc;
+	int   smbd_profiling_level;
+	char *  state_directory;
+	bool   usershare_allow_guests;
+	int   usershare_max_shares;
+	bool   usershare_owner_only;
+	char *  usershare_path;
+	const char **  usershare_prefix_allow_list;
+	const char **  usershare_prefix_deny_list;
+	char *  usershare_template_share;
+	bool   utmp;
+	char *  utmp_directory;
+	char *  wtmp_directory;
+	char *  addport_command;
+	char *  addprinter_command;
+	int   cups_connection_timeout;
+	int   cups_encrypt;
+	char *  cups_server;
+	char *  deleteprinter_command;
+	bool   _disable_spoolss;
+	char *  enumports_command;
+	char *  iprint_server;
+	bool   load_printers;
+	int   lpq_cache_time;
+	char *  os2_driver_map;
+	int   printcap_cache_time;
+	char *  printcap_name;
+	bool   show_add_printer_wizard;
+	int   cldap_port;
+	int   _client_ipc_max_protocol;
+	int   _client_ipc_min_protocol;
+	int   _client_max_protocol;
+	int   client_min_protocol;
+	bool   client_smb2_compression;
+	bool   client_use_spnego;
+	const char **  dcerpc_endpoint_servers;
+	bool   defer_sharing_violations;
+	int   dgram_port;
+	bool   disable_netbios;
+	bool   enable_asu_support;
+	const char **  eventlog_list;
+	bool   large_readwrite;
+	int   max_mux;
+	int   max_ttl;
+	int   max_wins_ttl;
+	int   max_xmit;
+	int   min_receivefile_size;
+	int   min_wins_ttl;
+	const char **  name_resolve_order;
+	int   nbt_port;
+	bool   nt_pipe_support;
+	bool   nt_status_support;
+	bool   read_raw;
+	bool   rpc_big_endian;
+	int   server_max_protocol;
+	int   server_min_protocol;
+	bool   server_multi_channel_support;
+	bool   server_smb2_compression;
+	int   smb2_max_credits;
+	int   smb2_max_read;
+	int   smb2_max_trans;
+	int   smb2_max_write;
+	const char **  smb_ports;
+	const char **  svcctl_list;
+	bool   time_server;
+	bool   unicode;
+	bool   unix_extensions;
+	bool   use_spnego;
+	int   web_port;
+	bool   write_raw;
+	int   algorithmic_rid_base;
+	bool   allow_dcerpc_auth_level_connect;
+	bool   allow_trusted_domains;
+	const char **  auth_methods;
+	char *  check_password_script;
+	int   _client_ipc_signing;
+	bool   client_lanman_auth;
+	bool   client_ntlmv2_auth;
+	bool   client_plaintext_auth;
+	int   client_schannel;
+	int   client_signing;
+	bool   client_use_spnego_principal;
+	char *  dedicated_keytab_file;
+	bool   encrypt_passwords;
+	char *  guest_account;
+	int   kerberos_method;
+	int   kpasswd_port;
+	int   krb5_port;
+	bool   lanman_auth;
+	char *  log_nt_token_command;
+	int   map_to_guest;
+	bool   map_untrusted_to_domain;
+	bool   ntlm_auth;
+	char *  ntp_signd_socket_directory;
+	bool   null_passwords;
+	bool   obey_pam_restrictions;
+	int   old_password_allowed_period;
+	bool   pam_password_change;
+	char *  passdb_backend;
+	bool   passdb_expand_explicit;
+	char *  passwd_chat;
+	bool   passwd_chat_debug;
+	int   passwd_chat_timeout;
+	char *  passwd_program;
+	const char **  password_hash_gpg_key_ids;
+	char *  password_server;
+	const char **  preload_modules;
+	char *  private_dir;
+	bool   raw_ntlmv2_auth;
+	char *  rename_user_script;
+	int   restrict_anonymous;
+	char *  root_directory;
+	const char **  samba_kcc_command;
+	int   _security;
+	int   _server_role;
+	int   server_schannel;
+	int   server_signing;
+	char *  smb_passwd_file;
+	char *  _tls_cafile;
+	char *  _tls_certfile;
+	char *  _tls_crlfile;
+	char *  _tls_dhpfile;
+	bool   tls_enabled;
+	char *  _tls_keyfile;
+	char *  tls_priority;
+	int   tls_verify_peer;
+	bool   unix_password_sync;
+	int   username_level;
+	char *  username_map;
+	int   username_map_cache_time;
+	char *  username_map_script;
+	int   aio_max_threads;
+	int   deadtime;
+	bool   getwd_cache;
+	bool   hostname_lookups;
+	int   keepalive;
+	int   max_disk_size;
+	int   max_open_files;
+	int   max_smbd_processes;
+	int   name_cache_timeout;
+	char *  socket_options;
+	bool   use_mmap;
+	char *  get_quota_command;
+	bool   host_msdfs;
+	char *  set_quota_command;
+	bool   create_krb5_conf;
+	char *  idmap_backend;
+	int   idmap_cache_time;
+	char *  idmap_gid;
+	int   idmap_negative_cache_time;
+	char *  idmap_uid;
+	bool   neutralize_nt4_emulation;
+	bool   reject_md5_servers;
+	bool   require_strong_key;
+	char *  template_homedir;
+	char *  template_shell;
+	int   winbind_cache_time;
+	char *  winbindd_privileged_socket_directory;
+	char *  winbindd_socket_directory;
+	bool   winbind_enum_groups;
+	bool   winbind_enum_users;
+	int   winbind_expand_groups;
+	int   winbind_max_clients;
+	int   _winbind_max_domain_connections;
+	bool   winbind_nested_groups;
+	bool   winbind_normalize_names;
+	const char **  winbind_nss_info;
+	bool   winbind_offline_logon;
+	int   winbind_reconnect_delay;
+	bool   winbind_refresh_tickets;
+	int   winbind_request_timeout;
+	bool   winbind_rpc_only;
+	bool   winbind_sealed_pipes;
+	char *  winbind_separator;
+	bool   winbind_trusted_domains_only;
+	bool   winbind_use_default_domain;
+	bool   wins_dns_proxy;
+	char *  wins_hook;
+	bool   wins_proxy;
+	const char **  wins_server_list;
+	bool   we_are_a_wins_server;
+LOADPARM_EXTRA_GLOBALS
+};
+
+#endif /* __PARAM_GLOBAL_H__ */
+
@@ -0,0 +1,145 @@
+/* This file was automatically generated by generate_param.py. DO NOT EDIT */
+
+#ifndef __PARAM_LOCAL_H__
+#define __PARAM_LOCAL_H__
+
+/**
+ * This structure describes a single service.
+ */
+struct loadparm_service 
+{
+	bool   autoloaded;
+	char *  comment;
+	char *  path;
+	bool   administrative_share;
+	bool   browseable;
+	int   case_sensitive;
+	int   default_case;
+	bool   delete_veto_files;
+	bool   hide_dot_files;
+	char *  hide_files;
+	bool   hide_special_files;
+	bool   hide_unreadable;
+	bool   hide_unwriteable_files;
+	bool   mangled_names;
+	char   mangling_char;
+	bool   map_archive;
+	bool   map_hidden;
+	int   map_readonly;
+	bool   map_system;
+	bool   preserve_case;
+	bool   short_preserve_case;
+	bool   store_dos_attributes;
+	char *  veto_files;
+	char *  veto_oplock_files;
+	bool   blocking_locks;
+	int   csc_policy;
+	bool   fake_oplocks;
+	bool   kernel_oplocks;
+	bool   kernel_share_modes;
+	bool   level2_oplocks;
+	bool   locking;
+	int   oplock_contention_limit;
+	bool   oplocks;
+	bool   posix_locking;
+	int   strict_locking;
+	bool   afs_share;
+	bool   available;
+	char *  copy;
+	bool   delete_readonly;
+	int   dfree_cache_time;
+	char *  dfree_command;
+	int   directory_name_cache_size;
+	bool   dmapi_support;
+	char *  dont_descend;
+	bool   dos_filemode;
+	bool   dos_filetime_resolution;
+	bool   dos_filetimes;
+	bool   fake_directory_create_times;
+	bool   follow_symlinks;
+	char *  fstype;
+	char *  include;
+	char *  magic_output;
+	char *  magic_script;
+	char *  postexec;
+	char *  preexec;
+	bool   preexec_close;
+	char *  root_postexec;
+	char *  root_preexec;
+	bool   root_preexec_close;
+	bool   spotlight;
+	bool   valid;
+	char *  volume;
+	bool   wide_links;
+	char *  cups_options;
+	bool   default_devmode;
+	bool   force_printername;
+	char *  lppause_command;
+	char *  lpq_command;
+	char *  lpresume_command;
+	char *  lprm_command;
+	int   max_print_jobs;
+	int   max_reported_print_jobs;
+	bool   printable;
+	char *  print_command;
+	char *  _printername;
+	int   printing;
+	char *  printjob_username;
+	bool   print_notify_backchannel;
+	char *  queuepause_command;
+	char *  queueresume_command;
+	bool   use_client_driver;
+	bool   acl_allow_execute_always;
+	bool   acl_check_permissions;
+	bool   acl_map_full_control;
+	bool   durable_handles;
+	bool   ea_support;
+	bool   map_acl_inherit;
+	bool   nt_acl_support;
+	bool   profile_acls;
+	bool   access_based_share_enum;
+	bool   acl_group_control;
+	const char **  admin_users;
+	int   create_mask;
+	int   directory_mask;
+	int   force_create_mode;
+	int   force_directory_mode;
+	char *  force_group;
+	bool   force_unknown_acl_user;
+	char *  force_user;
+	bool   guest_ok;
+	bool   guest_only;
+	const char **  hosts_allow;
+	const char **  hosts_deny;
+	bool   inherit_acls;
+	bool   inherit_owner;
+	bool   inherit_permissions;
+	const char **  invalid_users;
+	const char **  read_list;
+	bool   read_only;
+	int   smb_encrypt;
+	const char **  valid_users;
+	const char **  write_list;
+	int   aio_read_size;
+	char *  aio_write_behind;
+	int   aio_write_size;
+	int   allocation_roundup_size;
+	int   block_size;
+	int   max_connections;
+	int   min_print_space;
+	bool   strict_allocate;
+	bool   strict_rename;
+	bool   strict_sync;
+	bool   sync_always;
+	bool   _use_sendfile;
+	int   write_cache_size;
+	char *  msdfs_proxy;
+	bool   msdfs_root;
+	bool   msdfs_shuffle_referrals;
+	const char **  ntvfs_handler;
+	const char **  vfs_objects;
+LOADPARM_EXTRA_LOCALS
+};
+
+#endif /* __PARAM_LOCAL_H__ */
+
@@ -0,0 +1,8 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/audiosrv.h"
+#ifndef _HEADER_RPC_audiosrv
+#define _HEADER_RPC_audiosrv
+
+extern const struct ndr_interface_table ndr_table_audiosrv;
+
+#endif /* _HEADER_RPC_audiosrv */
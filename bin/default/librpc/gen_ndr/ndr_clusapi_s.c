@@ -0,0 +1,3742 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_clusapi.h"
+#include <util/debug.h>
+
+NTSTATUS dcerpc_server_clusapi_init(void);
+
+/* clusapi - dcerpc server boilerplate generated by pidl */
+
+
+static NTSTATUS clusapi__op_bind(struct dcesrv_call_state *dce_call, const struct dcesrv_interface *iface, uint32_t if_version)
+{
+#ifdef DCESRV_INTERFACE_CLUSAPI_BIND
+	return DCESRV_INTERFACE_CLUSAPI_BIND(dce_call,iface);
+#else
+	return NT_STATUS_OK;
+#endif
+}
+
+static void clusapi__op_unbind(struct dcesrv_connection_context *context, const struct dcesrv_interface *iface)
+{
+#ifdef DCESRV_INTERFACE_CLUSAPI_UNBIND
+	DCESRV_INTERFACE_CLUSAPI_UNBIND(context, iface);
+#else
+	return;
+#endif
+}
+
+static NTSTATUS clusapi__op_ndr_pull(struct dcesrv_call_state *dce_call, TALLOC_CTX *mem_ctx, struct ndr_pull *pull, void **r)
+{
+	enum ndr_err_code ndr_err;
+	uint16_t opnum = dce_call->pkt.u.request.opnum;
+
+	dce_call->fault_code = 0;
+
+	if (opnum >= ndr_table_clusapi.num_calls) {
+		dce_call->fault_code = DCERPC_FAULT_OP_RNG_ERROR;
+		return NT_STATUS_NET_WRITE_FAULT;
+	}
+
+	*r = talloc_named(mem_ctx,
+			  ndr_table_clusapi.calls[opnum].struct_size,
+			  "struct %s",
+			  ndr_table_clusapi.calls[opnum].name);
+	NT_STATUS_HAVE_NO_MEMORY(*r);
+
+        /* unravel the NDR for the packet */
+	ndr_err = ndr_table_clusapi.calls[opnum].ndr_pull(pull, NDR_IN, *r);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		dcerpc_log_packet(dce_call->conn->packet_log_dir, 
+				  &ndr_table_clusapi, opnum, NDR_IN,
+				  &dce_call->pkt.u.request.stub_and_verifier);
+		dce_call->fault_code = DCERPC_FAULT_NDR;
+		return NT_STATUS_NET_WRITE_FAULT;
+	}
+
+	return NT_STATUS_OK;
+}
+
+static NTSTATUS clusapi__op_dispatch(struct dcesrv_call_state *dce_call, TALLOC_CTX *mem_ctx, void *r)
+{
+	uint16_t opnum = dce_call->pkt.u.request.opnum;
+
+	switch (opnum) {
+	case 0: {
+		struct clusapi_OpenCluster *r2 = (struct clusapi_OpenCluster *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenCluster, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenCluster(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenCluster will reply async\n"));
+		}
+		break;
+	}
+	case 1: {
+		struct clusapi_CloseCluster *r2 = (struct clusapi_CloseCluster *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseCluster, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseCluster(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseCluster will reply async\n"));
+		}
+		break;
+	}
+	case 2: {
+		struct clusapi_SetClusterName *r2 = (struct clusapi_SetClusterName *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetClusterName, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetClusterName(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetClusterName will reply async\n"));
+		}
+		break;
+	}
+	case 3: {
+		struct clusapi_GetClusterName *r2 = (struct clusapi_GetClusterName *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetClusterName, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetClusterName(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetClusterName will reply async\n"));
+		}
+		break;
+	}
+	case 4: {
+		struct clusapi_GetClusterVersion *r2 = (struct clusapi_GetClusterVersion *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetClusterVersion, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetClusterVersion(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetClusterVersion will reply async\n"));
+		}
+		break;
+	}
+	case 5: {
+		struct clusapi_GetQuorumResource *r2 = (struct clusapi_GetQuorumResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetQuorumResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetQuorumResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetQuorumResource will reply async\n"));
+		}
+		break;
+	}
+	case 6: {
+		struct clusapi_SetQuorumResource *r2 = (struct clusapi_SetQuorumResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetQuorumResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetQuorumResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetQuorumResource will reply async\n"));
+		}
+		break;
+	}
+	case 7: {
+		struct clusapi_CreateEnum *r2 = (struct clusapi_CreateEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateEnum will reply async\n"));
+		}
+		break;
+	}
+	case 8: {
+		struct clusapi_OpenResource *r2 = (struct clusapi_OpenResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenResource, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenResource will reply async\n"));
+		}
+		break;
+	}
+	case 9: {
+		struct clusapi_CreateResource *r2 = (struct clusapi_CreateResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResource, NDR_IN, r2);
+		}
+		dcesrv_clusapi_CreateResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResource will reply async\n"));
+		}
+		break;
+	}
+	case 10: {
+		struct clusapi_DeleteResource *r2 = (struct clusapi_DeleteResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_DeleteResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteResource will reply async\n"));
+		}
+		break;
+	}
+	case 11: {
+		struct clusapi_CloseResource *r2 = (struct clusapi_CloseResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseResource will reply async\n"));
+		}
+		break;
+	}
+	case 12: {
+		struct clusapi_GetResourceState *r2 = (struct clusapi_GetResourceState *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceState, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetResourceState(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceState will reply async\n"));
+		}
+		break;
+	}
+	case 13: {
+		struct clusapi_SetResourceName *r2 = (struct clusapi_SetResourceName *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetResourceName, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetResourceName(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetResourceName will reply async\n"));
+		}
+		break;
+	}
+	case 14: {
+		struct clusapi_GetResourceId *r2 = (struct clusapi_GetResourceId *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceId, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetResourceId(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceId will reply async\n"));
+		}
+		break;
+	}
+	case 15: {
+		struct clusapi_GetResourceType *r2 = (struct clusapi_GetResourceType *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceType, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetResourceType(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceType will reply async\n"));
+		}
+		break;
+	}
+	case 16: {
+		struct clusapi_FailResource *r2 = (struct clusapi_FailResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_FailResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_FailResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_FailResource will reply async\n"));
+		}
+		break;
+	}
+	case 17: {
+		struct clusapi_OnlineResource *r2 = (struct clusapi_OnlineResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OnlineResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineResource will reply async\n"));
+		}
+		break;
+	}
+	case 18: {
+		struct clusapi_OfflineResource *r2 = (struct clusapi_OfflineResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OfflineResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineResource will reply async\n"));
+		}
+		break;
+	}
+	case 19: {
+		struct clusapi_AddResourceDependency *r2 = (struct clusapi_AddResourceDependency *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddResourceDependency, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddResourceDependency(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddResourceDependency will reply async\n"));
+		}
+		break;
+	}
+	case 20: {
+		struct clusapi_RemoveResourceDependency *r2 = (struct clusapi_RemoveResourceDependency *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_RemoveResourceDependency, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_RemoveResourceDependency(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_RemoveResourceDependency will reply async\n"));
+		}
+		break;
+	}
+	case 21: {
+		struct clusapi_CanResourceBeDependent *r2 = (struct clusapi_CanResourceBeDependent *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CanResourceBeDependent, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CanResourceBeDependent(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CanResourceBeDependent will reply async\n"));
+		}
+		break;
+	}
+	case 22: {
+		struct clusapi_CreateResEnum *r2 = (struct clusapi_CreateResEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateResEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResEnum will reply async\n"));
+		}
+		break;
+	}
+	case 23: {
+		struct clusapi_AddResourceNode *r2 = (struct clusapi_AddResourceNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddResourceNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddResourceNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddResourceNode will reply async\n"));
+		}
+		break;
+	}
+	case 24: {
+		struct clusapi_RemoveResourceNode *r2 = (struct clusapi_RemoveResourceNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_RemoveResourceNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_RemoveResourceNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_RemoveResourceNode will reply async\n"));
+		}
+		break;
+	}
+	case 25: {
+		struct clusapi_ChangeResourceGroup *r2 = (struct clusapi_ChangeResourceGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ChangeResourceGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ChangeResourceGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ChangeResourceGroup will reply async\n"));
+		}
+		break;
+	}
+	case 26: {
+		struct clusapi_CreateResourceType *r2 = (struct clusapi_CreateResourceType *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResourceType, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateResourceType(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResourceType will reply async\n"));
+		}
+		break;
+	}
+	case 27: {
+		struct clusapi_DeleteResourceType *r2 = (struct clusapi_DeleteResourceType *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteResourceType, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_DeleteResourceType(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteResourceType will reply async\n"));
+		}
+		break;
+	}
+	case 28: {
+		struct clusapi_GetRootKey *r2 = (struct clusapi_GetRootKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetRootKey, NDR_IN, r2);
+		}
+		dcesrv_clusapi_GetRootKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetRootKey will reply async\n"));
+		}
+		break;
+	}
+	case 29: {
+		struct clusapi_CreateKey *r2 = (struct clusapi_CreateKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateKey, NDR_IN, r2);
+		}
+		dcesrv_clusapi_CreateKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateKey will reply async\n"));
+		}
+		break;
+	}
+	case 30: {
+		struct clusapi_OpenKey *r2 = (struct clusapi_OpenKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenKey, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenKey will reply async\n"));
+		}
+		break;
+	}
+	case 31: {
+		struct clusapi_EnumKey *r2 = (struct clusapi_EnumKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_EnumKey, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_EnumKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_EnumKey will reply async\n"));
+		}
+		break;
+	}
+	case 32: {
+		struct clusapi_SetValue *r2 = (struct clusapi_SetValue *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetValue, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetValue(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetValue will reply async\n"));
+		}
+		break;
+	}
+	case 33: {
+		struct clusapi_DeleteValue *r2 = (struct clusapi_DeleteValue *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteValue, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_DeleteValue(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteValue will reply async\n"));
+		}
+		break;
+	}
+	case 34: {
+		struct clusapi_QueryValue *r2 = (struct clusapi_QueryValue *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_QueryValue, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_QueryValue(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_QueryValue will reply async\n"));
+		}
+		break;
+	}
+	case 35: {
+		struct clusapi_DeleteKey *r2 = (struct clusapi_DeleteKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteKey, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_DeleteKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteKey will reply async\n"));
+		}
+		break;
+	}
+	case 36: {
+		struct clusapi_EnumValue *r2 = (struct clusapi_EnumValue *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_EnumValue, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_EnumValue(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_EnumValue will reply async\n"));
+		}
+		break;
+	}
+	case 37: {
+		struct clusapi_CloseKey *r2 = (struct clusapi_CloseKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseKey, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseKey will reply async\n"));
+		}
+		break;
+	}
+	case 38: {
+		struct clusapi_QueryInfoKey *r2 = (struct clusapi_QueryInfoKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_QueryInfoKey, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_QueryInfoKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_QueryInfoKey will reply async\n"));
+		}
+		break;
+	}
+	case 39: {
+		struct clusapi_SetKeySecurity *r2 = (struct clusapi_SetKeySecurity *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetKeySecurity, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetKeySecurity(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetKeySecurity will reply async\n"));
+		}
+		break;
+	}
+	case 40: {
+		struct clusapi_GetKeySecurity *r2 = (struct clusapi_GetKeySecurity *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetKeySecurity, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetKeySecurity(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetKeySecurity will reply async\n"));
+		}
+		break;
+	}
+	case 41: {
+		struct clusapi_OpenGroup *r2 = (struct clusapi_OpenGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenGroup, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenGroup will reply async\n"));
+		}
+		break;
+	}
+	case 42: {
+		struct clusapi_CreateGroup *r2 = (struct clusapi_CreateGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroup, NDR_IN, r2);
+		}
+		dcesrv_clusapi_CreateGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroup will reply async\n"));
+		}
+		break;
+	}
+	case 43: {
+		struct clusapi_DeleteGroup *r2 = (struct clusapi_DeleteGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_DeleteGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteGroup will reply async\n"));
+		}
+		break;
+	}
+	case 44: {
+		struct clusapi_CloseGroup *r2 = (struct clusapi_CloseGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseGroup will reply async\n"));
+		}
+		break;
+	}
+	case 45: {
+		struct clusapi_GetGroupState *r2 = (struct clusapi_GetGroupState *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetGroupState, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetGroupState(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetGroupState will reply async\n"));
+		}
+		break;
+	}
+	case 46: {
+		struct clusapi_SetGroupName *r2 = (struct clusapi_SetGroupName *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetGroupName, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetGroupName(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetGroupName will reply async\n"));
+		}
+		break;
+	}
+	case 47: {
+		struct clusapi_GetGroupId *r2 = (struct clusapi_GetGroupId *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetGroupId, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetGroupId(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetGroupId will reply async\n"));
+		}
+		break;
+	}
+	case 48: {
+		struct clusapi_GetNodeId *r2 = (struct clusapi_GetNodeId *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNodeId, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNodeId(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNodeId will reply async\n"));
+		}
+		break;
+	}
+	case 49: {
+		struct clusapi_OnlineGroup *r2 = (struct clusapi_OnlineGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OnlineGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineGroup will reply async\n"));
+		}
+		break;
+	}
+	case 50: {
+		struct clusapi_OfflineGroup *r2 = (struct clusapi_OfflineGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OfflineGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineGroup will reply async\n"));
+		}
+		break;
+	}
+	case 51: {
+		struct clusapi_MoveGroup *r2 = (struct clusapi_MoveGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_MoveGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroup will reply async\n"));
+		}
+		break;
+	}
+	case 52: {
+		struct clusapi_MoveGroupToNode *r2 = (struct clusapi_MoveGroupToNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroupToNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_MoveGroupToNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroupToNode will reply async\n"));
+		}
+		break;
+	}
+	case 53: {
+		struct clusapi_CreateGroupResourceEnum *r2 = (struct clusapi_CreateGroupResourceEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroupResourceEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateGroupResourceEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroupResourceEnum will reply async\n"));
+		}
+		break;
+	}
+	case 54: {
+		struct clusapi_SetGroupNodeList *r2 = (struct clusapi_SetGroupNodeList *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetGroupNodeList, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetGroupNodeList(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetGroupNodeList will reply async\n"));
+		}
+		break;
+	}
+	case 55: {
+		struct clusapi_CreateNotify *r2 = (struct clusapi_CreateNotify *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNotify, NDR_IN, r2);
+		}
+		dcesrv_clusapi_CreateNotify(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNotify will reply async\n"));
+		}
+		break;
+	}
+	case 56: {
+		struct clusapi_CloseNotify *r2 = (struct clusapi_CloseNotify *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNotify, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseNotify(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNotify will reply async\n"));
+		}
+		break;
+	}
+	case 57: {
+		struct clusapi_AddNotifyCluster *r2 = (struct clusapi_AddNotifyCluster *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyCluster, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyCluster(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyCluster will reply async\n"));
+		}
+		break;
+	}
+	case 58: {
+		struct clusapi_AddNotifyNode *r2 = (struct clusapi_AddNotifyNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyNode will reply async\n"));
+		}
+		break;
+	}
+	case 59: {
+		struct clusapi_AddNotifyGroup *r2 = (struct clusapi_AddNotifyGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyGroup will reply async\n"));
+		}
+		break;
+	}
+	case 60: {
+		struct clusapi_AddNotifyResource *r2 = (struct clusapi_AddNotifyResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyResource will reply async\n"));
+		}
+		break;
+	}
+	case 61: {
+		struct clusapi_AddNotifyKey *r2 = (struct clusapi_AddNotifyKey *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyKey, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyKey(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyKey will reply async\n"));
+		}
+		break;
+	}
+	case 62: {
+		struct clusapi_ReAddNotifyNode *r2 = (struct clusapi_ReAddNotifyNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ReAddNotifyNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyNode will reply async\n"));
+		}
+		break;
+	}
+	case 63: {
+		struct clusapi_ReAddNotifyGroup *r2 = (struct clusapi_ReAddNotifyGroup *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyGroup, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ReAddNotifyGroup(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyGroup will reply async\n"));
+		}
+		break;
+	}
+	case 64: {
+		struct clusapi_ReAddNotifyResource *r2 = (struct clusapi_ReAddNotifyResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ReAddNotifyResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyResource will reply async\n"));
+		}
+		break;
+	}
+	case 65: {
+		struct clusapi_GetNotify *r2 = (struct clusapi_GetNotify *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNotify, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNotify(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNotify will reply async\n"));
+		}
+		break;
+	}
+	case 66: {
+		struct clusapi_OpenNode *r2 = (struct clusapi_OpenNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNode, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNode will reply async\n"));
+		}
+		break;
+	}
+	case 67: {
+		struct clusapi_CloseNode *r2 = (struct clusapi_CloseNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNode will reply async\n"));
+		}
+		break;
+	}
+	case 68: {
+		struct clusapi_GetNodeState *r2 = (struct clusapi_GetNodeState *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNodeState, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNodeState(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNodeState will reply async\n"));
+		}
+		break;
+	}
+	case 69: {
+		struct clusapi_PauseNode *r2 = (struct clusapi_PauseNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_PauseNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_PauseNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_PauseNode will reply async\n"));
+		}
+		break;
+	}
+	case 70: {
+		struct clusapi_ResumeNode *r2 = (struct clusapi_ResumeNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResumeNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ResumeNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResumeNode will reply async\n"));
+		}
+		break;
+	}
+	case 71: {
+		struct clusapi_EvictNode *r2 = (struct clusapi_EvictNode *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_EvictNode, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_EvictNode(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_EvictNode will reply async\n"));
+		}
+		break;
+	}
+	case 72: {
+		struct clusapi_NodeResourceControl *r2 = (struct clusapi_NodeResourceControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeResourceControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeResourceControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeResourceControl will reply async\n"));
+		}
+		break;
+	}
+	case 73: {
+		struct clusapi_ResourceControl *r2 = (struct clusapi_ResourceControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResourceControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ResourceControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResourceControl will reply async\n"));
+		}
+		break;
+	}
+	case 74: {
+		struct clusapi_NodeResourceTypeControl *r2 = (struct clusapi_NodeResourceTypeControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeResourceTypeControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeResourceTypeControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeResourceTypeControl will reply async\n"));
+		}
+		break;
+	}
+	case 75: {
+		struct clusapi_ResourceTypeControl *r2 = (struct clusapi_ResourceTypeControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResourceTypeControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ResourceTypeControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResourceTypeControl will reply async\n"));
+		}
+		break;
+	}
+	case 76: {
+		struct clusapi_NodeGroupControl *r2 = (struct clusapi_NodeGroupControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeGroupControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeGroupControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeGroupControl will reply async\n"));
+		}
+		break;
+	}
+	case 77: {
+		struct clusapi_GroupControl *r2 = (struct clusapi_GroupControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GroupControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GroupControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GroupControl will reply async\n"));
+		}
+		break;
+	}
+	case 78: {
+		struct clusapi_NodeNodeControl *r2 = (struct clusapi_NodeNodeControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeNodeControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeNodeControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeNodeControl will reply async\n"));
+		}
+		break;
+	}
+	case 79: {
+		struct clusapi_NodeControl *r2 = (struct clusapi_NodeControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeControl will reply async\n"));
+		}
+		break;
+	}
+	case 80: {
+		struct Opnum80NotUsedOnWire *r2 = (struct Opnum80NotUsedOnWire *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(Opnum80NotUsedOnWire, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_Opnum80NotUsedOnWire(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function Opnum80NotUsedOnWire will reply async\n"));
+		}
+		break;
+	}
+	case 81: {
+		struct clusapi_OpenNetwork *r2 = (struct clusapi_OpenNetwork *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetwork, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenNetwork(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetwork will reply async\n"));
+		}
+		break;
+	}
+	case 82: {
+		struct clusapi_CloseNetwork *r2 = (struct clusapi_CloseNetwork *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNetwork, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseNetwork(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNetwork will reply async\n"));
+		}
+		break;
+	}
+	case 83: {
+		struct clusapi_GetNetworkState *r2 = (struct clusapi_GetNetworkState *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetworkState, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNetworkState(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetworkState will reply async\n"));
+		}
+		break;
+	}
+	case 84: {
+		struct clusapi_SetNetworkName *r2 = (struct clusapi_SetNetworkName *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetNetworkName, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetNetworkName(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetNetworkName will reply async\n"));
+		}
+		break;
+	}
+	case 85: {
+		struct clusapi_CreateNetworkEnum *r2 = (struct clusapi_CreateNetworkEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNetworkEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateNetworkEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNetworkEnum will reply async\n"));
+		}
+		break;
+	}
+	case 86: {
+		struct clusapi_GetNetworkId *r2 = (struct clusapi_GetNetworkId *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetworkId, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNetworkId(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetworkId will reply async\n"));
+		}
+		break;
+	}
+	case 87: {
+		struct clusapi_SetNetworkPriorityOrder *r2 = (struct clusapi_SetNetworkPriorityOrder *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetNetworkPriorityOrder, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetNetworkPriorityOrder(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetNetworkPriorityOrder will reply async\n"));
+		}
+		break;
+	}
+	case 88: {
+		struct clusapi_NodeNetworkControl *r2 = (struct clusapi_NodeNetworkControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeNetworkControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeNetworkControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeNetworkControl will reply async\n"));
+		}
+		break;
+	}
+	case 89: {
+		struct clusapi_NetworkControl *r2 = (struct clusapi_NetworkControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NetworkControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NetworkControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NetworkControl will reply async\n"));
+		}
+		break;
+	}
+	case 90: {
+		struct clusapi_AddNotifyNetwork *r2 = (struct clusapi_AddNotifyNetwork *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyNetwork, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyNetwork(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyNetwork will reply async\n"));
+		}
+		break;
+	}
+	case 91: {
+		struct clusapi_ReAddNotifyNetwork *r2 = (struct clusapi_ReAddNotifyNetwork *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyNetwork, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ReAddNotifyNetwork(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyNetwork will reply async\n"));
+		}
+		break;
+	}
+	case 92: {
+		struct clusapi_OpenNetInterface *r2 = (struct clusapi_OpenNetInterface *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetInterface, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenNetInterface(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetInterface will reply async\n"));
+		}
+		break;
+	}
+	case 93: {
+		struct clusapi_CloseNetInterface *r2 = (struct clusapi_CloseNetInterface *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNetInterface, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseNetInterface(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNetInterface will reply async\n"));
+		}
+		break;
+	}
+	case 94: {
+		struct clusapi_GetNetInterfaceState *r2 = (struct clusapi_GetNetInterfaceState *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetInterfaceState, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNetInterfaceState(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetInterfaceState will reply async\n"));
+		}
+		break;
+	}
+	case 95: {
+		struct clusapi_GetNetInterface *r2 = (struct clusapi_GetNetInterface *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetInterface, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNetInterface(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetInterface will reply async\n"));
+		}
+		break;
+	}
+	case 96: {
+		struct clusapi_GetNetInterfaceId *r2 = (struct clusapi_GetNetInterfaceId *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetInterfaceId, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNetInterfaceId(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetInterfaceId will reply async\n"));
+		}
+		break;
+	}
+	case 97: {
+		struct clusapi_NodeNetInterfaceControl *r2 = (struct clusapi_NodeNetInterfaceControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeNetInterfaceControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeNetInterfaceControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeNetInterfaceControl will reply async\n"));
+		}
+		break;
+	}
+	case 98: {
+		struct clusapi_NetInterfaceControl *r2 = (struct clusapi_NetInterfaceControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NetInterfaceControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NetInterfaceControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NetInterfaceControl will reply async\n"));
+		}
+		break;
+	}
+	case 99: {
+		struct clusapi_AddNotifyNetInterface *r2 = (struct clusapi_AddNotifyNetInterface *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyNetInterface, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyNetInterface(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyNetInterface will reply async\n"));
+		}
+		break;
+	}
+	case 100: {
+		struct clusapi_ReAddNotifyNetInterface *r2 = (struct clusapi_ReAddNotifyNetInterface *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyNetInterface, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ReAddNotifyNetInterface(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyNetInterface will reply async\n"));
+		}
+		break;
+	}
+	case 101: {
+		struct clusapi_CreateNodeEnum *r2 = (struct clusapi_CreateNodeEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNodeEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateNodeEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNodeEnum will reply async\n"));
+		}
+		break;
+	}
+	case 102: {
+		struct clusapi_GetClusterVersion2 *r2 = (struct clusapi_GetClusterVersion2 *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetClusterVersion2, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetClusterVersion2(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetClusterVersion2 will reply async\n"));
+		}
+		break;
+	}
+	case 103: {
+		struct clusapi_CreateResTypeEnum *r2 = (struct clusapi_CreateResTypeEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResTypeEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateResTypeEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResTypeEnum will reply async\n"));
+		}
+		break;
+	}
+	case 104: {
+		struct clusapi_BackupClusterDatabase *r2 = (struct clusapi_BackupClusterDatabase *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_BackupClusterDatabase, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_BackupClusterDatabase(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_BackupClusterDatabase will reply async\n"));
+		}
+		break;
+	}
+	case 105: {
+		struct clusapi_NodeClusterControl *r2 = (struct clusapi_NodeClusterControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeClusterControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_NodeClusterControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeClusterControl will reply async\n"));
+		}
+		break;
+	}
+	case 106: {
+		struct clusapi_ClusterControl *r2 = (struct clusapi_ClusterControl *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ClusterControl, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ClusterControl(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ClusterControl will reply async\n"));
+		}
+		break;
+	}
+	case 107: {
+		struct clusapi_UnblockGetNotifyCall *r2 = (struct clusapi_UnblockGetNotifyCall *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_UnblockGetNotifyCall, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_UnblockGetNotifyCall(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_UnblockGetNotifyCall will reply async\n"));
+		}
+		break;
+	}
+	case 108: {
+		struct clusapi_SetServiceAccountPassword *r2 = (struct clusapi_SetServiceAccountPassword *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetServiceAccountPassword, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetServiceAccountPassword(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetServiceAccountPassword will reply async\n"));
+		}
+		break;
+	}
+	case 109: {
+		struct clusapi_SetResourceDependencyExpression *r2 = (struct clusapi_SetResourceDependencyExpression *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetResourceDependencyExpression, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_SetResourceDependencyExpression(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetResourceDependencyExpression will reply async\n"));
+		}
+		break;
+	}
+	case 110: {
+		struct clusapi_GetResourceDependencyExpression *r2 = (struct clusapi_GetResourceDependencyExpression *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceDependencyExpression, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetResourceDependencyExpression(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceDependencyExpression will reply async\n"));
+		}
+		break;
+	}
+	case 111: {
+		struct Opnum111NotUsedOnWire *r2 = (struct Opnum111NotUsedOnWire *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(Opnum111NotUsedOnWire, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_Opnum111NotUsedOnWire(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function Opnum111NotUsedOnWire will reply async\n"));
+		}
+		break;
+	}
+	case 112: {
+		struct clusapi_GetResourceNetworkName *r2 = (struct clusapi_GetResourceNetworkName *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceNetworkName, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetResourceNetworkName(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceNetworkName will reply async\n"));
+		}
+		break;
+	}
+	case 113: {
+		struct clusapi_ExecuteBatch *r2 = (struct clusapi_ExecuteBatch *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ExecuteBatch, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ExecuteBatch(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ExecuteBatch will reply async\n"));
+		}
+		break;
+	}
+	case 114: {
+		struct clusapi_CreateBatchPort *r2 = (struct clusapi_CreateBatchPort *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateBatchPort, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateBatchPort(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateBatchPort will reply async\n"));
+		}
+		break;
+	}
+	case 115: {
+		struct clusapi_GetBatchNotification *r2 = (struct clusapi_GetBatchNotification *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetBatchNotification, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetBatchNotification(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetBatchNotification will reply async\n"));
+		}
+		break;
+	}
+	case 116: {
+		struct clusapi_CloseBatchPort *r2 = (struct clusapi_CloseBatchPort *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseBatchPort, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CloseBatchPort(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseBatchPort will reply async\n"));
+		}
+		break;
+	}
+	case 117: {
+		struct clusapi_OpenClusterEx *r2 = (struct clusapi_OpenClusterEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenClusterEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenClusterEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenClusterEx will reply async\n"));
+		}
+		break;
+	}
+	case 118: {
+		struct clusapi_OpenNodeEx *r2 = (struct clusapi_OpenNodeEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNodeEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenNodeEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNodeEx will reply async\n"));
+		}
+		break;
+	}
+	case 119: {
+		struct clusapi_OpenGroupEx *r2 = (struct clusapi_OpenGroupEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenGroupEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenGroupEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenGroupEx will reply async\n"));
+		}
+		break;
+	}
+	case 120: {
+		struct clusapi_OpenResourceEx *r2 = (struct clusapi_OpenResourceEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenResourceEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenResourceEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenResourceEx will reply async\n"));
+		}
+		break;
+	}
+	case 121: {
+		struct clusapi_OpenNetworkEx *r2 = (struct clusapi_OpenNetworkEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetworkEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenNetworkEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetworkEx will reply async\n"));
+		}
+		break;
+	}
+	case 122: {
+		struct clusapi_OpenNetInterfaceEx *r2 = (struct clusapi_OpenNetInterfaceEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetInterfaceEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_OpenNetInterfaceEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetInterfaceEx will reply async\n"));
+		}
+		break;
+	}
+	case 123: {
+		struct clusapi_ChangeCsvState *r2 = (struct clusapi_ChangeCsvState *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ChangeCsvState, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ChangeCsvState(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ChangeCsvState will reply async\n"));
+		}
+		break;
+	}
+	case 124: {
+		struct clusapi_CreateNodeEnumEx *r2 = (struct clusapi_CreateNodeEnumEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNodeEnumEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateNodeEnumEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNodeEnumEx will reply async\n"));
+		}
+		break;
+	}
+	case 125: {
+		struct clusapi_CreateEnumEx *r2 = (struct clusapi_CreateEnumEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateEnumEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateEnumEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateEnumEx will reply async\n"));
+		}
+		break;
+	}
+	case 126: {
+		struct clusapi_PauseNodeEx *r2 = (struct clusapi_PauseNodeEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_PauseNodeEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_PauseNodeEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_PauseNodeEx will reply async\n"));
+		}
+		break;
+	}
+	case 127: {
+		struct clusapi_PauseNodeWithDrainTarget *r2 = (struct clusapi_PauseNodeWithDrainTarget *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_PauseNodeWithDrainTarget, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_PauseNodeWithDrainTarget(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_PauseNodeWithDrainTarget will reply async\n"));
+		}
+		break;
+	}
+	case 128: {
+		struct clusapi_ResumeNodeEx *r2 = (struct clusapi_ResumeNodeEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResumeNodeEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ResumeNodeEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResumeNodeEx will reply async\n"));
+		}
+		break;
+	}
+	case 129: {
+		struct clusapi_CreateGroupEx *r2 = (struct clusapi_CreateGroupEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroupEx, NDR_IN, r2);
+		}
+		dcesrv_clusapi_CreateGroupEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroupEx will reply async\n"));
+		}
+		break;
+	}
+	case 130: {
+		struct clusapi_OnlineGroupEx *r2 = (struct clusapi_OnlineGroupEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineGroupEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OnlineGroupEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineGroupEx will reply async\n"));
+		}
+		break;
+	}
+	case 131: {
+		struct clusapi_OfflineGroupEx *r2 = (struct clusapi_OfflineGroupEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineGroupEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OfflineGroupEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineGroupEx will reply async\n"));
+		}
+		break;
+	}
+	case 132: {
+		struct clusapi_MoveGroupEx *r2 = (struct clusapi_MoveGroupEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroupEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_MoveGroupEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroupEx will reply async\n"));
+		}
+		break;
+	}
+	case 133: {
+		struct clusapi_MoveGroupToNodeEx *r2 = (struct clusapi_MoveGroupToNodeEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroupToNodeEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_MoveGroupToNodeEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroupToNodeEx will reply async\n"));
+		}
+		break;
+	}
+	case 134: {
+		struct clusapi_CancelClusterGroupOperation *r2 = (struct clusapi_CancelClusterGroupOperation *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CancelClusterGroupOperation, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CancelClusterGroupOperation(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CancelClusterGroupOperation will reply async\n"));
+		}
+		break;
+	}
+	case 135: {
+		struct clusapi_OnlineResourceEx *r2 = (struct clusapi_OnlineResourceEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineResourceEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OnlineResourceEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineResourceEx will reply async\n"));
+		}
+		break;
+	}
+	case 136: {
+		struct clusapi_OfflineResourceEx *r2 = (struct clusapi_OfflineResourceEx *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineResourceEx, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_OfflineResourceEx(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineResourceEx will reply async\n"));
+		}
+		break;
+	}
+	case 137: {
+		struct clusapi_CreateNotifyV2 *r2 = (struct clusapi_CreateNotifyV2 *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNotifyV2, NDR_IN, r2);
+		}
+		dcesrv_clusapi_CreateNotifyV2(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNotifyV2 will reply async\n"));
+		}
+		break;
+	}
+	case 138: {
+		struct clusapi_AddNotifyV2 *r2 = (struct clusapi_AddNotifyV2 *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyV2, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_AddNotifyV2(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyV2 will reply async\n"));
+		}
+		break;
+	}
+	case 139: {
+		struct clusapi_GetNotifyV2 *r2 = (struct clusapi_GetNotifyV2 *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNotifyV2, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNotifyV2(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNotifyV2 will reply async\n"));
+		}
+		break;
+	}
+	case 140: {
+		struct clusapi_QueryAllValues *r2 = (struct clusapi_QueryAllValues *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_QueryAllValues, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_QueryAllValues(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_QueryAllValues will reply async\n"));
+		}
+		break;
+	}
+	case 141: {
+		struct clusapi_StmFindDisk *r2 = (struct clusapi_StmFindDisk *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_StmFindDisk, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_StmFindDisk(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_StmFindDisk will reply async\n"));
+		}
+		break;
+	}
+	case 142: {
+		struct clusapi_ClusterMrr *r2 = (struct clusapi_ClusterMrr *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ClusterMrr, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ClusterMrr(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ClusterMrr will reply async\n"));
+		}
+		break;
+	}
+	case 143: {
+		struct clusapi_CreateGroupEnum *r2 = (struct clusapi_CreateGroupEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroupEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateGroupEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroupEnum will reply async\n"));
+		}
+		break;
+	}
+	case 144: {
+		struct clusapi_CreateResourceEnum *r2 = (struct clusapi_CreateResourceEnum *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResourceEnum, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_CreateResourceEnum(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResourceEnum will reply async\n"));
+		}
+		break;
+	}
+	case 145: {
+		struct clusapi_ExecuteReadBatch *r2 = (struct clusapi_ExecuteReadBatch *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ExecuteReadBatch, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_ExecuteReadBatch(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ExecuteReadBatch will reply async\n"));
+		}
+		break;
+	}
+	case 146: {
+		struct clusapi_RestartResource *r2 = (struct clusapi_RestartResource *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_RestartResource, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_RestartResource(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_RestartResource will reply async\n"));
+		}
+		break;
+	}
+	case 147: {
+		struct clusapi_GetNotifyAsync *r2 = (struct clusapi_GetNotifyAsync *)r;
+		if (DEBUGLEVEL >= 10) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNotifyAsync, NDR_IN, r2);
+		}
+		r2->out.result = dcesrv_clusapi_GetNotifyAsync(dce_call, mem_ctx, r2);
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNotifyAsync will reply async\n"));
+		}
+		break;
+	}
+
+	default:
+		dce_call->fault_code = DCERPC_FAULT_OP_RNG_ERROR;
+		break;
+	}
+
+	if (dce_call->fault_code != 0) {
+		dcerpc_log_packet(dce_call->conn->packet_log_dir, 
+		          &ndr_table_clusapi, opnum, NDR_IN,
+				  &dce_call->pkt.u.request.stub_and_verifier);
+		return NT_STATUS_NET_WRITE_FAULT;
+	}
+
+	return NT_STATUS_OK;
+}
+
+static NTSTATUS clusapi__op_reply(struct dcesrv_call_state *dce_call, TALLOC_CTX *mem_ctx, void *r)
+{
+	uint16_t opnum = dce_call->pkt.u.request.opnum;
+
+	switch (opnum) {
+	case 0: {
+		struct clusapi_OpenCluster *r2 = (struct clusapi_OpenCluster *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenCluster replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenCluster, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenCluster\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 1: {
+		struct clusapi_CloseCluster *r2 = (struct clusapi_CloseCluster *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseCluster replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseCluster, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseCluster\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 2: {
+		struct clusapi_SetClusterName *r2 = (struct clusapi_SetClusterName *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetClusterName replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetClusterName, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetClusterName\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 3: {
+		struct clusapi_GetClusterName *r2 = (struct clusapi_GetClusterName *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetClusterName replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetClusterName, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetClusterName\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 4: {
+		struct clusapi_GetClusterVersion *r2 = (struct clusapi_GetClusterVersion *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetClusterVersion replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetClusterVersion, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetClusterVersion\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 5: {
+		struct clusapi_GetQuorumResource *r2 = (struct clusapi_GetQuorumResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetQuorumResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetQuorumResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetQuorumResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 6: {
+		struct clusapi_SetQuorumResource *r2 = (struct clusapi_SetQuorumResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetQuorumResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetQuorumResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetQuorumResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 7: {
+		struct clusapi_CreateEnum *r2 = (struct clusapi_CreateEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 8: {
+		struct clusapi_OpenResource *r2 = (struct clusapi_OpenResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 9: {
+		struct clusapi_CreateResource *r2 = (struct clusapi_CreateResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 10: {
+		struct clusapi_DeleteResource *r2 = (struct clusapi_DeleteResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_DeleteResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 11: {
+		struct clusapi_CloseResource *r2 = (struct clusapi_CloseResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 12: {
+		struct clusapi_GetResourceState *r2 = (struct clusapi_GetResourceState *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceState replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceState, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetResourceState\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 13: {
+		struct clusapi_SetResourceName *r2 = (struct clusapi_SetResourceName *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetResourceName replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetResourceName, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetResourceName\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 14: {
+		struct clusapi_GetResourceId *r2 = (struct clusapi_GetResourceId *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceId replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceId, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetResourceId\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 15: {
+		struct clusapi_GetResourceType *r2 = (struct clusapi_GetResourceType *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceType replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceType, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetResourceType\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 16: {
+		struct clusapi_FailResource *r2 = (struct clusapi_FailResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_FailResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_FailResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_FailResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 17: {
+		struct clusapi_OnlineResource *r2 = (struct clusapi_OnlineResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OnlineResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 18: {
+		struct clusapi_OfflineResource *r2 = (struct clusapi_OfflineResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OfflineResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 19: {
+		struct clusapi_AddResourceDependency *r2 = (struct clusapi_AddResourceDependency *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddResourceDependency replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddResourceDependency, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddResourceDependency\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 20: {
+		struct clusapi_RemoveResourceDependency *r2 = (struct clusapi_RemoveResourceDependency *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_RemoveResourceDependency replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_RemoveResourceDependency, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_RemoveResourceDependency\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 21: {
+		struct clusapi_CanResourceBeDependent *r2 = (struct clusapi_CanResourceBeDependent *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CanResourceBeDependent replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CanResourceBeDependent, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CanResourceBeDependent\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 22: {
+		struct clusapi_CreateResEnum *r2 = (struct clusapi_CreateResEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateResEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 23: {
+		struct clusapi_AddResourceNode *r2 = (struct clusapi_AddResourceNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddResourceNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddResourceNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddResourceNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 24: {
+		struct clusapi_RemoveResourceNode *r2 = (struct clusapi_RemoveResourceNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_RemoveResourceNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_RemoveResourceNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_RemoveResourceNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 25: {
+		struct clusapi_ChangeResourceGroup *r2 = (struct clusapi_ChangeResourceGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ChangeResourceGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ChangeResourceGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ChangeResourceGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 26: {
+		struct clusapi_CreateResourceType *r2 = (struct clusapi_CreateResourceType *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResourceType replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResourceType, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateResourceType\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 27: {
+		struct clusapi_DeleteResourceType *r2 = (struct clusapi_DeleteResourceType *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteResourceType replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteResourceType, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_DeleteResourceType\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 28: {
+		struct clusapi_GetRootKey *r2 = (struct clusapi_GetRootKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetRootKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetRootKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetRootKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 29: {
+		struct clusapi_CreateKey *r2 = (struct clusapi_CreateKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 30: {
+		struct clusapi_OpenKey *r2 = (struct clusapi_OpenKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 31: {
+		struct clusapi_EnumKey *r2 = (struct clusapi_EnumKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_EnumKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_EnumKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_EnumKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 32: {
+		struct clusapi_SetValue *r2 = (struct clusapi_SetValue *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetValue replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetValue, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetValue\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 33: {
+		struct clusapi_DeleteValue *r2 = (struct clusapi_DeleteValue *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteValue replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteValue, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_DeleteValue\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 34: {
+		struct clusapi_QueryValue *r2 = (struct clusapi_QueryValue *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_QueryValue replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_QueryValue, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_QueryValue\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 35: {
+		struct clusapi_DeleteKey *r2 = (struct clusapi_DeleteKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_DeleteKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 36: {
+		struct clusapi_EnumValue *r2 = (struct clusapi_EnumValue *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_EnumValue replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_EnumValue, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_EnumValue\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 37: {
+		struct clusapi_CloseKey *r2 = (struct clusapi_CloseKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 38: {
+		struct clusapi_QueryInfoKey *r2 = (struct clusapi_QueryInfoKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_QueryInfoKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_QueryInfoKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_QueryInfoKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 39: {
+		struct clusapi_SetKeySecurity *r2 = (struct clusapi_SetKeySecurity *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetKeySecurity replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetKeySecurity, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetKeySecurity\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 40: {
+		struct clusapi_GetKeySecurity *r2 = (struct clusapi_GetKeySecurity *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetKeySecurity replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetKeySecurity, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetKeySecurity\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 41: {
+		struct clusapi_OpenGroup *r2 = (struct clusapi_OpenGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 42: {
+		struct clusapi_CreateGroup *r2 = (struct clusapi_CreateGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 43: {
+		struct clusapi_DeleteGroup *r2 = (struct clusapi_DeleteGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_DeleteGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_DeleteGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_DeleteGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 44: {
+		struct clusapi_CloseGroup *r2 = (struct clusapi_CloseGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 45: {
+		struct clusapi_GetGroupState *r2 = (struct clusapi_GetGroupState *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetGroupState replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetGroupState, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetGroupState\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 46: {
+		struct clusapi_SetGroupName *r2 = (struct clusapi_SetGroupName *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetGroupName replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetGroupName, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetGroupName\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 47: {
+		struct clusapi_GetGroupId *r2 = (struct clusapi_GetGroupId *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetGroupId replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetGroupId, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetGroupId\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 48: {
+		struct clusapi_GetNodeId *r2 = (struct clusapi_GetNodeId *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNodeId replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNodeId, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNodeId\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 49: {
+		struct clusapi_OnlineGroup *r2 = (struct clusapi_OnlineGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OnlineGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 50: {
+		struct clusapi_OfflineGroup *r2 = (struct clusapi_OfflineGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OfflineGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 51: {
+		struct clusapi_MoveGroup *r2 = (struct clusapi_MoveGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_MoveGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 52: {
+		struct clusapi_MoveGroupToNode *r2 = (struct clusapi_MoveGroupToNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroupToNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroupToNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_MoveGroupToNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 53: {
+		struct clusapi_CreateGroupResourceEnum *r2 = (struct clusapi_CreateGroupResourceEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroupResourceEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroupResourceEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateGroupResourceEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 54: {
+		struct clusapi_SetGroupNodeList *r2 = (struct clusapi_SetGroupNodeList *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetGroupNodeList replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetGroupNodeList, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetGroupNodeList\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 55: {
+		struct clusapi_CreateNotify *r2 = (struct clusapi_CreateNotify *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNotify replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNotify, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateNotify\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 56: {
+		struct clusapi_CloseNotify *r2 = (struct clusapi_CloseNotify *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNotify replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNotify, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseNotify\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 57: {
+		struct clusapi_AddNotifyCluster *r2 = (struct clusapi_AddNotifyCluster *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyCluster replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyCluster, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyCluster\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 58: {
+		struct clusapi_AddNotifyNode *r2 = (struct clusapi_AddNotifyNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 59: {
+		struct clusapi_AddNotifyGroup *r2 = (struct clusapi_AddNotifyGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 60: {
+		struct clusapi_AddNotifyResource *r2 = (struct clusapi_AddNotifyResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 61: {
+		struct clusapi_AddNotifyKey *r2 = (struct clusapi_AddNotifyKey *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyKey replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyKey, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyKey\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 62: {
+		struct clusapi_ReAddNotifyNode *r2 = (struct clusapi_ReAddNotifyNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ReAddNotifyNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 63: {
+		struct clusapi_ReAddNotifyGroup *r2 = (struct clusapi_ReAddNotifyGroup *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyGroup replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyGroup, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ReAddNotifyGroup\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 64: {
+		struct clusapi_ReAddNotifyResource *r2 = (struct clusapi_ReAddNotifyResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ReAddNotifyResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 65: {
+		struct clusapi_GetNotify *r2 = (struct clusapi_GetNotify *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNotify replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNotify, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNotify\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 66: {
+		struct clusapi_OpenNode *r2 = (struct clusapi_OpenNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 67: {
+		struct clusapi_CloseNode *r2 = (struct clusapi_CloseNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 68: {
+		struct clusapi_GetNodeState *r2 = (struct clusapi_GetNodeState *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNodeState replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNodeState, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNodeState\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 69: {
+		struct clusapi_PauseNode *r2 = (struct clusapi_PauseNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_PauseNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_PauseNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_PauseNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 70: {
+		struct clusapi_ResumeNode *r2 = (struct clusapi_ResumeNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResumeNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResumeNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ResumeNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 71: {
+		struct clusapi_EvictNode *r2 = (struct clusapi_EvictNode *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_EvictNode replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_EvictNode, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_EvictNode\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 72: {
+		struct clusapi_NodeResourceControl *r2 = (struct clusapi_NodeResourceControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeResourceControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeResourceControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeResourceControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 73: {
+		struct clusapi_ResourceControl *r2 = (struct clusapi_ResourceControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResourceControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResourceControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ResourceControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 74: {
+		struct clusapi_NodeResourceTypeControl *r2 = (struct clusapi_NodeResourceTypeControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeResourceTypeControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeResourceTypeControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeResourceTypeControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 75: {
+		struct clusapi_ResourceTypeControl *r2 = (struct clusapi_ResourceTypeControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResourceTypeControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResourceTypeControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ResourceTypeControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 76: {
+		struct clusapi_NodeGroupControl *r2 = (struct clusapi_NodeGroupControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeGroupControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeGroupControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeGroupControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 77: {
+		struct clusapi_GroupControl *r2 = (struct clusapi_GroupControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GroupControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GroupControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GroupControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 78: {
+		struct clusapi_NodeNodeControl *r2 = (struct clusapi_NodeNodeControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeNodeControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeNodeControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeNodeControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 79: {
+		struct clusapi_NodeControl *r2 = (struct clusapi_NodeControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 80: {
+		struct Opnum80NotUsedOnWire *r2 = (struct Opnum80NotUsedOnWire *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function Opnum80NotUsedOnWire replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(Opnum80NotUsedOnWire, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in Opnum80NotUsedOnWire\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 81: {
+		struct clusapi_OpenNetwork *r2 = (struct clusapi_OpenNetwork *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetwork replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetwork, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenNetwork\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 82: {
+		struct clusapi_CloseNetwork *r2 = (struct clusapi_CloseNetwork *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNetwork replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNetwork, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseNetwork\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 83: {
+		struct clusapi_GetNetworkState *r2 = (struct clusapi_GetNetworkState *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetworkState replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetworkState, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNetworkState\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 84: {
+		struct clusapi_SetNetworkName *r2 = (struct clusapi_SetNetworkName *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetNetworkName replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetNetworkName, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetNetworkName\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 85: {
+		struct clusapi_CreateNetworkEnum *r2 = (struct clusapi_CreateNetworkEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNetworkEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNetworkEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateNetworkEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 86: {
+		struct clusapi_GetNetworkId *r2 = (struct clusapi_GetNetworkId *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetworkId replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetworkId, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNetworkId\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 87: {
+		struct clusapi_SetNetworkPriorityOrder *r2 = (struct clusapi_SetNetworkPriorityOrder *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetNetworkPriorityOrder replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetNetworkPriorityOrder, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetNetworkPriorityOrder\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 88: {
+		struct clusapi_NodeNetworkControl *r2 = (struct clusapi_NodeNetworkControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeNetworkControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeNetworkControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeNetworkControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 89: {
+		struct clusapi_NetworkControl *r2 = (struct clusapi_NetworkControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NetworkControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NetworkControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NetworkControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 90: {
+		struct clusapi_AddNotifyNetwork *r2 = (struct clusapi_AddNotifyNetwork *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyNetwork replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyNetwork, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyNetwork\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 91: {
+		struct clusapi_ReAddNotifyNetwork *r2 = (struct clusapi_ReAddNotifyNetwork *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyNetwork replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyNetwork, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ReAddNotifyNetwork\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 92: {
+		struct clusapi_OpenNetInterface *r2 = (struct clusapi_OpenNetInterface *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetInterface replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetInterface, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenNetInterface\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 93: {
+		struct clusapi_CloseNetInterface *r2 = (struct clusapi_CloseNetInterface *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseNetInterface replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseNetInterface, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseNetInterface\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 94: {
+		struct clusapi_GetNetInterfaceState *r2 = (struct clusapi_GetNetInterfaceState *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetInterfaceState replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetInterfaceState, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNetInterfaceState\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 95: {
+		struct clusapi_GetNetInterface *r2 = (struct clusapi_GetNetInterface *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetInterface replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetInterface, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNetInterface\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 96: {
+		struct clusapi_GetNetInterfaceId *r2 = (struct clusapi_GetNetInterfaceId *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNetInterfaceId replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNetInterfaceId, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNetInterfaceId\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 97: {
+		struct clusapi_NodeNetInterfaceControl *r2 = (struct clusapi_NodeNetInterfaceControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeNetInterfaceControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeNetInterfaceControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeNetInterfaceControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 98: {
+		struct clusapi_NetInterfaceControl *r2 = (struct clusapi_NetInterfaceControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NetInterfaceControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NetInterfaceControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NetInterfaceControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 99: {
+		struct clusapi_AddNotifyNetInterface *r2 = (struct clusapi_AddNotifyNetInterface *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyNetInterface replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyNetInterface, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyNetInterface\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 100: {
+		struct clusapi_ReAddNotifyNetInterface *r2 = (struct clusapi_ReAddNotifyNetInterface *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ReAddNotifyNetInterface replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ReAddNotifyNetInterface, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ReAddNotifyNetInterface\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 101: {
+		struct clusapi_CreateNodeEnum *r2 = (struct clusapi_CreateNodeEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNodeEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNodeEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateNodeEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 102: {
+		struct clusapi_GetClusterVersion2 *r2 = (struct clusapi_GetClusterVersion2 *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetClusterVersion2 replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetClusterVersion2, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetClusterVersion2\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 103: {
+		struct clusapi_CreateResTypeEnum *r2 = (struct clusapi_CreateResTypeEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResTypeEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResTypeEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateResTypeEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 104: {
+		struct clusapi_BackupClusterDatabase *r2 = (struct clusapi_BackupClusterDatabase *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_BackupClusterDatabase replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_BackupClusterDatabase, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_BackupClusterDatabase\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 105: {
+		struct clusapi_NodeClusterControl *r2 = (struct clusapi_NodeClusterControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_NodeClusterControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_NodeClusterControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_NodeClusterControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 106: {
+		struct clusapi_ClusterControl *r2 = (struct clusapi_ClusterControl *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ClusterControl replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ClusterControl, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ClusterControl\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 107: {
+		struct clusapi_UnblockGetNotifyCall *r2 = (struct clusapi_UnblockGetNotifyCall *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_UnblockGetNotifyCall replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_UnblockGetNotifyCall, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_UnblockGetNotifyCall\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 108: {
+		struct clusapi_SetServiceAccountPassword *r2 = (struct clusapi_SetServiceAccountPassword *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetServiceAccountPassword replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetServiceAccountPassword, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetServiceAccountPassword\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 109: {
+		struct clusapi_SetResourceDependencyExpression *r2 = (struct clusapi_SetResourceDependencyExpression *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_SetResourceDependencyExpression replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_SetResourceDependencyExpression, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_SetResourceDependencyExpression\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 110: {
+		struct clusapi_GetResourceDependencyExpression *r2 = (struct clusapi_GetResourceDependencyExpression *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceDependencyExpression replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceDependencyExpression, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetResourceDependencyExpression\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 111: {
+		struct Opnum111NotUsedOnWire *r2 = (struct Opnum111NotUsedOnWire *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function Opnum111NotUsedOnWire replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(Opnum111NotUsedOnWire, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in Opnum111NotUsedOnWire\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 112: {
+		struct clusapi_GetResourceNetworkName *r2 = (struct clusapi_GetResourceNetworkName *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetResourceNetworkName replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetResourceNetworkName, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetResourceNetworkName\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 113: {
+		struct clusapi_ExecuteBatch *r2 = (struct clusapi_ExecuteBatch *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ExecuteBatch replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ExecuteBatch, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ExecuteBatch\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 114: {
+		struct clusapi_CreateBatchPort *r2 = (struct clusapi_CreateBatchPort *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateBatchPort replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateBatchPort, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateBatchPort\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 115: {
+		struct clusapi_GetBatchNotification *r2 = (struct clusapi_GetBatchNotification *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetBatchNotification replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetBatchNotification, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetBatchNotification\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 116: {
+		struct clusapi_CloseBatchPort *r2 = (struct clusapi_CloseBatchPort *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CloseBatchPort replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CloseBatchPort, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CloseBatchPort\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 117: {
+		struct clusapi_OpenClusterEx *r2 = (struct clusapi_OpenClusterEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenClusterEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenClusterEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenClusterEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 118: {
+		struct clusapi_OpenNodeEx *r2 = (struct clusapi_OpenNodeEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNodeEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNodeEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenNodeEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 119: {
+		struct clusapi_OpenGroupEx *r2 = (struct clusapi_OpenGroupEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenGroupEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenGroupEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenGroupEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 120: {
+		struct clusapi_OpenResourceEx *r2 = (struct clusapi_OpenResourceEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenResourceEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenResourceEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenResourceEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 121: {
+		struct clusapi_OpenNetworkEx *r2 = (struct clusapi_OpenNetworkEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetworkEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetworkEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenNetworkEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 122: {
+		struct clusapi_OpenNetInterfaceEx *r2 = (struct clusapi_OpenNetInterfaceEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OpenNetInterfaceEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OpenNetInterfaceEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OpenNetInterfaceEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 123: {
+		struct clusapi_ChangeCsvState *r2 = (struct clusapi_ChangeCsvState *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ChangeCsvState replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ChangeCsvState, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ChangeCsvState\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 124: {
+		struct clusapi_CreateNodeEnumEx *r2 = (struct clusapi_CreateNodeEnumEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNodeEnumEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNodeEnumEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateNodeEnumEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 125: {
+		struct clusapi_CreateEnumEx *r2 = (struct clusapi_CreateEnumEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateEnumEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateEnumEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateEnumEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 126: {
+		struct clusapi_PauseNodeEx *r2 = (struct clusapi_PauseNodeEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_PauseNodeEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_PauseNodeEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_PauseNodeEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 127: {
+		struct clusapi_PauseNodeWithDrainTarget *r2 = (struct clusapi_PauseNodeWithDrainTarget *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_PauseNodeWithDrainTarget replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_PauseNodeWithDrainTarget, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_PauseNodeWithDrainTarget\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 128: {
+		struct clusapi_ResumeNodeEx *r2 = (struct clusapi_ResumeNodeEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ResumeNodeEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ResumeNodeEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ResumeNodeEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 129: {
+		struct clusapi_CreateGroupEx *r2 = (struct clusapi_CreateGroupEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroupEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroupEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateGroupEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 130: {
+		struct clusapi_OnlineGroupEx *r2 = (struct clusapi_OnlineGroupEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineGroupEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineGroupEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OnlineGroupEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 131: {
+		struct clusapi_OfflineGroupEx *r2 = (struct clusapi_OfflineGroupEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineGroupEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineGroupEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OfflineGroupEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 132: {
+		struct clusapi_MoveGroupEx *r2 = (struct clusapi_MoveGroupEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroupEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroupEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_MoveGroupEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 133: {
+		struct clusapi_MoveGroupToNodeEx *r2 = (struct clusapi_MoveGroupToNodeEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_MoveGroupToNodeEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_MoveGroupToNodeEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_MoveGroupToNodeEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 134: {
+		struct clusapi_CancelClusterGroupOperation *r2 = (struct clusapi_CancelClusterGroupOperation *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CancelClusterGroupOperation replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CancelClusterGroupOperation, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CancelClusterGroupOperation\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 135: {
+		struct clusapi_OnlineResourceEx *r2 = (struct clusapi_OnlineResourceEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OnlineResourceEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OnlineResourceEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OnlineResourceEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 136: {
+		struct clusapi_OfflineResourceEx *r2 = (struct clusapi_OfflineResourceEx *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_OfflineResourceEx replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_OfflineResourceEx, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_OfflineResourceEx\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 137: {
+		struct clusapi_CreateNotifyV2 *r2 = (struct clusapi_CreateNotifyV2 *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateNotifyV2 replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateNotifyV2, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateNotifyV2\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 138: {
+		struct clusapi_AddNotifyV2 *r2 = (struct clusapi_AddNotifyV2 *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_AddNotifyV2 replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_AddNotifyV2, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_AddNotifyV2\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 139: {
+		struct clusapi_GetNotifyV2 *r2 = (struct clusapi_GetNotifyV2 *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNotifyV2 replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNotifyV2, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNotifyV2\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 140: {
+		struct clusapi_QueryAllValues *r2 = (struct clusapi_QueryAllValues *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_QueryAllValues replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_QueryAllValues, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_QueryAllValues\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 141: {
+		struct clusapi_StmFindDisk *r2 = (struct clusapi_StmFindDisk *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_StmFindDisk replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_StmFindDisk, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_StmFindDisk\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 142: {
+		struct clusapi_ClusterMrr *r2 = (struct clusapi_ClusterMrr *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ClusterMrr replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ClusterMrr, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ClusterMrr\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 143: {
+		struct clusapi_CreateGroupEnum *r2 = (struct clusapi_CreateGroupEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateGroupEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateGroupEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateGroupEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 144: {
+		struct clusapi_CreateResourceEnum *r2 = (struct clusapi_CreateResourceEnum *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_CreateResourceEnum replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_CreateResourceEnum, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_CreateResourceEnum\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 145: {
+		struct clusapi_ExecuteReadBatch *r2 = (struct clusapi_ExecuteReadBatch *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_ExecuteReadBatch replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_ExecuteReadBatch, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_ExecuteReadBatch\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 146: {
+		struct clusapi_RestartResource *r2 = (struct clusapi_RestartResource *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_RestartResource replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_RestartResource, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_RestartResource\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+	case 147: {
+		struct clusapi_GetNotifyAsync *r2 = (struct clusapi_GetNotifyAsync *)r;
+		if (dce_call->state_flags & DCESRV_CALL_STATE_FLAG_ASYNC) {
+			DEBUG(5,("function clusapi_GetNotifyAsync replied async\n"));
+		}
+		if (DEBUGLEVEL >= 10 && dce_call->fault_code == 0) {
+			NDR_PRINT_FUNCTION_DEBUG(clusapi_GetNotifyAsync, NDR_OUT | NDR_SET_VALUES, r2);
+		}
+		if (dce_call->fault_code != 0) {
+			DEBUG(2,("dcerpc_fault %s in clusapi_GetNotifyAsync\n", dcerpc_errstr(mem_ctx, dce_call->fault_code)));
+		}
+		break;
+	}
+
+	default:
+		dce_call->fault_code = DCERPC_FAULT_OP_RNG_ERROR;
+		break;
+	}
+
+	if (dce_call->fault_code != 0) {
+		dcerpc_log_packet(dce_call->conn->packet_log_dir,
+		          &ndr_table_clusapi, opnum, NDR_IN,
+				  &dce_call->pkt.u.request.stub_and_verifier);
+		return NT_STATUS_NET_WRITE_FAULT;
+	}
+
+	return NT_STATUS_OK;
+}
+
+static NTSTATUS clusapi__op_ndr_push(struct dcesrv_call_state *dce_call, TALLOC_CTX *mem_ctx, struct ndr_push *push, const void *r)
+{
+	enum ndr_err_code ndr_err;
+	uint16_t opnum = dce_call->pkt.u.request.opnum;
+
+	ndr_err = ndr_table_clusapi.calls[opnum].ndr_push(push, NDR_OUT, r);
+	if (!NDR_ERR_CODE_IS_SUCCESS(ndr_err)) {
+		dce_call->fault_code = DCERPC_FAULT_NDR;
+		return NT_STATUS_NET_WRITE_FAULT;
+	}
+
+	return NT_STATUS_OK;
+}
+
+const struct dcesrv_interface dcesrv_clusapi_interface = {
+	.name		= "clusapi",
+	.syntax_id  = {{0xb97db8b2,0x4c63,0x11cf,{0xbf,0xf6},{0x08,0x00,0x2b,0xe2,0x3f,0x2f}},3.0},
+	.bind		= clusapi__op_bind,
+	.unbind		= clusapi__op_unbind,
+	.ndr_pull	= clusapi__op_ndr_pull,
+	.dispatch	= clusapi__op_dispatch,
+	.reply		= clusapi__op_reply,
+	.ndr_push	= clusapi__op_ndr_push
+};
+
+
+static NTSTATUS clusapi__op_init_server(struct dcesrv_context *dce_ctx, const struct dcesrv_endpoint_server *ep_server)
+{
+	int i;
+
+	for (i=0;i<ndr_table_clusapi.endpoints->count;i++) {
+		NTSTATUS ret;
+		const char *name = ndr_table_clusapi.endpoints->names[i];
+
+		ret = dcesrv_interface_register(dce_ctx, name, &dcesrv_clusapi_interface, NULL);
+		if (!NT_STATUS_IS_OK(ret)) {
+			DEBUG(1,("clusapi_op_init_server: failed to register endpoint '%s'\n",name));
+			return ret;
+		}
+	}
+
+	return NT_STATUS_OK;
+}
+
+static bool clusapi__op_interface_by_uuid(struct dcesrv_interface *iface, const struct GUID *uuid, uint32_t if_version)
+{
+	if (dcesrv_clusapi_interface.syntax_id.if_version == if_version &&
+		GUID_equal(&dcesrv_clusapi_interface.syntax_id.uuid, uuid)) {
+		memcpy(iface,&dcesrv_clusapi_interface, sizeof(*iface));
+		return true;
+	}
+
+	return false;
+}
+
+static bool clusapi__op_interface_by_name(struct dcesrv_interface *iface, const char *name)
+{
+	if (strcmp(dcesrv_clusapi_interface.name, name)==0) {
+		memcpy(iface, &dcesrv_clusapi_interface, sizeof(*iface));
+		return true;
+	}
+
+	return false;
+}
+
+NTSTATUS dcerpc_server_clusapi_init(void)
+{
+	NTSTATUS ret;
+	struct dcesrv_endpoint_server ep_server;
+
+	/* fill in our name */
+	ep_server.name = "clusapi";
+
+	/* fill in all the operations */
+	ep_server.init_server = clusapi__op_init_server;
+
+	ep_server.interface_by_uuid = clusapi__op_interface_by_uuid;
+	ep_server.interface_by_name = clusapi__op_interface_by_name;
+
+	/* register ourselves with the DCERPC subsystem. */
+	ret = dcerpc_register_ep_server(&ep_server);
+
+	if (!NT_STATUS_IS_OK(ret)) {
+		DEBUG(0,("Failed to register 'clusapi' endpoint server!\n"));
+		return ret;
+	}
+
+	return ret;
+}
+
@@ -0,0 +1,12 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_dsbackup.h"
+#include "bin/default/librpc/gen_ndr/ndr_dsbackup_c.h"
+
+/* ad_backup - client functions generated by pidl */
+
+/* ad_restore - client functions generated by pidl */
+
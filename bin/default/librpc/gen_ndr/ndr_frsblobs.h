@@ -0,0 +1,24 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/frsblobs.h"
+
+#ifndef _HEADER_NDR_frsblobs
+#define _HEADER_NDR_frsblobs
+
+#define NDR_FRSBLOBS_UUID "12345777-1234-abcd-0001-00000004"
+#define NDR_FRSBLOBS_VERSION 0.0
+#define NDR_FRSBLOBS_NAME "frsblobs"
+#define NDR_FRSBLOBS_HELPSTRING "bkup blobs"
+extern const struct ndr_interface_table ndr_table_frsblobs;
+#define NDR_DECODE_NT_BACKUP_FILE (0x00)
+
+#define NDR_DECODE_FRSRPC_STAGEHEADER (0x01)
+
+#define NDR_DECODE_FILENETWORKOPENINFORMATION (0x02)
+
+#define NDR_FRSBLOBS_CALL_COUNT (3)
+void ndr_print_decode_nt_backup_file(struct ndr_print *ndr, const char *name, int flags, const struct decode_nt_backup_file *r);
+void ndr_print_decode_frsrpc_StageHeader(struct ndr_print *ndr, const char *name, int flags, const struct decode_frsrpc_StageHeader *r);
+void ndr_print_decode_FileNetworkOpenInformation(struct ndr_print *ndr, const char *name, int flags, const struct decode_FileNetworkOpenInformation *r);
+#endif /* _HEADER_NDR_frsblobs */
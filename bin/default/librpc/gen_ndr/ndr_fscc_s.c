@@ -0,0 +1,6 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_fscc.h"
+#include <util/debug.h>
+
+NTSTATUS dcerpc_server_fscc_init(void);
+
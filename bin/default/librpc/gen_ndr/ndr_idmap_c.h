@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/idmap.h"
+#ifndef _HEADER_RPC_idmap
+#define _HEADER_RPC_idmap
+
+#endif /* _HEADER_RPC_idmap */
@@ -0,0 +1,216 @@
+/* client functions auto-generated by pidl */
+
+#include "includes.h"
+#include <tevent.h>
+#include "lib/util/tevent_ntstatus.h"
+#include "bin/default/librpc/gen_ndr/ndr_nfs4acl.h"
+#include "bin/default/librpc/gen_ndr/ndr_nfs4acl_c.h"
+
+/* nfs4acl - client functions generated by pidl */
+
+struct dcerpc_nfs4acl_test_r_state {
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_nfs4acl_test_r_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_nfs4acl_test_r_send(TALLOC_CTX *mem_ctx,
+	struct tevent_context *ev,
+	struct dcerpc_binding_handle *h,
+	struct nfs4acl_test *r)
+{
+	struct tevent_req *req;
+	struct dcerpc_nfs4acl_test_r_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_nfs4acl_test_r_state);
+	if (req == NULL) {
+		return NULL;
+	}
+
+	state->out_mem_ctx = NULL;
+
+	subreq = dcerpc_binding_handle_call_send(state, ev, h,
+			NULL, &ndr_table_nfs4acl,
+			NDR_NFS4ACL_TEST, state, r);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_nfs4acl_test_r_done, req);
+
+	return req;
+}
+
+static void dcerpc_nfs4acl_test_r_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req =
+		tevent_req_callback_data(subreq,
+		struct tevent_req);
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call_recv(subreq);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_nfs4acl_test_r_recv(struct tevent_req *req, TALLOC_CTX *mem_ctx)
+{
+	struct dcerpc_nfs4acl_test_r_state *state =
+		tevent_req_data(req,
+		struct dcerpc_nfs4acl_test_r_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_nfs4acl_test_r(struct dcerpc_binding_handle *h, TALLOC_CTX *mem_ctx, struct nfs4acl_test *r)
+{
+	NTSTATUS status;
+
+	status = dcerpc_binding_handle_call(h,
+			NULL, &ndr_table_nfs4acl,
+			NDR_NFS4ACL_TEST, mem_ctx, r);
+
+	return status;
+}
+
+struct dcerpc_nfs4acl_test_state {
+	struct nfs4acl_test orig;
+	struct nfs4acl_test tmp;
+	TALLOC_CTX *out_mem_ctx;
+};
+
+static void dcerpc_nfs4acl_test_done(struct tevent_req *subreq);
+
+struct tevent_req *dcerpc_nfs4acl_test_send(TALLOC_CTX *mem_ctx,
+					    struct tevent_context *ev,
+					    struct dcerpc_binding_handle *h,
+					    struct nfs4acl _acl /* [in]  */)
+{
+	struct tevent_req *req;
+	struct dcerpc_nfs4acl_test_state *state;
+	struct tevent_req *subreq;
+
+	req = tevent_req_create(mem_ctx, &state,
+				struct dcerpc_nfs4acl_test_state);
+	if (req == NULL) {
+		return NULL;
+	}
+	state->out_mem_ctx = NULL;
+
+	/* In parameters */
+	state->orig.in.acl = _acl;
+
+	/* Out parameters */
+
+	/* Result */
+	ZERO_STRUCT(state->orig.out.result);
+
+	/* make a temporary copy, that we pass to the dispatch function */
+	state->tmp = state->orig;
+
+	subreq = dcerpc_nfs4acl_test_r_send(state, ev, h, &state->tmp);
+	if (tevent_req_nomem(subreq, req)) {
+		return tevent_req_post(req, ev);
+	}
+	tevent_req_set_callback(subreq, dcerpc_nfs4acl_test_done, req);
+	return req;
+}
+
+static void dcerpc_nfs4acl_test_done(struct tevent_req *subreq)
+{
+	struct tevent_req *req = tevent_req_callback_data(
+		subreq, struct tevent_req);
+	struct dcerpc_nfs4acl_test_state *state = tevent_req_data(
+		req, struct dcerpc_nfs4acl_test_state);
+	NTSTATUS status;
+	TALLOC_CTX *mem_ctx;
+
+	if (state->out_mem_ctx) {
+		mem_ctx = state->out_mem_ctx;
+	} else {
+		mem_ctx = state;
+	}
+
+	status = dcerpc_nfs4acl_test_r_recv(subreq, mem_ctx);
+	TALLOC_FREE(subreq);
+	if (tevent_req_nterror(req, status)) {
+		return;
+	}
+
+	/* Copy out parameters */
+
+	/* Copy result */
+	state->orig.out.result = state->tmp.out.result;
+
+	/* Reset temporary structure */
+	ZERO_STRUCT(state->tmp);
+
+	tevent_req_done(req);
+}
+
+NTSTATUS dcerpc_nfs4acl_test_recv(struct tevent_req *req,
+				  TALLOC_CTX *mem_ctx,
+				  NTSTATUS *result)
+{
+	struct dcerpc_nfs4acl_test_state *state = tevent_req_data(
+		req, struct dcerpc_nfs4acl_test_state);
+	NTSTATUS status;
+
+	if (tevent_req_is_nterror(req, &status)) {
+		tevent_req_received(req);
+		return status;
+	}
+
+	/* Steal possible out parameters to the callers context */
+	talloc_steal(mem_ctx, state->out_mem_ctx);
+
+	/* Return result */
+	*result = state->orig.out.result;
+
+	tevent_req_received(req);
+	return NT_STATUS_OK;
+}
+
+NTSTATUS dcerpc_nfs4acl_test(struct dcerpc_binding_handle *h,
+			     TALLOC_CTX *mem_ctx,
+			     struct nfs4acl _acl /* [in]  */,
+			     NTSTATUS *result)
+{
+	struct nfs4acl_test r;
+	NTSTATUS status;
+
+	/* In parameters */
+	r.in.acl = _acl;
+
+	/* Out parameters */
+
+	/* Result */
+	ZERO_STRUCT(r.out.result);
+
+	status = dcerpc_nfs4acl_test_r(h, mem_ctx, &r);
+	if (!NT_STATUS_IS_OK(status)) {
+		return status;
+	}
+
+	/* Return variables */
+
+	/* Return result */
+	*result = r.out.result;
+
+	return NT_STATUS_OK;
+}
+
@@ -0,0 +1,8 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/policyagent.h"
+#ifndef _HEADER_RPC_policyagent
+#define _HEADER_RPC_policyagent
+
+extern const struct ndr_interface_table ndr_table_policyagent;
+
+#endif /* _HEADER_RPC_policyagent */
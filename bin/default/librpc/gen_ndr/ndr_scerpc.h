@@ -0,0 +1,18 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/scerpc.h"
+
+#ifndef _HEADER_NDR_scerpc
+#define _HEADER_NDR_scerpc
+
+#define NDR_SCERPC_UUID "93149ca2-973b-11d1-8c39-00c04fb984f9"
+#define NDR_SCERPC_VERSION 0.0
+#define NDR_SCERPC_NAME "scerpc"
+#define NDR_SCERPC_HELPSTRING "Security Configuration Editor"
+extern const struct ndr_interface_table ndr_table_scerpc;
+#define NDR_SCERPC_UNKNOWN0 (0x00)
+
+#define NDR_SCERPC_CALL_COUNT (1)
+void ndr_print_scerpc_Unknown0(struct ndr_print *ndr, const char *name, int flags, const struct scerpc_Unknown0 *r);
+#endif /* _HEADER_NDR_scerpc */
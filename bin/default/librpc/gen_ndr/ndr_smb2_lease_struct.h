@@ -0,0 +1,19 @@
+/* header auto-generated by pidl */
+
+#include "librpc/ndr/libndr.h"
+#include "bin/default/librpc/gen_ndr/smb2_lease_struct.h"
+
+#ifndef _HEADER_NDR_smb2_lease_struct
+#define _HEADER_NDR_smb2_lease_struct
+
+#define NDR_SMB2_LEASE_STRUCT_CALL_COUNT (0)
+enum ndr_err_code ndr_push_smb2_lease_key(struct ndr_push *ndr, int ndr_flags, const struct smb2_lease_key *r);
+enum ndr_err_code ndr_pull_smb2_lease_key(struct ndr_pull *ndr, int ndr_flags, struct smb2_lease_key *r);
+void ndr_print_smb2_lease_key(struct ndr_print *ndr, const char *name, const struct smb2_lease_key *r);
+enum ndr_err_code ndr_push_smb2_lease_state(struct ndr_push *ndr, int ndr_flags, uint32_t r);
+enum ndr_err_code ndr_pull_smb2_lease_state(struct ndr_pull *ndr, int ndr_flags, uint32_t *r);
+void ndr_print_smb2_lease_state(struct ndr_print *ndr, const char *name, uint32_t r);
+enum ndr_err_code ndr_push_smb2_lease(struct ndr_push *ndr, int ndr_flags, const struct smb2_lease *r);
+enum ndr_err_code ndr_pull_smb2_lease(struct ndr_pull *ndr, int ndr_flags, struct smb2_lease *r);
+void ndr_print_smb2_lease(struct ndr_print *ndr, const char *name, const struct smb2_lease *r);
+#endif /* _HEADER_NDR_smb2_lease_struct */
@@ -0,0 +1,6 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_smb2_lease_struct.h"
+#include <util/debug.h>
+
+NTSTATUS dcerpc_server_smb2_lease_struct_init(void);
+
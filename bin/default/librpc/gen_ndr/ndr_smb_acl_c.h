@@ -0,0 +1,6 @@
+#include "librpc/rpc/dcerpc.h"
+#include "bin/default/librpc/gen_ndr/smb_acl.h"
+#ifndef _HEADER_RPC_smb_acl
+#define _HEADER_RPC_smb_acl
+
+#endif /* _HEADER_RPC_smb_acl */
@@ -0,0 +1,6 @@
+/* server functions auto-generated by pidl */
+#include "bin/default/librpc/gen_ndr/ndr_smb_acl.h"
+#include <util/debug.h>
+
+NTSTATUS dcerpc_server_smb_acl_init(void);
+
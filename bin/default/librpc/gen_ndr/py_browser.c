@@ -0,0 +1,797 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_browser.h"
+#include "bin/default/librpc/gen_ndr/ndr_browser_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/srvsvc.h"
+static PyTypeObject BrowserrSrvInfo100Ctr_Type;
+static PyTypeObject BrowserrSrvInfo101Ctr_Type;
+PyObject *py_import_BrowserrSrvInfoUnion(TALLOC_CTX *mem_ctx, int level, union BrowserrSrvInfoUnion *in);
+union BrowserrSrvInfoUnion *py_export_BrowserrSrvInfoUnion(TALLOC_CTX *mem_ctx, int level, PyObject *in);
+static PyTypeObject BrowserrSrvInfo_Type;
+static PyTypeObject browser_InterfaceType;
+
+void initbrowser(void);static PyTypeObject *srvsvc_NetSrvInfo100_Type;
+static PyTypeObject *BaseObject_Type;
+static PyTypeObject *srvsvc_NetSrvInfo101_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static PyObject *py_BrowserrSrvInfo100Ctr_get_entries_read(PyObject *obj, void *closure)
+{
+	struct BrowserrSrvInfo100Ctr *object = (struct BrowserrSrvInfo100Ctr *)pytalloc_get_ptr(obj);
+	PyObject *py_entries_read;
+	py_entries_read = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->entries_read);
+	return py_entries_read;
+}
+
+static int py_BrowserrSrvInfo100Ctr_set_entries_read(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct BrowserrSrvInfo100Ctr *object = (struct BrowserrSrvInfo100Ctr *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->entries_read");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->entries_read));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->entries_read = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->entries_read = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_BrowserrSrvInfo100Ctr_get_entries(PyObject *obj, void *closure)
+{
+	struct BrowserrSrvInfo100Ctr *object = (struct BrowserrSrvInfo100Ctr *)pytalloc_get_ptr(obj);
+	PyObject *py_entries;
+	if (object->entries == NULL) {
+		py_entries = Py_None;
+		Py_INCREF(py_entries);
+	} else {
+		py_entries = PyList_New(object->entries_read);
+		if (py_entries == NULL) {
+			return NULL;
+		}
+		{
+			int entries_cntr_1;
+			for (entries_cntr_1 = 0; entries_cntr_1 < (object->entries_read); entries_cntr_1++) {
+				PyObject *py_entries_1;
+				py_entries_1 = pytalloc_reference_ex(srvsvc_NetSrvInfo100_Type, object->entries, &object->entries[entries_cntr_1]);
+				PyList_SetItem(py_entries, entries_cntr_1, py_entries_1);
+			}
+		}
+	}
+	return py_entries;
+}
+
+static int py_BrowserrSrvInfo100Ctr_set_entries(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct BrowserrSrvInfo100Ctr *object = (struct BrowserrSrvInfo100Ctr *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->entries));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->entries");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->entries = NULL;
+	} else {
+		object->entries = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->entries");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int entries_cntr_1;
+			object->entries = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->entries, PyList_GET_SIZE(value));
+			if (!object->entries) { return -1;; }
+			talloc_set_name_const(object->entries, "ARRAY: object->entries");
+			for (entries_cntr_1 = 0; entries_cntr_1 < PyList_GET_SIZE(value); entries_cntr_1++) {
+				if (PyList_GET_ITEM(value, entries_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->entries[entries_cntr_1]");
+					return -1;
+				}
+				PY_CHECK_TYPE(srvsvc_NetSrvInfo100_Type, PyList_GET_ITEM(value, entries_cntr_1), return -1;);
+				if (talloc_reference(object->entries, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, entries_cntr_1))) == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				object->entries[entries_cntr_1] = *(struct srvsvc_NetSrvInfo100 *)pytalloc_get_ptr(PyList_GET_ITEM(value, entries_cntr_1));
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_BrowserrSrvInfo100Ctr_getsetters[] = {
+	{
+		.name = discard_const_p(char, "entries_read"),
+		.get = py_BrowserrSrvInfo100Ctr_get_entries_read,
+		.set = py_BrowserrSrvInfo100Ctr_set_entries_read,
+		.doc = discard_const_p(char, "PIDL-generated element entries_read")
+	},
+	{
+		.name = discard_const_p(char, "entries"),
+		.get = py_BrowserrSrvInfo100Ctr_get_entries,
+		.set = py_BrowserrSrvInfo100Ctr_set_entries,
+		.doc = discard_const_p(char, "PIDL-generated element entries")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_BrowserrSrvInfo100Ctr_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct BrowserrSrvInfo100Ctr, type);
+}
+
+
+static PyTypeObject BrowserrSrvInfo100Ctr_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "browser.BrowserrSrvInfo100Ctr",
+	.tp_getset = py_BrowserrSrvInfo100Ctr_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_BrowserrSrvInfo100Ctr_new,
+};
+
+
+static PyObject *py_BrowserrSrvInfo101Ctr_get_entries_read(PyObject *obj, void *closure)
+{
+	struct BrowserrSrvInfo101Ctr *object = (struct BrowserrSrvInfo101Ctr *)pytalloc_get_ptr(obj);
+	PyObject *py_entries_read;
+	py_entries_read = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->entries_read);
+	return py_entries_read;
+}
+
+static int py_BrowserrSrvInfo101Ctr_set_entries_read(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct BrowserrSrvInfo101Ctr *object = (struct BrowserrSrvInfo101Ctr *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->entries_read");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->entries_read));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->entries_read = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->entries_read = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_BrowserrSrvInfo101Ctr_get_entries(PyObject *obj, void *closure)
+{
+	struct BrowserrSrvInfo101Ctr *object = (struct BrowserrSrvInfo101Ctr *)pytalloc_get_ptr(obj);
+	PyObject *py_entries;
+	if (object->entries == NULL) {
+		py_entries = Py_None;
+		Py_INCREF(py_entries);
+	} else {
+		py_entries = PyList_New(object->entries_read);
+		if (py_entries == NULL) {
+			return NULL;
+		}
+		{
+			int entries_cntr_1;
+			for (entries_cntr_1 = 0; entries_cntr_1 < (object->entries_read); entries_cntr_1++) {
+				PyObject *py_entries_1;
+				py_entries_1 = pytalloc_reference_ex(srvsvc_NetSrvInfo101_Type, object->entries, &object->entries[entries_cntr_1]);
+				PyList_SetItem(py_entries, entries_cntr_1, py_entries_1);
+			}
+		}
+	}
+	return py_entries;
+}
+
+static int py_BrowserrSrvInfo101Ctr_set_entries(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct BrowserrSrvInfo101Ctr *object = (struct BrowserrSrvInfo101Ctr *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->entries));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->entries");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->entries = NULL;
+	} else {
+		object->entries = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->entries");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int entries_cntr_1;
+			object->entries = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->entries, PyList_GET_SIZE(value));
+			if (!object->entries) { return -1;; }
+			talloc_set_name_const(object->entries, "ARRAY: object->entries");
+			for (entries_cntr_1 = 0; entries_cntr_1 < PyList_GET_SIZE(value); entries_cntr_1++) {
+				if (PyList_GET_ITEM(value, entries_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->entries[entries_cntr_1]");
+					return -1;
+				}
+				PY_CHECK_TYPE(srvsvc_NetSrvInfo101_Type, PyList_GET_ITEM(value, entries_cntr_1), return -1;);
+				if (talloc_reference(object->entries, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, entries_cntr_1))) == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				object->entries[entries_cntr_1] = *(struct srvsvc_NetSrvInfo101 *)pytalloc_get_ptr(PyList_GET_ITEM(value, entries_cntr_1));
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_BrowserrSrvInfo101Ctr_getsetters[] = {
+	{
+		.name = discard_const_p(char, "entries_read"),
+		.get = py_BrowserrSrvInfo101Ctr_get_entries_read,
+		.set = py_BrowserrSrvInfo101Ctr_set_entries_read,
+		.doc = discard_const_p(char, "PIDL-generated element entries_read")
+	},
+	{
+		.name = discard_const_p(char, "entries"),
+		.get = py_BrowserrSrvInfo101Ctr_get_entries,
+		.set = py_BrowserrSrvInfo101Ctr_set_entries,
+		.doc = discard_const_p(char, "PIDL-generated element entries")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_BrowserrSrvInfo101Ctr_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct BrowserrSrvInfo101Ctr, type);
+}
+
+
+static PyTypeObject BrowserrSrvInfo101Ctr_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "browser.BrowserrSrvInfo101Ctr",
+	.tp_getset = py_BrowserrSrvInfo101Ctr_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_BrowserrSrvInfo101Ctr_new,
+};
+
+PyObject *py_import_BrowserrSrvInfoUnion(TALLOC_CTX *mem_ctx, int level, union BrowserrSrvInfoUnion *in)
+{
+	PyObject *ret;
+
+	switch (level) {
+		case 100:
+			if (in->info100 == NULL) {
+				ret = Py_None;
+				Py_INCREF(ret);
+			} else {
+				ret = pytalloc_reference_ex(&BrowserrSrvInfo100Ctr_Type, in->info100, in->info100);
+			}
+			return ret;
+
+		case 101:
+			if (in->info101 == NULL) {
+				ret = Py_None;
+				Py_INCREF(ret);
+			} else {
+				ret = pytalloc_reference_ex(&BrowserrSrvInfo101Ctr_Type, in->info101, in->info101);
+			}
+			return ret;
+
+		default:
+			ret = Py_None;
+			Py_INCREF(ret);
+			return ret;
+
+	}
+	PyErr_SetString(PyExc_TypeError, "unknown union level");
+	return NULL;
+}
+
+union BrowserrSrvInfoUnion *py_export_BrowserrSrvInfoUnion(TALLOC_CTX *mem_ctx, int level, PyObject *in)
+{
+	union BrowserrSrvInfoUnion *ret = talloc_zero(mem_ctx, union BrowserrSrvInfoUnion);
+	switch (level) {
+		case 100:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info100");
+				talloc_free(ret); return NULL;
+			}
+			if (in == Py_None) {
+				ret->info100 = NULL;
+			} else {
+				ret->info100 = NULL;
+				if (in == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *ret->info100");
+					talloc_free(ret); return NULL;
+				}
+				PY_CHECK_TYPE(&BrowserrSrvInfo100Ctr_Type, in, talloc_free(ret); return NULL;);
+				if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+					PyErr_NoMemory();
+					talloc_free(ret); return NULL;
+				}
+				ret->info100 = (struct BrowserrSrvInfo100Ctr *)pytalloc_get_ptr(in);
+			}
+			break;
+
+		case 101:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info101");
+				talloc_free(ret); return NULL;
+			}
+			if (in == Py_None) {
+				ret->info101 = NULL;
+			} else {
+				ret->info101 = NULL;
+				if (in == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *ret->info101");
+					talloc_free(ret); return NULL;
+				}
+				PY_CHECK_TYPE(&BrowserrSrvInfo101Ctr_Type, in, talloc_free(ret); return NULL;);
+				if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+					PyErr_NoMemory();
+					talloc_free(ret); return NULL;
+				}
+				ret->info101 = (struct BrowserrSrvInfo101Ctr *)pytalloc_get_ptr(in);
+			}
+			break;
+
+		default:
+			break;
+
+	}
+
+	return ret;
+}
+
+
+static PyObject *py_BrowserrSrvInfo_get_level(PyObject *obj, void *closure)
+{
+	struct BrowserrSrvInfo *object = (struct BrowserrSrvInfo *)pytalloc_get_ptr(obj);
+	PyObject *py_level;
+	py_level = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->level);
+	return py_level;
+}
+
+static int py_BrowserrSrvInfo_set_level(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct BrowserrSrvInfo *object = (struct BrowserrSrvInfo *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->level");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->level));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->level = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->level = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_BrowserrSrvInfo_get_info(PyObject *obj, void *closure)
+{
+	struct BrowserrSrvInfo *object = (struct BrowserrSrvInfo *)pytalloc_get_ptr(obj);
+	PyObject *py_info;
+	py_info = py_import_BrowserrSrvInfoUnion(pytalloc_get_mem_ctx(obj), object->level, &object->info);
+	if (py_info == NULL) {
+		return NULL;
+	}
+	return py_info;
+}
+
+static int py_BrowserrSrvInfo_set_info(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct BrowserrSrvInfo *object = (struct BrowserrSrvInfo *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->info");
+		return -1;
+	}
+	{
+		union BrowserrSrvInfoUnion *info_switch_0;
+		info_switch_0 = py_export_BrowserrSrvInfoUnion(pytalloc_get_mem_ctx(py_obj), object->level, value);
+		if (info_switch_0 == NULL) {
+			return -1;
+		}
+		object->info = *info_switch_0;
+	}
+	return 0;
+}
+
+static PyGetSetDef py_BrowserrSrvInfo_getsetters[] = {
+	{
+		.name = discard_const_p(char, "level"),
+		.get = py_BrowserrSrvInfo_get_level,
+		.set = py_BrowserrSrvInfo_set_level,
+		.doc = discard_const_p(char, "PIDL-generated element level")
+	},
+	{
+		.name = discard_const_p(char, "info"),
+		.get = py_BrowserrSrvInfo_get_info,
+		.set = py_BrowserrSrvInfo_set_info,
+		.doc = discard_const_p(char, "PIDL-generated element info")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_BrowserrSrvInfo_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct BrowserrSrvInfo, type);
+}
+
+
+static PyTypeObject BrowserrSrvInfo_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "browser.BrowserrSrvInfo",
+	.tp_getset = py_BrowserrSrvInfo_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_BrowserrSrvInfo_new,
+};
+
+
+static bool pack_py_BrowserrQueryOtherDomains_args_in(PyObject *args, PyObject *kwargs, struct BrowserrQueryOtherDomains *r)
+{
+	PyObject *py_server_unc;
+	PyObject *py_info;
+	const char *kwnames[] = {
+		"server_unc", "info", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:BrowserrQueryOtherDomains", discard_const_p(char *, kwnames), &py_server_unc, &py_info)) {
+		return false;
+	}
+
+	if (py_server_unc == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.server_unc");
+		return false;
+	}
+	if (py_server_unc == Py_None) {
+		r->in.server_unc = NULL;
+	} else {
+		r->in.server_unc = NULL;
+		if (py_server_unc == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.server_unc");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_server_unc)) {
+				unicode = PyUnicode_AsEncodedString(py_server_unc, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_server_unc)) {
+				test_str = PyString_AS_STRING(py_server_unc);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_server_unc)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.server_unc = talloc_str;
+		}
+	}
+	if (py_info == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.info");
+		return false;
+	}
+	r->in.info = talloc_ptrtype(r, r->in.info);
+	if (py_info == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.info");
+		return false;
+	}
+	PY_CHECK_TYPE(&BrowserrSrvInfo_Type, py_info, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_info)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.info = (struct BrowserrSrvInfo *)pytalloc_get_ptr(py_info);
+	return true;
+}
+
+static PyObject *unpack_py_BrowserrQueryOtherDomains_args_out(struct BrowserrQueryOtherDomains *r)
+{
+	PyObject *result;
+	PyObject *py_info;
+	PyObject *py_total_entries;
+	result = PyTuple_New(2);
+	py_info = pytalloc_reference_ex(&BrowserrSrvInfo_Type, r->out.info, r->out.info);
+	PyTuple_SetItem(result, 0, py_info);
+	py_total_entries = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.total_entries);
+	PyTuple_SetItem(result, 1, py_total_entries);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_browser_methods[] = {
+	{ "BrowserrQueryOtherDomains", "S.BrowserrQueryOtherDomains(server_unc, info) -> (info, total_entries)", (py_dcerpc_call_fn)dcerpc_BrowserrQueryOtherDomains_r, (py_data_pack_fn)pack_py_BrowserrQueryOtherDomains_args_in, (py_data_unpack_fn)unpack_py_BrowserrQueryOtherDomains_args_out, 2, &ndr_table_browser },
+	{ NULL }
+};
+
+static PyObject *interface_browser_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_browser);
+}
+
+#define PY_DOC_BROWSER "Browsing"
+static PyTypeObject browser_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "browser.browser",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "browser(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_BROWSER,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_browser_new,
+};
+
+static PyObject *syntax_browser_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_browser.syntax_id);
+}
+
+#define PY_DOC_BROWSER_SYNTAX "Browsing"
+static PyTypeObject browser_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "browser.browser",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_BROWSER_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_browser_new,
+};
+
+static PyMethodDef browser_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initbrowser(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_srvsvc;
+	PyObject *dep_talloc;
+	PyObject *dep_samba_dcerpc_base;
+	PyObject *dep_samba_dcerpc_misc;
+
+	dep_samba_dcerpc_srvsvc = PyImport_ImportModule("samba.dcerpc.srvsvc");
+	if (dep_samba_dcerpc_srvsvc == NULL)
+		return;
+
+	dep_talloc = PyImport_ImportModule("talloc");
+	if (dep_talloc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	srvsvc_NetSrvInfo100_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_srvsvc, "NetSrvInfo100");
+	if (srvsvc_NetSrvInfo100_Type == NULL)
+		return;
+
+	BaseObject_Type = (PyTypeObject *)PyObject_GetAttrString(dep_talloc, "BaseObject");
+	if (BaseObject_Type == NULL)
+		return;
+
+	srvsvc_NetSrvInfo101_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_srvsvc, "NetSrvInfo101");
+	if (srvsvc_NetSrvInfo101_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	BrowserrSrvInfo100Ctr_Type.tp_base = BaseObject_Type;
+	BrowserrSrvInfo100Ctr_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	BrowserrSrvInfo101Ctr_Type.tp_base = BaseObject_Type;
+	BrowserrSrvInfo101Ctr_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	BrowserrSrvInfo_Type.tp_base = BaseObject_Type;
+	BrowserrSrvInfo_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	browser_InterfaceType.tp_base = ClientConnection_Type;
+
+	browser_SyntaxType.tp_base = ndr_syntax_id_Type;
+	browser_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&BrowserrSrvInfo100Ctr_Type) < 0)
+		return;
+	if (PyType_Ready(&BrowserrSrvInfo101Ctr_Type) < 0)
+		return;
+	if (PyType_Ready(&BrowserrSrvInfo_Type) < 0)
+		return;
+	if (PyType_Ready(&browser_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&browser_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&browser_InterfaceType, py_ndr_browser_methods))
+		return;
+
+#ifdef PY_BROWSERRSRVINFO100CTR_PATCH
+	PY_BROWSERRSRVINFO100CTR_PATCH(&BrowserrSrvInfo100Ctr_Type);
+#endif
+#ifdef PY_BROWSERRSRVINFO101CTR_PATCH
+	PY_BROWSERRSRVINFO101CTR_PATCH(&BrowserrSrvInfo101Ctr_Type);
+#endif
+#ifdef PY_BROWSERRSRVINFO_PATCH
+	PY_BROWSERRSRVINFO_PATCH(&BrowserrSrvInfo_Type);
+#endif
+#ifdef PY_BROWSER_PATCH
+	PY_BROWSER_PATCH(&browser_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&browser_SyntaxType);
+#endif
+
+	m = Py_InitModule3("browser", browser_methods, "browser DCE/RPC");
+	if (m == NULL)
+		return;
+
+	Py_INCREF((PyObject *)(void *)&BrowserrSrvInfo100Ctr_Type);
+	PyModule_AddObject(m, "BrowserrSrvInfo100Ctr", (PyObject *)(void *)&BrowserrSrvInfo100Ctr_Type);
+	Py_INCREF((PyObject *)(void *)&BrowserrSrvInfo101Ctr_Type);
+	PyModule_AddObject(m, "BrowserrSrvInfo101Ctr", (PyObject *)(void *)&BrowserrSrvInfo101Ctr_Type);
+	Py_INCREF((PyObject *)(void *)&BrowserrSrvInfo_Type);
+	PyModule_AddObject(m, "BrowserrSrvInfo", (PyObject *)(void *)&BrowserrSrvInfo_Type);
+	Py_INCREF((PyObject *)(void *)&browser_InterfaceType);
+	PyModule_AddObject(m, "browser", (PyObject *)(void *)&browser_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&browser_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&browser_SyntaxType);
+#ifdef PY_MOD_BROWSER_PATCH
+	PY_MOD_BROWSER_PATCH(m);
+#endif
+
+}
@@ -0,0 +1,19566 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_clusapi.h"
+#include "bin/default/librpc/gen_ndr/ndr_clusapi_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/winreg.h"
+#include "librpc/gen_ndr/misc.h"
+static PyTypeObject RPC_SECURITY_DESCRIPTOR_Type;
+static PyTypeObject RPC_SECURITY_ATTRIBUTES_Type;
+static PyTypeObject CLUSTER_OPERATIONAL_VERSION_INFO_Type;
+static PyTypeObject IDL_CLUSTER_SET_PASSWORD_STATUS_Type;
+static PyTypeObject CLUSTER_CREATE_GROUP_INFO_RPC_Type;
+static PyTypeObject ENUM_ENTRY_Type;
+static PyTypeObject ENUM_LIST_Type;
+static PyTypeObject GROUP_ENUM_ENTRY_Type;
+static PyTypeObject RESOURCE_ENUM_ENTRY_Type;
+static PyTypeObject GROUP_ENUM_LIST_Type;
+static PyTypeObject RESOURCE_ENUM_LIST_Type;
+static PyTypeObject clusapi_propertyValues_Type;
+static PyTypeObject clusapi_propertyValue_Type;
+static PyTypeObject clusapi_PROPERTY_LIST_Type;
+static PyTypeObject NOTIFY_FILTER_AND_TYPE_RPC_Type;
+static PyTypeObject NOTIFICATION_DATA_RPC_Type;
+static PyTypeObject NOTIFICATION_RPC_Type;
+static PyTypeObject CLUSTER_DISKID_Type;
+static PyTypeObject CLUSTER_MRR_NODE_RESPONSE_Type;
+static PyTypeObject CLUSTER_MRR_RESPONSE_Type;
+static PyTypeObject NOTIFICATION_DATA_ASYNC_RPC_Type;
+static PyTypeObject clusapi_InterfaceType;
+
+void initclusapi(void);static PyTypeObject *BaseObject_Type;
+static PyTypeObject *policy_handle_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static PyObject *py_RPC_SECURITY_DESCRIPTOR_get_lpSecurityDescriptor(PyObject *obj, void *closure)
+{
+	struct RPC_SECURITY_DESCRIPTOR *object = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(obj);
+	PyObject *py_lpSecurityDescriptor;
+	if (object->lpSecurityDescriptor == NULL) {
+		py_lpSecurityDescriptor = Py_None;
+		Py_INCREF(py_lpSecurityDescriptor);
+	} else {
+		py_lpSecurityDescriptor = PyList_New(object->cbOutSecurityDescriptor);
+		if (py_lpSecurityDescriptor == NULL) {
+			return NULL;
+		}
+		{
+			int lpSecurityDescriptor_cntr_1;
+			for (lpSecurityDescriptor_cntr_1 = 0; lpSecurityDescriptor_cntr_1 < (object->cbOutSecurityDescriptor); lpSecurityDescriptor_cntr_1++) {
+				PyObject *py_lpSecurityDescriptor_1;
+				py_lpSecurityDescriptor_1 = PyInt_FromLong((uint16_t)object->lpSecurityDescriptor[lpSecurityDescriptor_cntr_1]);
+				PyList_SetItem(py_lpSecurityDescriptor, lpSecurityDescriptor_cntr_1, py_lpSecurityDescriptor_1);
+			}
+		}
+	}
+	return py_lpSecurityDescriptor;
+}
+
+static int py_RPC_SECURITY_DESCRIPTOR_set_lpSecurityDescriptor(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RPC_SECURITY_DESCRIPTOR *object = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->lpSecurityDescriptor));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->lpSecurityDescriptor");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->lpSecurityDescriptor = NULL;
+	} else {
+		object->lpSecurityDescriptor = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->lpSecurityDescriptor");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int lpSecurityDescriptor_cntr_1;
+			object->lpSecurityDescriptor = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->lpSecurityDescriptor, PyList_GET_SIZE(value));
+			if (!object->lpSecurityDescriptor) { return -1;; }
+			talloc_set_name_const(object->lpSecurityDescriptor, "ARRAY: object->lpSecurityDescriptor");
+			for (lpSecurityDescriptor_cntr_1 = 0; lpSecurityDescriptor_cntr_1 < PyList_GET_SIZE(value); lpSecurityDescriptor_cntr_1++) {
+				if (PyList_GET_ITEM(value, lpSecurityDescriptor_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->lpSecurityDescriptor[lpSecurityDescriptor_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->lpSecurityDescriptor[lpSecurityDescriptor_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, lpSecurityDescriptor_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, lpSecurityDescriptor_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->lpSecurityDescriptor[lpSecurityDescriptor_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, lpSecurityDescriptor_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, lpSecurityDescriptor_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->lpSecurityDescriptor[lpSecurityDescriptor_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RPC_SECURITY_DESCRIPTOR_get_cbInSecurityDescriptor(PyObject *obj, void *closure)
+{
+	struct RPC_SECURITY_DESCRIPTOR *object = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(obj);
+	PyObject *py_cbInSecurityDescriptor;
+	py_cbInSecurityDescriptor = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbInSecurityDescriptor);
+	return py_cbInSecurityDescriptor;
+}
+
+static int py_RPC_SECURITY_DESCRIPTOR_set_cbInSecurityDescriptor(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RPC_SECURITY_DESCRIPTOR *object = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbInSecurityDescriptor");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbInSecurityDescriptor));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbInSecurityDescriptor = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbInSecurityDescriptor = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RPC_SECURITY_DESCRIPTOR_get_cbOutSecurityDescriptor(PyObject *obj, void *closure)
+{
+	struct RPC_SECURITY_DESCRIPTOR *object = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(obj);
+	PyObject *py_cbOutSecurityDescriptor;
+	py_cbOutSecurityDescriptor = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbOutSecurityDescriptor);
+	return py_cbOutSecurityDescriptor;
+}
+
+static int py_RPC_SECURITY_DESCRIPTOR_set_cbOutSecurityDescriptor(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RPC_SECURITY_DESCRIPTOR *object = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbOutSecurityDescriptor");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbOutSecurityDescriptor));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbOutSecurityDescriptor = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbOutSecurityDescriptor = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_RPC_SECURITY_DESCRIPTOR_getsetters[] = {
+	{
+		.name = discard_const_p(char, "lpSecurityDescriptor"),
+		.get = py_RPC_SECURITY_DESCRIPTOR_get_lpSecurityDescriptor,
+		.set = py_RPC_SECURITY_DESCRIPTOR_set_lpSecurityDescriptor,
+		.doc = discard_const_p(char, "PIDL-generated element lpSecurityDescriptor")
+	},
+	{
+		.name = discard_const_p(char, "cbInSecurityDescriptor"),
+		.get = py_RPC_SECURITY_DESCRIPTOR_get_cbInSecurityDescriptor,
+		.set = py_RPC_SECURITY_DESCRIPTOR_set_cbInSecurityDescriptor,
+		.doc = discard_const_p(char, "PIDL-generated element cbInSecurityDescriptor")
+	},
+	{
+		.name = discard_const_p(char, "cbOutSecurityDescriptor"),
+		.get = py_RPC_SECURITY_DESCRIPTOR_get_cbOutSecurityDescriptor,
+		.set = py_RPC_SECURITY_DESCRIPTOR_set_cbOutSecurityDescriptor,
+		.doc = discard_const_p(char, "PIDL-generated element cbOutSecurityDescriptor")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_RPC_SECURITY_DESCRIPTOR_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct RPC_SECURITY_DESCRIPTOR, type);
+}
+
+
+static PyTypeObject RPC_SECURITY_DESCRIPTOR_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.RPC_SECURITY_DESCRIPTOR",
+	.tp_getset = py_RPC_SECURITY_DESCRIPTOR_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_RPC_SECURITY_DESCRIPTOR_new,
+};
+
+
+static PyObject *py_RPC_SECURITY_ATTRIBUTES_get_nLength(PyObject *obj, void *closure)
+{
+	struct RPC_SECURITY_ATTRIBUTES *object = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(obj);
+	PyObject *py_nLength;
+	py_nLength = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->nLength);
+	return py_nLength;
+}
+
+static int py_RPC_SECURITY_ATTRIBUTES_set_nLength(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RPC_SECURITY_ATTRIBUTES *object = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->nLength");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->nLength));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->nLength = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->nLength = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RPC_SECURITY_ATTRIBUTES_get_RpcSecurityDescriptor(PyObject *obj, void *closure)
+{
+	struct RPC_SECURITY_ATTRIBUTES *object = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(obj);
+	PyObject *py_RpcSecurityDescriptor;
+	py_RpcSecurityDescriptor = pytalloc_reference_ex(&RPC_SECURITY_DESCRIPTOR_Type, pytalloc_get_mem_ctx(obj), &object->RpcSecurityDescriptor);
+	return py_RpcSecurityDescriptor;
+}
+
+static int py_RPC_SECURITY_ATTRIBUTES_set_RpcSecurityDescriptor(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RPC_SECURITY_ATTRIBUTES *object = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->RpcSecurityDescriptor");
+		return -1;
+	}
+	PY_CHECK_TYPE(&RPC_SECURITY_DESCRIPTOR_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->RpcSecurityDescriptor = *(struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_RPC_SECURITY_ATTRIBUTES_get_bInheritHandle(PyObject *obj, void *closure)
+{
+	struct RPC_SECURITY_ATTRIBUTES *object = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(obj);
+	PyObject *py_bInheritHandle;
+	py_bInheritHandle = PyInt_FromLong(object->bInheritHandle);
+	return py_bInheritHandle;
+}
+
+static int py_RPC_SECURITY_ATTRIBUTES_set_bInheritHandle(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RPC_SECURITY_ATTRIBUTES *object = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->bInheritHandle");
+		return -1;
+	}
+	{
+		const long long int_max = ndr_sizeof2intmax(sizeof(object->bInheritHandle));
+		const long long int_min = -int_max - 1;
+		if (PyLong_Check(value)) {
+			long long test_var;
+			test_var = PyLong_AsLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var < int_min || test_var > int_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range %lld - %lld, got %lld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, int_min, int_max, test_var);
+				return -1;
+			}
+			object->bInheritHandle = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < int_min || test_var > int_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range %lld - %lld, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, int_min, int_max, test_var);
+				return -1;
+			}
+			object->bInheritHandle = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_RPC_SECURITY_ATTRIBUTES_getsetters[] = {
+	{
+		.name = discard_const_p(char, "nLength"),
+		.get = py_RPC_SECURITY_ATTRIBUTES_get_nLength,
+		.set = py_RPC_SECURITY_ATTRIBUTES_set_nLength,
+		.doc = discard_const_p(char, "PIDL-generated element nLength")
+	},
+	{
+		.name = discard_const_p(char, "RpcSecurityDescriptor"),
+		.get = py_RPC_SECURITY_ATTRIBUTES_get_RpcSecurityDescriptor,
+		.set = py_RPC_SECURITY_ATTRIBUTES_set_RpcSecurityDescriptor,
+		.doc = discard_const_p(char, "PIDL-generated element RpcSecurityDescriptor")
+	},
+	{
+		.name = discard_const_p(char, "bInheritHandle"),
+		.get = py_RPC_SECURITY_ATTRIBUTES_get_bInheritHandle,
+		.set = py_RPC_SECURITY_ATTRIBUTES_set_bInheritHandle,
+		.doc = discard_const_p(char, "PIDL-generated element bInheritHandle")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_RPC_SECURITY_ATTRIBUTES_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct RPC_SECURITY_ATTRIBUTES, type);
+}
+
+
+static PyTypeObject RPC_SECURITY_ATTRIBUTES_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.RPC_SECURITY_ATTRIBUTES",
+	.tp_getset = py_RPC_SECURITY_ATTRIBUTES_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_RPC_SECURITY_ATTRIBUTES_new,
+};
+
+
+static PyObject *py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwSize(PyObject *obj, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(obj);
+	PyObject *py_dwSize;
+	py_dwSize = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwSize);
+	return py_dwSize;
+}
+
+static int py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwSize(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwSize");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwSize));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwSize = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwClusterHighestVersion(PyObject *obj, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(obj);
+	PyObject *py_dwClusterHighestVersion;
+	py_dwClusterHighestVersion = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwClusterHighestVersion);
+	return py_dwClusterHighestVersion;
+}
+
+static int py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwClusterHighestVersion(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwClusterHighestVersion");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwClusterHighestVersion));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwClusterHighestVersion = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwClusterHighestVersion = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwClusterLowestVersion(PyObject *obj, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(obj);
+	PyObject *py_dwClusterLowestVersion;
+	py_dwClusterLowestVersion = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwClusterLowestVersion);
+	return py_dwClusterLowestVersion;
+}
+
+static int py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwClusterLowestVersion(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwClusterLowestVersion");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwClusterLowestVersion));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwClusterLowestVersion = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwClusterLowestVersion = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwFlags(PyObject *obj, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(obj);
+	PyObject *py_dwFlags;
+	py_dwFlags = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwFlags);
+	return py_dwFlags;
+}
+
+static int py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwFlags(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwFlags");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwFlags));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwFlags = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwReserved(PyObject *obj, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(obj);
+	PyObject *py_dwReserved;
+	py_dwReserved = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwReserved);
+	return py_dwReserved;
+}
+
+static int py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwReserved(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_OPERATIONAL_VERSION_INFO *object = (struct CLUSTER_OPERATIONAL_VERSION_INFO *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwReserved");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwReserved));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwReserved = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwReserved = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_CLUSTER_OPERATIONAL_VERSION_INFO_getsetters[] = {
+	{
+		.name = discard_const_p(char, "dwSize"),
+		.get = py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwSize,
+		.set = py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwSize,
+		.doc = discard_const_p(char, "PIDL-generated element dwSize")
+	},
+	{
+		.name = discard_const_p(char, "dwClusterHighestVersion"),
+		.get = py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwClusterHighestVersion,
+		.set = py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwClusterHighestVersion,
+		.doc = discard_const_p(char, "PIDL-generated element dwClusterHighestVersion")
+	},
+	{
+		.name = discard_const_p(char, "dwClusterLowestVersion"),
+		.get = py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwClusterLowestVersion,
+		.set = py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwClusterLowestVersion,
+		.doc = discard_const_p(char, "PIDL-generated element dwClusterLowestVersion")
+	},
+	{
+		.name = discard_const_p(char, "dwFlags"),
+		.get = py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwFlags,
+		.set = py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwFlags,
+		.doc = discard_const_p(char, "PIDL-generated element dwFlags")
+	},
+	{
+		.name = discard_const_p(char, "dwReserved"),
+		.get = py_CLUSTER_OPERATIONAL_VERSION_INFO_get_dwReserved,
+		.set = py_CLUSTER_OPERATIONAL_VERSION_INFO_set_dwReserved,
+		.doc = discard_const_p(char, "PIDL-generated element dwReserved")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_CLUSTER_OPERATIONAL_VERSION_INFO_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct CLUSTER_OPERATIONAL_VERSION_INFO, type);
+}
+
+
+static PyTypeObject CLUSTER_OPERATIONAL_VERSION_INFO_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.CLUSTER_OPERATIONAL_VERSION_INFO",
+	.tp_getset = py_CLUSTER_OPERATIONAL_VERSION_INFO_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_CLUSTER_OPERATIONAL_VERSION_INFO_new,
+};
+
+
+static PyObject *py_IDL_CLUSTER_SET_PASSWORD_STATUS_get_NodeId(PyObject *obj, void *closure)
+{
+	struct IDL_CLUSTER_SET_PASSWORD_STATUS *object = (struct IDL_CLUSTER_SET_PASSWORD_STATUS *)pytalloc_get_ptr(obj);
+	PyObject *py_NodeId;
+	py_NodeId = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->NodeId);
+	return py_NodeId;
+}
+
+static int py_IDL_CLUSTER_SET_PASSWORD_STATUS_set_NodeId(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct IDL_CLUSTER_SET_PASSWORD_STATUS *object = (struct IDL_CLUSTER_SET_PASSWORD_STATUS *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->NodeId");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->NodeId));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->NodeId = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->NodeId = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_IDL_CLUSTER_SET_PASSWORD_STATUS_get_SetAttempted(PyObject *obj, void *closure)
+{
+	struct IDL_CLUSTER_SET_PASSWORD_STATUS *object = (struct IDL_CLUSTER_SET_PASSWORD_STATUS *)pytalloc_get_ptr(obj);
+	PyObject *py_SetAttempted;
+	py_SetAttempted = PyInt_FromLong((uint16_t)object->SetAttempted);
+	return py_SetAttempted;
+}
+
+static int py_IDL_CLUSTER_SET_PASSWORD_STATUS_set_SetAttempted(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct IDL_CLUSTER_SET_PASSWORD_STATUS *object = (struct IDL_CLUSTER_SET_PASSWORD_STATUS *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->SetAttempted");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->SetAttempted));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->SetAttempted = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->SetAttempted = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_IDL_CLUSTER_SET_PASSWORD_STATUS_get_ReturnStatus(PyObject *obj, void *closure)
+{
+	struct IDL_CLUSTER_SET_PASSWORD_STATUS *object = (struct IDL_CLUSTER_SET_PASSWORD_STATUS *)pytalloc_get_ptr(obj);
+	PyObject *py_ReturnStatus;
+	py_ReturnStatus = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->ReturnStatus);
+	return py_ReturnStatus;
+}
+
+static int py_IDL_CLUSTER_SET_PASSWORD_STATUS_set_ReturnStatus(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct IDL_CLUSTER_SET_PASSWORD_STATUS *object = (struct IDL_CLUSTER_SET_PASSWORD_STATUS *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ReturnStatus");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->ReturnStatus));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->ReturnStatus = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->ReturnStatus = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_IDL_CLUSTER_SET_PASSWORD_STATUS_getsetters[] = {
+	{
+		.name = discard_const_p(char, "NodeId"),
+		.get = py_IDL_CLUSTER_SET_PASSWORD_STATUS_get_NodeId,
+		.set = py_IDL_CLUSTER_SET_PASSWORD_STATUS_set_NodeId,
+		.doc = discard_const_p(char, "PIDL-generated element NodeId")
+	},
+	{
+		.name = discard_const_p(char, "SetAttempted"),
+		.get = py_IDL_CLUSTER_SET_PASSWORD_STATUS_get_SetAttempted,
+		.set = py_IDL_CLUSTER_SET_PASSWORD_STATUS_set_SetAttempted,
+		.doc = discard_const_p(char, "PIDL-generated element SetAttempted")
+	},
+	{
+		.name = discard_const_p(char, "ReturnStatus"),
+		.get = py_IDL_CLUSTER_SET_PASSWORD_STATUS_get_ReturnStatus,
+		.set = py_IDL_CLUSTER_SET_PASSWORD_STATUS_set_ReturnStatus,
+		.doc = discard_const_p(char, "PIDL-generated element ReturnStatus")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_IDL_CLUSTER_SET_PASSWORD_STATUS_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct IDL_CLUSTER_SET_PASSWORD_STATUS, type);
+}
+
+
+static PyTypeObject IDL_CLUSTER_SET_PASSWORD_STATUS_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.IDL_CLUSTER_SET_PASSWORD_STATUS",
+	.tp_getset = py_IDL_CLUSTER_SET_PASSWORD_STATUS_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_IDL_CLUSTER_SET_PASSWORD_STATUS_new,
+};
+
+
+static PyObject *py_CLUSTER_CREATE_GROUP_INFO_RPC_get_dwVersion(PyObject *obj, void *closure)
+{
+	struct CLUSTER_CREATE_GROUP_INFO_RPC *object = (struct CLUSTER_CREATE_GROUP_INFO_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwVersion;
+	py_dwVersion = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwVersion);
+	return py_dwVersion;
+}
+
+static int py_CLUSTER_CREATE_GROUP_INFO_RPC_set_dwVersion(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_CREATE_GROUP_INFO_RPC *object = (struct CLUSTER_CREATE_GROUP_INFO_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwVersion");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwVersion));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwVersion = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwVersion = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_CREATE_GROUP_INFO_RPC_get_dwGroupType(PyObject *obj, void *closure)
+{
+	struct CLUSTER_CREATE_GROUP_INFO_RPC *object = (struct CLUSTER_CREATE_GROUP_INFO_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwGroupType;
+	py_dwGroupType = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwGroupType);
+	return py_dwGroupType;
+}
+
+static int py_CLUSTER_CREATE_GROUP_INFO_RPC_set_dwGroupType(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_CREATE_GROUP_INFO_RPC *object = (struct CLUSTER_CREATE_GROUP_INFO_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwGroupType");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwGroupType));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwGroupType = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwGroupType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_CLUSTER_CREATE_GROUP_INFO_RPC_getsetters[] = {
+	{
+		.name = discard_const_p(char, "dwVersion"),
+		.get = py_CLUSTER_CREATE_GROUP_INFO_RPC_get_dwVersion,
+		.set = py_CLUSTER_CREATE_GROUP_INFO_RPC_set_dwVersion,
+		.doc = discard_const_p(char, "PIDL-generated element dwVersion")
+	},
+	{
+		.name = discard_const_p(char, "dwGroupType"),
+		.get = py_CLUSTER_CREATE_GROUP_INFO_RPC_get_dwGroupType,
+		.set = py_CLUSTER_CREATE_GROUP_INFO_RPC_set_dwGroupType,
+		.doc = discard_const_p(char, "PIDL-generated element dwGroupType")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_CLUSTER_CREATE_GROUP_INFO_RPC_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct CLUSTER_CREATE_GROUP_INFO_RPC, type);
+}
+
+
+static PyTypeObject CLUSTER_CREATE_GROUP_INFO_RPC_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.CLUSTER_CREATE_GROUP_INFO_RPC",
+	.tp_getset = py_CLUSTER_CREATE_GROUP_INFO_RPC_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_CLUSTER_CREATE_GROUP_INFO_RPC_new,
+};
+
+
+static PyObject *py_ENUM_ENTRY_get_Type(PyObject *obj, void *closure)
+{
+	struct ENUM_ENTRY *object = (struct ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Type;
+	py_Type = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->Type);
+	return py_Type;
+}
+
+static int py_ENUM_ENTRY_set_Type(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENUM_ENTRY *object = (struct ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Type");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->Type));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->Type = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->Type = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_ENUM_ENTRY_get_Name(PyObject *obj, void *closure)
+{
+	struct ENUM_ENTRY *object = (struct ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Name;
+	if (object->Name == NULL) {
+		py_Name = Py_None;
+		Py_INCREF(py_Name);
+	} else {
+		if (object->Name == NULL) {
+			py_Name = Py_None;
+			Py_INCREF(py_Name);
+		} else {
+			py_Name = PyUnicode_Decode(object->Name, strlen(object->Name), "utf-8", "ignore");
+		}
+	}
+	return py_Name;
+}
+
+static int py_ENUM_ENTRY_set_Name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENUM_ENTRY *object = (struct ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Name");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Name = NULL;
+	} else {
+		object->Name = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Name");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Name = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_ENUM_ENTRY_getsetters[] = {
+	{
+		.name = discard_const_p(char, "Type"),
+		.get = py_ENUM_ENTRY_get_Type,
+		.set = py_ENUM_ENTRY_set_Type,
+		.doc = discard_const_p(char, "PIDL-generated element Type")
+	},
+	{
+		.name = discard_const_p(char, "Name"),
+		.get = py_ENUM_ENTRY_get_Name,
+		.set = py_ENUM_ENTRY_set_Name,
+		.doc = discard_const_p(char, "PIDL-generated element Name")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_ENUM_ENTRY_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct ENUM_ENTRY, type);
+}
+
+
+static PyTypeObject ENUM_ENTRY_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.ENUM_ENTRY",
+	.tp_getset = py_ENUM_ENTRY_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_ENUM_ENTRY_new,
+};
+
+
+static PyObject *py_ENUM_LIST_get_EntryCount(PyObject *obj, void *closure)
+{
+	struct ENUM_LIST *object = (struct ENUM_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_EntryCount;
+	py_EntryCount = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->EntryCount);
+	return py_EntryCount;
+}
+
+static int py_ENUM_LIST_set_EntryCount(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENUM_LIST *object = (struct ENUM_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->EntryCount");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->EntryCount));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->EntryCount = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->EntryCount = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_ENUM_LIST_get_Entry(PyObject *obj, void *closure)
+{
+	struct ENUM_LIST *object = (struct ENUM_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_Entry;
+	py_Entry = PyList_New(object->EntryCount);
+	if (py_Entry == NULL) {
+		return NULL;
+	}
+	{
+		int Entry_cntr_0;
+		for (Entry_cntr_0 = 0; Entry_cntr_0 < (object->EntryCount); Entry_cntr_0++) {
+			PyObject *py_Entry_0;
+			py_Entry_0 = pytalloc_reference_ex(&ENUM_ENTRY_Type, object->Entry, &object->Entry[Entry_cntr_0]);
+			PyList_SetItem(py_Entry, Entry_cntr_0, py_Entry_0);
+		}
+	}
+	return py_Entry;
+}
+
+static int py_ENUM_LIST_set_Entry(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENUM_LIST *object = (struct ENUM_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Entry");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int Entry_cntr_0;
+		object->Entry = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->Entry, PyList_GET_SIZE(value));
+		if (!object->Entry) { return -1;; }
+		talloc_set_name_const(object->Entry, "ARRAY: object->Entry");
+		for (Entry_cntr_0 = 0; Entry_cntr_0 < PyList_GET_SIZE(value); Entry_cntr_0++) {
+			if (PyList_GET_ITEM(value, Entry_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Entry[Entry_cntr_0]");
+				return -1;
+			}
+			PY_CHECK_TYPE(&ENUM_ENTRY_Type, PyList_GET_ITEM(value, Entry_cntr_0), return -1;);
+			if (talloc_reference(object->Entry, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, Entry_cntr_0))) == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Entry[Entry_cntr_0] = *(struct ENUM_ENTRY *)pytalloc_get_ptr(PyList_GET_ITEM(value, Entry_cntr_0));
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_ENUM_LIST_getsetters[] = {
+	{
+		.name = discard_const_p(char, "EntryCount"),
+		.get = py_ENUM_LIST_get_EntryCount,
+		.set = py_ENUM_LIST_set_EntryCount,
+		.doc = discard_const_p(char, "PIDL-generated element EntryCount")
+	},
+	{
+		.name = discard_const_p(char, "Entry"),
+		.get = py_ENUM_LIST_get_Entry,
+		.set = py_ENUM_LIST_set_Entry,
+		.doc = discard_const_p(char, "PIDL-generated element Entry")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_ENUM_LIST_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct ENUM_LIST, type);
+}
+
+
+static PyTypeObject ENUM_LIST_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.ENUM_LIST",
+	.tp_getset = py_ENUM_LIST_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_ENUM_LIST_new,
+};
+
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_Name(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Name;
+	if (object->Name == NULL) {
+		py_Name = Py_None;
+		Py_INCREF(py_Name);
+	} else {
+		if (object->Name == NULL) {
+			py_Name = Py_None;
+			Py_INCREF(py_Name);
+		} else {
+			py_Name = PyUnicode_Decode(object->Name, strlen(object->Name), "utf-8", "ignore");
+		}
+	}
+	return py_Name;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_Name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Name");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Name = NULL;
+	} else {
+		object->Name = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Name");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Name = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_Id(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Id;
+	if (object->Id == NULL) {
+		py_Id = Py_None;
+		Py_INCREF(py_Id);
+	} else {
+		if (object->Id == NULL) {
+			py_Id = Py_None;
+			Py_INCREF(py_Id);
+		} else {
+			py_Id = PyUnicode_Decode(object->Id, strlen(object->Id), "utf-8", "ignore");
+		}
+	}
+	return py_Id;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_Id(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Id");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Id = NULL;
+	} else {
+		object->Id = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Id");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Id = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_dwState(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_dwState;
+	py_dwState = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwState);
+	return py_dwState;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_dwState(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwState");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwState));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwState = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwState = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_Owner(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Owner;
+	if (object->Owner == NULL) {
+		py_Owner = Py_None;
+		Py_INCREF(py_Owner);
+	} else {
+		if (object->Owner == NULL) {
+			py_Owner = Py_None;
+			Py_INCREF(py_Owner);
+		} else {
+			py_Owner = PyUnicode_Decode(object->Owner, strlen(object->Owner), "utf-8", "ignore");
+		}
+	}
+	return py_Owner;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_Owner(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Owner");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Owner = NULL;
+	} else {
+		object->Owner = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Owner");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Owner = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_dwFlags(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_dwFlags;
+	py_dwFlags = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwFlags);
+	return py_dwFlags;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_dwFlags(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwFlags");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwFlags));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwFlags = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_cbProperties(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_cbProperties;
+	py_cbProperties = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbProperties);
+	return py_cbProperties;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_cbProperties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbProperties");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbProperties));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbProperties = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbProperties = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_Properties(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Properties;
+	if (object->Properties == NULL) {
+		py_Properties = Py_None;
+		Py_INCREF(py_Properties);
+	} else {
+		py_Properties = PyList_New(object->cbProperties);
+		if (py_Properties == NULL) {
+			return NULL;
+		}
+		{
+			int Properties_cntr_1;
+			for (Properties_cntr_1 = 0; Properties_cntr_1 < (object->cbProperties); Properties_cntr_1++) {
+				PyObject *py_Properties_1;
+				py_Properties_1 = PyInt_FromLong((uint16_t)object->Properties[Properties_cntr_1]);
+				PyList_SetItem(py_Properties, Properties_cntr_1, py_Properties_1);
+			}
+		}
+	}
+	return py_Properties;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_Properties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->Properties));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Properties");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Properties = NULL;
+	} else {
+		object->Properties = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Properties");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int Properties_cntr_1;
+			object->Properties = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->Properties, PyList_GET_SIZE(value));
+			if (!object->Properties) { return -1;; }
+			talloc_set_name_const(object->Properties, "ARRAY: object->Properties");
+			for (Properties_cntr_1 = 0; Properties_cntr_1 < PyList_GET_SIZE(value); Properties_cntr_1++) {
+				if (PyList_GET_ITEM(value, Properties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Properties[Properties_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->Properties[Properties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, Properties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, Properties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->Properties[Properties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, Properties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, Properties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->Properties[Properties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_cbRoProperties(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_cbRoProperties;
+	py_cbRoProperties = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbRoProperties);
+	return py_cbRoProperties;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_cbRoProperties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbRoProperties");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbRoProperties));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbRoProperties = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbRoProperties = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_ENTRY_get_RoProperties(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_RoProperties;
+	if (object->RoProperties == NULL) {
+		py_RoProperties = Py_None;
+		Py_INCREF(py_RoProperties);
+	} else {
+		py_RoProperties = PyList_New(object->cbRoProperties);
+		if (py_RoProperties == NULL) {
+			return NULL;
+		}
+		{
+			int RoProperties_cntr_1;
+			for (RoProperties_cntr_1 = 0; RoProperties_cntr_1 < (object->cbRoProperties); RoProperties_cntr_1++) {
+				PyObject *py_RoProperties_1;
+				py_RoProperties_1 = PyInt_FromLong((uint16_t)object->RoProperties[RoProperties_cntr_1]);
+				PyList_SetItem(py_RoProperties, RoProperties_cntr_1, py_RoProperties_1);
+			}
+		}
+	}
+	return py_RoProperties;
+}
+
+static int py_GROUP_ENUM_ENTRY_set_RoProperties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_ENTRY *object = (struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->RoProperties));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->RoProperties");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->RoProperties = NULL;
+	} else {
+		object->RoProperties = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->RoProperties");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int RoProperties_cntr_1;
+			object->RoProperties = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->RoProperties, PyList_GET_SIZE(value));
+			if (!object->RoProperties) { return -1;; }
+			talloc_set_name_const(object->RoProperties, "ARRAY: object->RoProperties");
+			for (RoProperties_cntr_1 = 0; RoProperties_cntr_1 < PyList_GET_SIZE(value); RoProperties_cntr_1++) {
+				if (PyList_GET_ITEM(value, RoProperties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->RoProperties[RoProperties_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->RoProperties[RoProperties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, RoProperties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, RoProperties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->RoProperties[RoProperties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, RoProperties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, RoProperties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->RoProperties[RoProperties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_GROUP_ENUM_ENTRY_getsetters[] = {
+	{
+		.name = discard_const_p(char, "Name"),
+		.get = py_GROUP_ENUM_ENTRY_get_Name,
+		.set = py_GROUP_ENUM_ENTRY_set_Name,
+		.doc = discard_const_p(char, "PIDL-generated element Name")
+	},
+	{
+		.name = discard_const_p(char, "Id"),
+		.get = py_GROUP_ENUM_ENTRY_get_Id,
+		.set = py_GROUP_ENUM_ENTRY_set_Id,
+		.doc = discard_const_p(char, "PIDL-generated element Id")
+	},
+	{
+		.name = discard_const_p(char, "dwState"),
+		.get = py_GROUP_ENUM_ENTRY_get_dwState,
+		.set = py_GROUP_ENUM_ENTRY_set_dwState,
+		.doc = discard_const_p(char, "PIDL-generated element dwState")
+	},
+	{
+		.name = discard_const_p(char, "Owner"),
+		.get = py_GROUP_ENUM_ENTRY_get_Owner,
+		.set = py_GROUP_ENUM_ENTRY_set_Owner,
+		.doc = discard_const_p(char, "PIDL-generated element Owner")
+	},
+	{
+		.name = discard_const_p(char, "dwFlags"),
+		.get = py_GROUP_ENUM_ENTRY_get_dwFlags,
+		.set = py_GROUP_ENUM_ENTRY_set_dwFlags,
+		.doc = discard_const_p(char, "PIDL-generated element dwFlags")
+	},
+	{
+		.name = discard_const_p(char, "cbProperties"),
+		.get = py_GROUP_ENUM_ENTRY_get_cbProperties,
+		.set = py_GROUP_ENUM_ENTRY_set_cbProperties,
+		.doc = discard_const_p(char, "PIDL-generated element cbProperties")
+	},
+	{
+		.name = discard_const_p(char, "Properties"),
+		.get = py_GROUP_ENUM_ENTRY_get_Properties,
+		.set = py_GROUP_ENUM_ENTRY_set_Properties,
+		.doc = discard_const_p(char, "PIDL-generated element Properties")
+	},
+	{
+		.name = discard_const_p(char, "cbRoProperties"),
+		.get = py_GROUP_ENUM_ENTRY_get_cbRoProperties,
+		.set = py_GROUP_ENUM_ENTRY_set_cbRoProperties,
+		.doc = discard_const_p(char, "PIDL-generated element cbRoProperties")
+	},
+	{
+		.name = discard_const_p(char, "RoProperties"),
+		.get = py_GROUP_ENUM_ENTRY_get_RoProperties,
+		.set = py_GROUP_ENUM_ENTRY_set_RoProperties,
+		.doc = discard_const_p(char, "PIDL-generated element RoProperties")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_GROUP_ENUM_ENTRY_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct GROUP_ENUM_ENTRY, type);
+}
+
+
+static PyTypeObject GROUP_ENUM_ENTRY_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.GROUP_ENUM_ENTRY",
+	.tp_getset = py_GROUP_ENUM_ENTRY_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_GROUP_ENUM_ENTRY_new,
+};
+
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_Name(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Name;
+	if (object->Name == NULL) {
+		py_Name = Py_None;
+		Py_INCREF(py_Name);
+	} else {
+		if (object->Name == NULL) {
+			py_Name = Py_None;
+			Py_INCREF(py_Name);
+		} else {
+			py_Name = PyUnicode_Decode(object->Name, strlen(object->Name), "utf-8", "ignore");
+		}
+	}
+	return py_Name;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_Name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Name");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Name = NULL;
+	} else {
+		object->Name = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Name");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Name = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_Id(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Id;
+	if (object->Id == NULL) {
+		py_Id = Py_None;
+		Py_INCREF(py_Id);
+	} else {
+		if (object->Id == NULL) {
+			py_Id = Py_None;
+			Py_INCREF(py_Id);
+		} else {
+			py_Id = PyUnicode_Decode(object->Id, strlen(object->Id), "utf-8", "ignore");
+		}
+	}
+	return py_Id;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_Id(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Id");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Id = NULL;
+	} else {
+		object->Id = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Id");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Id = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_OwnerName(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_OwnerName;
+	if (object->OwnerName == NULL) {
+		py_OwnerName = Py_None;
+		Py_INCREF(py_OwnerName);
+	} else {
+		if (object->OwnerName == NULL) {
+			py_OwnerName = Py_None;
+			Py_INCREF(py_OwnerName);
+		} else {
+			py_OwnerName = PyUnicode_Decode(object->OwnerName, strlen(object->OwnerName), "utf-8", "ignore");
+		}
+	}
+	return py_OwnerName;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_OwnerName(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->OwnerName");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->OwnerName = NULL;
+	} else {
+		object->OwnerName = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->OwnerName");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->OwnerName = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_OwnerId(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_OwnerId;
+	if (object->OwnerId == NULL) {
+		py_OwnerId = Py_None;
+		Py_INCREF(py_OwnerId);
+	} else {
+		if (object->OwnerId == NULL) {
+			py_OwnerId = Py_None;
+			Py_INCREF(py_OwnerId);
+		} else {
+			py_OwnerId = PyUnicode_Decode(object->OwnerId, strlen(object->OwnerId), "utf-8", "ignore");
+		}
+	}
+	return py_OwnerId;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_OwnerId(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->OwnerId");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->OwnerId = NULL;
+	} else {
+		object->OwnerId = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->OwnerId");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->OwnerId = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_cbProperties(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_cbProperties;
+	py_cbProperties = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbProperties);
+	return py_cbProperties;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_cbProperties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbProperties");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbProperties));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbProperties = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbProperties = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_Properties(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_Properties;
+	if (object->Properties == NULL) {
+		py_Properties = Py_None;
+		Py_INCREF(py_Properties);
+	} else {
+		py_Properties = PyList_New(object->cbProperties);
+		if (py_Properties == NULL) {
+			return NULL;
+		}
+		{
+			int Properties_cntr_1;
+			for (Properties_cntr_1 = 0; Properties_cntr_1 < (object->cbProperties); Properties_cntr_1++) {
+				PyObject *py_Properties_1;
+				py_Properties_1 = PyInt_FromLong((uint16_t)object->Properties[Properties_cntr_1]);
+				PyList_SetItem(py_Properties, Properties_cntr_1, py_Properties_1);
+			}
+		}
+	}
+	return py_Properties;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_Properties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->Properties));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Properties");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Properties = NULL;
+	} else {
+		object->Properties = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Properties");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int Properties_cntr_1;
+			object->Properties = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->Properties, PyList_GET_SIZE(value));
+			if (!object->Properties) { return -1;; }
+			talloc_set_name_const(object->Properties, "ARRAY: object->Properties");
+			for (Properties_cntr_1 = 0; Properties_cntr_1 < PyList_GET_SIZE(value); Properties_cntr_1++) {
+				if (PyList_GET_ITEM(value, Properties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Properties[Properties_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->Properties[Properties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, Properties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, Properties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->Properties[Properties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, Properties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, Properties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->Properties[Properties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_cbRoProperties(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_cbRoProperties;
+	py_cbRoProperties = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbRoProperties);
+	return py_cbRoProperties;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_cbRoProperties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbRoProperties");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbRoProperties));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbRoProperties = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbRoProperties = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_get_RoProperties(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(obj);
+	PyObject *py_RoProperties;
+	if (object->RoProperties == NULL) {
+		py_RoProperties = Py_None;
+		Py_INCREF(py_RoProperties);
+	} else {
+		py_RoProperties = PyList_New(object->cbRoProperties);
+		if (py_RoProperties == NULL) {
+			return NULL;
+		}
+		{
+			int RoProperties_cntr_1;
+			for (RoProperties_cntr_1 = 0; RoProperties_cntr_1 < (object->cbRoProperties); RoProperties_cntr_1++) {
+				PyObject *py_RoProperties_1;
+				py_RoProperties_1 = PyInt_FromLong((uint16_t)object->RoProperties[RoProperties_cntr_1]);
+				PyList_SetItem(py_RoProperties, RoProperties_cntr_1, py_RoProperties_1);
+			}
+		}
+	}
+	return py_RoProperties;
+}
+
+static int py_RESOURCE_ENUM_ENTRY_set_RoProperties(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_ENTRY *object = (struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->RoProperties));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->RoProperties");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->RoProperties = NULL;
+	} else {
+		object->RoProperties = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->RoProperties");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int RoProperties_cntr_1;
+			object->RoProperties = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->RoProperties, PyList_GET_SIZE(value));
+			if (!object->RoProperties) { return -1;; }
+			talloc_set_name_const(object->RoProperties, "ARRAY: object->RoProperties");
+			for (RoProperties_cntr_1 = 0; RoProperties_cntr_1 < PyList_GET_SIZE(value); RoProperties_cntr_1++) {
+				if (PyList_GET_ITEM(value, RoProperties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->RoProperties[RoProperties_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->RoProperties[RoProperties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, RoProperties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, RoProperties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->RoProperties[RoProperties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, RoProperties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, RoProperties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->RoProperties[RoProperties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_RESOURCE_ENUM_ENTRY_getsetters[] = {
+	{
+		.name = discard_const_p(char, "Name"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_Name,
+		.set = py_RESOURCE_ENUM_ENTRY_set_Name,
+		.doc = discard_const_p(char, "PIDL-generated element Name")
+	},
+	{
+		.name = discard_const_p(char, "Id"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_Id,
+		.set = py_RESOURCE_ENUM_ENTRY_set_Id,
+		.doc = discard_const_p(char, "PIDL-generated element Id")
+	},
+	{
+		.name = discard_const_p(char, "OwnerName"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_OwnerName,
+		.set = py_RESOURCE_ENUM_ENTRY_set_OwnerName,
+		.doc = discard_const_p(char, "PIDL-generated element OwnerName")
+	},
+	{
+		.name = discard_const_p(char, "OwnerId"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_OwnerId,
+		.set = py_RESOURCE_ENUM_ENTRY_set_OwnerId,
+		.doc = discard_const_p(char, "PIDL-generated element OwnerId")
+	},
+	{
+		.name = discard_const_p(char, "cbProperties"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_cbProperties,
+		.set = py_RESOURCE_ENUM_ENTRY_set_cbProperties,
+		.doc = discard_const_p(char, "PIDL-generated element cbProperties")
+	},
+	{
+		.name = discard_const_p(char, "Properties"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_Properties,
+		.set = py_RESOURCE_ENUM_ENTRY_set_Properties,
+		.doc = discard_const_p(char, "PIDL-generated element Properties")
+	},
+	{
+		.name = discard_const_p(char, "cbRoProperties"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_cbRoProperties,
+		.set = py_RESOURCE_ENUM_ENTRY_set_cbRoProperties,
+		.doc = discard_const_p(char, "PIDL-generated element cbRoProperties")
+	},
+	{
+		.name = discard_const_p(char, "RoProperties"),
+		.get = py_RESOURCE_ENUM_ENTRY_get_RoProperties,
+		.set = py_RESOURCE_ENUM_ENTRY_set_RoProperties,
+		.doc = discard_const_p(char, "PIDL-generated element RoProperties")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_RESOURCE_ENUM_ENTRY_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct RESOURCE_ENUM_ENTRY, type);
+}
+
+
+static PyTypeObject RESOURCE_ENUM_ENTRY_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.RESOURCE_ENUM_ENTRY",
+	.tp_getset = py_RESOURCE_ENUM_ENTRY_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_RESOURCE_ENUM_ENTRY_new,
+};
+
+
+static PyObject *py_GROUP_ENUM_LIST_get_EntryCount(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_LIST *object = (struct GROUP_ENUM_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_EntryCount;
+	py_EntryCount = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->EntryCount);
+	return py_EntryCount;
+}
+
+static int py_GROUP_ENUM_LIST_set_EntryCount(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_LIST *object = (struct GROUP_ENUM_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->EntryCount");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->EntryCount));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->EntryCount = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->EntryCount = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_GROUP_ENUM_LIST_get_Entry(PyObject *obj, void *closure)
+{
+	struct GROUP_ENUM_LIST *object = (struct GROUP_ENUM_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_Entry;
+	py_Entry = PyList_New(object->EntryCount);
+	if (py_Entry == NULL) {
+		return NULL;
+	}
+	{
+		int Entry_cntr_0;
+		for (Entry_cntr_0 = 0; Entry_cntr_0 < (object->EntryCount); Entry_cntr_0++) {
+			PyObject *py_Entry_0;
+			py_Entry_0 = pytalloc_reference_ex(&GROUP_ENUM_ENTRY_Type, object->Entry, &object->Entry[Entry_cntr_0]);
+			PyList_SetItem(py_Entry, Entry_cntr_0, py_Entry_0);
+		}
+	}
+	return py_Entry;
+}
+
+static int py_GROUP_ENUM_LIST_set_Entry(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct GROUP_ENUM_LIST *object = (struct GROUP_ENUM_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Entry");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int Entry_cntr_0;
+		object->Entry = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->Entry, PyList_GET_SIZE(value));
+		if (!object->Entry) { return -1;; }
+		talloc_set_name_const(object->Entry, "ARRAY: object->Entry");
+		for (Entry_cntr_0 = 0; Entry_cntr_0 < PyList_GET_SIZE(value); Entry_cntr_0++) {
+			if (PyList_GET_ITEM(value, Entry_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Entry[Entry_cntr_0]");
+				return -1;
+			}
+			PY_CHECK_TYPE(&GROUP_ENUM_ENTRY_Type, PyList_GET_ITEM(value, Entry_cntr_0), return -1;);
+			if (talloc_reference(object->Entry, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, Entry_cntr_0))) == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Entry[Entry_cntr_0] = *(struct GROUP_ENUM_ENTRY *)pytalloc_get_ptr(PyList_GET_ITEM(value, Entry_cntr_0));
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_GROUP_ENUM_LIST_getsetters[] = {
+	{
+		.name = discard_const_p(char, "EntryCount"),
+		.get = py_GROUP_ENUM_LIST_get_EntryCount,
+		.set = py_GROUP_ENUM_LIST_set_EntryCount,
+		.doc = discard_const_p(char, "PIDL-generated element EntryCount")
+	},
+	{
+		.name = discard_const_p(char, "Entry"),
+		.get = py_GROUP_ENUM_LIST_get_Entry,
+		.set = py_GROUP_ENUM_LIST_set_Entry,
+		.doc = discard_const_p(char, "PIDL-generated element Entry")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_GROUP_ENUM_LIST_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct GROUP_ENUM_LIST, type);
+}
+
+
+static PyTypeObject GROUP_ENUM_LIST_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.GROUP_ENUM_LIST",
+	.tp_getset = py_GROUP_ENUM_LIST_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_GROUP_ENUM_LIST_new,
+};
+
+
+static PyObject *py_RESOURCE_ENUM_LIST_get_EntryCount(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_LIST *object = (struct RESOURCE_ENUM_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_EntryCount;
+	py_EntryCount = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->EntryCount);
+	return py_EntryCount;
+}
+
+static int py_RESOURCE_ENUM_LIST_set_EntryCount(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_LIST *object = (struct RESOURCE_ENUM_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->EntryCount");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->EntryCount));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->EntryCount = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->EntryCount = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_RESOURCE_ENUM_LIST_get_Entry(PyObject *obj, void *closure)
+{
+	struct RESOURCE_ENUM_LIST *object = (struct RESOURCE_ENUM_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_Entry;
+	py_Entry = PyList_New(object->EntryCount);
+	if (py_Entry == NULL) {
+		return NULL;
+	}
+	{
+		int Entry_cntr_0;
+		for (Entry_cntr_0 = 0; Entry_cntr_0 < (object->EntryCount); Entry_cntr_0++) {
+			PyObject *py_Entry_0;
+			py_Entry_0 = pytalloc_reference_ex(&RESOURCE_ENUM_ENTRY_Type, object->Entry, &object->Entry[Entry_cntr_0]);
+			PyList_SetItem(py_Entry, Entry_cntr_0, py_Entry_0);
+		}
+	}
+	return py_Entry;
+}
+
+static int py_RESOURCE_ENUM_LIST_set_Entry(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct RESOURCE_ENUM_LIST *object = (struct RESOURCE_ENUM_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Entry");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int Entry_cntr_0;
+		object->Entry = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->Entry, PyList_GET_SIZE(value));
+		if (!object->Entry) { return -1;; }
+		talloc_set_name_const(object->Entry, "ARRAY: object->Entry");
+		for (Entry_cntr_0 = 0; Entry_cntr_0 < PyList_GET_SIZE(value); Entry_cntr_0++) {
+			if (PyList_GET_ITEM(value, Entry_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Entry[Entry_cntr_0]");
+				return -1;
+			}
+			PY_CHECK_TYPE(&RESOURCE_ENUM_ENTRY_Type, PyList_GET_ITEM(value, Entry_cntr_0), return -1;);
+			if (talloc_reference(object->Entry, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, Entry_cntr_0))) == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Entry[Entry_cntr_0] = *(struct RESOURCE_ENUM_ENTRY *)pytalloc_get_ptr(PyList_GET_ITEM(value, Entry_cntr_0));
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_RESOURCE_ENUM_LIST_getsetters[] = {
+	{
+		.name = discard_const_p(char, "EntryCount"),
+		.get = py_RESOURCE_ENUM_LIST_get_EntryCount,
+		.set = py_RESOURCE_ENUM_LIST_set_EntryCount,
+		.doc = discard_const_p(char, "PIDL-generated element EntryCount")
+	},
+	{
+		.name = discard_const_p(char, "Entry"),
+		.get = py_RESOURCE_ENUM_LIST_get_Entry,
+		.set = py_RESOURCE_ENUM_LIST_set_Entry,
+		.doc = discard_const_p(char, "PIDL-generated element Entry")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_RESOURCE_ENUM_LIST_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct RESOURCE_ENUM_LIST, type);
+}
+
+
+static PyTypeObject RESOURCE_ENUM_LIST_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.RESOURCE_ENUM_LIST",
+	.tp_getset = py_RESOURCE_ENUM_LIST_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_RESOURCE_ENUM_LIST_new,
+};
+
+
+static PyObject *py_clusapi_propertyValues_get_Syntax(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(obj);
+	PyObject *py_Syntax;
+	py_Syntax = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->Syntax);
+	return py_Syntax;
+}
+
+static int py_clusapi_propertyValues_set_Syntax(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Syntax");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->Syntax));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->Syntax = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->Syntax = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValues_get_Size(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(obj);
+	PyObject *py_Size;
+	py_Size = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->Size);
+	return py_Size;
+}
+
+static int py_clusapi_propertyValues_set_Size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->Size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->Size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->Size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValues_get_Buffer(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(obj);
+	PyObject *py_Buffer;
+	py_Buffer = PyString_FromStringAndSize((char *)(object->Buffer).data, (object->Buffer).length);
+	return py_Buffer;
+}
+
+static int py_clusapi_propertyValues_set_Buffer(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Buffer");
+		return -1;
+	}
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Buffer");
+		return -1;
+	}
+	object->Buffer = data_blob_talloc(pytalloc_get_mem_ctx(py_obj), PyString_AS_STRING(value), PyString_GET_SIZE(value));
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValues_get_Padding(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(obj);
+	PyObject *py_Padding;
+	py_Padding = PyString_FromStringAndSize((char *)(object->Padding).data, (object->Padding).length);
+	return py_Padding;
+}
+
+static int py_clusapi_propertyValues_set_Padding(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValues *object = (struct clusapi_propertyValues *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Padding");
+		return -1;
+	}
+	object->Padding = data_blob_talloc(pytalloc_get_mem_ctx(py_obj), PyString_AS_STRING(value), PyString_GET_SIZE(value));
+	return 0;
+}
+
+static PyGetSetDef py_clusapi_propertyValues_getsetters[] = {
+	{
+		.name = discard_const_p(char, "Syntax"),
+		.get = py_clusapi_propertyValues_get_Syntax,
+		.set = py_clusapi_propertyValues_set_Syntax,
+		.doc = discard_const_p(char, "PIDL-generated element Syntax")
+	},
+	{
+		.name = discard_const_p(char, "Size"),
+		.get = py_clusapi_propertyValues_get_Size,
+		.set = py_clusapi_propertyValues_set_Size,
+		.doc = discard_const_p(char, "PIDL-generated element Size")
+	},
+	{
+		.name = discard_const_p(char, "Buffer"),
+		.get = py_clusapi_propertyValues_get_Buffer,
+		.set = py_clusapi_propertyValues_set_Buffer,
+		.doc = discard_const_p(char, "PIDL-generated element Buffer")
+	},
+	{
+		.name = discard_const_p(char, "Padding"),
+		.get = py_clusapi_propertyValues_get_Padding,
+		.set = py_clusapi_propertyValues_set_Padding,
+		.doc = discard_const_p(char, "PIDL-generated element Padding")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_clusapi_propertyValues_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct clusapi_propertyValues, type);
+}
+
+
+static PyTypeObject clusapi_propertyValues_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.propertyValues",
+	.tp_getset = py_clusapi_propertyValues_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_clusapi_propertyValues_new,
+};
+
+
+static PyObject *py_clusapi_propertyValue_get_syntax_name(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(obj);
+	PyObject *py_syntax_name;
+	py_syntax_name = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->syntax_name);
+	return py_syntax_name;
+}
+
+static int py_clusapi_propertyValue_set_syntax_name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->syntax_name");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->syntax_name));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->syntax_name = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->syntax_name = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValue_get_size(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(obj);
+	PyObject *py_size;
+	py_size = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->size);
+	return py_size;
+}
+
+static int py_clusapi_propertyValue_set_size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValue_get_buffer(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(obj);
+	PyObject *py_buffer;
+	py_buffer = PyString_FromStringOrNULL(object->buffer);
+	return py_buffer;
+}
+
+static int py_clusapi_propertyValue_set_buffer(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->buffer");
+		return -1;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(value)) {
+			unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(value)) {
+			test_str = PyString_AS_STRING(value);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+			return -1;
+		}
+		talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->buffer = talloc_str;
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValue_get_padding(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(obj);
+	PyObject *py_padding;
+	py_padding = PyString_FromStringAndSize((char *)(object->padding).data, (object->padding).length);
+	return py_padding;
+}
+
+static int py_clusapi_propertyValue_set_padding(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->padding");
+		return -1;
+	}
+	object->padding = data_blob_talloc(pytalloc_get_mem_ctx(py_obj), PyString_AS_STRING(value), PyString_GET_SIZE(value));
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValue_get_PropertyValues(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(obj);
+	PyObject *py_PropertyValues;
+	py_PropertyValues = pytalloc_reference_ex(&clusapi_propertyValues_Type, pytalloc_get_mem_ctx(obj), &object->PropertyValues);
+	return py_PropertyValues;
+}
+
+static int py_clusapi_propertyValue_set_PropertyValues(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->PropertyValues");
+		return -1;
+	}
+	PY_CHECK_TYPE(&clusapi_propertyValues_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->PropertyValues = *(struct clusapi_propertyValues *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_clusapi_propertyValue_get_end_mark(PyObject *obj, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(obj);
+	PyObject *py_end_mark;
+	py_end_mark = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->end_mark);
+	return py_end_mark;
+}
+
+static int py_clusapi_propertyValue_set_end_mark(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_propertyValue *object = (struct clusapi_propertyValue *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->end_mark");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->end_mark));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->end_mark = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->end_mark = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_clusapi_propertyValue_getsetters[] = {
+	{
+		.name = discard_const_p(char, "syntax_name"),
+		.get = py_clusapi_propertyValue_get_syntax_name,
+		.set = py_clusapi_propertyValue_set_syntax_name,
+		.doc = discard_const_p(char, "PIDL-generated element syntax_name")
+	},
+	{
+		.name = discard_const_p(char, "size"),
+		.get = py_clusapi_propertyValue_get_size,
+		.set = py_clusapi_propertyValue_set_size,
+		.doc = discard_const_p(char, "PIDL-generated element size")
+	},
+	{
+		.name = discard_const_p(char, "buffer"),
+		.get = py_clusapi_propertyValue_get_buffer,
+		.set = py_clusapi_propertyValue_set_buffer,
+		.doc = discard_const_p(char, "PIDL-generated element buffer")
+	},
+	{
+		.name = discard_const_p(char, "padding"),
+		.get = py_clusapi_propertyValue_get_padding,
+		.set = py_clusapi_propertyValue_set_padding,
+		.doc = discard_const_p(char, "PIDL-generated element padding")
+	},
+	{
+		.name = discard_const_p(char, "PropertyValues"),
+		.get = py_clusapi_propertyValue_get_PropertyValues,
+		.set = py_clusapi_propertyValue_set_PropertyValues,
+		.doc = discard_const_p(char, "PIDL-generated element PropertyValues")
+	},
+	{
+		.name = discard_const_p(char, "end_mark"),
+		.get = py_clusapi_propertyValue_get_end_mark,
+		.set = py_clusapi_propertyValue_set_end_mark,
+		.doc = discard_const_p(char, "PIDL-generated element end_mark")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_clusapi_propertyValue_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct clusapi_propertyValue, type);
+}
+
+
+static PyTypeObject clusapi_propertyValue_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.propertyValue",
+	.tp_getset = py_clusapi_propertyValue_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_clusapi_propertyValue_new,
+};
+
+
+static PyObject *py_clusapi_PROPERTY_LIST_get_propertyCount(PyObject *obj, void *closure)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_propertyCount;
+	py_propertyCount = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->propertyCount);
+	return py_propertyCount;
+}
+
+static int py_clusapi_PROPERTY_LIST_set_propertyCount(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->propertyCount");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->propertyCount));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->propertyCount = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->propertyCount = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_PROPERTY_LIST_get_propertyValues(PyObject *obj, void *closure)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_propertyValues;
+	py_propertyValues = PyList_New(object->propertyCount);
+	if (py_propertyValues == NULL) {
+		return NULL;
+	}
+	{
+		int propertyValues_cntr_0;
+		for (propertyValues_cntr_0 = 0; propertyValues_cntr_0 < (object->propertyCount); propertyValues_cntr_0++) {
+			PyObject *py_propertyValues_0;
+			py_propertyValues_0 = pytalloc_reference_ex(&clusapi_propertyValue_Type, object->propertyValues, &object->propertyValues[propertyValues_cntr_0]);
+			PyList_SetItem(py_propertyValues, propertyValues_cntr_0, py_propertyValues_0);
+		}
+	}
+	return py_propertyValues;
+}
+
+static int py_clusapi_PROPERTY_LIST_set_propertyValues(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->propertyValues");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int propertyValues_cntr_0;
+		object->propertyValues = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->propertyValues, PyList_GET_SIZE(value));
+		if (!object->propertyValues) { return -1;; }
+		talloc_set_name_const(object->propertyValues, "ARRAY: object->propertyValues");
+		for (propertyValues_cntr_0 = 0; propertyValues_cntr_0 < PyList_GET_SIZE(value); propertyValues_cntr_0++) {
+			if (PyList_GET_ITEM(value, propertyValues_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->propertyValues[propertyValues_cntr_0]");
+				return -1;
+			}
+			PY_CHECK_TYPE(&clusapi_propertyValue_Type, PyList_GET_ITEM(value, propertyValues_cntr_0), return -1;);
+			if (talloc_reference(object->propertyValues, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, propertyValues_cntr_0))) == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->propertyValues[propertyValues_cntr_0] = *(struct clusapi_propertyValue *)pytalloc_get_ptr(PyList_GET_ITEM(value, propertyValues_cntr_0));
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_clusapi_PROPERTY_LIST_get_end_mark(PyObject *obj, void *closure)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_end_mark;
+	py_end_mark = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->end_mark);
+	return py_end_mark;
+}
+
+static int py_clusapi_PROPERTY_LIST_set_end_mark(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->end_mark");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->end_mark));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->end_mark = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->end_mark = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_clusapi_PROPERTY_LIST_getsetters[] = {
+	{
+		.name = discard_const_p(char, "propertyCount"),
+		.get = py_clusapi_PROPERTY_LIST_get_propertyCount,
+		.set = py_clusapi_PROPERTY_LIST_set_propertyCount,
+		.doc = discard_const_p(char, "PIDL-generated element propertyCount")
+	},
+	{
+		.name = discard_const_p(char, "propertyValues"),
+		.get = py_clusapi_PROPERTY_LIST_get_propertyValues,
+		.set = py_clusapi_PROPERTY_LIST_set_propertyValues,
+		.doc = discard_const_p(char, "PIDL-generated element propertyValues")
+	},
+	{
+		.name = discard_const_p(char, "end_mark"),
+		.get = py_clusapi_PROPERTY_LIST_get_end_mark,
+		.set = py_clusapi_PROPERTY_LIST_set_end_mark,
+		.doc = discard_const_p(char, "PIDL-generated element end_mark")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_clusapi_PROPERTY_LIST_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct clusapi_PROPERTY_LIST, type);
+}
+
+static PyObject *py_clusapi_PROPERTY_LIST_ndr_pack(PyObject *py_obj)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(py_obj);
+	PyObject *ret = NULL;
+	DATA_BLOB blob;
+	enum ndr_err_code err;
+	TALLOC_CTX *tmp_ctx = talloc_new(pytalloc_get_mem_ctx(py_obj));
+	if (tmp_ctx == NULL) {
+		PyErr_SetNdrError(NDR_ERR_ALLOC);
+		return NULL;
+	}
+	err = ndr_push_struct_blob(&blob, tmp_ctx, object, (ndr_push_flags_fn_t)ndr_push_clusapi_PROPERTY_LIST);
+	if (err != NDR_ERR_SUCCESS) {
+		TALLOC_FREE(tmp_ctx);
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	ret = PyString_FromStringAndSize((char *)blob.data, blob.length);
+	TALLOC_FREE(tmp_ctx);
+	return ret;
+}
+
+static PyObject *py_clusapi_PROPERTY_LIST_ndr_unpack(PyObject *py_obj, PyObject *args, PyObject *kwargs)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(py_obj);
+	DATA_BLOB blob;
+	Py_ssize_t blob_length = 0;
+	enum ndr_err_code err;
+	const char * const kwnames[] = { "data_blob", "allow_remaining", NULL };
+	PyObject *allow_remaining_obj = NULL;
+	bool allow_remaining = false;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s#|O:__ndr_unpack__",
+		discard_const_p(char *, kwnames),
+		&blob.data, &blob_length,
+		&allow_remaining_obj)) {
+		return NULL;
+	}
+	blob.length = blob_length;
+
+	if (allow_remaining_obj && PyObject_IsTrue(allow_remaining_obj)) {
+		allow_remaining = true;
+	}
+
+	if (allow_remaining) {
+		err = ndr_pull_struct_blob(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_clusapi_PROPERTY_LIST);
+	} else {
+		err = ndr_pull_struct_blob_all(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_clusapi_PROPERTY_LIST);
+	}
+	if (err != NDR_ERR_SUCCESS) {
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_clusapi_PROPERTY_LIST_ndr_print(PyObject *py_obj)
+{
+	struct clusapi_PROPERTY_LIST *object = (struct clusapi_PROPERTY_LIST *)pytalloc_get_ptr(py_obj);
+	PyObject *ret;
+	char *retstr;
+
+	retstr = ndr_print_struct_string(pytalloc_get_mem_ctx(py_obj), (ndr_print_fn_t)ndr_print_clusapi_PROPERTY_LIST, "clusapi_PROPERTY_LIST", object);
+	ret = PyString_FromString(retstr);
+	talloc_free(retstr);
+
+	return ret;
+}
+
+static PyMethodDef py_clusapi_PROPERTY_LIST_methods[] = {
+	{ "__ndr_pack__", (PyCFunction)py_clusapi_PROPERTY_LIST_ndr_pack, METH_NOARGS, "S.ndr_pack(object) -> blob\nNDR pack" },
+	{ "__ndr_unpack__", (PyCFunction)py_clusapi_PROPERTY_LIST_ndr_unpack, METH_VARARGS|METH_KEYWORDS, "S.ndr_unpack(class, blob, allow_remaining=False) -> None\nNDR unpack" },
+	{ "__ndr_print__", (PyCFunction)py_clusapi_PROPERTY_LIST_ndr_print, METH_VARARGS, "S.ndr_print(object) -> None\nNDR print" },
+	{ NULL, NULL, 0, NULL }
+};
+
+
+static PyTypeObject clusapi_PROPERTY_LIST_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.PROPERTY_LIST",
+	.tp_getset = py_clusapi_PROPERTY_LIST_getsetters,
+	.tp_methods = py_clusapi_PROPERTY_LIST_methods,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_clusapi_PROPERTY_LIST_new,
+};
+
+
+static PyObject *py_NOTIFY_FILTER_AND_TYPE_RPC_get_dwObjectType(PyObject *obj, void *closure)
+{
+	struct NOTIFY_FILTER_AND_TYPE_RPC *object = (struct NOTIFY_FILTER_AND_TYPE_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwObjectType;
+	py_dwObjectType = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwObjectType);
+	return py_dwObjectType;
+}
+
+static int py_NOTIFY_FILTER_AND_TYPE_RPC_set_dwObjectType(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFY_FILTER_AND_TYPE_RPC *object = (struct NOTIFY_FILTER_AND_TYPE_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwObjectType");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwObjectType));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwObjectType = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwObjectType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFY_FILTER_AND_TYPE_RPC_get_FilterFlags(PyObject *obj, void *closure)
+{
+	struct NOTIFY_FILTER_AND_TYPE_RPC *object = (struct NOTIFY_FILTER_AND_TYPE_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_FilterFlags;
+	py_FilterFlags = ndr_PyLong_FromUnsignedLongLong(object->FilterFlags);
+	return py_FilterFlags;
+}
+
+static int py_NOTIFY_FILTER_AND_TYPE_RPC_set_FilterFlags(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFY_FILTER_AND_TYPE_RPC *object = (struct NOTIFY_FILTER_AND_TYPE_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->FilterFlags");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->FilterFlags));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->FilterFlags = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->FilterFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_NOTIFY_FILTER_AND_TYPE_RPC_getsetters[] = {
+	{
+		.name = discard_const_p(char, "dwObjectType"),
+		.get = py_NOTIFY_FILTER_AND_TYPE_RPC_get_dwObjectType,
+		.set = py_NOTIFY_FILTER_AND_TYPE_RPC_set_dwObjectType,
+		.doc = discard_const_p(char, "PIDL-generated element dwObjectType")
+	},
+	{
+		.name = discard_const_p(char, "FilterFlags"),
+		.get = py_NOTIFY_FILTER_AND_TYPE_RPC_get_FilterFlags,
+		.set = py_NOTIFY_FILTER_AND_TYPE_RPC_set_FilterFlags,
+		.doc = discard_const_p(char, "PIDL-generated element FilterFlags")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_NOTIFY_FILTER_AND_TYPE_RPC_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct NOTIFY_FILTER_AND_TYPE_RPC, type);
+}
+
+
+static PyTypeObject NOTIFY_FILTER_AND_TYPE_RPC_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.NOTIFY_FILTER_AND_TYPE_RPC",
+	.tp_getset = py_NOTIFY_FILTER_AND_TYPE_RPC_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_NOTIFY_FILTER_AND_TYPE_RPC_new,
+};
+
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_FilterAndType(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_FilterAndType;
+	py_FilterAndType = pytalloc_reference_ex(&NOTIFY_FILTER_AND_TYPE_RPC_Type, pytalloc_get_mem_ctx(obj), &object->FilterAndType);
+	return py_FilterAndType;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_FilterAndType(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->FilterAndType");
+		return -1;
+	}
+	PY_CHECK_TYPE(&NOTIFY_FILTER_AND_TYPE_RPC_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->FilterAndType = *(struct NOTIFY_FILTER_AND_TYPE_RPC *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_buffer(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_buffer;
+	if (object->buffer == NULL) {
+		py_buffer = Py_None;
+		Py_INCREF(py_buffer);
+	} else {
+		py_buffer = PyList_New(object->dwBufferSize);
+		if (py_buffer == NULL) {
+			return NULL;
+		}
+		{
+			int buffer_cntr_1;
+			for (buffer_cntr_1 = 0; buffer_cntr_1 < (object->dwBufferSize); buffer_cntr_1++) {
+				PyObject *py_buffer_1;
+				py_buffer_1 = PyInt_FromLong((uint16_t)object->buffer[buffer_cntr_1]);
+				PyList_SetItem(py_buffer, buffer_cntr_1, py_buffer_1);
+			}
+		}
+	}
+	return py_buffer;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_buffer(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->buffer));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->buffer");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->buffer = NULL;
+	} else {
+		object->buffer = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->buffer");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int buffer_cntr_1;
+			object->buffer = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->buffer, PyList_GET_SIZE(value));
+			if (!object->buffer) { return -1;; }
+			talloc_set_name_const(object->buffer, "ARRAY: object->buffer");
+			for (buffer_cntr_1 = 0; buffer_cntr_1 < PyList_GET_SIZE(value); buffer_cntr_1++) {
+				if (PyList_GET_ITEM(value, buffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->buffer[buffer_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->buffer[buffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, buffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, buffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->buffer[buffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, buffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, buffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->buffer[buffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_dwBufferSize(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwBufferSize;
+	py_dwBufferSize = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwBufferSize);
+	return py_dwBufferSize;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_dwBufferSize(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwBufferSize");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwBufferSize));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwBufferSize = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_ObjectId(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_ObjectId;
+	if (object->ObjectId == NULL) {
+		py_ObjectId = Py_None;
+		Py_INCREF(py_ObjectId);
+	} else {
+		if (object->ObjectId == NULL) {
+			py_ObjectId = Py_None;
+			Py_INCREF(py_ObjectId);
+		} else {
+			py_ObjectId = PyUnicode_Decode(object->ObjectId, strlen(object->ObjectId), "utf-8", "ignore");
+		}
+	}
+	return py_ObjectId;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_ObjectId(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ObjectId");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->ObjectId = NULL;
+	} else {
+		object->ObjectId = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->ObjectId");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->ObjectId = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_ParentId(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_ParentId;
+	if (object->ParentId == NULL) {
+		py_ParentId = Py_None;
+		Py_INCREF(py_ParentId);
+	} else {
+		if (object->ParentId == NULL) {
+			py_ParentId = Py_None;
+			Py_INCREF(py_ParentId);
+		} else {
+			py_ParentId = PyUnicode_Decode(object->ParentId, strlen(object->ParentId), "utf-8", "ignore");
+		}
+	}
+	return py_ParentId;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_ParentId(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ParentId");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->ParentId = NULL;
+	} else {
+		object->ParentId = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->ParentId");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->ParentId = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_Name(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_Name;
+	if (object->Name == NULL) {
+		py_Name = Py_None;
+		Py_INCREF(py_Name);
+	} else {
+		if (object->Name == NULL) {
+			py_Name = Py_None;
+			Py_INCREF(py_Name);
+		} else {
+			py_Name = PyUnicode_Decode(object->Name, strlen(object->Name), "utf-8", "ignore");
+		}
+	}
+	return py_Name;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_Name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Name");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Name = NULL;
+	} else {
+		object->Name = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Name");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Name = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_RPC_get_Type(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_Type;
+	if (object->Type == NULL) {
+		py_Type = Py_None;
+		Py_INCREF(py_Type);
+	} else {
+		if (object->Type == NULL) {
+			py_Type = Py_None;
+			Py_INCREF(py_Type);
+		} else {
+			py_Type = PyUnicode_Decode(object->Type, strlen(object->Type), "utf-8", "ignore");
+		}
+	}
+	return py_Type;
+}
+
+static int py_NOTIFICATION_DATA_RPC_set_Type(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_RPC *object = (struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Type");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Type = NULL;
+	} else {
+		object->Type = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Type");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Type = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_NOTIFICATION_DATA_RPC_getsetters[] = {
+	{
+		.name = discard_const_p(char, "FilterAndType"),
+		.get = py_NOTIFICATION_DATA_RPC_get_FilterAndType,
+		.set = py_NOTIFICATION_DATA_RPC_set_FilterAndType,
+		.doc = discard_const_p(char, "PIDL-generated element FilterAndType")
+	},
+	{
+		.name = discard_const_p(char, "buffer"),
+		.get = py_NOTIFICATION_DATA_RPC_get_buffer,
+		.set = py_NOTIFICATION_DATA_RPC_set_buffer,
+		.doc = discard_const_p(char, "PIDL-generated element buffer")
+	},
+	{
+		.name = discard_const_p(char, "dwBufferSize"),
+		.get = py_NOTIFICATION_DATA_RPC_get_dwBufferSize,
+		.set = py_NOTIFICATION_DATA_RPC_set_dwBufferSize,
+		.doc = discard_const_p(char, "PIDL-generated element dwBufferSize")
+	},
+	{
+		.name = discard_const_p(char, "ObjectId"),
+		.get = py_NOTIFICATION_DATA_RPC_get_ObjectId,
+		.set = py_NOTIFICATION_DATA_RPC_set_ObjectId,
+		.doc = discard_const_p(char, "PIDL-generated element ObjectId")
+	},
+	{
+		.name = discard_const_p(char, "ParentId"),
+		.get = py_NOTIFICATION_DATA_RPC_get_ParentId,
+		.set = py_NOTIFICATION_DATA_RPC_set_ParentId,
+		.doc = discard_const_p(char, "PIDL-generated element ParentId")
+	},
+	{
+		.name = discard_const_p(char, "Name"),
+		.get = py_NOTIFICATION_DATA_RPC_get_Name,
+		.set = py_NOTIFICATION_DATA_RPC_set_Name,
+		.doc = discard_const_p(char, "PIDL-generated element Name")
+	},
+	{
+		.name = discard_const_p(char, "Type"),
+		.get = py_NOTIFICATION_DATA_RPC_get_Type,
+		.set = py_NOTIFICATION_DATA_RPC_set_Type,
+		.doc = discard_const_p(char, "PIDL-generated element Type")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_NOTIFICATION_DATA_RPC_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct NOTIFICATION_DATA_RPC, type);
+}
+
+
+static PyTypeObject NOTIFICATION_DATA_RPC_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.NOTIFICATION_DATA_RPC",
+	.tp_getset = py_NOTIFICATION_DATA_RPC_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_NOTIFICATION_DATA_RPC_new,
+};
+
+
+static PyObject *py_NOTIFICATION_RPC_get_dwNotifyKey(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_RPC *object = (struct NOTIFICATION_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwNotifyKey;
+	if (object->dwNotifyKey == NULL) {
+		py_dwNotifyKey = Py_None;
+		Py_INCREF(py_dwNotifyKey);
+	} else {
+		py_dwNotifyKey = ndr_PyLong_FromUnsignedLongLong((uint32_t)*object->dwNotifyKey);
+	}
+	return py_dwNotifyKey;
+}
+
+static int py_NOTIFICATION_RPC_set_dwNotifyKey(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_RPC *object = (struct NOTIFICATION_RPC *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->dwNotifyKey));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwNotifyKey");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->dwNotifyKey = NULL;
+	} else {
+		object->dwNotifyKey = talloc_ptrtype(pytalloc_get_mem_ctx(py_obj), object->dwNotifyKey);
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->dwNotifyKey");
+			return -1;
+		}
+		{
+			const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(*object->dwNotifyKey));
+			if (PyLong_Check(value)) {
+				unsigned long long test_var;
+				test_var = PyLong_AsUnsignedLongLong(value);
+				if (PyErr_Occurred() != NULL) {
+					return -1;
+				}
+				if (test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return -1;
+				}
+				*object->dwNotifyKey = test_var;
+			} else if (PyInt_Check(value)) {
+				long test_var;
+				test_var = PyInt_AsLong(value);
+				if (test_var < 0 || test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return -1;
+				}
+				*object->dwNotifyKey = test_var;
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name);
+				return -1;
+			}
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_RPC_get_NotificationData(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_RPC *object = (struct NOTIFICATION_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_NotificationData;
+	py_NotificationData = pytalloc_reference_ex(&NOTIFICATION_DATA_RPC_Type, pytalloc_get_mem_ctx(obj), &object->NotificationData);
+	return py_NotificationData;
+}
+
+static int py_NOTIFICATION_RPC_set_NotificationData(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_RPC *object = (struct NOTIFICATION_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->NotificationData");
+		return -1;
+	}
+	PY_CHECK_TYPE(&NOTIFICATION_DATA_RPC_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->NotificationData = *(struct NOTIFICATION_DATA_RPC *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyGetSetDef py_NOTIFICATION_RPC_getsetters[] = {
+	{
+		.name = discard_const_p(char, "dwNotifyKey"),
+		.get = py_NOTIFICATION_RPC_get_dwNotifyKey,
+		.set = py_NOTIFICATION_RPC_set_dwNotifyKey,
+		.doc = discard_const_p(char, "PIDL-generated element dwNotifyKey")
+	},
+	{
+		.name = discard_const_p(char, "NotificationData"),
+		.get = py_NOTIFICATION_RPC_get_NotificationData,
+		.set = py_NOTIFICATION_RPC_set_NotificationData,
+		.doc = discard_const_p(char, "PIDL-generated element NotificationData")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_NOTIFICATION_RPC_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct NOTIFICATION_RPC, type);
+}
+
+
+static PyTypeObject NOTIFICATION_RPC_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.NOTIFICATION_RPC",
+	.tp_getset = py_NOTIFICATION_RPC_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_NOTIFICATION_RPC_new,
+};
+
+
+static PyObject *py_CLUSTER_DISKID_get_DiskIdType(PyObject *obj, void *closure)
+{
+	struct CLUSTER_DISKID *object = (struct CLUSTER_DISKID *)pytalloc_get_ptr(obj);
+	PyObject *py_DiskIdType;
+	py_DiskIdType = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->DiskIdType);
+	return py_DiskIdType;
+}
+
+static int py_CLUSTER_DISKID_set_DiskIdType(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_DISKID *object = (struct CLUSTER_DISKID *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->DiskIdType");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->DiskIdType));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->DiskIdType = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->DiskIdType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_DISKID_get_DiskIdBlob(PyObject *obj, void *closure)
+{
+	struct CLUSTER_DISKID *object = (struct CLUSTER_DISKID *)pytalloc_get_ptr(obj);
+	PyObject *py_DiskIdBlob;
+	py_DiskIdBlob = PyList_New(16);
+	if (py_DiskIdBlob == NULL) {
+		return NULL;
+	}
+	{
+		int DiskIdBlob_cntr_0;
+		for (DiskIdBlob_cntr_0 = 0; DiskIdBlob_cntr_0 < (16); DiskIdBlob_cntr_0++) {
+			PyObject *py_DiskIdBlob_0;
+			py_DiskIdBlob_0 = PyInt_FromLong((uint16_t)object->DiskIdBlob[DiskIdBlob_cntr_0]);
+			PyList_SetItem(py_DiskIdBlob, DiskIdBlob_cntr_0, py_DiskIdBlob_0);
+		}
+	}
+	return py_DiskIdBlob;
+}
+
+static int py_CLUSTER_DISKID_set_DiskIdBlob(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_DISKID *object = (struct CLUSTER_DISKID *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->DiskIdBlob");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int DiskIdBlob_cntr_0;
+		if (ARRAY_SIZE(object->DiskIdBlob) != PyList_GET_SIZE(value)) {
+			PyErr_Format(PyExc_TypeError, "Expected list of type %s, length %zu, got %zd", Py_TYPE(value)->tp_name, ARRAY_SIZE(object->DiskIdBlob),  PyList_GET_SIZE(value));
+			return -1;
+		}
+		for (DiskIdBlob_cntr_0 = 0; DiskIdBlob_cntr_0 < PyList_GET_SIZE(value); DiskIdBlob_cntr_0++) {
+			if (PyList_GET_ITEM(value, DiskIdBlob_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->DiskIdBlob[DiskIdBlob_cntr_0]");
+				return -1;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->DiskIdBlob[DiskIdBlob_cntr_0]));
+				if (PyLong_Check(PyList_GET_ITEM(value, DiskIdBlob_cntr_0))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, DiskIdBlob_cntr_0));
+					if (PyErr_Occurred() != NULL) {
+						return -1;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->DiskIdBlob[DiskIdBlob_cntr_0] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(value, DiskIdBlob_cntr_0))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(value, DiskIdBlob_cntr_0));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->DiskIdBlob[DiskIdBlob_cntr_0] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return -1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_CLUSTER_DISKID_getsetters[] = {
+	{
+		.name = discard_const_p(char, "DiskIdType"),
+		.get = py_CLUSTER_DISKID_get_DiskIdType,
+		.set = py_CLUSTER_DISKID_set_DiskIdType,
+		.doc = discard_const_p(char, "PIDL-generated element DiskIdType")
+	},
+	{
+		.name = discard_const_p(char, "DiskIdBlob"),
+		.get = py_CLUSTER_DISKID_get_DiskIdBlob,
+		.set = py_CLUSTER_DISKID_set_DiskIdBlob,
+		.doc = discard_const_p(char, "PIDL-generated element DiskIdBlob")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_CLUSTER_DISKID_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct CLUSTER_DISKID, type);
+}
+
+
+static PyTypeObject CLUSTER_DISKID_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.CLUSTER_DISKID",
+	.tp_getset = py_CLUSTER_DISKID_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_CLUSTER_DISKID_new,
+};
+
+
+static PyObject *py_CLUSTER_MRR_NODE_RESPONSE_get_pszNodeName(PyObject *obj, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(obj);
+	PyObject *py_pszNodeName;
+	if (object->pszNodeName == NULL) {
+		py_pszNodeName = Py_None;
+		Py_INCREF(py_pszNodeName);
+	} else {
+		if (object->pszNodeName == NULL) {
+			py_pszNodeName = Py_None;
+			Py_INCREF(py_pszNodeName);
+		} else {
+			py_pszNodeName = PyUnicode_Decode(object->pszNodeName, strlen(object->pszNodeName), "utf-8", "ignore");
+		}
+	}
+	return py_pszNodeName;
+}
+
+static int py_CLUSTER_MRR_NODE_RESPONSE_set_pszNodeName(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pszNodeName");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pszNodeName = NULL;
+	} else {
+		object->pszNodeName = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pszNodeName");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->pszNodeName = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_MRR_NODE_RESPONSE_get_ResultCode(PyObject *obj, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(obj);
+	PyObject *py_ResultCode;
+	py_ResultCode = PyErr_FromHRESULT(object->ResultCode);
+	return py_ResultCode;
+}
+
+static int py_CLUSTER_MRR_NODE_RESPONSE_set_ResultCode(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ResultCode");
+		return -1;
+	}
+	object->ResultCode = HRES_ERROR(PyInt_AsLong(value));
+	return 0;
+}
+
+static PyObject *py_CLUSTER_MRR_NODE_RESPONSE_get_ResultSize(PyObject *obj, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(obj);
+	PyObject *py_ResultSize;
+	py_ResultSize = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->ResultSize);
+	return py_ResultSize;
+}
+
+static int py_CLUSTER_MRR_NODE_RESPONSE_set_ResultSize(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ResultSize");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->ResultSize));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->ResultSize = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->ResultSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_MRR_NODE_RESPONSE_get_pResultData(PyObject *obj, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(obj);
+	PyObject *py_pResultData;
+	if (object->pResultData == NULL) {
+		py_pResultData = Py_None;
+		Py_INCREF(py_pResultData);
+	} else {
+		py_pResultData = PyList_New(object->ResultSize);
+		if (py_pResultData == NULL) {
+			return NULL;
+		}
+		{
+			int pResultData_cntr_1;
+			for (pResultData_cntr_1 = 0; pResultData_cntr_1 < (object->ResultSize); pResultData_cntr_1++) {
+				PyObject *py_pResultData_1;
+				py_pResultData_1 = PyInt_FromLong((uint16_t)object->pResultData[pResultData_cntr_1]);
+				PyList_SetItem(py_pResultData, pResultData_cntr_1, py_pResultData_1);
+			}
+		}
+	}
+	return py_pResultData;
+}
+
+static int py_CLUSTER_MRR_NODE_RESPONSE_set_pResultData(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_MRR_NODE_RESPONSE *object = (struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pResultData));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pResultData");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pResultData = NULL;
+	} else {
+		object->pResultData = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pResultData");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int pResultData_cntr_1;
+			object->pResultData = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->pResultData, PyList_GET_SIZE(value));
+			if (!object->pResultData) { return -1;; }
+			talloc_set_name_const(object->pResultData, "ARRAY: object->pResultData");
+			for (pResultData_cntr_1 = 0; pResultData_cntr_1 < PyList_GET_SIZE(value); pResultData_cntr_1++) {
+				if (PyList_GET_ITEM(value, pResultData_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pResultData[pResultData_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->pResultData[pResultData_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, pResultData_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, pResultData_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->pResultData[pResultData_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, pResultData_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, pResultData_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->pResultData[pResultData_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_CLUSTER_MRR_NODE_RESPONSE_getsetters[] = {
+	{
+		.name = discard_const_p(char, "pszNodeName"),
+		.get = py_CLUSTER_MRR_NODE_RESPONSE_get_pszNodeName,
+		.set = py_CLUSTER_MRR_NODE_RESPONSE_set_pszNodeName,
+		.doc = discard_const_p(char, "PIDL-generated element pszNodeName")
+	},
+	{
+		.name = discard_const_p(char, "ResultCode"),
+		.get = py_CLUSTER_MRR_NODE_RESPONSE_get_ResultCode,
+		.set = py_CLUSTER_MRR_NODE_RESPONSE_set_ResultCode,
+		.doc = discard_const_p(char, "PIDL-generated element ResultCode")
+	},
+	{
+		.name = discard_const_p(char, "ResultSize"),
+		.get = py_CLUSTER_MRR_NODE_RESPONSE_get_ResultSize,
+		.set = py_CLUSTER_MRR_NODE_RESPONSE_set_ResultSize,
+		.doc = discard_const_p(char, "PIDL-generated element ResultSize")
+	},
+	{
+		.name = discard_const_p(char, "pResultData"),
+		.get = py_CLUSTER_MRR_NODE_RESPONSE_get_pResultData,
+		.set = py_CLUSTER_MRR_NODE_RESPONSE_set_pResultData,
+		.doc = discard_const_p(char, "PIDL-generated element pResultData")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_CLUSTER_MRR_NODE_RESPONSE_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct CLUSTER_MRR_NODE_RESPONSE, type);
+}
+
+
+static PyTypeObject CLUSTER_MRR_NODE_RESPONSE_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.CLUSTER_MRR_NODE_RESPONSE",
+	.tp_getset = py_CLUSTER_MRR_NODE_RESPONSE_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_CLUSTER_MRR_NODE_RESPONSE_new,
+};
+
+
+static PyObject *py_CLUSTER_MRR_RESPONSE_get_NodeCount(PyObject *obj, void *closure)
+{
+	struct CLUSTER_MRR_RESPONSE *object = (struct CLUSTER_MRR_RESPONSE *)pytalloc_get_ptr(obj);
+	PyObject *py_NodeCount;
+	py_NodeCount = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->NodeCount);
+	return py_NodeCount;
+}
+
+static int py_CLUSTER_MRR_RESPONSE_set_NodeCount(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_MRR_RESPONSE *object = (struct CLUSTER_MRR_RESPONSE *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->NodeCount");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->NodeCount));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->NodeCount = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->NodeCount = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_CLUSTER_MRR_RESPONSE_get_pNodes(PyObject *obj, void *closure)
+{
+	struct CLUSTER_MRR_RESPONSE *object = (struct CLUSTER_MRR_RESPONSE *)pytalloc_get_ptr(obj);
+	PyObject *py_pNodes;
+	if (object->pNodes == NULL) {
+		py_pNodes = Py_None;
+		Py_INCREF(py_pNodes);
+	} else {
+		py_pNodes = PyList_New(object->NodeCount);
+		if (py_pNodes == NULL) {
+			return NULL;
+		}
+		{
+			int pNodes_cntr_1;
+			for (pNodes_cntr_1 = 0; pNodes_cntr_1 < (object->NodeCount); pNodes_cntr_1++) {
+				PyObject *py_pNodes_1;
+				py_pNodes_1 = pytalloc_reference_ex(&CLUSTER_MRR_NODE_RESPONSE_Type, object->pNodes, &object->pNodes[pNodes_cntr_1]);
+				PyList_SetItem(py_pNodes, pNodes_cntr_1, py_pNodes_1);
+			}
+		}
+	}
+	return py_pNodes;
+}
+
+static int py_CLUSTER_MRR_RESPONSE_set_pNodes(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct CLUSTER_MRR_RESPONSE *object = (struct CLUSTER_MRR_RESPONSE *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pNodes));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pNodes");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pNodes = NULL;
+	} else {
+		object->pNodes = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pNodes");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int pNodes_cntr_1;
+			object->pNodes = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->pNodes, PyList_GET_SIZE(value));
+			if (!object->pNodes) { return -1;; }
+			talloc_set_name_const(object->pNodes, "ARRAY: object->pNodes");
+			for (pNodes_cntr_1 = 0; pNodes_cntr_1 < PyList_GET_SIZE(value); pNodes_cntr_1++) {
+				if (PyList_GET_ITEM(value, pNodes_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pNodes[pNodes_cntr_1]");
+					return -1;
+				}
+				PY_CHECK_TYPE(&CLUSTER_MRR_NODE_RESPONSE_Type, PyList_GET_ITEM(value, pNodes_cntr_1), return -1;);
+				if (talloc_reference(object->pNodes, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, pNodes_cntr_1))) == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				object->pNodes[pNodes_cntr_1] = *(struct CLUSTER_MRR_NODE_RESPONSE *)pytalloc_get_ptr(PyList_GET_ITEM(value, pNodes_cntr_1));
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_CLUSTER_MRR_RESPONSE_getsetters[] = {
+	{
+		.name = discard_const_p(char, "NodeCount"),
+		.get = py_CLUSTER_MRR_RESPONSE_get_NodeCount,
+		.set = py_CLUSTER_MRR_RESPONSE_set_NodeCount,
+		.doc = discard_const_p(char, "PIDL-generated element NodeCount")
+	},
+	{
+		.name = discard_const_p(char, "pNodes"),
+		.get = py_CLUSTER_MRR_RESPONSE_get_pNodes,
+		.set = py_CLUSTER_MRR_RESPONSE_set_pNodes,
+		.doc = discard_const_p(char, "PIDL-generated element pNodes")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_CLUSTER_MRR_RESPONSE_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct CLUSTER_MRR_RESPONSE, type);
+}
+
+
+static PyTypeObject CLUSTER_MRR_RESPONSE_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.CLUSTER_MRR_RESPONSE",
+	.tp_getset = py_CLUSTER_MRR_RESPONSE_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_CLUSTER_MRR_RESPONSE_new,
+};
+
+
+static PyObject *py_NOTIFICATION_DATA_ASYNC_RPC_get_dwNotifyKey(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_ASYNC_RPC *object = (struct NOTIFICATION_DATA_ASYNC_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwNotifyKey;
+	py_dwNotifyKey = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwNotifyKey);
+	return py_dwNotifyKey;
+}
+
+static int py_NOTIFICATION_DATA_ASYNC_RPC_set_dwNotifyKey(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_ASYNC_RPC *object = (struct NOTIFICATION_DATA_ASYNC_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwNotifyKey");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwNotifyKey));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwNotifyKey = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_ASYNC_RPC_get_dwFilter(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_ASYNC_RPC *object = (struct NOTIFICATION_DATA_ASYNC_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_dwFilter;
+	py_dwFilter = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwFilter);
+	return py_dwFilter;
+}
+
+static int py_NOTIFICATION_DATA_ASYNC_RPC_set_dwFilter(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_ASYNC_RPC *object = (struct NOTIFICATION_DATA_ASYNC_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwFilter");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwFilter));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwFilter = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_NOTIFICATION_DATA_ASYNC_RPC_get_Name(PyObject *obj, void *closure)
+{
+	struct NOTIFICATION_DATA_ASYNC_RPC *object = (struct NOTIFICATION_DATA_ASYNC_RPC *)pytalloc_get_ptr(obj);
+	PyObject *py_Name;
+	if (object->Name == NULL) {
+		py_Name = Py_None;
+		Py_INCREF(py_Name);
+	} else {
+		if (object->Name == NULL) {
+			py_Name = Py_None;
+			Py_INCREF(py_Name);
+		} else {
+			py_Name = PyUnicode_Decode(object->Name, strlen(object->Name), "utf-8", "ignore");
+		}
+	}
+	return py_Name;
+}
+
+static int py_NOTIFICATION_DATA_ASYNC_RPC_set_Name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct NOTIFICATION_DATA_ASYNC_RPC *object = (struct NOTIFICATION_DATA_ASYNC_RPC *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->Name");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->Name = NULL;
+	} else {
+		object->Name = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->Name");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->Name = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_NOTIFICATION_DATA_ASYNC_RPC_getsetters[] = {
+	{
+		.name = discard_const_p(char, "dwNotifyKey"),
+		.get = py_NOTIFICATION_DATA_ASYNC_RPC_get_dwNotifyKey,
+		.set = py_NOTIFICATION_DATA_ASYNC_RPC_set_dwNotifyKey,
+		.doc = discard_const_p(char, "PIDL-generated element dwNotifyKey")
+	},
+	{
+		.name = discard_const_p(char, "dwFilter"),
+		.get = py_NOTIFICATION_DATA_ASYNC_RPC_get_dwFilter,
+		.set = py_NOTIFICATION_DATA_ASYNC_RPC_set_dwFilter,
+		.doc = discard_const_p(char, "PIDL-generated element dwFilter")
+	},
+	{
+		.name = discard_const_p(char, "Name"),
+		.get = py_NOTIFICATION_DATA_ASYNC_RPC_get_Name,
+		.set = py_NOTIFICATION_DATA_ASYNC_RPC_set_Name,
+		.doc = discard_const_p(char, "PIDL-generated element Name")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_NOTIFICATION_DATA_ASYNC_RPC_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct NOTIFICATION_DATA_ASYNC_RPC, type);
+}
+
+
+static PyTypeObject NOTIFICATION_DATA_ASYNC_RPC_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.NOTIFICATION_DATA_ASYNC_RPC",
+	.tp_getset = py_NOTIFICATION_DATA_ASYNC_RPC_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_NOTIFICATION_DATA_ASYNC_RPC_new,
+};
+
+
+static bool pack_py_clusapi_OpenCluster_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenCluster *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_OpenCluster", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenCluster_args_out(struct clusapi_OpenCluster *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_Cluster;
+	result = PyTuple_New(2);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_Cluster = pytalloc_reference_ex(policy_handle_Type, r->out.Cluster, r->out.Cluster);
+	PyTuple_SetItem(result, 1, py_Cluster);
+	return result;
+}
+
+static bool pack_py_clusapi_CloseCluster_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseCluster *r)
+{
+	PyObject *py_Cluster;
+	const char *kwnames[] = {
+		"Cluster", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseCluster", discard_const_p(char *, kwnames), &py_Cluster)) {
+		return false;
+	}
+
+	if (py_Cluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Cluster");
+		return false;
+	}
+	r->in.Cluster = talloc_ptrtype(r, r->in.Cluster);
+	if (py_Cluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.Cluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Cluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Cluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Cluster = (struct policy_handle *)pytalloc_get_ptr(py_Cluster);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseCluster_args_out(struct clusapi_CloseCluster *r)
+{
+	PyObject *result;
+	PyObject *py_Cluster;
+	py_Cluster = pytalloc_reference_ex(policy_handle_Type, r->out.Cluster, r->out.Cluster);
+	result = py_Cluster;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetClusterName_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetClusterName *r)
+{
+	PyObject *py_NewClusterName;
+	const char *kwnames[] = {
+		"NewClusterName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_SetClusterName", discard_const_p(char *, kwnames), &py_NewClusterName)) {
+		return false;
+	}
+
+	if (py_NewClusterName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.NewClusterName");
+		return false;
+	}
+	r->in.NewClusterName = talloc_ptrtype(r, r->in.NewClusterName);
+	if (py_NewClusterName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.NewClusterName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_NewClusterName)) {
+			unicode = PyUnicode_AsEncodedString(py_NewClusterName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_NewClusterName)) {
+			test_str = PyString_AS_STRING(py_NewClusterName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_NewClusterName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.NewClusterName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetClusterName_args_out(struct clusapi_SetClusterName *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetClusterName_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetClusterName *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_GetClusterName", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetClusterName_args_out(struct clusapi_GetClusterName *r)
+{
+	PyObject *result;
+	PyObject *py_ClusterName;
+	PyObject *py_NodeName;
+	result = PyTuple_New(2);
+	if (*r->out.ClusterName == NULL) {
+		py_ClusterName = Py_None;
+		Py_INCREF(py_ClusterName);
+	} else {
+		if (*r->out.ClusterName == NULL) {
+			py_ClusterName = Py_None;
+			Py_INCREF(py_ClusterName);
+		} else {
+			py_ClusterName = PyUnicode_Decode(*r->out.ClusterName, strlen(*r->out.ClusterName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_ClusterName);
+	if (*r->out.NodeName == NULL) {
+		py_NodeName = Py_None;
+		Py_INCREF(py_NodeName);
+	} else {
+		if (*r->out.NodeName == NULL) {
+			py_NodeName = Py_None;
+			Py_INCREF(py_NodeName);
+		} else {
+			py_NodeName = PyUnicode_Decode(*r->out.NodeName, strlen(*r->out.NodeName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 1, py_NodeName);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetClusterVersion_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetClusterVersion *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_GetClusterVersion", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetClusterVersion_args_out(struct clusapi_GetClusterVersion *r)
+{
+	PyObject *result;
+	PyObject *py_lpwMajorVersion;
+	PyObject *py_lpwMinorVersion;
+	PyObject *py_lpwBuildNumber;
+	PyObject *py_lpszVendorId;
+	PyObject *py_lpszCSDVersion;
+	result = PyTuple_New(5);
+	py_lpwMajorVersion = PyInt_FromLong((uint16_t)*r->out.lpwMajorVersion);
+	PyTuple_SetItem(result, 0, py_lpwMajorVersion);
+	py_lpwMinorVersion = PyInt_FromLong((uint16_t)*r->out.lpwMinorVersion);
+	PyTuple_SetItem(result, 1, py_lpwMinorVersion);
+	py_lpwBuildNumber = PyInt_FromLong((uint16_t)*r->out.lpwBuildNumber);
+	PyTuple_SetItem(result, 2, py_lpwBuildNumber);
+	if (*r->out.lpszVendorId == NULL) {
+		py_lpszVendorId = Py_None;
+		Py_INCREF(py_lpszVendorId);
+	} else {
+		if (*r->out.lpszVendorId == NULL) {
+			py_lpszVendorId = Py_None;
+			Py_INCREF(py_lpszVendorId);
+		} else {
+			py_lpszVendorId = PyUnicode_Decode(*r->out.lpszVendorId, strlen(*r->out.lpszVendorId), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 3, py_lpszVendorId);
+	if (*r->out.lpszCSDVersion == NULL) {
+		py_lpszCSDVersion = Py_None;
+		Py_INCREF(py_lpszCSDVersion);
+	} else {
+		if (*r->out.lpszCSDVersion == NULL) {
+			py_lpszCSDVersion = Py_None;
+			Py_INCREF(py_lpszCSDVersion);
+		} else {
+			py_lpszCSDVersion = PyUnicode_Decode(*r->out.lpszCSDVersion, strlen(*r->out.lpszCSDVersion), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 4, py_lpszCSDVersion);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetQuorumResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetQuorumResource *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_GetQuorumResource", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetQuorumResource_args_out(struct clusapi_GetQuorumResource *r)
+{
+	PyObject *result;
+	PyObject *py_lpszResourceName;
+	PyObject *py_lpszDeviceName;
+	PyObject *py_pdwMaxQuorumLogSize;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(4);
+	if (*r->out.lpszResourceName == NULL) {
+		py_lpszResourceName = Py_None;
+		Py_INCREF(py_lpszResourceName);
+	} else {
+		if (*r->out.lpszResourceName == NULL) {
+			py_lpszResourceName = Py_None;
+			Py_INCREF(py_lpszResourceName);
+		} else {
+			py_lpszResourceName = PyUnicode_Decode(*r->out.lpszResourceName, strlen(*r->out.lpszResourceName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpszResourceName);
+	if (*r->out.lpszDeviceName == NULL) {
+		py_lpszDeviceName = Py_None;
+		Py_INCREF(py_lpszDeviceName);
+	} else {
+		if (*r->out.lpszDeviceName == NULL) {
+			py_lpszDeviceName = Py_None;
+			Py_INCREF(py_lpszDeviceName);
+		} else {
+			py_lpszDeviceName = PyUnicode_Decode(*r->out.lpszDeviceName, strlen(*r->out.lpszDeviceName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 1, py_lpszDeviceName);
+	py_pdwMaxQuorumLogSize = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.pdwMaxQuorumLogSize);
+	PyTuple_SetItem(result, 2, py_pdwMaxQuorumLogSize);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 3, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetQuorumResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetQuorumResource *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_lpszDeviceName;
+	PyObject *py_dwMaxQuorumLogSize;
+	const char *kwnames[] = {
+		"hResource", "lpszDeviceName", "dwMaxQuorumLogSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_SetQuorumResource", discard_const_p(char *, kwnames), &py_hResource, &py_lpszDeviceName, &py_dwMaxQuorumLogSize)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_lpszDeviceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszDeviceName");
+		return false;
+	}
+	r->in.lpszDeviceName = talloc_ptrtype(r, r->in.lpszDeviceName);
+	if (py_lpszDeviceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszDeviceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszDeviceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszDeviceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszDeviceName)) {
+			test_str = PyString_AS_STRING(py_lpszDeviceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszDeviceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszDeviceName = talloc_str;
+	}
+	if (py_dwMaxQuorumLogSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwMaxQuorumLogSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwMaxQuorumLogSize));
+		if (PyLong_Check(py_dwMaxQuorumLogSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwMaxQuorumLogSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwMaxQuorumLogSize = test_var;
+		} else if (PyInt_Check(py_dwMaxQuorumLogSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwMaxQuorumLogSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwMaxQuorumLogSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetQuorumResource_args_out(struct clusapi_SetQuorumResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateEnum *r)
+{
+	PyObject *py_dwType;
+	const char *kwnames[] = {
+		"dwType", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CreateEnum", discard_const_p(char *, kwnames), &py_dwType)) {
+		return false;
+	}
+
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateEnum_args_out(struct clusapi_CreateEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ReturnEnum == NULL) {
+		py_ReturnEnum = Py_None;
+		Py_INCREF(py_ReturnEnum);
+	} else {
+		py_ReturnEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnEnum, *r->out.ReturnEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OpenResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenResource *r)
+{
+	PyObject *py_lpszResourceName;
+	const char *kwnames[] = {
+		"lpszResourceName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OpenResource", discard_const_p(char *, kwnames), &py_lpszResourceName)) {
+		return false;
+	}
+
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceName");
+		return false;
+	}
+	r->in.lpszResourceName = talloc_ptrtype(r, r->in.lpszResourceName);
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceName)) {
+			test_str = PyString_AS_STRING(py_lpszResourceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenResource_args_out(struct clusapi_OpenResource *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hResource;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hResource = pytalloc_reference_ex(policy_handle_Type, r->out.hResource, r->out.hResource);
+	PyTuple_SetItem(result, 2, py_hResource);
+	return result;
+}
+
+static bool pack_py_clusapi_CreateResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateResource *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_lpszResourceName;
+	PyObject *py_lpszResourceType;
+	PyObject *py_dwFlags;
+	const char *kwnames[] = {
+		"hGroup", "lpszResourceName", "lpszResourceType", "dwFlags", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_CreateResource", discard_const_p(char *, kwnames), &py_hGroup, &py_lpszResourceName, &py_lpszResourceType, &py_dwFlags)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceName");
+		return false;
+	}
+	r->in.lpszResourceName = talloc_ptrtype(r, r->in.lpszResourceName);
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceName)) {
+			test_str = PyString_AS_STRING(py_lpszResourceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceName = talloc_str;
+	}
+	if (py_lpszResourceType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceType");
+		return false;
+	}
+	r->in.lpszResourceType = talloc_ptrtype(r, r->in.lpszResourceType);
+	if (py_lpszResourceType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceType");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceType)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceType, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceType)) {
+			test_str = PyString_AS_STRING(py_lpszResourceType);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceType)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceType = talloc_str;
+	}
+	if (py_dwFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFlags));
+		if (PyLong_Check(py_dwFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else if (PyInt_Check(py_dwFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateResource_args_out(struct clusapi_CreateResource *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hResource;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hResource = pytalloc_reference_ex(policy_handle_Type, r->out.hResource, r->out.hResource);
+	PyTuple_SetItem(result, 2, py_hResource);
+	return result;
+}
+
+static bool pack_py_clusapi_DeleteResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_DeleteResource *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_DeleteResource", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_DeleteResource_args_out(struct clusapi_DeleteResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CloseResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseResource *r)
+{
+	PyObject *py_Resource;
+	const char *kwnames[] = {
+		"Resource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseResource", discard_const_p(char *, kwnames), &py_Resource)) {
+		return false;
+	}
+
+	if (py_Resource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Resource");
+		return false;
+	}
+	r->in.Resource = talloc_ptrtype(r, r->in.Resource);
+	if (py_Resource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.Resource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Resource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Resource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Resource = (struct policy_handle *)pytalloc_get_ptr(py_Resource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseResource_args_out(struct clusapi_CloseResource *r)
+{
+	PyObject *result;
+	PyObject *py_Resource;
+	py_Resource = pytalloc_reference_ex(policy_handle_Type, r->out.Resource, r->out.Resource);
+	result = py_Resource;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetResourceState_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetResourceState *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetResourceState", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetResourceState_args_out(struct clusapi_GetResourceState *r)
+{
+	PyObject *result;
+	PyObject *py_State;
+	PyObject *py_NodeName;
+	PyObject *py_GroupName;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(4);
+	py_State = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.State);
+	PyTuple_SetItem(result, 0, py_State);
+	if (*r->out.NodeName == NULL) {
+		py_NodeName = Py_None;
+		Py_INCREF(py_NodeName);
+	} else {
+		if (*r->out.NodeName == NULL) {
+			py_NodeName = Py_None;
+			Py_INCREF(py_NodeName);
+		} else {
+			py_NodeName = PyUnicode_Decode(*r->out.NodeName, strlen(*r->out.NodeName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 1, py_NodeName);
+	if (*r->out.GroupName == NULL) {
+		py_GroupName = Py_None;
+		Py_INCREF(py_GroupName);
+	} else {
+		if (*r->out.GroupName == NULL) {
+			py_GroupName = Py_None;
+			Py_INCREF(py_GroupName);
+		} else {
+			py_GroupName = PyUnicode_Decode(*r->out.GroupName, strlen(*r->out.GroupName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 2, py_GroupName);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 3, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetResourceName_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetResourceName *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_lpszResourceName;
+	const char *kwnames[] = {
+		"hResource", "lpszResourceName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_SetResourceName", discard_const_p(char *, kwnames), &py_hResource, &py_lpszResourceName)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceName");
+		return false;
+	}
+	r->in.lpszResourceName = talloc_ptrtype(r, r->in.lpszResourceName);
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceName)) {
+			test_str = PyString_AS_STRING(py_lpszResourceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetResourceName_args_out(struct clusapi_SetResourceName *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetResourceId_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetResourceId *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetResourceId", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetResourceId_args_out(struct clusapi_GetResourceId *r)
+{
+	PyObject *result;
+	PyObject *py_pGuid;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.pGuid == NULL) {
+		py_pGuid = Py_None;
+		Py_INCREF(py_pGuid);
+	} else {
+		if (*r->out.pGuid == NULL) {
+			py_pGuid = Py_None;
+			Py_INCREF(py_pGuid);
+		} else {
+			py_pGuid = PyUnicode_Decode(*r->out.pGuid, strlen(*r->out.pGuid), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_pGuid);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetResourceType_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetResourceType *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetResourceType", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetResourceType_args_out(struct clusapi_GetResourceType *r)
+{
+	PyObject *result;
+	PyObject *py_lpszResourceType;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.lpszResourceType == NULL) {
+		py_lpszResourceType = Py_None;
+		Py_INCREF(py_lpszResourceType);
+	} else {
+		if (*r->out.lpszResourceType == NULL) {
+			py_lpszResourceType = Py_None;
+			Py_INCREF(py_lpszResourceType);
+		} else {
+			py_lpszResourceType = PyUnicode_Decode(*r->out.lpszResourceType, strlen(*r->out.lpszResourceType), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpszResourceType);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_FailResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_FailResource *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_FailResource", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_FailResource_args_out(struct clusapi_FailResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OnlineResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OnlineResource *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OnlineResource", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OnlineResource_args_out(struct clusapi_OnlineResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OfflineResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OfflineResource *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OfflineResource", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OfflineResource_args_out(struct clusapi_OfflineResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddResourceDependency_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddResourceDependency *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hDependsOn;
+	const char *kwnames[] = {
+		"hResource", "hDependsOn", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_AddResourceDependency", discard_const_p(char *, kwnames), &py_hResource, &py_hDependsOn)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hDependsOn == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hDependsOn");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hDependsOn, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hDependsOn)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hDependsOn = *(struct policy_handle *)pytalloc_get_ptr(py_hDependsOn);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddResourceDependency_args_out(struct clusapi_AddResourceDependency *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_RemoveResourceDependency_args_in(PyObject *args, PyObject *kwargs, struct clusapi_RemoveResourceDependency *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hDependsOn;
+	const char *kwnames[] = {
+		"hResource", "hDependsOn", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_RemoveResourceDependency", discard_const_p(char *, kwnames), &py_hResource, &py_hDependsOn)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hDependsOn == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hDependsOn");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hDependsOn, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hDependsOn)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hDependsOn = *(struct policy_handle *)pytalloc_get_ptr(py_hDependsOn);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_RemoveResourceDependency_args_out(struct clusapi_RemoveResourceDependency *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CanResourceBeDependent_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CanResourceBeDependent *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hResourceDependent;
+	const char *kwnames[] = {
+		"hResource", "hResourceDependent", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CanResourceBeDependent", discard_const_p(char *, kwnames), &py_hResource, &py_hResourceDependent)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hResourceDependent == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResourceDependent");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResourceDependent, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResourceDependent)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResourceDependent = *(struct policy_handle *)pytalloc_get_ptr(py_hResourceDependent);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CanResourceBeDependent_args_out(struct clusapi_CanResourceBeDependent *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateResEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateResEnum *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_dwType;
+	const char *kwnames[] = {
+		"hResource", "dwType", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CreateResEnum", discard_const_p(char *, kwnames), &py_hResource, &py_dwType)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateResEnum_args_out(struct clusapi_CreateResEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ReturnEnum == NULL) {
+		py_ReturnEnum = Py_None;
+		Py_INCREF(py_ReturnEnum);
+	} else {
+		py_ReturnEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnEnum, *r->out.ReturnEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddResourceNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddResourceNode *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hResource", "hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_AddResourceNode", discard_const_p(char *, kwnames), &py_hResource, &py_hNode)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddResourceNode_args_out(struct clusapi_AddResourceNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_RemoveResourceNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_RemoveResourceNode *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hResource", "hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_RemoveResourceNode", discard_const_p(char *, kwnames), &py_hResource, &py_hNode)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_RemoveResourceNode_args_out(struct clusapi_RemoveResourceNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ChangeResourceGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ChangeResourceGroup *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hGroup;
+	const char *kwnames[] = {
+		"hResource", "hGroup", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_ChangeResourceGroup", discard_const_p(char *, kwnames), &py_hResource, &py_hGroup)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ChangeResourceGroup_args_out(struct clusapi_ChangeResourceGroup *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateResourceType_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateResourceType *r)
+{
+	PyObject *py_lpszTypeName;
+	PyObject *py_lpszDisplayName;
+	PyObject *py_lpszDllName;
+	PyObject *py_dwLooksAlive;
+	PyObject *py_dwIsAlive;
+	const char *kwnames[] = {
+		"lpszTypeName", "lpszDisplayName", "lpszDllName", "dwLooksAlive", "dwIsAlive", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_CreateResourceType", discard_const_p(char *, kwnames), &py_lpszTypeName, &py_lpszDisplayName, &py_lpszDllName, &py_dwLooksAlive, &py_dwIsAlive)) {
+		return false;
+	}
+
+	if (py_lpszTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszTypeName");
+		return false;
+	}
+	r->in.lpszTypeName = talloc_ptrtype(r, r->in.lpszTypeName);
+	if (py_lpszTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszTypeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszTypeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszTypeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszTypeName)) {
+			test_str = PyString_AS_STRING(py_lpszTypeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszTypeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszTypeName = talloc_str;
+	}
+	if (py_lpszDisplayName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszDisplayName");
+		return false;
+	}
+	r->in.lpszDisplayName = talloc_ptrtype(r, r->in.lpszDisplayName);
+	if (py_lpszDisplayName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszDisplayName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszDisplayName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszDisplayName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszDisplayName)) {
+			test_str = PyString_AS_STRING(py_lpszDisplayName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszDisplayName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszDisplayName = talloc_str;
+	}
+	if (py_lpszDllName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszDllName");
+		return false;
+	}
+	r->in.lpszDllName = talloc_ptrtype(r, r->in.lpszDllName);
+	if (py_lpszDllName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszDllName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszDllName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszDllName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszDllName)) {
+			test_str = PyString_AS_STRING(py_lpszDllName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszDllName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszDllName = talloc_str;
+	}
+	if (py_dwLooksAlive == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwLooksAlive");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwLooksAlive));
+		if (PyLong_Check(py_dwLooksAlive)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwLooksAlive);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwLooksAlive = test_var;
+		} else if (PyInt_Check(py_dwLooksAlive)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwLooksAlive);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwLooksAlive = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwIsAlive == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwIsAlive");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwIsAlive));
+		if (PyLong_Check(py_dwIsAlive)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwIsAlive);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwIsAlive = test_var;
+		} else if (PyInt_Check(py_dwIsAlive)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwIsAlive);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwIsAlive = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateResourceType_args_out(struct clusapi_CreateResourceType *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_DeleteResourceType_args_in(PyObject *args, PyObject *kwargs, struct clusapi_DeleteResourceType *r)
+{
+	PyObject *py_lpszTypeName;
+	const char *kwnames[] = {
+		"lpszTypeName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_DeleteResourceType", discard_const_p(char *, kwnames), &py_lpszTypeName)) {
+		return false;
+	}
+
+	if (py_lpszTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszTypeName");
+		return false;
+	}
+	r->in.lpszTypeName = talloc_ptrtype(r, r->in.lpszTypeName);
+	if (py_lpszTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszTypeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszTypeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszTypeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszTypeName)) {
+			test_str = PyString_AS_STRING(py_lpszTypeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszTypeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszTypeName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_DeleteResourceType_args_out(struct clusapi_DeleteResourceType *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetRootKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetRootKey *r)
+{
+	PyObject *py_samDesired;
+	const char *kwnames[] = {
+		"samDesired", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetRootKey", discard_const_p(char *, kwnames), &py_samDesired)) {
+		return false;
+	}
+
+	if (py_samDesired == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.samDesired");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.samDesired));
+		if (PyLong_Check(py_samDesired)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_samDesired);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.samDesired = test_var;
+		} else if (PyInt_Check(py_samDesired)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_samDesired);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.samDesired = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetRootKey_args_out(struct clusapi_GetRootKey *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_phKey;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_phKey = pytalloc_reference_ex(policy_handle_Type, r->out.phKey, r->out.phKey);
+	PyTuple_SetItem(result, 2, py_phKey);
+	return result;
+}
+
+static bool pack_py_clusapi_CreateKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateKey *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpSubKey;
+	PyObject *py_dwOptions;
+	PyObject *py_samDesired;
+	PyObject *py_lpSecurityAttributes;
+	const char *kwnames[] = {
+		"hKey", "lpSubKey", "dwOptions", "samDesired", "lpSecurityAttributes", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_CreateKey", discard_const_p(char *, kwnames), &py_hKey, &py_lpSubKey, &py_dwOptions, &py_samDesired, &py_lpSecurityAttributes)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_lpSubKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpSubKey");
+		return false;
+	}
+	r->in.lpSubKey = talloc_ptrtype(r, r->in.lpSubKey);
+	if (py_lpSubKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpSubKey");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpSubKey)) {
+			unicode = PyUnicode_AsEncodedString(py_lpSubKey, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpSubKey)) {
+			test_str = PyString_AS_STRING(py_lpSubKey);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpSubKey)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpSubKey = talloc_str;
+	}
+	if (py_dwOptions == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOptions");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOptions));
+		if (PyLong_Check(py_dwOptions)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOptions);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOptions = test_var;
+		} else if (PyInt_Check(py_dwOptions)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOptions);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOptions = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_samDesired == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.samDesired");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.samDesired));
+		if (PyLong_Check(py_samDesired)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_samDesired);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.samDesired = test_var;
+		} else if (PyInt_Check(py_samDesired)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_samDesired);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.samDesired = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpSecurityAttributes == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpSecurityAttributes");
+		return false;
+	}
+	if (py_lpSecurityAttributes == Py_None) {
+		r->in.lpSecurityAttributes = NULL;
+	} else {
+		r->in.lpSecurityAttributes = NULL;
+		if (py_lpSecurityAttributes == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpSecurityAttributes");
+			return false;
+		}
+		PY_CHECK_TYPE(&RPC_SECURITY_ATTRIBUTES_Type, py_lpSecurityAttributes, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_lpSecurityAttributes)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpSecurityAttributes = (struct RPC_SECURITY_ATTRIBUTES *)pytalloc_get_ptr(py_lpSecurityAttributes);
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateKey_args_out(struct clusapi_CreateKey *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwDisposition;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_phKey;
+	result = PyTuple_New(4);
+	py_lpdwDisposition = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwDisposition);
+	PyTuple_SetItem(result, 0, py_lpdwDisposition);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	py_phKey = pytalloc_reference_ex(policy_handle_Type, r->out.phKey, r->out.phKey);
+	PyTuple_SetItem(result, 3, py_phKey);
+	return result;
+}
+
+static bool pack_py_clusapi_OpenKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenKey *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpSubKey;
+	PyObject *py_samDesired;
+	const char *kwnames[] = {
+		"hKey", "lpSubKey", "samDesired", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_OpenKey", discard_const_p(char *, kwnames), &py_hKey, &py_lpSubKey, &py_samDesired)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_lpSubKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpSubKey");
+		return false;
+	}
+	r->in.lpSubKey = talloc_ptrtype(r, r->in.lpSubKey);
+	if (py_lpSubKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpSubKey");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpSubKey)) {
+			unicode = PyUnicode_AsEncodedString(py_lpSubKey, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpSubKey)) {
+			test_str = PyString_AS_STRING(py_lpSubKey);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpSubKey)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpSubKey = talloc_str;
+	}
+	if (py_samDesired == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.samDesired");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.samDesired));
+		if (PyLong_Check(py_samDesired)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_samDesired);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.samDesired = test_var;
+		} else if (PyInt_Check(py_samDesired)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_samDesired);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.samDesired = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenKey_args_out(struct clusapi_OpenKey *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_phKey;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_phKey = pytalloc_reference_ex(policy_handle_Type, r->out.phKey, r->out.phKey);
+	PyTuple_SetItem(result, 2, py_phKey);
+	return result;
+}
+
+static bool pack_py_clusapi_EnumKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_EnumKey *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_dwIndex;
+	const char *kwnames[] = {
+		"hKey", "dwIndex", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_EnumKey", discard_const_p(char *, kwnames), &py_hKey, &py_dwIndex)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_dwIndex == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwIndex");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwIndex));
+		if (PyLong_Check(py_dwIndex)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwIndex);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwIndex = test_var;
+		} else if (PyInt_Check(py_dwIndex)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwIndex);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwIndex = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_EnumKey_args_out(struct clusapi_EnumKey *r)
+{
+	PyObject *result;
+	PyObject *py_KeyName;
+	PyObject *py_lpftLastWriteTime;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	if (*r->out.KeyName == NULL) {
+		py_KeyName = Py_None;
+		Py_INCREF(py_KeyName);
+	} else {
+		if (*r->out.KeyName == NULL) {
+			py_KeyName = Py_None;
+			Py_INCREF(py_KeyName);
+		} else {
+			py_KeyName = PyUnicode_Decode(*r->out.KeyName, strlen(*r->out.KeyName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_KeyName);
+	py_lpftLastWriteTime = ndr_PyLong_FromUnsignedLongLong(*r->out.lpftLastWriteTime);
+	PyTuple_SetItem(result, 1, py_lpftLastWriteTime);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetValue_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetValue *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpValueName;
+	PyObject *py_dwType;
+	PyObject *py_lpData;
+	const char *kwnames[] = {
+		"hKey", "lpValueName", "dwType", "lpData", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_SetValue", discard_const_p(char *, kwnames), &py_hKey, &py_lpValueName, &py_dwType, &py_lpData)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_lpValueName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpValueName");
+		return false;
+	}
+	r->in.lpValueName = talloc_ptrtype(r, r->in.lpValueName);
+	if (py_lpValueName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpValueName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpValueName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpValueName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpValueName)) {
+			test_str = PyString_AS_STRING(py_lpValueName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpValueName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpValueName = talloc_str;
+	}
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpData");
+		return false;
+	}
+	r->in.lpData = talloc_ptrtype(r, r->in.lpData);
+	if (py_lpData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpData");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpData, return false;);
+	{
+		int lpData_cntr_1;
+		r->in.lpData = talloc_array_ptrtype(r, r->in.lpData, PyList_GET_SIZE(py_lpData));
+		if (!r->in.lpData) { return false;; }
+		talloc_set_name_const(r->in.lpData, "ARRAY: r->in.lpData");
+		for (lpData_cntr_1 = 0; lpData_cntr_1 < PyList_GET_SIZE(py_lpData); lpData_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpData, lpData_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpData[lpData_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpData[lpData_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpData, lpData_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpData, lpData_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpData[lpData_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpData, lpData_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpData, lpData_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpData[lpData_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpData, return false;);
+	r->in.cbData = PyList_GET_SIZE(py_lpData);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetValue_args_out(struct clusapi_SetValue *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_DeleteValue_args_in(PyObject *args, PyObject *kwargs, struct clusapi_DeleteValue *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpValueName;
+	const char *kwnames[] = {
+		"hKey", "lpValueName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_DeleteValue", discard_const_p(char *, kwnames), &py_hKey, &py_lpValueName)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_lpValueName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpValueName");
+		return false;
+	}
+	r->in.lpValueName = talloc_ptrtype(r, r->in.lpValueName);
+	if (py_lpValueName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpValueName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpValueName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpValueName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpValueName)) {
+			test_str = PyString_AS_STRING(py_lpValueName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpValueName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpValueName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_DeleteValue_args_out(struct clusapi_DeleteValue *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_QueryValue_args_in(PyObject *args, PyObject *kwargs, struct clusapi_QueryValue *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpValueName;
+	PyObject *py_cbData;
+	const char *kwnames[] = {
+		"hKey", "lpValueName", "cbData", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_QueryValue", discard_const_p(char *, kwnames), &py_hKey, &py_lpValueName, &py_cbData)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_lpValueName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpValueName");
+		return false;
+	}
+	r->in.lpValueName = talloc_ptrtype(r, r->in.lpValueName);
+	if (py_lpValueName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpValueName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpValueName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpValueName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpValueName)) {
+			test_str = PyString_AS_STRING(py_lpValueName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpValueName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpValueName = talloc_str;
+	}
+	if (py_cbData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.cbData");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.cbData));
+		if (PyLong_Check(py_cbData)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_cbData);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.cbData = test_var;
+		} else if (PyInt_Check(py_cbData)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_cbData);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.cbData = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_QueryValue_args_out(struct clusapi_QueryValue *r)
+{
+	PyObject *result;
+	PyObject *py_lpValueType;
+	PyObject *py_lpData;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(4);
+	py_lpValueType = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpValueType);
+	PyTuple_SetItem(result, 0, py_lpValueType);
+	py_lpData = PyList_New(r->in.cbData);
+	if (py_lpData == NULL) {
+		return NULL;
+	}
+	{
+		int lpData_cntr_1;
+		for (lpData_cntr_1 = 0; lpData_cntr_1 < (r->in.cbData); lpData_cntr_1++) {
+			PyObject *py_lpData_1;
+			py_lpData_1 = PyInt_FromLong((uint16_t)r->out.lpData[lpData_cntr_1]);
+			PyList_SetItem(py_lpData, lpData_cntr_1, py_lpData_1);
+		}
+	}
+	PyTuple_SetItem(result, 1, py_lpData);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 2, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 3, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_DeleteKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_DeleteKey *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpSubKey;
+	const char *kwnames[] = {
+		"hKey", "lpSubKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_DeleteKey", discard_const_p(char *, kwnames), &py_hKey, &py_lpSubKey)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_lpSubKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpSubKey");
+		return false;
+	}
+	r->in.lpSubKey = talloc_ptrtype(r, r->in.lpSubKey);
+	if (py_lpSubKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpSubKey");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpSubKey)) {
+			unicode = PyUnicode_AsEncodedString(py_lpSubKey, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpSubKey)) {
+			test_str = PyString_AS_STRING(py_lpSubKey);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpSubKey)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpSubKey = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_DeleteKey_args_out(struct clusapi_DeleteKey *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_EnumValue_args_in(PyObject *args, PyObject *kwargs, struct clusapi_EnumValue *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_dwIndex;
+	const char *kwnames[] = {
+		"hKey", "dwIndex", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_EnumValue", discard_const_p(char *, kwnames), &py_hKey, &py_dwIndex)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_dwIndex == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwIndex");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwIndex));
+		if (PyLong_Check(py_dwIndex)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwIndex);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwIndex = test_var;
+		} else if (PyInt_Check(py_dwIndex)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwIndex);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwIndex = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpcbData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpcbData");
+		return false;
+	}
+	r->in.lpcbData = talloc_ptrtype(r, r->in.lpcbData);
+	if (py_lpcbData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpcbData");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(*r->in.lpcbData));
+		if (PyLong_Check(py_lpcbData)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_lpcbData);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			*r->in.lpcbData = test_var;
+		} else if (PyInt_Check(py_lpcbData)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_lpcbData);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			*r->in.lpcbData = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_EnumValue_args_out(struct clusapi_EnumValue *r)
+{
+	PyObject *result;
+	PyObject *py_lpValueName;
+	PyObject *py_lpType;
+	PyObject *py_lpData;
+	PyObject *py_TotalSize;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(5);
+	if (*r->out.lpValueName == NULL) {
+		py_lpValueName = Py_None;
+		Py_INCREF(py_lpValueName);
+	} else {
+		if (*r->out.lpValueName == NULL) {
+			py_lpValueName = Py_None;
+			Py_INCREF(py_lpValueName);
+		} else {
+			py_lpValueName = PyUnicode_Decode(*r->out.lpValueName, strlen(*r->out.lpValueName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpValueName);
+	py_lpType = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpType);
+	PyTuple_SetItem(result, 1, py_lpType);
+	py_lpData = PyList_New(*r->out.lpcbData);
+	if (py_lpData == NULL) {
+		return NULL;
+	}
+	{
+		int lpData_cntr_1;
+		for (lpData_cntr_1 = 0; lpData_cntr_1 < (*r->out.lpcbData); lpData_cntr_1++) {
+			PyObject *py_lpData_1;
+			py_lpData_1 = PyInt_FromLong((uint16_t)r->out.lpData[lpData_cntr_1]);
+			PyList_SetItem(py_lpData, lpData_cntr_1, py_lpData_1);
+		}
+	}
+	PyTuple_SetItem(result, 2, py_lpData);
+	py_TotalSize = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.TotalSize);
+	PyTuple_SetItem(result, 3, py_TotalSize);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 4, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CloseKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseKey *r)
+{
+	PyObject *py_pKey;
+	const char *kwnames[] = {
+		"pKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseKey", discard_const_p(char *, kwnames), &py_pKey)) {
+		return false;
+	}
+
+	if (py_pKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pKey");
+		return false;
+	}
+	r->in.pKey = talloc_ptrtype(r, r->in.pKey);
+	if (py_pKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_pKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_pKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.pKey = (struct policy_handle *)pytalloc_get_ptr(py_pKey);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseKey_args_out(struct clusapi_CloseKey *r)
+{
+	PyObject *result;
+	PyObject *py_pKey;
+	py_pKey = pytalloc_reference_ex(policy_handle_Type, r->out.pKey, r->out.pKey);
+	result = py_pKey;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_QueryInfoKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_QueryInfoKey *r)
+{
+	PyObject *py_hKey;
+	const char *kwnames[] = {
+		"hKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_QueryInfoKey", discard_const_p(char *, kwnames), &py_hKey)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_QueryInfoKey_args_out(struct clusapi_QueryInfoKey *r)
+{
+	PyObject *result;
+	PyObject *py_lpcSubKeys;
+	PyObject *py_lpcbMaxSubKeyLen;
+	PyObject *py_lpcValues;
+	PyObject *py_lpcbMaxValueNameLen;
+	PyObject *py_lpcbMaxValueLen;
+	PyObject *py_lpcbSecurityDescriptor;
+	PyObject *py_lpftLastWriteTime;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(8);
+	py_lpcSubKeys = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcSubKeys);
+	PyTuple_SetItem(result, 0, py_lpcSubKeys);
+	py_lpcbMaxSubKeyLen = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbMaxSubKeyLen);
+	PyTuple_SetItem(result, 1, py_lpcbMaxSubKeyLen);
+	py_lpcValues = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcValues);
+	PyTuple_SetItem(result, 2, py_lpcValues);
+	py_lpcbMaxValueNameLen = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbMaxValueNameLen);
+	PyTuple_SetItem(result, 3, py_lpcbMaxValueNameLen);
+	py_lpcbMaxValueLen = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbMaxValueLen);
+	PyTuple_SetItem(result, 4, py_lpcbMaxValueLen);
+	py_lpcbSecurityDescriptor = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbSecurityDescriptor);
+	PyTuple_SetItem(result, 5, py_lpcbSecurityDescriptor);
+	py_lpftLastWriteTime = ndr_PyLong_FromUnsignedLongLong(*r->out.lpftLastWriteTime);
+	PyTuple_SetItem(result, 6, py_lpftLastWriteTime);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 7, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetKeySecurity_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetKeySecurity *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_SecurityInformation;
+	PyObject *py_pRpcSecurityDescriptor;
+	const char *kwnames[] = {
+		"hKey", "SecurityInformation", "pRpcSecurityDescriptor", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_SetKeySecurity", discard_const_p(char *, kwnames), &py_hKey, &py_SecurityInformation, &py_pRpcSecurityDescriptor)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_SecurityInformation == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.SecurityInformation");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.SecurityInformation));
+		if (PyLong_Check(py_SecurityInformation)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_SecurityInformation);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.SecurityInformation = test_var;
+		} else if (PyInt_Check(py_SecurityInformation)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_SecurityInformation);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.SecurityInformation = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_pRpcSecurityDescriptor == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pRpcSecurityDescriptor");
+		return false;
+	}
+	r->in.pRpcSecurityDescriptor = talloc_ptrtype(r, r->in.pRpcSecurityDescriptor);
+	if (py_pRpcSecurityDescriptor == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pRpcSecurityDescriptor");
+		return false;
+	}
+	PY_CHECK_TYPE(&RPC_SECURITY_DESCRIPTOR_Type, py_pRpcSecurityDescriptor, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_pRpcSecurityDescriptor)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.pRpcSecurityDescriptor = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(py_pRpcSecurityDescriptor);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetKeySecurity_args_out(struct clusapi_SetKeySecurity *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetKeySecurity_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetKeySecurity *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_SecurityInformation;
+	PyObject *py_pRpcSecurityDescriptor;
+	const char *kwnames[] = {
+		"hKey", "SecurityInformation", "pRpcSecurityDescriptor", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_GetKeySecurity", discard_const_p(char *, kwnames), &py_hKey, &py_SecurityInformation, &py_pRpcSecurityDescriptor)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_SecurityInformation == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.SecurityInformation");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.SecurityInformation));
+		if (PyLong_Check(py_SecurityInformation)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_SecurityInformation);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.SecurityInformation = test_var;
+		} else if (PyInt_Check(py_SecurityInformation)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_SecurityInformation);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.SecurityInformation = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_pRpcSecurityDescriptor == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pRpcSecurityDescriptor");
+		return false;
+	}
+	r->in.pRpcSecurityDescriptor = talloc_ptrtype(r, r->in.pRpcSecurityDescriptor);
+	if (py_pRpcSecurityDescriptor == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pRpcSecurityDescriptor");
+		return false;
+	}
+	PY_CHECK_TYPE(&RPC_SECURITY_DESCRIPTOR_Type, py_pRpcSecurityDescriptor, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_pRpcSecurityDescriptor)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.pRpcSecurityDescriptor = (struct RPC_SECURITY_DESCRIPTOR *)pytalloc_get_ptr(py_pRpcSecurityDescriptor);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetKeySecurity_args_out(struct clusapi_GetKeySecurity *r)
+{
+	PyObject *result;
+	PyObject *py_pRpcSecurityDescriptor;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_pRpcSecurityDescriptor = pytalloc_reference_ex(&RPC_SECURITY_DESCRIPTOR_Type, r->out.pRpcSecurityDescriptor, r->out.pRpcSecurityDescriptor);
+	PyTuple_SetItem(result, 0, py_pRpcSecurityDescriptor);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OpenGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenGroup *r)
+{
+	PyObject *py_lpszGroupName;
+	const char *kwnames[] = {
+		"lpszGroupName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OpenGroup", discard_const_p(char *, kwnames), &py_lpszGroupName)) {
+		return false;
+	}
+
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszGroupName");
+		return false;
+	}
+	r->in.lpszGroupName = talloc_ptrtype(r, r->in.lpszGroupName);
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszGroupName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszGroupName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszGroupName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszGroupName)) {
+			test_str = PyString_AS_STRING(py_lpszGroupName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszGroupName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszGroupName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenGroup_args_out(struct clusapi_OpenGroup *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hGroup;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hGroup = pytalloc_reference_ex(policy_handle_Type, r->out.hGroup, r->out.hGroup);
+	PyTuple_SetItem(result, 2, py_hGroup);
+	return result;
+}
+
+static bool pack_py_clusapi_CreateGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateGroup *r)
+{
+	PyObject *py_lpszGroupName;
+	const char *kwnames[] = {
+		"lpszGroupName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CreateGroup", discard_const_p(char *, kwnames), &py_lpszGroupName)) {
+		return false;
+	}
+
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszGroupName");
+		return false;
+	}
+	r->in.lpszGroupName = talloc_ptrtype(r, r->in.lpszGroupName);
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszGroupName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszGroupName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszGroupName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszGroupName)) {
+			test_str = PyString_AS_STRING(py_lpszGroupName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszGroupName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszGroupName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateGroup_args_out(struct clusapi_CreateGroup *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hGroup;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hGroup = pytalloc_reference_ex(policy_handle_Type, r->out.hGroup, r->out.hGroup);
+	PyTuple_SetItem(result, 2, py_hGroup);
+	return result;
+}
+
+static bool pack_py_clusapi_DeleteGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_DeleteGroup *r)
+{
+	PyObject *py_Group;
+	PyObject *py_force;
+	const char *kwnames[] = {
+		"Group", "force", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_DeleteGroup", discard_const_p(char *, kwnames), &py_Group, &py_force)) {
+		return false;
+	}
+
+	if (py_Group == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Group");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Group, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Group)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Group = *(struct policy_handle *)pytalloc_get_ptr(py_Group);
+	if (py_force == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.force");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.force));
+		if (PyLong_Check(py_force)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_force);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.force = test_var;
+		} else if (PyInt_Check(py_force)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_force);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.force = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_DeleteGroup_args_out(struct clusapi_DeleteGroup *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CloseGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseGroup *r)
+{
+	PyObject *py_Group;
+	const char *kwnames[] = {
+		"Group", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseGroup", discard_const_p(char *, kwnames), &py_Group)) {
+		return false;
+	}
+
+	if (py_Group == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Group");
+		return false;
+	}
+	r->in.Group = talloc_ptrtype(r, r->in.Group);
+	if (py_Group == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.Group");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Group, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Group)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Group = (struct policy_handle *)pytalloc_get_ptr(py_Group);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseGroup_args_out(struct clusapi_CloseGroup *r)
+{
+	PyObject *result;
+	PyObject *py_Group;
+	py_Group = pytalloc_reference_ex(policy_handle_Type, r->out.Group, r->out.Group);
+	result = py_Group;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetGroupState_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetGroupState *r)
+{
+	PyObject *py_hGroup;
+	const char *kwnames[] = {
+		"hGroup", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetGroupState", discard_const_p(char *, kwnames), &py_hGroup)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetGroupState_args_out(struct clusapi_GetGroupState *r)
+{
+	PyObject *result;
+	PyObject *py_State;
+	PyObject *py_NodeName;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_State = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.State);
+	PyTuple_SetItem(result, 0, py_State);
+	if (*r->out.NodeName == NULL) {
+		py_NodeName = Py_None;
+		Py_INCREF(py_NodeName);
+	} else {
+		if (*r->out.NodeName == NULL) {
+			py_NodeName = Py_None;
+			Py_INCREF(py_NodeName);
+		} else {
+			py_NodeName = PyUnicode_Decode(*r->out.NodeName, strlen(*r->out.NodeName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 1, py_NodeName);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetGroupName_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetGroupName *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_lpszGroupName;
+	const char *kwnames[] = {
+		"hGroup", "lpszGroupName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_SetGroupName", discard_const_p(char *, kwnames), &py_hGroup, &py_lpszGroupName)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszGroupName");
+		return false;
+	}
+	r->in.lpszGroupName = talloc_ptrtype(r, r->in.lpszGroupName);
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszGroupName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszGroupName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszGroupName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszGroupName)) {
+			test_str = PyString_AS_STRING(py_lpszGroupName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszGroupName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszGroupName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetGroupName_args_out(struct clusapi_SetGroupName *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetGroupId_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetGroupId *r)
+{
+	PyObject *py_hGroup;
+	const char *kwnames[] = {
+		"hGroup", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetGroupId", discard_const_p(char *, kwnames), &py_hGroup)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetGroupId_args_out(struct clusapi_GetGroupId *r)
+{
+	PyObject *result;
+	PyObject *py_pGuid;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.pGuid == NULL) {
+		py_pGuid = Py_None;
+		Py_INCREF(py_pGuid);
+	} else {
+		if (*r->out.pGuid == NULL) {
+			py_pGuid = Py_None;
+			Py_INCREF(py_pGuid);
+		} else {
+			py_pGuid = PyUnicode_Decode(*r->out.pGuid, strlen(*r->out.pGuid), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_pGuid);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNodeId_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNodeId *r)
+{
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNodeId", discard_const_p(char *, kwnames), &py_hNode)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNodeId_args_out(struct clusapi_GetNodeId *r)
+{
+	PyObject *result;
+	PyObject *py_pGuid;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.pGuid == NULL) {
+		py_pGuid = Py_None;
+		Py_INCREF(py_pGuid);
+	} else {
+		if (*r->out.pGuid == NULL) {
+			py_pGuid = Py_None;
+			Py_INCREF(py_pGuid);
+		} else {
+			py_pGuid = PyUnicode_Decode(*r->out.pGuid, strlen(*r->out.pGuid), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_pGuid);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OnlineGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OnlineGroup *r)
+{
+	PyObject *py_hGroup;
+	const char *kwnames[] = {
+		"hGroup", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OnlineGroup", discard_const_p(char *, kwnames), &py_hGroup)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OnlineGroup_args_out(struct clusapi_OnlineGroup *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OfflineGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OfflineGroup *r)
+{
+	PyObject *py_hGroup;
+	const char *kwnames[] = {
+		"hGroup", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OfflineGroup", discard_const_p(char *, kwnames), &py_hGroup)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OfflineGroup_args_out(struct clusapi_OfflineGroup *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_MoveGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_MoveGroup *r)
+{
+	PyObject *py_hGroup;
+	const char *kwnames[] = {
+		"hGroup", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_MoveGroup", discard_const_p(char *, kwnames), &py_hGroup)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_MoveGroup_args_out(struct clusapi_MoveGroup *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_MoveGroupToNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_MoveGroupToNode *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hGroup", "hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_MoveGroupToNode", discard_const_p(char *, kwnames), &py_hGroup, &py_hNode)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_MoveGroupToNode_args_out(struct clusapi_MoveGroupToNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateGroupResourceEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateGroupResourceEnum *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_dwType;
+	const char *kwnames[] = {
+		"hGroup", "dwType", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CreateGroupResourceEnum", discard_const_p(char *, kwnames), &py_hGroup, &py_dwType)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateGroupResourceEnum_args_out(struct clusapi_CreateGroupResourceEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ReturnEnum == NULL) {
+		py_ReturnEnum = Py_None;
+		Py_INCREF(py_ReturnEnum);
+	} else {
+		py_ReturnEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnEnum, *r->out.ReturnEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetGroupNodeList_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetGroupNodeList *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_multiSzNodeList;
+	const char *kwnames[] = {
+		"hGroup", "multiSzNodeList", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_SetGroupNodeList", discard_const_p(char *, kwnames), &py_hGroup, &py_multiSzNodeList)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_multiSzNodeList == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.multiSzNodeList");
+		return false;
+	}
+	if (py_multiSzNodeList == Py_None) {
+		r->in.multiSzNodeList = NULL;
+	} else {
+		r->in.multiSzNodeList = NULL;
+		if (py_multiSzNodeList == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.multiSzNodeList");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_multiSzNodeList, return false;);
+		{
+			int multiSzNodeList_cntr_1;
+			r->in.multiSzNodeList = talloc_array_ptrtype(r, r->in.multiSzNodeList, PyList_GET_SIZE(py_multiSzNodeList));
+			if (!r->in.multiSzNodeList) { return false;; }
+			talloc_set_name_const(r->in.multiSzNodeList, "ARRAY: r->in.multiSzNodeList");
+			for (multiSzNodeList_cntr_1 = 0; multiSzNodeList_cntr_1 < PyList_GET_SIZE(py_multiSzNodeList); multiSzNodeList_cntr_1++) {
+				if (PyList_GET_ITEM(py_multiSzNodeList, multiSzNodeList_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.multiSzNodeList[multiSzNodeList_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.multiSzNodeList[multiSzNodeList_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_multiSzNodeList, multiSzNodeList_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_multiSzNodeList, multiSzNodeList_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.multiSzNodeList[multiSzNodeList_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_multiSzNodeList, multiSzNodeList_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_multiSzNodeList, multiSzNodeList_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.multiSzNodeList[multiSzNodeList_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_multiSzNodeList, return false;);
+	r->in.cchListSize = PyList_GET_SIZE(py_multiSzNodeList);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetGroupNodeList_args_out(struct clusapi_SetGroupNodeList *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateNotify_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateNotify *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_CreateNotify", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateNotify_args_out(struct clusapi_CreateNotify *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNotify;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hNotify = pytalloc_reference_ex(policy_handle_Type, r->out.hNotify, r->out.hNotify);
+	PyTuple_SetItem(result, 2, py_hNotify);
+	return result;
+}
+
+static bool pack_py_clusapi_CloseNotify_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseNotify *r)
+{
+	PyObject *py_Notify;
+	const char *kwnames[] = {
+		"Notify", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseNotify", discard_const_p(char *, kwnames), &py_Notify)) {
+		return false;
+	}
+
+	if (py_Notify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Notify");
+		return false;
+	}
+	r->in.Notify = talloc_ptrtype(r, r->in.Notify);
+	if (py_Notify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.Notify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Notify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Notify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Notify = (struct policy_handle *)pytalloc_get_ptr(py_Notify);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseNotify_args_out(struct clusapi_CloseNotify *r)
+{
+	PyObject *result;
+	PyObject *py_Notify;
+	py_Notify = pytalloc_reference_ex(policy_handle_Type, r->out.Notify, r->out.Notify);
+	result = py_Notify;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyCluster_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyCluster *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hCluster;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	const char *kwnames[] = {
+		"hNotify", "hCluster", "dwFilter", "dwNotifyKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_AddNotifyCluster", discard_const_p(char *, kwnames), &py_hNotify, &py_hCluster, &py_dwFilter, &py_dwNotifyKey)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyCluster_args_out(struct clusapi_AddNotifyCluster *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyNode *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hNode;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	const char *kwnames[] = {
+		"hNotify", "hNode", "dwFilter", "dwNotifyKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_AddNotifyNode", discard_const_p(char *, kwnames), &py_hNotify, &py_hNode, &py_dwFilter, &py_dwNotifyKey)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyNode_args_out(struct clusapi_AddNotifyNode *r)
+{
+	PyObject *result;
+	PyObject *py_dwStateSequence;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_dwStateSequence = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwStateSequence);
+	PyTuple_SetItem(result, 0, py_dwStateSequence);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyGroup *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hGroup;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	const char *kwnames[] = {
+		"hNotify", "hGroup", "dwFilter", "dwNotifyKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_AddNotifyGroup", discard_const_p(char *, kwnames), &py_hNotify, &py_hGroup, &py_dwFilter, &py_dwNotifyKey)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyGroup_args_out(struct clusapi_AddNotifyGroup *r)
+{
+	PyObject *result;
+	PyObject *py_dwStateSequence;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_dwStateSequence = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwStateSequence);
+	PyTuple_SetItem(result, 0, py_dwStateSequence);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyResource *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hResource;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	const char *kwnames[] = {
+		"hNotify", "hResource", "dwFilter", "dwNotifyKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_AddNotifyResource", discard_const_p(char *, kwnames), &py_hNotify, &py_hResource, &py_dwFilter, &py_dwNotifyKey)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyResource_args_out(struct clusapi_AddNotifyResource *r)
+{
+	PyObject *result;
+	PyObject *py_dwStateSequence;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_dwStateSequence = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwStateSequence);
+	PyTuple_SetItem(result, 0, py_dwStateSequence);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyKey_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyKey *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hKey;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_Filter;
+	PyObject *py_WatchSubTree;
+	const char *kwnames[] = {
+		"hNotify", "hKey", "dwNotifyKey", "Filter", "WatchSubTree", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_AddNotifyKey", discard_const_p(char *, kwnames), &py_hNotify, &py_hKey, &py_dwNotifyKey, &py_Filter, &py_WatchSubTree)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_Filter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Filter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.Filter));
+		if (PyLong_Check(py_Filter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_Filter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.Filter = test_var;
+		} else if (PyInt_Check(py_Filter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_Filter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.Filter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_WatchSubTree == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.WatchSubTree");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.WatchSubTree));
+		if (PyLong_Check(py_WatchSubTree)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_WatchSubTree);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.WatchSubTree = test_var;
+		} else if (PyInt_Check(py_WatchSubTree)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_WatchSubTree);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.WatchSubTree = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyKey_args_out(struct clusapi_AddNotifyKey *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ReAddNotifyNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ReAddNotifyNode *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hNode;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_StateSequence;
+	const char *kwnames[] = {
+		"hNotify", "hNode", "dwFilter", "dwNotifyKey", "StateSequence", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_ReAddNotifyNode", discard_const_p(char *, kwnames), &py_hNotify, &py_hNode, &py_dwFilter, &py_dwNotifyKey, &py_StateSequence)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_StateSequence == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.StateSequence");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.StateSequence));
+		if (PyLong_Check(py_StateSequence)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_StateSequence);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else if (PyInt_Check(py_StateSequence)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_StateSequence);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ReAddNotifyNode_args_out(struct clusapi_ReAddNotifyNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ReAddNotifyGroup_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ReAddNotifyGroup *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hGroup;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_StateSequence;
+	const char *kwnames[] = {
+		"hNotify", "hGroup", "dwFilter", "dwNotifyKey", "StateSequence", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_ReAddNotifyGroup", discard_const_p(char *, kwnames), &py_hNotify, &py_hGroup, &py_dwFilter, &py_dwNotifyKey, &py_StateSequence)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_StateSequence == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.StateSequence");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.StateSequence));
+		if (PyLong_Check(py_StateSequence)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_StateSequence);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else if (PyInt_Check(py_StateSequence)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_StateSequence);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ReAddNotifyGroup_args_out(struct clusapi_ReAddNotifyGroup *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ReAddNotifyResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ReAddNotifyResource *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hResource;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_StateSequence;
+	const char *kwnames[] = {
+		"hNotify", "hResource", "dwFilter", "dwNotifyKey", "StateSequence", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_ReAddNotifyResource", discard_const_p(char *, kwnames), &py_hNotify, &py_hResource, &py_dwFilter, &py_dwNotifyKey, &py_StateSequence)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_StateSequence == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.StateSequence");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.StateSequence));
+		if (PyLong_Check(py_StateSequence)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_StateSequence);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else if (PyInt_Check(py_StateSequence)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_StateSequence);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ReAddNotifyResource_args_out(struct clusapi_ReAddNotifyResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNotify_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNotify *r)
+{
+	PyObject *py_hNotify;
+	const char *kwnames[] = {
+		"hNotify", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNotify", discard_const_p(char *, kwnames), &py_hNotify)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNotify_args_out(struct clusapi_GetNotify *r)
+{
+	PyObject *result;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_dwFilter;
+	PyObject *py_dwStateSequence;
+	PyObject *py_Name;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(5);
+	py_dwNotifyKey = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwNotifyKey);
+	PyTuple_SetItem(result, 0, py_dwNotifyKey);
+	py_dwFilter = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwFilter);
+	PyTuple_SetItem(result, 1, py_dwFilter);
+	py_dwStateSequence = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwStateSequence);
+	PyTuple_SetItem(result, 2, py_dwStateSequence);
+	if (*r->out.Name == NULL) {
+		py_Name = Py_None;
+		Py_INCREF(py_Name);
+	} else {
+		if (*r->out.Name == NULL) {
+			py_Name = Py_None;
+			Py_INCREF(py_Name);
+		} else {
+			py_Name = PyUnicode_Decode(*r->out.Name, strlen(*r->out.Name), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 3, py_Name);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 4, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OpenNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenNode *r)
+{
+	PyObject *py_lpszNodeName;
+	const char *kwnames[] = {
+		"lpszNodeName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OpenNode", discard_const_p(char *, kwnames), &py_lpszNodeName)) {
+		return false;
+	}
+
+	if (py_lpszNodeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNodeName");
+		return false;
+	}
+	r->in.lpszNodeName = talloc_ptrtype(r, r->in.lpszNodeName);
+	if (py_lpszNodeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNodeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNodeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNodeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNodeName)) {
+			test_str = PyString_AS_STRING(py_lpszNodeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNodeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNodeName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenNode_args_out(struct clusapi_OpenNode *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNode;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hNode = pytalloc_reference_ex(policy_handle_Type, r->out.hNode, r->out.hNode);
+	PyTuple_SetItem(result, 2, py_hNode);
+	return result;
+}
+
+static bool pack_py_clusapi_CloseNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseNode *r)
+{
+	PyObject *py_Node;
+	const char *kwnames[] = {
+		"Node", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseNode", discard_const_p(char *, kwnames), &py_Node)) {
+		return false;
+	}
+
+	if (py_Node == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Node");
+		return false;
+	}
+	r->in.Node = talloc_ptrtype(r, r->in.Node);
+	if (py_Node == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.Node");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Node, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Node)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Node = (struct policy_handle *)pytalloc_get_ptr(py_Node);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseNode_args_out(struct clusapi_CloseNode *r)
+{
+	PyObject *result;
+	PyObject *py_Node;
+	py_Node = pytalloc_reference_ex(policy_handle_Type, r->out.Node, r->out.Node);
+	result = py_Node;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNodeState_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNodeState *r)
+{
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNodeState", discard_const_p(char *, kwnames), &py_hNode)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNodeState_args_out(struct clusapi_GetNodeState *r)
+{
+	PyObject *result;
+	PyObject *py_State;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_State = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.State);
+	PyTuple_SetItem(result, 0, py_State);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_PauseNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_PauseNode *r)
+{
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_PauseNode", discard_const_p(char *, kwnames), &py_hNode)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_PauseNode_args_out(struct clusapi_PauseNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ResumeNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ResumeNode *r)
+{
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_ResumeNode", discard_const_p(char *, kwnames), &py_hNode)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ResumeNode_args_out(struct clusapi_ResumeNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_EvictNode_args_in(PyObject *args, PyObject *kwargs, struct clusapi_EvictNode *r)
+{
+	PyObject *py_hNode;
+	const char *kwnames[] = {
+		"hNode", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_EvictNode", discard_const_p(char *, kwnames), &py_hNode)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_EvictNode_args_out(struct clusapi_EvictNode *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeResourceControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeResourceControl *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_hNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hResource", "hNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_NodeResourceControl", discard_const_p(char *, kwnames), &py_hResource, &py_hNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeResourceControl_args_out(struct clusapi_NodeResourceControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ResourceControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ResourceControl *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hResource", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_ResourceControl", discard_const_p(char *, kwnames), &py_hResource, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ResourceControl_args_out(struct clusapi_ResourceControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeResourceTypeControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeResourceTypeControl *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_lpszResourceTypeName;
+	PyObject *py_hNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hCluster", "lpszResourceTypeName", "hNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:clusapi_NodeResourceTypeControl", discard_const_p(char *, kwnames), &py_hCluster, &py_lpszResourceTypeName, &py_hNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_lpszResourceTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceTypeName");
+		return false;
+	}
+	r->in.lpszResourceTypeName = talloc_ptrtype(r, r->in.lpszResourceTypeName);
+	if (py_lpszResourceTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceTypeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceTypeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceTypeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceTypeName)) {
+			test_str = PyString_AS_STRING(py_lpszResourceTypeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceTypeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceTypeName = talloc_str;
+	}
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeResourceTypeControl_args_out(struct clusapi_NodeResourceTypeControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ResourceTypeControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ResourceTypeControl *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_lpszResourceTypeName;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hCluster", "lpszResourceTypeName", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_ResourceTypeControl", discard_const_p(char *, kwnames), &py_hCluster, &py_lpszResourceTypeName, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_lpszResourceTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceTypeName");
+		return false;
+	}
+	r->in.lpszResourceTypeName = talloc_ptrtype(r, r->in.lpszResourceTypeName);
+	if (py_lpszResourceTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceTypeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceTypeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceTypeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceTypeName)) {
+			test_str = PyString_AS_STRING(py_lpszResourceTypeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceTypeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceTypeName = talloc_str;
+	}
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ResourceTypeControl_args_out(struct clusapi_ResourceTypeControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeGroupControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeGroupControl *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_hNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hGroup", "hNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_NodeGroupControl", discard_const_p(char *, kwnames), &py_hGroup, &py_hNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeGroupControl_args_out(struct clusapi_NodeGroupControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GroupControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GroupControl *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hGroup", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_GroupControl", discard_const_p(char *, kwnames), &py_hGroup, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GroupControl_args_out(struct clusapi_GroupControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeNodeControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeNodeControl *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_hHostNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hNode", "hHostNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_NodeNodeControl", discard_const_p(char *, kwnames), &py_hNode, &py_hHostNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_hHostNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hHostNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hHostNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hHostNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hHostNode = *(struct policy_handle *)pytalloc_get_ptr(py_hHostNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeNodeControl_args_out(struct clusapi_NodeNodeControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeControl *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_NodeControl", discard_const_p(char *, kwnames), &py_hNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeControl_args_out(struct clusapi_NodeControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_Opnum80NotUsedOnWire_args_in(PyObject *args, PyObject *kwargs, struct Opnum80NotUsedOnWire *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":Opnum80NotUsedOnWire", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_Opnum80NotUsedOnWire_args_out(struct Opnum80NotUsedOnWire *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OpenNetwork_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenNetwork *r)
+{
+	PyObject *py_lpszNetworkName;
+	const char *kwnames[] = {
+		"lpszNetworkName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OpenNetwork", discard_const_p(char *, kwnames), &py_lpszNetworkName)) {
+		return false;
+	}
+
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNetworkName");
+		return false;
+	}
+	r->in.lpszNetworkName = talloc_ptrtype(r, r->in.lpszNetworkName);
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNetworkName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNetworkName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNetworkName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNetworkName)) {
+			test_str = PyString_AS_STRING(py_lpszNetworkName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNetworkName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNetworkName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenNetwork_args_out(struct clusapi_OpenNetwork *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNetwork;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hNetwork = pytalloc_reference_ex(policy_handle_Type, r->out.hNetwork, r->out.hNetwork);
+	PyTuple_SetItem(result, 2, py_hNetwork);
+	return result;
+}
+
+static bool pack_py_clusapi_CloseNetwork_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseNetwork *r)
+{
+	PyObject *py_Network;
+	const char *kwnames[] = {
+		"Network", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseNetwork", discard_const_p(char *, kwnames), &py_Network)) {
+		return false;
+	}
+
+	if (py_Network == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Network");
+		return false;
+	}
+	r->in.Network = talloc_ptrtype(r, r->in.Network);
+	if (py_Network == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.Network");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_Network, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_Network)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.Network = (struct policy_handle *)pytalloc_get_ptr(py_Network);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseNetwork_args_out(struct clusapi_CloseNetwork *r)
+{
+	PyObject *result;
+	PyObject *py_Network;
+	py_Network = pytalloc_reference_ex(policy_handle_Type, r->out.Network, r->out.Network);
+	result = py_Network;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNetworkState_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNetworkState *r)
+{
+	PyObject *py_hNetwork;
+	const char *kwnames[] = {
+		"hNetwork", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNetworkState", discard_const_p(char *, kwnames), &py_hNetwork)) {
+		return false;
+	}
+
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNetworkState_args_out(struct clusapi_GetNetworkState *r)
+{
+	PyObject *result;
+	PyObject *py_State;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_State = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.State);
+	PyTuple_SetItem(result, 0, py_State);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetNetworkName_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetNetworkName *r)
+{
+	PyObject *py_hNetwork;
+	PyObject *py_lpszNetworkName;
+	const char *kwnames[] = {
+		"hNetwork", "lpszNetworkName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_SetNetworkName", discard_const_p(char *, kwnames), &py_hNetwork, &py_lpszNetworkName)) {
+		return false;
+	}
+
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNetworkName");
+		return false;
+	}
+	r->in.lpszNetworkName = talloc_ptrtype(r, r->in.lpszNetworkName);
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNetworkName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNetworkName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNetworkName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNetworkName)) {
+			test_str = PyString_AS_STRING(py_lpszNetworkName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNetworkName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNetworkName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetNetworkName_args_out(struct clusapi_SetNetworkName *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateNetworkEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateNetworkEnum *r)
+{
+	PyObject *py_hNetwork;
+	PyObject *py_dwType;
+	const char *kwnames[] = {
+		"hNetwork", "dwType", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CreateNetworkEnum", discard_const_p(char *, kwnames), &py_hNetwork, &py_dwType)) {
+		return false;
+	}
+
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateNetworkEnum_args_out(struct clusapi_CreateNetworkEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ReturnEnum == NULL) {
+		py_ReturnEnum = Py_None;
+		Py_INCREF(py_ReturnEnum);
+	} else {
+		py_ReturnEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnEnum, *r->out.ReturnEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNetworkId_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNetworkId *r)
+{
+	PyObject *py_hNetwork;
+	const char *kwnames[] = {
+		"hNetwork", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNetworkId", discard_const_p(char *, kwnames), &py_hNetwork)) {
+		return false;
+	}
+
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNetworkId_args_out(struct clusapi_GetNetworkId *r)
+{
+	PyObject *result;
+	PyObject *py_pGuid;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.pGuid == NULL) {
+		py_pGuid = Py_None;
+		Py_INCREF(py_pGuid);
+	} else {
+		if (*r->out.pGuid == NULL) {
+			py_pGuid = Py_None;
+			Py_INCREF(py_pGuid);
+		} else {
+			py_pGuid = PyUnicode_Decode(*r->out.pGuid, strlen(*r->out.pGuid), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_pGuid);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetNetworkPriorityOrder_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetNetworkPriorityOrder *r)
+{
+	PyObject *py_NetworkIdList;
+	const char *kwnames[] = {
+		"NetworkIdList", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_SetNetworkPriorityOrder", discard_const_p(char *, kwnames), &py_NetworkIdList)) {
+		return false;
+	}
+
+	PY_CHECK_TYPE(&PyList_Type, py_NetworkIdList, return false;);
+	r->in.NetworkCount = PyList_GET_SIZE(py_NetworkIdList);
+	if (py_NetworkIdList == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.NetworkIdList");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_NetworkIdList)) {
+			unicode = PyUnicode_AsEncodedString(py_NetworkIdList, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_NetworkIdList)) {
+			test_str = PyString_AS_STRING(py_NetworkIdList);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_NetworkIdList)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.NetworkIdList = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetNetworkPriorityOrder_args_out(struct clusapi_SetNetworkPriorityOrder *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeNetworkControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeNetworkControl *r)
+{
+	PyObject *py_hNetwork;
+	PyObject *py_hNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hNetwork", "hNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_NodeNetworkControl", discard_const_p(char *, kwnames), &py_hNetwork, &py_hNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeNetworkControl_args_out(struct clusapi_NodeNetworkControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NetworkControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NetworkControl *r)
+{
+	PyObject *py_hNetwork;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hNetwork", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_NetworkControl", discard_const_p(char *, kwnames), &py_hNetwork, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NetworkControl_args_out(struct clusapi_NetworkControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyNetwork_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyNetwork *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hNetwork;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	const char *kwnames[] = {
+		"hNotify", "hNetwork", "dwFilter", "dwNotifyKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_AddNotifyNetwork", discard_const_p(char *, kwnames), &py_hNotify, &py_hNetwork, &py_dwFilter, &py_dwNotifyKey)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyNetwork_args_out(struct clusapi_AddNotifyNetwork *r)
+{
+	PyObject *result;
+	PyObject *py_dwStateSequence;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_dwStateSequence = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwStateSequence);
+	PyTuple_SetItem(result, 0, py_dwStateSequence);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ReAddNotifyNetwork_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ReAddNotifyNetwork *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hNetwork;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_StateSequence;
+	const char *kwnames[] = {
+		"hNotify", "hNetwork", "dwFilter", "dwNotifyKey", "StateSequence", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_ReAddNotifyNetwork", discard_const_p(char *, kwnames), &py_hNotify, &py_hNetwork, &py_dwFilter, &py_dwNotifyKey, &py_StateSequence)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hNetwork == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetwork");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetwork, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetwork)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetwork = *(struct policy_handle *)pytalloc_get_ptr(py_hNetwork);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_StateSequence == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.StateSequence");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.StateSequence));
+		if (PyLong_Check(py_StateSequence)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_StateSequence);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else if (PyInt_Check(py_StateSequence)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_StateSequence);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ReAddNotifyNetwork_args_out(struct clusapi_ReAddNotifyNetwork *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OpenNetInterface_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenNetInterface *r)
+{
+	PyObject *py_lpszNetInterfaceName;
+	const char *kwnames[] = {
+		"lpszNetInterfaceName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OpenNetInterface", discard_const_p(char *, kwnames), &py_lpszNetInterfaceName)) {
+		return false;
+	}
+
+	if (py_lpszNetInterfaceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNetInterfaceName");
+		return false;
+	}
+	r->in.lpszNetInterfaceName = talloc_ptrtype(r, r->in.lpszNetInterfaceName);
+	if (py_lpszNetInterfaceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNetInterfaceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNetInterfaceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNetInterfaceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNetInterfaceName)) {
+			test_str = PyString_AS_STRING(py_lpszNetInterfaceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNetInterfaceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNetInterfaceName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenNetInterface_args_out(struct clusapi_OpenNetInterface *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNetInterface;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hNetInterface = pytalloc_reference_ex(policy_handle_Type, r->out.hNetInterface, r->out.hNetInterface);
+	PyTuple_SetItem(result, 2, py_hNetInterface);
+	return result;
+}
+
+static bool pack_py_clusapi_CloseNetInterface_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseNetInterface *r)
+{
+	PyObject *py_NetInterface;
+	const char *kwnames[] = {
+		"NetInterface", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseNetInterface", discard_const_p(char *, kwnames), &py_NetInterface)) {
+		return false;
+	}
+
+	if (py_NetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.NetInterface");
+		return false;
+	}
+	r->in.NetInterface = talloc_ptrtype(r, r->in.NetInterface);
+	if (py_NetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.NetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_NetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_NetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.NetInterface = (struct policy_handle *)pytalloc_get_ptr(py_NetInterface);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseNetInterface_args_out(struct clusapi_CloseNetInterface *r)
+{
+	PyObject *result;
+	PyObject *py_NetInterface;
+	py_NetInterface = pytalloc_reference_ex(policy_handle_Type, r->out.NetInterface, r->out.NetInterface);
+	result = py_NetInterface;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNetInterfaceState_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNetInterfaceState *r)
+{
+	PyObject *py_hNetInterface;
+	const char *kwnames[] = {
+		"hNetInterface", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNetInterfaceState", discard_const_p(char *, kwnames), &py_hNetInterface)) {
+		return false;
+	}
+
+	if (py_hNetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetInterface = *(struct policy_handle *)pytalloc_get_ptr(py_hNetInterface);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNetInterfaceState_args_out(struct clusapi_GetNetInterfaceState *r)
+{
+	PyObject *result;
+	PyObject *py_State;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_State = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.State);
+	PyTuple_SetItem(result, 0, py_State);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNetInterface_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNetInterface *r)
+{
+	PyObject *py_lpszNodeName;
+	PyObject *py_lpszNetworkName;
+	const char *kwnames[] = {
+		"lpszNodeName", "lpszNetworkName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_GetNetInterface", discard_const_p(char *, kwnames), &py_lpszNodeName, &py_lpszNetworkName)) {
+		return false;
+	}
+
+	if (py_lpszNodeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNodeName");
+		return false;
+	}
+	r->in.lpszNodeName = talloc_ptrtype(r, r->in.lpszNodeName);
+	if (py_lpszNodeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNodeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNodeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNodeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNodeName)) {
+			test_str = PyString_AS_STRING(py_lpszNodeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNodeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNodeName = talloc_str;
+	}
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNetworkName");
+		return false;
+	}
+	r->in.lpszNetworkName = talloc_ptrtype(r, r->in.lpszNetworkName);
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNetworkName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNetworkName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNetworkName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNetworkName)) {
+			test_str = PyString_AS_STRING(py_lpszNetworkName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNetworkName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNetworkName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNetInterface_args_out(struct clusapi_GetNetInterface *r)
+{
+	PyObject *result;
+	PyObject *py_lppszInterfaceName;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.lppszInterfaceName == NULL) {
+		py_lppszInterfaceName = Py_None;
+		Py_INCREF(py_lppszInterfaceName);
+	} else {
+		if (*r->out.lppszInterfaceName == NULL) {
+			py_lppszInterfaceName = Py_None;
+			Py_INCREF(py_lppszInterfaceName);
+		} else {
+			py_lppszInterfaceName = PyUnicode_Decode(*r->out.lppszInterfaceName, strlen(*r->out.lppszInterfaceName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lppszInterfaceName);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNetInterfaceId_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNetInterfaceId *r)
+{
+	PyObject *py_hNetInterface;
+	const char *kwnames[] = {
+		"hNetInterface", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNetInterfaceId", discard_const_p(char *, kwnames), &py_hNetInterface)) {
+		return false;
+	}
+
+	if (py_hNetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetInterface = *(struct policy_handle *)pytalloc_get_ptr(py_hNetInterface);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNetInterfaceId_args_out(struct clusapi_GetNetInterfaceId *r)
+{
+	PyObject *result;
+	PyObject *py_pGuid;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.pGuid == NULL) {
+		py_pGuid = Py_None;
+		Py_INCREF(py_pGuid);
+	} else {
+		if (*r->out.pGuid == NULL) {
+			py_pGuid = Py_None;
+			Py_INCREF(py_pGuid);
+		} else {
+			py_pGuid = PyUnicode_Decode(*r->out.pGuid, strlen(*r->out.pGuid), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_pGuid);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeNetInterfaceControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeNetInterfaceControl *r)
+{
+	PyObject *py_hNetInterface;
+	PyObject *py_hNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hNetInterface", "hNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_NodeNetInterfaceControl", discard_const_p(char *, kwnames), &py_hNetInterface, &py_hNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hNetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetInterface = *(struct policy_handle *)pytalloc_get_ptr(py_hNetInterface);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeNetInterfaceControl_args_out(struct clusapi_NodeNetInterfaceControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NetInterfaceControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NetInterfaceControl *r)
+{
+	PyObject *py_hNetInterface;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hNetInterface", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_NetInterfaceControl", discard_const_p(char *, kwnames), &py_hNetInterface, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hNetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetInterface = *(struct policy_handle *)pytalloc_get_ptr(py_hNetInterface);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NetInterfaceControl_args_out(struct clusapi_NetInterfaceControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyNetInterface_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyNetInterface *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hNetInterface;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	const char *kwnames[] = {
+		"hNotify", "hNetInterface", "dwFilter", "dwNotifyKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_AddNotifyNetInterface", discard_const_p(char *, kwnames), &py_hNotify, &py_hNetInterface, &py_dwFilter, &py_dwNotifyKey)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hNetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetInterface = *(struct policy_handle *)pytalloc_get_ptr(py_hNetInterface);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyNetInterface_args_out(struct clusapi_AddNotifyNetInterface *r)
+{
+	PyObject *result;
+	PyObject *py_dwStateSequence;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_dwStateSequence = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwStateSequence);
+	PyTuple_SetItem(result, 0, py_dwStateSequence);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ReAddNotifyNetInterface_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ReAddNotifyNetInterface *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hNetInterface;
+	PyObject *py_dwFilter;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_StateSequence;
+	const char *kwnames[] = {
+		"hNotify", "hNetInterface", "dwFilter", "dwNotifyKey", "StateSequence", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_ReAddNotifyNetInterface", discard_const_p(char *, kwnames), &py_hNotify, &py_hNetInterface, &py_dwFilter, &py_dwNotifyKey, &py_StateSequence)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hNetInterface == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNetInterface");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNetInterface, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNetInterface)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNetInterface = *(struct policy_handle *)pytalloc_get_ptr(py_hNetInterface);
+	if (py_dwFilter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFilter");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFilter));
+		if (PyLong_Check(py_dwFilter)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFilter);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else if (PyInt_Check(py_dwFilter)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFilter);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFilter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_StateSequence == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.StateSequence");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.StateSequence));
+		if (PyLong_Check(py_StateSequence)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_StateSequence);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else if (PyInt_Check(py_StateSequence)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_StateSequence);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.StateSequence = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ReAddNotifyNetInterface_args_out(struct clusapi_ReAddNotifyNetInterface *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateNodeEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateNodeEnum *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_dwType;
+	const char *kwnames[] = {
+		"hNode", "dwType", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CreateNodeEnum", discard_const_p(char *, kwnames), &py_hNode, &py_dwType)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateNodeEnum_args_out(struct clusapi_CreateNodeEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ReturnEnum == NULL) {
+		py_ReturnEnum = Py_None;
+		Py_INCREF(py_ReturnEnum);
+	} else {
+		py_ReturnEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnEnum, *r->out.ReturnEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetClusterVersion2_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetClusterVersion2 *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_GetClusterVersion2", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetClusterVersion2_args_out(struct clusapi_GetClusterVersion2 *r)
+{
+	PyObject *result;
+	PyObject *py_lpwMajorVersion;
+	PyObject *py_lpwMinorVersion;
+	PyObject *py_lpwBuildNumber;
+	PyObject *py_lpszVendorId;
+	PyObject *py_lpszCSDVersion;
+	PyObject *py_ppClusterOpVerInfo;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(7);
+	py_lpwMajorVersion = PyInt_FromLong((uint16_t)*r->out.lpwMajorVersion);
+	PyTuple_SetItem(result, 0, py_lpwMajorVersion);
+	py_lpwMinorVersion = PyInt_FromLong((uint16_t)*r->out.lpwMinorVersion);
+	PyTuple_SetItem(result, 1, py_lpwMinorVersion);
+	py_lpwBuildNumber = PyInt_FromLong((uint16_t)*r->out.lpwBuildNumber);
+	PyTuple_SetItem(result, 2, py_lpwBuildNumber);
+	if (*r->out.lpszVendorId == NULL) {
+		py_lpszVendorId = Py_None;
+		Py_INCREF(py_lpszVendorId);
+	} else {
+		if (*r->out.lpszVendorId == NULL) {
+			py_lpszVendorId = Py_None;
+			Py_INCREF(py_lpszVendorId);
+		} else {
+			py_lpszVendorId = PyUnicode_Decode(*r->out.lpszVendorId, strlen(*r->out.lpszVendorId), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 3, py_lpszVendorId);
+	if (*r->out.lpszCSDVersion == NULL) {
+		py_lpszCSDVersion = Py_None;
+		Py_INCREF(py_lpszCSDVersion);
+	} else {
+		if (*r->out.lpszCSDVersion == NULL) {
+			py_lpszCSDVersion = Py_None;
+			Py_INCREF(py_lpszCSDVersion);
+		} else {
+			py_lpszCSDVersion = PyUnicode_Decode(*r->out.lpszCSDVersion, strlen(*r->out.lpszCSDVersion), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 4, py_lpszCSDVersion);
+	if (*r->out.ppClusterOpVerInfo == NULL) {
+		py_ppClusterOpVerInfo = Py_None;
+		Py_INCREF(py_ppClusterOpVerInfo);
+	} else {
+		py_ppClusterOpVerInfo = pytalloc_reference_ex(&CLUSTER_OPERATIONAL_VERSION_INFO_Type, *r->out.ppClusterOpVerInfo, *r->out.ppClusterOpVerInfo);
+	}
+	PyTuple_SetItem(result, 5, py_ppClusterOpVerInfo);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 6, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateResTypeEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateResTypeEnum *r)
+{
+	PyObject *py_lpszTypeName;
+	PyObject *py_dwType;
+	const char *kwnames[] = {
+		"lpszTypeName", "dwType", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CreateResTypeEnum", discard_const_p(char *, kwnames), &py_lpszTypeName, &py_dwType)) {
+		return false;
+	}
+
+	if (py_lpszTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszTypeName");
+		return false;
+	}
+	r->in.lpszTypeName = talloc_ptrtype(r, r->in.lpszTypeName);
+	if (py_lpszTypeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszTypeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszTypeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszTypeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszTypeName)) {
+			test_str = PyString_AS_STRING(py_lpszTypeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszTypeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszTypeName = talloc_str;
+	}
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateResTypeEnum_args_out(struct clusapi_CreateResTypeEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ReturnEnum == NULL) {
+		py_ReturnEnum = Py_None;
+		Py_INCREF(py_ReturnEnum);
+	} else {
+		py_ReturnEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnEnum, *r->out.ReturnEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_BackupClusterDatabase_args_in(PyObject *args, PyObject *kwargs, struct clusapi_BackupClusterDatabase *r)
+{
+	PyObject *py_lpszPathName;
+	const char *kwnames[] = {
+		"lpszPathName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_BackupClusterDatabase", discard_const_p(char *, kwnames), &py_lpszPathName)) {
+		return false;
+	}
+
+	if (py_lpszPathName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszPathName");
+		return false;
+	}
+	r->in.lpszPathName = talloc_ptrtype(r, r->in.lpszPathName);
+	if (py_lpszPathName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszPathName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszPathName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszPathName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszPathName)) {
+			test_str = PyString_AS_STRING(py_lpszPathName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszPathName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszPathName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_BackupClusterDatabase_args_out(struct clusapi_BackupClusterDatabase *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_NodeClusterControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_NodeClusterControl *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_hHostNode;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hCluster", "hHostNode", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:clusapi_NodeClusterControl", discard_const_p(char *, kwnames), &py_hCluster, &py_hHostNode, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_hHostNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hHostNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hHostNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hHostNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hHostNode = *(struct policy_handle *)pytalloc_get_ptr(py_hHostNode);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_NodeClusterControl_args_out(struct clusapi_NodeClusterControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ClusterControl_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ClusterControl *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_dwControlCode;
+	PyObject *py_lpInBuffer;
+	PyObject *py_nOutBufferSize;
+	const char *kwnames[] = {
+		"hCluster", "dwControlCode", "lpInBuffer", "nOutBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_ClusterControl", discard_const_p(char *, kwnames), &py_hCluster, &py_dwControlCode, &py_lpInBuffer, &py_nOutBufferSize)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	if (py_lpInBuffer == Py_None) {
+		r->in.lpInBuffer = NULL;
+	} else {
+		r->in.lpInBuffer = NULL;
+		if (py_lpInBuffer == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+		{
+			int lpInBuffer_cntr_1;
+			r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+			if (!r->in.lpInBuffer) { return false;; }
+			talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+			for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+				if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.nInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	if (py_nOutBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nOutBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nOutBufferSize));
+		if (PyLong_Check(py_nOutBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nOutBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else if (PyInt_Check(py_nOutBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nOutBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nOutBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ClusterControl_args_out(struct clusapi_ClusterControl *r)
+{
+	PyObject *result;
+	PyObject *py_lpOutBuffer;
+	PyObject *py_lpcbRequired;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_lpOutBuffer = PyList_New(*r->out.lpBytesReturned);
+	if (py_lpOutBuffer == NULL) {
+		return NULL;
+	}
+	{
+		int lpOutBuffer_cntr_1;
+		for (lpOutBuffer_cntr_1 = 0; lpOutBuffer_cntr_1 < (*r->out.lpBytesReturned); lpOutBuffer_cntr_1++) {
+			PyObject *py_lpOutBuffer_1;
+			py_lpOutBuffer_1 = PyInt_FromLong((uint16_t)r->out.lpOutBuffer[lpOutBuffer_cntr_1]);
+			PyList_SetItem(py_lpOutBuffer, lpOutBuffer_cntr_1, py_lpOutBuffer_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpOutBuffer);
+	py_lpcbRequired = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpcbRequired);
+	PyTuple_SetItem(result, 1, py_lpcbRequired);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_UnblockGetNotifyCall_args_in(PyObject *args, PyObject *kwargs, struct clusapi_UnblockGetNotifyCall *r)
+{
+	PyObject *py_hNotify;
+	const char *kwnames[] = {
+		"hNotify", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_UnblockGetNotifyCall", discard_const_p(char *, kwnames), &py_hNotify)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_UnblockGetNotifyCall_args_out(struct clusapi_UnblockGetNotifyCall *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetServiceAccountPassword_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetServiceAccountPassword *r)
+{
+	PyObject *py_lpszNewPassword;
+	PyObject *py_dwFlags;
+	PyObject *py_ReturnStatusBufferSize;
+	const char *kwnames[] = {
+		"lpszNewPassword", "dwFlags", "ReturnStatusBufferSize", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_SetServiceAccountPassword", discard_const_p(char *, kwnames), &py_lpszNewPassword, &py_dwFlags, &py_ReturnStatusBufferSize)) {
+		return false;
+	}
+
+	if (py_lpszNewPassword == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNewPassword");
+		return false;
+	}
+	r->in.lpszNewPassword = talloc_ptrtype(r, r->in.lpszNewPassword);
+	if (py_lpszNewPassword == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNewPassword");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNewPassword)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNewPassword, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNewPassword)) {
+			test_str = PyString_AS_STRING(py_lpszNewPassword);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNewPassword)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNewPassword = talloc_str;
+	}
+	if (py_dwFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFlags));
+		if (PyLong_Check(py_dwFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else if (PyInt_Check(py_dwFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_ReturnStatusBufferSize == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.ReturnStatusBufferSize");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.ReturnStatusBufferSize));
+		if (PyLong_Check(py_ReturnStatusBufferSize)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_ReturnStatusBufferSize);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.ReturnStatusBufferSize = test_var;
+		} else if (PyInt_Check(py_ReturnStatusBufferSize)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_ReturnStatusBufferSize);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.ReturnStatusBufferSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetServiceAccountPassword_args_out(struct clusapi_SetServiceAccountPassword *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnStatusBufferPtr;
+	PyObject *py_ExpectedBufferSize;
+	result = PyTuple_New(2);
+	py_ReturnStatusBufferPtr = PyList_New(*r->out.SizeReturned);
+	if (py_ReturnStatusBufferPtr == NULL) {
+		return NULL;
+	}
+	{
+		int ReturnStatusBufferPtr_cntr_0;
+		for (ReturnStatusBufferPtr_cntr_0 = 0; ReturnStatusBufferPtr_cntr_0 < (*r->out.SizeReturned); ReturnStatusBufferPtr_cntr_0++) {
+			PyObject *py_ReturnStatusBufferPtr_0;
+			py_ReturnStatusBufferPtr_0 = pytalloc_reference_ex(&IDL_CLUSTER_SET_PASSWORD_STATUS_Type, r->out.ReturnStatusBufferPtr, &r->out.ReturnStatusBufferPtr[ReturnStatusBufferPtr_cntr_0]);
+			PyList_SetItem(py_ReturnStatusBufferPtr, ReturnStatusBufferPtr_cntr_0, py_ReturnStatusBufferPtr_0);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_ReturnStatusBufferPtr);
+	py_ExpectedBufferSize = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.ExpectedBufferSize);
+	PyTuple_SetItem(result, 1, py_ExpectedBufferSize);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_SetResourceDependencyExpression_args_in(PyObject *args, PyObject *kwargs, struct clusapi_SetResourceDependencyExpression *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_lpszDependencyExpression;
+	const char *kwnames[] = {
+		"hResource", "lpszDependencyExpression", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_SetResourceDependencyExpression", discard_const_p(char *, kwnames), &py_hResource, &py_lpszDependencyExpression)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_lpszDependencyExpression == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszDependencyExpression");
+		return false;
+	}
+	if (py_lpszDependencyExpression == Py_None) {
+		r->in.lpszDependencyExpression = NULL;
+	} else {
+		r->in.lpszDependencyExpression = NULL;
+		if (py_lpszDependencyExpression == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszDependencyExpression");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_lpszDependencyExpression)) {
+				unicode = PyUnicode_AsEncodedString(py_lpszDependencyExpression, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_lpszDependencyExpression)) {
+				test_str = PyString_AS_STRING(py_lpszDependencyExpression);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszDependencyExpression)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.lpszDependencyExpression = talloc_str;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_SetResourceDependencyExpression_args_out(struct clusapi_SetResourceDependencyExpression *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetResourceDependencyExpression_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetResourceDependencyExpression *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetResourceDependencyExpression", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetResourceDependencyExpression_args_out(struct clusapi_GetResourceDependencyExpression *r)
+{
+	PyObject *result;
+	PyObject *py_lpszDependencyExpression;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.lpszDependencyExpression == NULL) {
+		py_lpszDependencyExpression = Py_None;
+		Py_INCREF(py_lpszDependencyExpression);
+	} else {
+		if (*r->out.lpszDependencyExpression == NULL) {
+			py_lpszDependencyExpression = Py_None;
+			Py_INCREF(py_lpszDependencyExpression);
+		} else {
+			py_lpszDependencyExpression = PyUnicode_Decode(*r->out.lpszDependencyExpression, strlen(*r->out.lpszDependencyExpression), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpszDependencyExpression);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_Opnum111NotUsedOnWire_args_in(PyObject *args, PyObject *kwargs, struct Opnum111NotUsedOnWire *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":Opnum111NotUsedOnWire", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_Opnum111NotUsedOnWire_args_out(struct Opnum111NotUsedOnWire *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetResourceNetworkName_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetResourceNetworkName *r)
+{
+	PyObject *py_hResource;
+	const char *kwnames[] = {
+		"hResource", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetResourceNetworkName", discard_const_p(char *, kwnames), &py_hResource)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetResourceNetworkName_args_out(struct clusapi_GetResourceNetworkName *r)
+{
+	PyObject *result;
+	PyObject *py_lpszName;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.lpszName == NULL) {
+		py_lpszName = Py_None;
+		Py_INCREF(py_lpszName);
+	} else {
+		if (*r->out.lpszName == NULL) {
+			py_lpszName = Py_None;
+			Py_INCREF(py_lpszName);
+		} else {
+			py_lpszName = PyUnicode_Decode(*r->out.lpszName, strlen(*r->out.lpszName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 0, py_lpszName);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ExecuteBatch_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ExecuteBatch *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpData;
+	const char *kwnames[] = {
+		"hKey", "lpData", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_ExecuteBatch", discard_const_p(char *, kwnames), &py_hKey, &py_lpData)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	PY_CHECK_TYPE(&PyList_Type, py_lpData, return false;);
+	r->in.cbData = PyList_GET_SIZE(py_lpData);
+	if (py_lpData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpData");
+		return false;
+	}
+	r->in.lpData = talloc_ptrtype(r, r->in.lpData);
+	if (py_lpData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpData");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpData, return false;);
+	{
+		int lpData_cntr_1;
+		r->in.lpData = talloc_array_ptrtype(r, r->in.lpData, PyList_GET_SIZE(py_lpData));
+		if (!r->in.lpData) { return false;; }
+		talloc_set_name_const(r->in.lpData, "ARRAY: r->in.lpData");
+		for (lpData_cntr_1 = 0; lpData_cntr_1 < PyList_GET_SIZE(py_lpData); lpData_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpData, lpData_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpData[lpData_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpData[lpData_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpData, lpData_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpData, lpData_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpData[lpData_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpData, lpData_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpData, lpData_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpData[lpData_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ExecuteBatch_args_out(struct clusapi_ExecuteBatch *r)
+{
+	PyObject *result;
+	PyObject *py_pdwFailedCommand;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_pdwFailedCommand = PyInt_FromLong(*r->out.pdwFailedCommand);
+	PyTuple_SetItem(result, 0, py_pdwFailedCommand);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateBatchPort_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateBatchPort *r)
+{
+	PyObject *py_hKey;
+	const char *kwnames[] = {
+		"hKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CreateBatchPort", discard_const_p(char *, kwnames), &py_hKey)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateBatchPort_args_out(struct clusapi_CreateBatchPort *r)
+{
+	PyObject *result;
+	PyObject *py_phBatchPort;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_phBatchPort = pytalloc_reference_ex(policy_handle_Type, r->out.phBatchPort, r->out.phBatchPort);
+	PyTuple_SetItem(result, 0, py_phBatchPort);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetBatchNotification_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetBatchNotification *r)
+{
+	PyObject *py_hBatchNotify;
+	const char *kwnames[] = {
+		"hBatchNotify", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetBatchNotification", discard_const_p(char *, kwnames), &py_hBatchNotify)) {
+		return false;
+	}
+
+	if (py_hBatchNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hBatchNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hBatchNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hBatchNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hBatchNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hBatchNotify);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetBatchNotification_args_out(struct clusapi_GetBatchNotification *r)
+{
+	PyObject *result;
+	PyObject *py_cbData;
+	PyObject *py_lpData;
+	result = PyTuple_New(2);
+	py_cbData = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.cbData);
+	PyTuple_SetItem(result, 0, py_cbData);
+	if (*r->out.lpData == NULL) {
+		py_lpData = Py_None;
+		Py_INCREF(py_lpData);
+	} else {
+		py_lpData = PyList_New(*r->out.cbData);
+		if (py_lpData == NULL) {
+			return NULL;
+		}
+		{
+			int lpData_cntr_2;
+			for (lpData_cntr_2 = 0; lpData_cntr_2 < (*r->out.cbData); lpData_cntr_2++) {
+				PyObject *py_lpData_2;
+				py_lpData_2 = PyInt_FromLong((uint16_t)*r->out.lpData[lpData_cntr_2]);
+				PyList_SetItem(py_lpData, lpData_cntr_2, py_lpData_2);
+			}
+		}
+	}
+	PyTuple_SetItem(result, 1, py_lpData);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CloseBatchPort_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CloseBatchPort *r)
+{
+	PyObject *py_phBatchPort;
+	const char *kwnames[] = {
+		"phBatchPort", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_CloseBatchPort", discard_const_p(char *, kwnames), &py_phBatchPort)) {
+		return false;
+	}
+
+	if (py_phBatchPort == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.phBatchPort");
+		return false;
+	}
+	r->in.phBatchPort = talloc_ptrtype(r, r->in.phBatchPort);
+	if (py_phBatchPort == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.phBatchPort");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_phBatchPort, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_phBatchPort)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.phBatchPort = (struct policy_handle *)pytalloc_get_ptr(py_phBatchPort);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CloseBatchPort_args_out(struct clusapi_CloseBatchPort *r)
+{
+	PyObject *result;
+	PyObject *py_phBatchPort;
+	py_phBatchPort = pytalloc_reference_ex(policy_handle_Type, r->out.phBatchPort, r->out.phBatchPort);
+	result = py_phBatchPort;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OpenClusterEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenClusterEx *r)
+{
+	PyObject *py_dwDesiredAccess;
+	const char *kwnames[] = {
+		"dwDesiredAccess", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_OpenClusterEx", discard_const_p(char *, kwnames), &py_dwDesiredAccess)) {
+		return false;
+	}
+
+	if (py_dwDesiredAccess == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwDesiredAccess");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwDesiredAccess));
+		if (PyLong_Check(py_dwDesiredAccess)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwDesiredAccess);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else if (PyInt_Check(py_dwDesiredAccess)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwDesiredAccess);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenClusterEx_args_out(struct clusapi_OpenClusterEx *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwGrantedAccess;
+	PyObject *py_Status;
+	PyObject *py_hCluster;
+	result = PyTuple_New(3);
+	py_lpdwGrantedAccess = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwGrantedAccess);
+	PyTuple_SetItem(result, 0, py_lpdwGrantedAccess);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_hCluster = pytalloc_reference_ex(policy_handle_Type, r->out.hCluster, r->out.hCluster);
+	PyTuple_SetItem(result, 2, py_hCluster);
+	return result;
+}
+
+static bool pack_py_clusapi_OpenNodeEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenNodeEx *r)
+{
+	PyObject *py_lpszNodeName;
+	PyObject *py_dwDesiredAccess;
+	const char *kwnames[] = {
+		"lpszNodeName", "dwDesiredAccess", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_OpenNodeEx", discard_const_p(char *, kwnames), &py_lpszNodeName, &py_dwDesiredAccess)) {
+		return false;
+	}
+
+	if (py_lpszNodeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNodeName");
+		return false;
+	}
+	r->in.lpszNodeName = talloc_ptrtype(r, r->in.lpszNodeName);
+	if (py_lpszNodeName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNodeName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNodeName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNodeName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNodeName)) {
+			test_str = PyString_AS_STRING(py_lpszNodeName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNodeName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNodeName = talloc_str;
+	}
+	if (py_dwDesiredAccess == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwDesiredAccess");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwDesiredAccess));
+		if (PyLong_Check(py_dwDesiredAccess)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwDesiredAccess);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else if (PyInt_Check(py_dwDesiredAccess)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwDesiredAccess);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenNodeEx_args_out(struct clusapi_OpenNodeEx *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwGrantedAccess;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNode;
+	result = PyTuple_New(4);
+	py_lpdwGrantedAccess = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwGrantedAccess);
+	PyTuple_SetItem(result, 0, py_lpdwGrantedAccess);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	py_hNode = pytalloc_reference_ex(policy_handle_Type, r->out.hNode, r->out.hNode);
+	PyTuple_SetItem(result, 3, py_hNode);
+	return result;
+}
+
+static bool pack_py_clusapi_OpenGroupEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenGroupEx *r)
+{
+	PyObject *py_lpszGroupName;
+	PyObject *py_dwDesiredAccess;
+	const char *kwnames[] = {
+		"lpszGroupName", "dwDesiredAccess", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_OpenGroupEx", discard_const_p(char *, kwnames), &py_lpszGroupName, &py_dwDesiredAccess)) {
+		return false;
+	}
+
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszGroupName");
+		return false;
+	}
+	r->in.lpszGroupName = talloc_ptrtype(r, r->in.lpszGroupName);
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszGroupName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszGroupName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszGroupName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszGroupName)) {
+			test_str = PyString_AS_STRING(py_lpszGroupName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszGroupName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszGroupName = talloc_str;
+	}
+	if (py_dwDesiredAccess == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwDesiredAccess");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwDesiredAccess));
+		if (PyLong_Check(py_dwDesiredAccess)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwDesiredAccess);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else if (PyInt_Check(py_dwDesiredAccess)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwDesiredAccess);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenGroupEx_args_out(struct clusapi_OpenGroupEx *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwGrantedAccess;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hGroup;
+	result = PyTuple_New(4);
+	py_lpdwGrantedAccess = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwGrantedAccess);
+	PyTuple_SetItem(result, 0, py_lpdwGrantedAccess);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	py_hGroup = pytalloc_reference_ex(policy_handle_Type, r->out.hGroup, r->out.hGroup);
+	PyTuple_SetItem(result, 3, py_hGroup);
+	return result;
+}
+
+static bool pack_py_clusapi_OpenResourceEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenResourceEx *r)
+{
+	PyObject *py_lpszResourceName;
+	PyObject *py_dwDesiredAccess;
+	const char *kwnames[] = {
+		"lpszResourceName", "dwDesiredAccess", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_OpenResourceEx", discard_const_p(char *, kwnames), &py_lpszResourceName, &py_dwDesiredAccess)) {
+		return false;
+	}
+
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszResourceName");
+		return false;
+	}
+	r->in.lpszResourceName = talloc_ptrtype(r, r->in.lpszResourceName);
+	if (py_lpszResourceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszResourceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszResourceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszResourceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszResourceName)) {
+			test_str = PyString_AS_STRING(py_lpszResourceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszResourceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszResourceName = talloc_str;
+	}
+	if (py_dwDesiredAccess == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwDesiredAccess");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwDesiredAccess));
+		if (PyLong_Check(py_dwDesiredAccess)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwDesiredAccess);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else if (PyInt_Check(py_dwDesiredAccess)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwDesiredAccess);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenResourceEx_args_out(struct clusapi_OpenResourceEx *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwGrantedAccess;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hResource;
+	result = PyTuple_New(4);
+	py_lpdwGrantedAccess = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwGrantedAccess);
+	PyTuple_SetItem(result, 0, py_lpdwGrantedAccess);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	py_hResource = pytalloc_reference_ex(policy_handle_Type, r->out.hResource, r->out.hResource);
+	PyTuple_SetItem(result, 3, py_hResource);
+	return result;
+}
+
+static bool pack_py_clusapi_OpenNetworkEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenNetworkEx *r)
+{
+	PyObject *py_lpszNetworkName;
+	PyObject *py_dwDesiredAccess;
+	const char *kwnames[] = {
+		"lpszNetworkName", "dwDesiredAccess", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_OpenNetworkEx", discard_const_p(char *, kwnames), &py_lpszNetworkName, &py_dwDesiredAccess)) {
+		return false;
+	}
+
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNetworkName");
+		return false;
+	}
+	r->in.lpszNetworkName = talloc_ptrtype(r, r->in.lpszNetworkName);
+	if (py_lpszNetworkName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNetworkName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNetworkName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNetworkName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNetworkName)) {
+			test_str = PyString_AS_STRING(py_lpszNetworkName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNetworkName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNetworkName = talloc_str;
+	}
+	if (py_dwDesiredAccess == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwDesiredAccess");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwDesiredAccess));
+		if (PyLong_Check(py_dwDesiredAccess)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwDesiredAccess);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else if (PyInt_Check(py_dwDesiredAccess)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwDesiredAccess);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenNetworkEx_args_out(struct clusapi_OpenNetworkEx *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwGrantedAccess;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNetwork;
+	result = PyTuple_New(4);
+	py_lpdwGrantedAccess = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwGrantedAccess);
+	PyTuple_SetItem(result, 0, py_lpdwGrantedAccess);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	py_hNetwork = pytalloc_reference_ex(policy_handle_Type, r->out.hNetwork, r->out.hNetwork);
+	PyTuple_SetItem(result, 3, py_hNetwork);
+	return result;
+}
+
+static bool pack_py_clusapi_OpenNetInterfaceEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OpenNetInterfaceEx *r)
+{
+	PyObject *py_lpszNetInterfaceName;
+	PyObject *py_dwDesiredAccess;
+	const char *kwnames[] = {
+		"lpszNetInterfaceName", "dwDesiredAccess", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_OpenNetInterfaceEx", discard_const_p(char *, kwnames), &py_lpszNetInterfaceName, &py_dwDesiredAccess)) {
+		return false;
+	}
+
+	if (py_lpszNetInterfaceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszNetInterfaceName");
+		return false;
+	}
+	r->in.lpszNetInterfaceName = talloc_ptrtype(r, r->in.lpszNetInterfaceName);
+	if (py_lpszNetInterfaceName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszNetInterfaceName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszNetInterfaceName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszNetInterfaceName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszNetInterfaceName)) {
+			test_str = PyString_AS_STRING(py_lpszNetInterfaceName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszNetInterfaceName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszNetInterfaceName = talloc_str;
+	}
+	if (py_dwDesiredAccess == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwDesiredAccess");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwDesiredAccess));
+		if (PyLong_Check(py_dwDesiredAccess)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwDesiredAccess);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else if (PyInt_Check(py_dwDesiredAccess)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwDesiredAccess);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwDesiredAccess = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OpenNetInterfaceEx_args_out(struct clusapi_OpenNetInterfaceEx *r)
+{
+	PyObject *result;
+	PyObject *py_lpdwGrantedAccess;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hNetInterface;
+	result = PyTuple_New(4);
+	py_lpdwGrantedAccess = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.lpdwGrantedAccess);
+	PyTuple_SetItem(result, 0, py_lpdwGrantedAccess);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 1, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	py_hNetInterface = pytalloc_reference_ex(policy_handle_Type, r->out.hNetInterface, r->out.hNetInterface);
+	PyTuple_SetItem(result, 3, py_hNetInterface);
+	return result;
+}
+
+static bool pack_py_clusapi_ChangeCsvState_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ChangeCsvState *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_dwState;
+	const char *kwnames[] = {
+		"hResource", "dwState", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_ChangeCsvState", discard_const_p(char *, kwnames), &py_hResource, &py_dwState)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwState == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwState");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwState));
+		if (PyLong_Check(py_dwState)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwState);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwState = test_var;
+		} else if (PyInt_Check(py_dwState)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwState);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwState = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ChangeCsvState_args_out(struct clusapi_ChangeCsvState *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateNodeEnumEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateNodeEnumEx *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_dwType;
+	PyObject *py_dwOptions;
+	const char *kwnames[] = {
+		"hNode", "dwType", "dwOptions", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_CreateNodeEnumEx", discard_const_p(char *, kwnames), &py_hNode, &py_dwType, &py_dwOptions)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwOptions == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOptions");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOptions));
+		if (PyLong_Check(py_dwOptions)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOptions);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOptions = test_var;
+		} else if (PyInt_Check(py_dwOptions)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOptions);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOptions = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateNodeEnumEx_args_out(struct clusapi_CreateNodeEnumEx *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnIdEnum;
+	PyObject *py_ReturnNameEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	if (*r->out.ReturnIdEnum == NULL) {
+		py_ReturnIdEnum = Py_None;
+		Py_INCREF(py_ReturnIdEnum);
+	} else {
+		py_ReturnIdEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnIdEnum, *r->out.ReturnIdEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnIdEnum);
+	if (*r->out.ReturnNameEnum == NULL) {
+		py_ReturnNameEnum = Py_None;
+		Py_INCREF(py_ReturnNameEnum);
+	} else {
+		py_ReturnNameEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnNameEnum, *r->out.ReturnNameEnum);
+	}
+	PyTuple_SetItem(result, 1, py_ReturnNameEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateEnumEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateEnumEx *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_dwType;
+	PyObject *py_dwOptions;
+	const char *kwnames[] = {
+		"hCluster", "dwType", "dwOptions", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_CreateEnumEx", discard_const_p(char *, kwnames), &py_hCluster, &py_dwType, &py_dwOptions)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_dwType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwType));
+		if (PyLong_Check(py_dwType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else if (PyInt_Check(py_dwType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwOptions == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOptions");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOptions));
+		if (PyLong_Check(py_dwOptions)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOptions);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOptions = test_var;
+		} else if (PyInt_Check(py_dwOptions)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOptions);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOptions = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateEnumEx_args_out(struct clusapi_CreateEnumEx *r)
+{
+	PyObject *result;
+	PyObject *py_ReturnIdEnum;
+	PyObject *py_ReturnNameEnum;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	if (*r->out.ReturnIdEnum == NULL) {
+		py_ReturnIdEnum = Py_None;
+		Py_INCREF(py_ReturnIdEnum);
+	} else {
+		py_ReturnIdEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnIdEnum, *r->out.ReturnIdEnum);
+	}
+	PyTuple_SetItem(result, 0, py_ReturnIdEnum);
+	if (*r->out.ReturnNameEnum == NULL) {
+		py_ReturnNameEnum = Py_None;
+		Py_INCREF(py_ReturnNameEnum);
+	} else {
+		py_ReturnNameEnum = pytalloc_reference_ex(&ENUM_LIST_Type, *r->out.ReturnNameEnum, *r->out.ReturnNameEnum);
+	}
+	PyTuple_SetItem(result, 1, py_ReturnNameEnum);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_PauseNodeEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_PauseNodeEx *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_bDrainNode;
+	PyObject *py_dwPauseFlags;
+	const char *kwnames[] = {
+		"hNode", "bDrainNode", "dwPauseFlags", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_PauseNodeEx", discard_const_p(char *, kwnames), &py_hNode, &py_bDrainNode, &py_dwPauseFlags)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_bDrainNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.bDrainNode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.bDrainNode));
+		if (PyLong_Check(py_bDrainNode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_bDrainNode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.bDrainNode = test_var;
+		} else if (PyInt_Check(py_bDrainNode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_bDrainNode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.bDrainNode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwPauseFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwPauseFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwPauseFlags));
+		if (PyLong_Check(py_dwPauseFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwPauseFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwPauseFlags = test_var;
+		} else if (PyInt_Check(py_dwPauseFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwPauseFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwPauseFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_PauseNodeEx_args_out(struct clusapi_PauseNodeEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_PauseNodeWithDrainTarget_args_in(PyObject *args, PyObject *kwargs, struct clusapi_PauseNodeWithDrainTarget *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_dwPauseFlags;
+	PyObject *py_hNodeDrainTarget;
+	const char *kwnames[] = {
+		"hNode", "dwPauseFlags", "hNodeDrainTarget", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_PauseNodeWithDrainTarget", discard_const_p(char *, kwnames), &py_hNode, &py_dwPauseFlags, &py_hNodeDrainTarget)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwPauseFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwPauseFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwPauseFlags));
+		if (PyLong_Check(py_dwPauseFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwPauseFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwPauseFlags = test_var;
+		} else if (PyInt_Check(py_dwPauseFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwPauseFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwPauseFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_hNodeDrainTarget == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNodeDrainTarget");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNodeDrainTarget, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNodeDrainTarget)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNodeDrainTarget = *(struct policy_handle *)pytalloc_get_ptr(py_hNodeDrainTarget);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_PauseNodeWithDrainTarget_args_out(struct clusapi_PauseNodeWithDrainTarget *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ResumeNodeEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ResumeNodeEx *r)
+{
+	PyObject *py_hNode;
+	PyObject *py_dwResumeFailbackType;
+	PyObject *py_dwResumeFlagsReserved;
+	const char *kwnames[] = {
+		"hNode", "dwResumeFailbackType", "dwResumeFlagsReserved", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_ResumeNodeEx", discard_const_p(char *, kwnames), &py_hNode, &py_dwResumeFailbackType, &py_dwResumeFlagsReserved)) {
+		return false;
+	}
+
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwResumeFailbackType == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwResumeFailbackType");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwResumeFailbackType));
+		if (PyLong_Check(py_dwResumeFailbackType)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwResumeFailbackType);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwResumeFailbackType = test_var;
+		} else if (PyInt_Check(py_dwResumeFailbackType)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwResumeFailbackType);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwResumeFailbackType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwResumeFlagsReserved == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwResumeFlagsReserved");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwResumeFlagsReserved));
+		if (PyLong_Check(py_dwResumeFlagsReserved)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwResumeFlagsReserved);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwResumeFlagsReserved = test_var;
+		} else if (PyInt_Check(py_dwResumeFlagsReserved)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwResumeFlagsReserved);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwResumeFlagsReserved = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ResumeNodeEx_args_out(struct clusapi_ResumeNodeEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateGroupEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateGroupEx *r)
+{
+	PyObject *py_lpszGroupName;
+	PyObject *py_pGroupInfo;
+	const char *kwnames[] = {
+		"lpszGroupName", "pGroupInfo", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CreateGroupEx", discard_const_p(char *, kwnames), &py_lpszGroupName, &py_pGroupInfo)) {
+		return false;
+	}
+
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpszGroupName");
+		return false;
+	}
+	r->in.lpszGroupName = talloc_ptrtype(r, r->in.lpszGroupName);
+	if (py_lpszGroupName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpszGroupName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_lpszGroupName)) {
+			unicode = PyUnicode_AsEncodedString(py_lpszGroupName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_lpszGroupName)) {
+			test_str = PyString_AS_STRING(py_lpszGroupName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_lpszGroupName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.lpszGroupName = talloc_str;
+	}
+	if (py_pGroupInfo == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pGroupInfo");
+		return false;
+	}
+	if (py_pGroupInfo == Py_None) {
+		r->in.pGroupInfo = NULL;
+	} else {
+		r->in.pGroupInfo = NULL;
+		if (py_pGroupInfo == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pGroupInfo");
+			return false;
+		}
+		PY_CHECK_TYPE(&CLUSTER_CREATE_GROUP_INFO_RPC_Type, py_pGroupInfo, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_pGroupInfo)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.pGroupInfo = (struct CLUSTER_CREATE_GROUP_INFO_RPC *)pytalloc_get_ptr(py_pGroupInfo);
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateGroupEx_args_out(struct clusapi_CreateGroupEx *r)
+{
+	PyObject *result;
+	PyObject *py_Status;
+	PyObject *py_rpc_status;
+	PyObject *py_hGroup;
+	result = PyTuple_New(3);
+	py_Status = PyErr_FromWERROR(*r->out.Status);
+	PyTuple_SetItem(result, 0, py_Status);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hGroup = pytalloc_reference_ex(policy_handle_Type, r->out.hGroup, r->out.hGroup);
+	PyTuple_SetItem(result, 2, py_hGroup);
+	return result;
+}
+
+static bool pack_py_clusapi_OnlineGroupEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OnlineGroupEx *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_dwOnlineFlags;
+	PyObject *py_lpInBuffer;
+	const char *kwnames[] = {
+		"hGroup", "dwOnlineFlags", "lpInBuffer", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_OnlineGroupEx", discard_const_p(char *, kwnames), &py_hGroup, &py_dwOnlineFlags, &py_lpInBuffer)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwOnlineFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOnlineFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOnlineFlags));
+		if (PyLong_Check(py_dwOnlineFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOnlineFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOnlineFlags = test_var;
+		} else if (PyInt_Check(py_dwOnlineFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOnlineFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOnlineFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	r->in.lpInBuffer = talloc_ptrtype(r, r->in.lpInBuffer);
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	{
+		int lpInBuffer_cntr_1;
+		r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+		if (!r->in.lpInBuffer) { return false;; }
+		talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+		for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.cbInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OnlineGroupEx_args_out(struct clusapi_OnlineGroupEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OfflineGroupEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OfflineGroupEx *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_dwOfflineFlags;
+	PyObject *py_lpInBuffer;
+	const char *kwnames[] = {
+		"hGroup", "dwOfflineFlags", "lpInBuffer", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_OfflineGroupEx", discard_const_p(char *, kwnames), &py_hGroup, &py_dwOfflineFlags, &py_lpInBuffer)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwOfflineFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOfflineFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOfflineFlags));
+		if (PyLong_Check(py_dwOfflineFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOfflineFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOfflineFlags = test_var;
+		} else if (PyInt_Check(py_dwOfflineFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOfflineFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOfflineFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	r->in.lpInBuffer = talloc_ptrtype(r, r->in.lpInBuffer);
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	{
+		int lpInBuffer_cntr_1;
+		r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+		if (!r->in.lpInBuffer) { return false;; }
+		talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+		for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.cbInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OfflineGroupEx_args_out(struct clusapi_OfflineGroupEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_MoveGroupEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_MoveGroupEx *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_dwMoveFlags;
+	PyObject *py_lpInBuffer;
+	const char *kwnames[] = {
+		"hGroup", "dwMoveFlags", "lpInBuffer", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_MoveGroupEx", discard_const_p(char *, kwnames), &py_hGroup, &py_dwMoveFlags, &py_lpInBuffer)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwMoveFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwMoveFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwMoveFlags));
+		if (PyLong_Check(py_dwMoveFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwMoveFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwMoveFlags = test_var;
+		} else if (PyInt_Check(py_dwMoveFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwMoveFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwMoveFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	r->in.lpInBuffer = talloc_ptrtype(r, r->in.lpInBuffer);
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	{
+		int lpInBuffer_cntr_1;
+		r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+		if (!r->in.lpInBuffer) { return false;; }
+		talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+		for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.cbInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_MoveGroupEx_args_out(struct clusapi_MoveGroupEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_MoveGroupToNodeEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_MoveGroupToNodeEx *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_hNode;
+	PyObject *py_dwMoveFlags;
+	PyObject *py_lpInBuffer;
+	const char *kwnames[] = {
+		"hGroup", "hNode", "dwMoveFlags", "lpInBuffer", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_MoveGroupToNodeEx", discard_const_p(char *, kwnames), &py_hGroup, &py_hNode, &py_dwMoveFlags, &py_lpInBuffer)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_hNode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNode");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNode, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNode)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNode = *(struct policy_handle *)pytalloc_get_ptr(py_hNode);
+	if (py_dwMoveFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwMoveFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwMoveFlags));
+		if (PyLong_Check(py_dwMoveFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwMoveFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwMoveFlags = test_var;
+		} else if (PyInt_Check(py_dwMoveFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwMoveFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwMoveFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	r->in.lpInBuffer = talloc_ptrtype(r, r->in.lpInBuffer);
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	{
+		int lpInBuffer_cntr_1;
+		r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+		if (!r->in.lpInBuffer) { return false;; }
+		talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+		for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.cbInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_MoveGroupToNodeEx_args_out(struct clusapi_MoveGroupToNodeEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CancelClusterGroupOperation_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CancelClusterGroupOperation *r)
+{
+	PyObject *py_hGroup;
+	PyObject *py_dwCancelFlags;
+	const char *kwnames[] = {
+		"hGroup", "dwCancelFlags", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_CancelClusterGroupOperation", discard_const_p(char *, kwnames), &py_hGroup, &py_dwCancelFlags)) {
+		return false;
+	}
+
+	if (py_hGroup == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hGroup");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hGroup, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hGroup)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hGroup = *(struct policy_handle *)pytalloc_get_ptr(py_hGroup);
+	if (py_dwCancelFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwCancelFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwCancelFlags));
+		if (PyLong_Check(py_dwCancelFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwCancelFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwCancelFlags = test_var;
+		} else if (PyInt_Check(py_dwCancelFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwCancelFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwCancelFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CancelClusterGroupOperation_args_out(struct clusapi_CancelClusterGroupOperation *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OnlineResourceEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OnlineResourceEx *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_dwOnlineFlags;
+	PyObject *py_lpInBuffer;
+	const char *kwnames[] = {
+		"hResource", "dwOnlineFlags", "lpInBuffer", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_OnlineResourceEx", discard_const_p(char *, kwnames), &py_hResource, &py_dwOnlineFlags, &py_lpInBuffer)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwOnlineFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOnlineFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOnlineFlags));
+		if (PyLong_Check(py_dwOnlineFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOnlineFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOnlineFlags = test_var;
+		} else if (PyInt_Check(py_dwOnlineFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOnlineFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOnlineFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	r->in.lpInBuffer = talloc_ptrtype(r, r->in.lpInBuffer);
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	{
+		int lpInBuffer_cntr_1;
+		r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+		if (!r->in.lpInBuffer) { return false;; }
+		talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+		for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.cbInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OnlineResourceEx_args_out(struct clusapi_OnlineResourceEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_OfflineResourceEx_args_in(PyObject *args, PyObject *kwargs, struct clusapi_OfflineResourceEx *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_dwOfflineFlags;
+	PyObject *py_lpInBuffer;
+	const char *kwnames[] = {
+		"hResource", "dwOfflineFlags", "lpInBuffer", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_OfflineResourceEx", discard_const_p(char *, kwnames), &py_hResource, &py_dwOfflineFlags, &py_lpInBuffer)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwOfflineFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwOfflineFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwOfflineFlags));
+		if (PyLong_Check(py_dwOfflineFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwOfflineFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOfflineFlags = test_var;
+		} else if (PyInt_Check(py_dwOfflineFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwOfflineFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwOfflineFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer");
+		return false;
+	}
+	r->in.lpInBuffer = talloc_ptrtype(r, r->in.lpInBuffer);
+	if (py_lpInBuffer == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInBuffer");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	{
+		int lpInBuffer_cntr_1;
+		r->in.lpInBuffer = talloc_array_ptrtype(r, r->in.lpInBuffer, PyList_GET_SIZE(py_lpInBuffer));
+		if (!r->in.lpInBuffer) { return false;; }
+		talloc_set_name_const(r->in.lpInBuffer, "ARRAY: r->in.lpInBuffer");
+		for (lpInBuffer_cntr_1 = 0; lpInBuffer_cntr_1 < PyList_GET_SIZE(py_lpInBuffer); lpInBuffer_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInBuffer[lpInBuffer_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInBuffer[lpInBuffer_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInBuffer, lpInBuffer_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInBuffer[lpInBuffer_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInBuffer, return false;);
+	r->in.cbInBufferSize = PyList_GET_SIZE(py_lpInBuffer);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_OfflineResourceEx_args_out(struct clusapi_OfflineResourceEx *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateNotifyV2_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateNotifyV2 *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":clusapi_CreateNotifyV2", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateNotifyV2_args_out(struct clusapi_CreateNotifyV2 *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_error;
+	PyObject *py_rpc_status;
+	PyObject *py_hNotify;
+	result = PyTuple_New(3);
+	py_rpc_error = PyErr_FromWERROR(*r->out.rpc_error);
+	PyTuple_SetItem(result, 0, py_rpc_error);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	py_hNotify = pytalloc_reference_ex(policy_handle_Type, r->out.hNotify, r->out.hNotify);
+	PyTuple_SetItem(result, 2, py_hNotify);
+	return result;
+}
+
+static bool pack_py_clusapi_AddNotifyV2_args_in(PyObject *args, PyObject *kwargs, struct clusapi_AddNotifyV2 *r)
+{
+	PyObject *py_hNotify;
+	PyObject *py_hObject;
+	PyObject *py_filter;
+	PyObject *py_dwNotifyKey;
+	PyObject *py_dwVersion;
+	PyObject *py_isTargetedAtObject;
+	const char *kwnames[] = {
+		"hNotify", "hObject", "filter", "dwNotifyKey", "dwVersion", "isTargetedAtObject", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:clusapi_AddNotifyV2", discard_const_p(char *, kwnames), &py_hNotify, &py_hObject, &py_filter, &py_dwNotifyKey, &py_dwVersion, &py_isTargetedAtObject)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	if (py_hObject == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hObject");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hObject, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hObject)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hObject = *(struct policy_handle *)pytalloc_get_ptr(py_hObject);
+	if (py_filter == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.filter");
+		return false;
+	}
+	PY_CHECK_TYPE(&NOTIFY_FILTER_AND_TYPE_RPC_Type, py_filter, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_filter)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.filter = *(struct NOTIFY_FILTER_AND_TYPE_RPC *)pytalloc_get_ptr(py_filter);
+	if (py_dwNotifyKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwNotifyKey");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwNotifyKey));
+		if (PyLong_Check(py_dwNotifyKey)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwNotifyKey);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else if (PyInt_Check(py_dwNotifyKey)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwNotifyKey);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwNotifyKey = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwVersion == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwVersion");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwVersion));
+		if (PyLong_Check(py_dwVersion)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwVersion);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwVersion = test_var;
+		} else if (PyInt_Check(py_dwVersion)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwVersion);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwVersion = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_isTargetedAtObject == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.isTargetedAtObject");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.isTargetedAtObject));
+		if (PyLong_Check(py_isTargetedAtObject)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_isTargetedAtObject);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.isTargetedAtObject = test_var;
+		} else if (PyInt_Check(py_isTargetedAtObject)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_isTargetedAtObject);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.isTargetedAtObject = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_AddNotifyV2_args_out(struct clusapi_AddNotifyV2 *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNotifyV2_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNotifyV2 *r)
+{
+	PyObject *py_hNotify;
+	const char *kwnames[] = {
+		"hNotify", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNotifyV2", discard_const_p(char *, kwnames), &py_hNotify)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNotifyV2_args_out(struct clusapi_GetNotifyV2 *r)
+{
+	PyObject *result;
+	PyObject *py_Notifications;
+	PyObject *py_dwNumNotifications;
+	result = PyTuple_New(2);
+	if (*r->out.Notifications == NULL) {
+		py_Notifications = Py_None;
+		Py_INCREF(py_Notifications);
+	} else {
+		py_Notifications = PyList_New(*r->out.dwNumNotifications);
+		if (py_Notifications == NULL) {
+			return NULL;
+		}
+		{
+			int Notifications_cntr_2;
+			for (Notifications_cntr_2 = 0; Notifications_cntr_2 < (*r->out.dwNumNotifications); Notifications_cntr_2++) {
+				PyObject *py_Notifications_2;
+				py_Notifications_2 = pytalloc_reference_ex(&NOTIFICATION_RPC_Type, *r->out.Notifications, r->out.Notifications[Notifications_cntr_2]);
+				PyList_SetItem(py_Notifications, Notifications_cntr_2, py_Notifications_2);
+			}
+		}
+	}
+	PyTuple_SetItem(result, 0, py_Notifications);
+	py_dwNumNotifications = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwNumNotifications);
+	PyTuple_SetItem(result, 1, py_dwNumNotifications);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_QueryAllValues_args_in(PyObject *args, PyObject *kwargs, struct clusapi_QueryAllValues *r)
+{
+	PyObject *py_hKey;
+	const char *kwnames[] = {
+		"hKey", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_QueryAllValues", discard_const_p(char *, kwnames), &py_hKey)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_QueryAllValues_args_out(struct clusapi_QueryAllValues *r)
+{
+	PyObject *result;
+	PyObject *py_pcbData;
+	PyObject *py_ppData;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_pcbData = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.pcbData);
+	PyTuple_SetItem(result, 0, py_pcbData);
+	py_ppData = PyList_New(1);
+	if (py_ppData == NULL) {
+		return NULL;
+	}
+	{
+		int ppData_cntr_1;
+		for (ppData_cntr_1 = 0; ppData_cntr_1 < (1); ppData_cntr_1++) {
+			PyObject *py_ppData_1;
+			if (r->out.ppData[ppData_cntr_1] == NULL) {
+				py_ppData_1 = Py_None;
+				Py_INCREF(py_ppData_1);
+			} else {
+				py_ppData_1 = PyList_New(*r->out.pcbData);
+				if (py_ppData_1 == NULL) {
+					return NULL;
+				}
+				{
+					int ppData_cntr_3;
+					for (ppData_cntr_3 = 0; ppData_cntr_3 < (*r->out.pcbData); ppData_cntr_3++) {
+						PyObject *py_ppData_3;
+						py_ppData_3 = PyInt_FromLong((uint16_t)r->out.ppData[ppData_cntr_1][ppData_cntr_3]);
+						PyList_SetItem(py_ppData_1, ppData_cntr_3, py_ppData_3);
+					}
+				}
+			}
+			PyList_SetItem(py_ppData, ppData_cntr_1, py_ppData_1);
+		}
+	}
+	PyTuple_SetItem(result, 1, py_ppData);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_StmFindDisk_args_in(PyObject *args, PyObject *kwargs, struct clusapi_StmFindDisk *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_dwFlags;
+	PyObject *py_pDiskId;
+	PyObject *py_pUniqueId;
+	const char *kwnames[] = {
+		"hCluster", "dwFlags", "pDiskId", "pUniqueId", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:clusapi_StmFindDisk", discard_const_p(char *, kwnames), &py_hCluster, &py_dwFlags, &py_pDiskId, &py_pUniqueId)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_dwFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFlags));
+		if (PyLong_Check(py_dwFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else if (PyInt_Check(py_dwFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_pDiskId == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pDiskId");
+		return false;
+	}
+	if (py_pDiskId == Py_None) {
+		r->in.pDiskId = NULL;
+	} else {
+		r->in.pDiskId = NULL;
+		if (py_pDiskId == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pDiskId");
+			return false;
+		}
+		PY_CHECK_TYPE(&CLUSTER_DISKID_Type, py_pDiskId, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_pDiskId)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.pDiskId = (struct CLUSTER_DISKID *)pytalloc_get_ptr(py_pDiskId);
+	}
+	if (py_pUniqueId == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pUniqueId");
+		return false;
+	}
+	if (py_pUniqueId == Py_None) {
+		r->in.pUniqueId = NULL;
+	} else {
+		r->in.pUniqueId = NULL;
+		if (py_pUniqueId == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pUniqueId");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_pUniqueId, return false;);
+		{
+			int pUniqueId_cntr_1;
+			r->in.pUniqueId = talloc_array_ptrtype(r, r->in.pUniqueId, PyList_GET_SIZE(py_pUniqueId));
+			if (!r->in.pUniqueId) { return false;; }
+			talloc_set_name_const(r->in.pUniqueId, "ARRAY: r->in.pUniqueId");
+			for (pUniqueId_cntr_1 = 0; pUniqueId_cntr_1 < PyList_GET_SIZE(py_pUniqueId); pUniqueId_cntr_1++) {
+				if (PyList_GET_ITEM(py_pUniqueId, pUniqueId_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pUniqueId[pUniqueId_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.pUniqueId[pUniqueId_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_pUniqueId, pUniqueId_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_pUniqueId, pUniqueId_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pUniqueId[pUniqueId_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_pUniqueId, pUniqueId_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_pUniqueId, pUniqueId_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pUniqueId[pUniqueId_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_pUniqueId, return false;);
+	r->in.uniqueIdSize = PyList_GET_SIZE(py_pUniqueId);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_StmFindDisk_args_out(struct clusapi_StmFindDisk *r)
+{
+	PyObject *result;
+	PyObject *py_pDiskId;
+	PyObject *py_ppszDeviceName;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	if (r->out.pDiskId == NULL) {
+		py_pDiskId = Py_None;
+		Py_INCREF(py_pDiskId);
+	} else {
+		py_pDiskId = pytalloc_reference_ex(&CLUSTER_DISKID_Type, r->out.pDiskId, r->out.pDiskId);
+	}
+	PyTuple_SetItem(result, 0, py_pDiskId);
+	if (*r->out.ppszDeviceName == NULL) {
+		py_ppszDeviceName = Py_None;
+		Py_INCREF(py_ppszDeviceName);
+	} else {
+		if (*r->out.ppszDeviceName == NULL) {
+			py_ppszDeviceName = Py_None;
+			Py_INCREF(py_ppszDeviceName);
+		} else {
+			py_ppszDeviceName = PyUnicode_Decode(*r->out.ppszDeviceName, strlen(*r->out.ppszDeviceName), "utf-8", "ignore");
+		}
+	}
+	PyTuple_SetItem(result, 1, py_ppszDeviceName);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ClusterMrr_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ClusterMrr *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_fExcludeSelf;
+	PyObject *py_nodeSet;
+	PyObject *py_dwTimeout;
+	PyObject *py_dwComponent;
+	PyObject *py_dwControlCode;
+	PyObject *py_pInData;
+	const char *kwnames[] = {
+		"hCluster", "fExcludeSelf", "nodeSet", "dwTimeout", "dwComponent", "dwControlCode", "pInData", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOOO:clusapi_ClusterMrr", discard_const_p(char *, kwnames), &py_hCluster, &py_fExcludeSelf, &py_nodeSet, &py_dwTimeout, &py_dwComponent, &py_dwControlCode, &py_pInData)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_fExcludeSelf == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.fExcludeSelf");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.fExcludeSelf));
+		if (PyLong_Check(py_fExcludeSelf)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_fExcludeSelf);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.fExcludeSelf = test_var;
+		} else if (PyInt_Check(py_fExcludeSelf)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_fExcludeSelf);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.fExcludeSelf = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_nodeSet == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.nodeSet");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.nodeSet));
+		if (PyLong_Check(py_nodeSet)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_nodeSet);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nodeSet = test_var;
+		} else if (PyInt_Check(py_nodeSet)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_nodeSet);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.nodeSet = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwTimeout == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwTimeout");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwTimeout));
+		if (PyLong_Check(py_dwTimeout)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwTimeout);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwTimeout = test_var;
+		} else if (PyInt_Check(py_dwTimeout)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwTimeout);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwTimeout = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwComponent == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwComponent");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwComponent));
+		if (PyLong_Check(py_dwComponent)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwComponent);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwComponent = test_var;
+		} else if (PyInt_Check(py_dwComponent)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwComponent);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwComponent = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_dwControlCode == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwControlCode");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwControlCode));
+		if (PyLong_Check(py_dwControlCode)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwControlCode);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else if (PyInt_Check(py_dwControlCode)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwControlCode);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwControlCode = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_pInData, return false;);
+	r->in.inSize = PyList_GET_SIZE(py_pInData);
+	if (py_pInData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pInData");
+		return false;
+	}
+	if (py_pInData == Py_None) {
+		r->in.pInData = NULL;
+	} else {
+		r->in.pInData = NULL;
+		if (py_pInData == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pInData");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_pInData, return false;);
+		{
+			int pInData_cntr_1;
+			r->in.pInData = talloc_array_ptrtype(r, r->in.pInData, PyList_GET_SIZE(py_pInData));
+			if (!r->in.pInData) { return false;; }
+			talloc_set_name_const(r->in.pInData, "ARRAY: r->in.pInData");
+			for (pInData_cntr_1 = 0; pInData_cntr_1 < PyList_GET_SIZE(py_pInData); pInData_cntr_1++) {
+				if (PyList_GET_ITEM(py_pInData, pInData_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pInData[pInData_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.pInData[pInData_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_pInData, pInData_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_pInData, pInData_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pInData[pInData_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_pInData, pInData_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_pInData, pInData_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pInData[pInData_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ClusterMrr_args_out(struct clusapi_ClusterMrr *r)
+{
+	PyObject *result;
+	PyObject *py_ppInfo;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	py_ppInfo = PyList_New(1);
+	if (py_ppInfo == NULL) {
+		return NULL;
+	}
+	{
+		int ppInfo_cntr_1;
+		for (ppInfo_cntr_1 = 0; ppInfo_cntr_1 < (1); ppInfo_cntr_1++) {
+			PyObject *py_ppInfo_1;
+			if (r->out.ppInfo[ppInfo_cntr_1] == NULL) {
+				py_ppInfo_1 = Py_None;
+				Py_INCREF(py_ppInfo_1);
+			} else {
+				py_ppInfo_1 = PyList_New(1);
+				if (py_ppInfo_1 == NULL) {
+					return NULL;
+				}
+				{
+					int ppInfo_cntr_3;
+					for (ppInfo_cntr_3 = 0; ppInfo_cntr_3 < (1); ppInfo_cntr_3++) {
+						PyObject *py_ppInfo_3;
+						py_ppInfo_3 = pytalloc_reference_ex(&CLUSTER_MRR_RESPONSE_Type, r->out.ppInfo[ppInfo_cntr_1], &r->out.ppInfo[ppInfo_cntr_1][ppInfo_cntr_3]);
+						PyList_SetItem(py_ppInfo_1, ppInfo_cntr_3, py_ppInfo_3);
+					}
+				}
+			}
+			PyList_SetItem(py_ppInfo, ppInfo_cntr_1, py_ppInfo_1);
+		}
+	}
+	PyTuple_SetItem(result, 0, py_ppInfo);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateGroupEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateGroupEnum *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_pProperties;
+	PyObject *py_pRoProperties;
+	const char *kwnames[] = {
+		"hCluster", "pProperties", "pRoProperties", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_CreateGroupEnum", discard_const_p(char *, kwnames), &py_hCluster, &py_pProperties, &py_pRoProperties)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_pProperties == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pProperties");
+		return false;
+	}
+	if (py_pProperties == Py_None) {
+		r->in.pProperties = NULL;
+	} else {
+		r->in.pProperties = NULL;
+		if (py_pProperties == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pProperties");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_pProperties, return false;);
+		{
+			int pProperties_cntr_1;
+			r->in.pProperties = talloc_array_ptrtype(r, r->in.pProperties, PyList_GET_SIZE(py_pProperties));
+			if (!r->in.pProperties) { return false;; }
+			talloc_set_name_const(r->in.pProperties, "ARRAY: r->in.pProperties");
+			for (pProperties_cntr_1 = 0; pProperties_cntr_1 < PyList_GET_SIZE(py_pProperties); pProperties_cntr_1++) {
+				if (PyList_GET_ITEM(py_pProperties, pProperties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pProperties[pProperties_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.pProperties[pProperties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pProperties[pProperties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pProperties[pProperties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_pProperties, return false;);
+	r->in.cbProperties = PyList_GET_SIZE(py_pProperties);
+	if (py_pRoProperties == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pRoProperties");
+		return false;
+	}
+	if (py_pRoProperties == Py_None) {
+		r->in.pRoProperties = NULL;
+	} else {
+		r->in.pRoProperties = NULL;
+		if (py_pRoProperties == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pRoProperties");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_pRoProperties, return false;);
+		{
+			int pRoProperties_cntr_1;
+			r->in.pRoProperties = talloc_array_ptrtype(r, r->in.pRoProperties, PyList_GET_SIZE(py_pRoProperties));
+			if (!r->in.pRoProperties) { return false;; }
+			talloc_set_name_const(r->in.pRoProperties, "ARRAY: r->in.pRoProperties");
+			for (pRoProperties_cntr_1 = 0; pRoProperties_cntr_1 < PyList_GET_SIZE(py_pRoProperties); pRoProperties_cntr_1++) {
+				if (PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pRoProperties[pRoProperties_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.pRoProperties[pRoProperties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pRoProperties[pRoProperties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pRoProperties[pRoProperties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_pRoProperties, return false;);
+	r->in.cbRoProperties = PyList_GET_SIZE(py_pRoProperties);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateGroupEnum_args_out(struct clusapi_CreateGroupEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ppResultList;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ppResultList == NULL) {
+		py_ppResultList = Py_None;
+		Py_INCREF(py_ppResultList);
+	} else {
+		py_ppResultList = pytalloc_reference_ex(&GROUP_ENUM_LIST_Type, *r->out.ppResultList, *r->out.ppResultList);
+	}
+	PyTuple_SetItem(result, 0, py_ppResultList);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_CreateResourceEnum_args_in(PyObject *args, PyObject *kwargs, struct clusapi_CreateResourceEnum *r)
+{
+	PyObject *py_hCluster;
+	PyObject *py_pProperties;
+	PyObject *py_pRoProperties;
+	const char *kwnames[] = {
+		"hCluster", "pProperties", "pRoProperties", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:clusapi_CreateResourceEnum", discard_const_p(char *, kwnames), &py_hCluster, &py_pProperties, &py_pRoProperties)) {
+		return false;
+	}
+
+	if (py_hCluster == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hCluster");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hCluster, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hCluster)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hCluster = *(struct policy_handle *)pytalloc_get_ptr(py_hCluster);
+	if (py_pProperties == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pProperties");
+		return false;
+	}
+	if (py_pProperties == Py_None) {
+		r->in.pProperties = NULL;
+	} else {
+		r->in.pProperties = NULL;
+		if (py_pProperties == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pProperties");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_pProperties, return false;);
+		{
+			int pProperties_cntr_1;
+			r->in.pProperties = talloc_array_ptrtype(r, r->in.pProperties, PyList_GET_SIZE(py_pProperties));
+			if (!r->in.pProperties) { return false;; }
+			talloc_set_name_const(r->in.pProperties, "ARRAY: r->in.pProperties");
+			for (pProperties_cntr_1 = 0; pProperties_cntr_1 < PyList_GET_SIZE(py_pProperties); pProperties_cntr_1++) {
+				if (PyList_GET_ITEM(py_pProperties, pProperties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pProperties[pProperties_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.pProperties[pProperties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pProperties[pProperties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_pProperties, pProperties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pProperties[pProperties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_pProperties, return false;);
+	r->in.cbProperties = PyList_GET_SIZE(py_pProperties);
+	if (py_pRoProperties == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pRoProperties");
+		return false;
+	}
+	if (py_pRoProperties == Py_None) {
+		r->in.pRoProperties = NULL;
+	} else {
+		r->in.pRoProperties = NULL;
+		if (py_pRoProperties == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pRoProperties");
+			return false;
+		}
+		PY_CHECK_TYPE(&PyList_Type, py_pRoProperties, return false;);
+		{
+			int pRoProperties_cntr_1;
+			r->in.pRoProperties = talloc_array_ptrtype(r, r->in.pRoProperties, PyList_GET_SIZE(py_pRoProperties));
+			if (!r->in.pRoProperties) { return false;; }
+			talloc_set_name_const(r->in.pRoProperties, "ARRAY: r->in.pRoProperties");
+			for (pRoProperties_cntr_1 = 0; pRoProperties_cntr_1 < PyList_GET_SIZE(py_pRoProperties); pRoProperties_cntr_1++) {
+				if (PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pRoProperties[pRoProperties_cntr_1]");
+					return false;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.pRoProperties[pRoProperties_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return false;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pRoProperties[pRoProperties_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(py_pRoProperties, pRoProperties_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return false;
+						}
+						r->in.pRoProperties[pRoProperties_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return false;
+					}
+				}
+			}
+		}
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_pRoProperties, return false;);
+	r->in.cbRoProperties = PyList_GET_SIZE(py_pRoProperties);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_CreateResourceEnum_args_out(struct clusapi_CreateResourceEnum *r)
+{
+	PyObject *result;
+	PyObject *py_ppResultList;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(2);
+	if (*r->out.ppResultList == NULL) {
+		py_ppResultList = Py_None;
+		Py_INCREF(py_ppResultList);
+	} else {
+		py_ppResultList = pytalloc_reference_ex(&RESOURCE_ENUM_LIST_Type, *r->out.ppResultList, *r->out.ppResultList);
+	}
+	PyTuple_SetItem(result, 0, py_ppResultList);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 1, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_ExecuteReadBatch_args_in(PyObject *args, PyObject *kwargs, struct clusapi_ExecuteReadBatch *r)
+{
+	PyObject *py_hKey;
+	PyObject *py_lpInData;
+	const char *kwnames[] = {
+		"hKey", "lpInData", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_ExecuteReadBatch", discard_const_p(char *, kwnames), &py_hKey, &py_lpInData)) {
+		return false;
+	}
+
+	if (py_hKey == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hKey");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hKey, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hKey)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hKey = *(struct policy_handle *)pytalloc_get_ptr(py_hKey);
+	PY_CHECK_TYPE(&PyList_Type, py_lpInData, return false;);
+	r->in.cbInData = PyList_GET_SIZE(py_lpInData);
+	if (py_lpInData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInData");
+		return false;
+	}
+	r->in.lpInData = talloc_ptrtype(r, r->in.lpInData);
+	if (py_lpInData == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.lpInData");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_lpInData, return false;);
+	{
+		int lpInData_cntr_1;
+		r->in.lpInData = talloc_array_ptrtype(r, r->in.lpInData, PyList_GET_SIZE(py_lpInData));
+		if (!r->in.lpInData) { return false;; }
+		talloc_set_name_const(r->in.lpInData, "ARRAY: r->in.lpInData");
+		for (lpInData_cntr_1 = 0; lpInData_cntr_1 < PyList_GET_SIZE(py_lpInData); lpInData_cntr_1++) {
+			if (PyList_GET_ITEM(py_lpInData, lpInData_cntr_1) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.lpInData[lpInData_cntr_1]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.lpInData[lpInData_cntr_1]));
+				if (PyLong_Check(PyList_GET_ITEM(py_lpInData, lpInData_cntr_1))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_lpInData, lpInData_cntr_1));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInData[lpInData_cntr_1] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_lpInData, lpInData_cntr_1))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_lpInData, lpInData_cntr_1));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.lpInData[lpInData_cntr_1] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_ExecuteReadBatch_args_out(struct clusapi_ExecuteReadBatch *r)
+{
+	PyObject *result;
+	PyObject *py_cbOutData;
+	PyObject *py_lpOutData;
+	PyObject *py_rpc_status;
+	result = PyTuple_New(3);
+	py_cbOutData = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.cbOutData);
+	PyTuple_SetItem(result, 0, py_cbOutData);
+	if (*r->out.lpOutData == NULL) {
+		py_lpOutData = Py_None;
+		Py_INCREF(py_lpOutData);
+	} else {
+		py_lpOutData = PyList_New(*r->out.cbOutData);
+		if (py_lpOutData == NULL) {
+			return NULL;
+		}
+		{
+			int lpOutData_cntr_2;
+			for (lpOutData_cntr_2 = 0; lpOutData_cntr_2 < (*r->out.cbOutData); lpOutData_cntr_2++) {
+				PyObject *py_lpOutData_2;
+				py_lpOutData_2 = PyInt_FromLong((uint16_t)*r->out.lpOutData[lpOutData_cntr_2]);
+				PyList_SetItem(py_lpOutData, lpOutData_cntr_2, py_lpOutData_2);
+			}
+		}
+	}
+	PyTuple_SetItem(result, 1, py_lpOutData);
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	PyTuple_SetItem(result, 2, py_rpc_status);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_RestartResource_args_in(PyObject *args, PyObject *kwargs, struct clusapi_RestartResource *r)
+{
+	PyObject *py_hResource;
+	PyObject *py_dwFlags;
+	const char *kwnames[] = {
+		"hResource", "dwFlags", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:clusapi_RestartResource", discard_const_p(char *, kwnames), &py_hResource, &py_dwFlags)) {
+		return false;
+	}
+
+	if (py_hResource == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hResource");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hResource, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hResource)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hResource = *(struct policy_handle *)pytalloc_get_ptr(py_hResource);
+	if (py_dwFlags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.dwFlags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.dwFlags));
+		if (PyLong_Check(py_dwFlags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_dwFlags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else if (PyInt_Check(py_dwFlags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_dwFlags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.dwFlags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_RestartResource_args_out(struct clusapi_RestartResource *r)
+{
+	PyObject *result;
+	PyObject *py_rpc_status;
+	py_rpc_status = PyErr_FromWERROR(*r->out.rpc_status);
+	result = py_rpc_status;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_clusapi_GetNotifyAsync_args_in(PyObject *args, PyObject *kwargs, struct clusapi_GetNotifyAsync *r)
+{
+	PyObject *py_hNotify;
+	const char *kwnames[] = {
+		"hNotify", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:clusapi_GetNotifyAsync", discard_const_p(char *, kwnames), &py_hNotify)) {
+		return false;
+	}
+
+	if (py_hNotify == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hNotify");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_hNotify, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_hNotify)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.hNotify = *(struct policy_handle *)pytalloc_get_ptr(py_hNotify);
+	return true;
+}
+
+static PyObject *unpack_py_clusapi_GetNotifyAsync_args_out(struct clusapi_GetNotifyAsync *r)
+{
+	PyObject *result;
+	PyObject *py_Notifications;
+	PyObject *py_dwNumNotifications;
+	result = PyTuple_New(2);
+	if (*r->out.Notifications == NULL) {
+		py_Notifications = Py_None;
+		Py_INCREF(py_Notifications);
+	} else {
+		py_Notifications = PyList_New(*r->out.dwNumNotifications);
+		if (py_Notifications == NULL) {
+			return NULL;
+		}
+		{
+			int Notifications_cntr_2;
+			for (Notifications_cntr_2 = 0; Notifications_cntr_2 < (*r->out.dwNumNotifications); Notifications_cntr_2++) {
+				PyObject *py_Notifications_2;
+				py_Notifications_2 = pytalloc_reference_ex(&NOTIFICATION_DATA_ASYNC_RPC_Type, *r->out.Notifications, r->out.Notifications[Notifications_cntr_2]);
+				PyList_SetItem(py_Notifications, Notifications_cntr_2, py_Notifications_2);
+			}
+		}
+	}
+	PyTuple_SetItem(result, 0, py_Notifications);
+	py_dwNumNotifications = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.dwNumNotifications);
+	PyTuple_SetItem(result, 1, py_dwNumNotifications);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_clusapi_methods[] = {
+	{ "OpenCluster", "S.OpenCluster() -> (Status, Cluster)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenCluster_r, (py_data_pack_fn)pack_py_clusapi_OpenCluster_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenCluster_args_out, 0, &ndr_table_clusapi },
+	{ "CloseCluster", "S.CloseCluster(Cluster) -> Cluster", (py_dcerpc_call_fn)dcerpc_clusapi_CloseCluster_r, (py_data_pack_fn)pack_py_clusapi_CloseCluster_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseCluster_args_out, 1, &ndr_table_clusapi },
+	{ "SetClusterName", "S.SetClusterName(NewClusterName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetClusterName_r, (py_data_pack_fn)pack_py_clusapi_SetClusterName_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetClusterName_args_out, 2, &ndr_table_clusapi },
+	{ "GetClusterName", "S.GetClusterName() -> (ClusterName, NodeName)", (py_dcerpc_call_fn)dcerpc_clusapi_GetClusterName_r, (py_data_pack_fn)pack_py_clusapi_GetClusterName_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetClusterName_args_out, 3, &ndr_table_clusapi },
+	{ "GetClusterVersion", "S.GetClusterVersion() -> (lpwMajorVersion, lpwMinorVersion, lpwBuildNumber, lpszVendorId, lpszCSDVersion)", (py_dcerpc_call_fn)dcerpc_clusapi_GetClusterVersion_r, (py_data_pack_fn)pack_py_clusapi_GetClusterVersion_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetClusterVersion_args_out, 4, &ndr_table_clusapi },
+	{ "GetQuorumResource", "S.GetQuorumResource() -> (lpszResourceName, lpszDeviceName, pdwMaxQuorumLogSize, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetQuorumResource_r, (py_data_pack_fn)pack_py_clusapi_GetQuorumResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetQuorumResource_args_out, 5, &ndr_table_clusapi },
+	{ "SetQuorumResource", "S.SetQuorumResource(hResource, lpszDeviceName, dwMaxQuorumLogSize) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetQuorumResource_r, (py_data_pack_fn)pack_py_clusapi_SetQuorumResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetQuorumResource_args_out, 6, &ndr_table_clusapi },
+	{ "CreateEnum", "S.CreateEnum(dwType) -> (ReturnEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateEnum_args_out, 7, &ndr_table_clusapi },
+	{ "OpenResource", "S.OpenResource(lpszResourceName) -> (Status, rpc_status, hResource)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenResource_r, (py_data_pack_fn)pack_py_clusapi_OpenResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenResource_args_out, 8, &ndr_table_clusapi },
+	{ "CreateResource", "S.CreateResource(hGroup, lpszResourceName, lpszResourceType, dwFlags) -> (Status, rpc_status, hResource)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateResource_r, (py_data_pack_fn)pack_py_clusapi_CreateResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateResource_args_out, 9, &ndr_table_clusapi },
+	{ "DeleteResource", "S.DeleteResource(hResource) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_DeleteResource_r, (py_data_pack_fn)pack_py_clusapi_DeleteResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_DeleteResource_args_out, 10, &ndr_table_clusapi },
+	{ "CloseResource", "S.CloseResource(Resource) -> Resource", (py_dcerpc_call_fn)dcerpc_clusapi_CloseResource_r, (py_data_pack_fn)pack_py_clusapi_CloseResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseResource_args_out, 11, &ndr_table_clusapi },
+	{ "GetResourceState", "S.GetResourceState(hResource) -> (State, NodeName, GroupName, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetResourceState_r, (py_data_pack_fn)pack_py_clusapi_GetResourceState_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetResourceState_args_out, 12, &ndr_table_clusapi },
+	{ "SetResourceName", "S.SetResourceName(hResource, lpszResourceName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetResourceName_r, (py_data_pack_fn)pack_py_clusapi_SetResourceName_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetResourceName_args_out, 13, &ndr_table_clusapi },
+	{ "GetResourceId", "S.GetResourceId(hResource) -> (pGuid, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetResourceId_r, (py_data_pack_fn)pack_py_clusapi_GetResourceId_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetResourceId_args_out, 14, &ndr_table_clusapi },
+	{ "GetResourceType", "S.GetResourceType(hResource) -> (lpszResourceType, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetResourceType_r, (py_data_pack_fn)pack_py_clusapi_GetResourceType_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetResourceType_args_out, 15, &ndr_table_clusapi },
+	{ "FailResource", "S.FailResource(hResource) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_FailResource_r, (py_data_pack_fn)pack_py_clusapi_FailResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_FailResource_args_out, 16, &ndr_table_clusapi },
+	{ "OnlineResource", "S.OnlineResource(hResource) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OnlineResource_r, (py_data_pack_fn)pack_py_clusapi_OnlineResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_OnlineResource_args_out, 17, &ndr_table_clusapi },
+	{ "OfflineResource", "S.OfflineResource(hResource) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OfflineResource_r, (py_data_pack_fn)pack_py_clusapi_OfflineResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_OfflineResource_args_out, 18, &ndr_table_clusapi },
+	{ "AddResourceDependency", "S.AddResourceDependency(hResource, hDependsOn) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_AddResourceDependency_r, (py_data_pack_fn)pack_py_clusapi_AddResourceDependency_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddResourceDependency_args_out, 19, &ndr_table_clusapi },
+	{ "RemoveResourceDependency", "S.RemoveResourceDependency(hResource, hDependsOn) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_RemoveResourceDependency_r, (py_data_pack_fn)pack_py_clusapi_RemoveResourceDependency_args_in, (py_data_unpack_fn)unpack_py_clusapi_RemoveResourceDependency_args_out, 20, &ndr_table_clusapi },
+	{ "CanResourceBeDependent", "S.CanResourceBeDependent(hResource, hResourceDependent) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_CanResourceBeDependent_r, (py_data_pack_fn)pack_py_clusapi_CanResourceBeDependent_args_in, (py_data_unpack_fn)unpack_py_clusapi_CanResourceBeDependent_args_out, 21, &ndr_table_clusapi },
+	{ "CreateResEnum", "S.CreateResEnum(hResource, dwType) -> (ReturnEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateResEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateResEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateResEnum_args_out, 22, &ndr_table_clusapi },
+	{ "AddResourceNode", "S.AddResourceNode(hResource, hNode) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_AddResourceNode_r, (py_data_pack_fn)pack_py_clusapi_AddResourceNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddResourceNode_args_out, 23, &ndr_table_clusapi },
+	{ "RemoveResourceNode", "S.RemoveResourceNode(hResource, hNode) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_RemoveResourceNode_r, (py_data_pack_fn)pack_py_clusapi_RemoveResourceNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_RemoveResourceNode_args_out, 24, &ndr_table_clusapi },
+	{ "ChangeResourceGroup", "S.ChangeResourceGroup(hResource, hGroup) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ChangeResourceGroup_r, (py_data_pack_fn)pack_py_clusapi_ChangeResourceGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_ChangeResourceGroup_args_out, 25, &ndr_table_clusapi },
+	{ "CreateResourceType", "S.CreateResourceType(lpszTypeName, lpszDisplayName, lpszDllName, dwLooksAlive, dwIsAlive) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_CreateResourceType_r, (py_data_pack_fn)pack_py_clusapi_CreateResourceType_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateResourceType_args_out, 26, &ndr_table_clusapi },
+	{ "DeleteResourceType", "S.DeleteResourceType(lpszTypeName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_DeleteResourceType_r, (py_data_pack_fn)pack_py_clusapi_DeleteResourceType_args_in, (py_data_unpack_fn)unpack_py_clusapi_DeleteResourceType_args_out, 27, &ndr_table_clusapi },
+	{ "GetRootKey", "S.GetRootKey(samDesired) -> (Status, rpc_status, phKey)", (py_dcerpc_call_fn)dcerpc_clusapi_GetRootKey_r, (py_data_pack_fn)pack_py_clusapi_GetRootKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetRootKey_args_out, 28, &ndr_table_clusapi },
+	{ "CreateKey", "S.CreateKey(hKey, lpSubKey, dwOptions, samDesired, lpSecurityAttributes) -> (lpdwDisposition, Status, rpc_status, phKey)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateKey_r, (py_data_pack_fn)pack_py_clusapi_CreateKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateKey_args_out, 29, &ndr_table_clusapi },
+	{ "OpenKey", "S.OpenKey(hKey, lpSubKey, samDesired) -> (Status, rpc_status, phKey)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenKey_r, (py_data_pack_fn)pack_py_clusapi_OpenKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenKey_args_out, 30, &ndr_table_clusapi },
+	{ "EnumKey", "S.EnumKey(hKey, dwIndex) -> (KeyName, lpftLastWriteTime, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_EnumKey_r, (py_data_pack_fn)pack_py_clusapi_EnumKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_EnumKey_args_out, 31, &ndr_table_clusapi },
+	{ "SetValue", "S.SetValue(hKey, lpValueName, dwType, lpData) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetValue_r, (py_data_pack_fn)pack_py_clusapi_SetValue_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetValue_args_out, 32, &ndr_table_clusapi },
+	{ "DeleteValue", "S.DeleteValue(hKey, lpValueName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_DeleteValue_r, (py_data_pack_fn)pack_py_clusapi_DeleteValue_args_in, (py_data_unpack_fn)unpack_py_clusapi_DeleteValue_args_out, 33, &ndr_table_clusapi },
+	{ "QueryValue", "S.QueryValue(hKey, lpValueName, cbData) -> (lpValueType, lpData, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_QueryValue_r, (py_data_pack_fn)pack_py_clusapi_QueryValue_args_in, (py_data_unpack_fn)unpack_py_clusapi_QueryValue_args_out, 34, &ndr_table_clusapi },
+	{ "DeleteKey", "S.DeleteKey(hKey, lpSubKey) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_DeleteKey_r, (py_data_pack_fn)pack_py_clusapi_DeleteKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_DeleteKey_args_out, 35, &ndr_table_clusapi },
+	{ "EnumValue", "S.EnumValue(hKey, dwIndex) -> (lpValueName, lpType, lpData, TotalSize, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_EnumValue_r, (py_data_pack_fn)pack_py_clusapi_EnumValue_args_in, (py_data_unpack_fn)unpack_py_clusapi_EnumValue_args_out, 36, &ndr_table_clusapi },
+	{ "CloseKey", "S.CloseKey(pKey) -> pKey", (py_dcerpc_call_fn)dcerpc_clusapi_CloseKey_r, (py_data_pack_fn)pack_py_clusapi_CloseKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseKey_args_out, 37, &ndr_table_clusapi },
+	{ "QueryInfoKey", "S.QueryInfoKey(hKey) -> (lpcSubKeys, lpcbMaxSubKeyLen, lpcValues, lpcbMaxValueNameLen, lpcbMaxValueLen, lpcbSecurityDescriptor, lpftLastWriteTime, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_QueryInfoKey_r, (py_data_pack_fn)pack_py_clusapi_QueryInfoKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_QueryInfoKey_args_out, 38, &ndr_table_clusapi },
+	{ "SetKeySecurity", "S.SetKeySecurity(hKey, SecurityInformation, pRpcSecurityDescriptor) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetKeySecurity_r, (py_data_pack_fn)pack_py_clusapi_SetKeySecurity_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetKeySecurity_args_out, 39, &ndr_table_clusapi },
+	{ "GetKeySecurity", "S.GetKeySecurity(hKey, SecurityInformation, pRpcSecurityDescriptor) -> (pRpcSecurityDescriptor, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetKeySecurity_r, (py_data_pack_fn)pack_py_clusapi_GetKeySecurity_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetKeySecurity_args_out, 40, &ndr_table_clusapi },
+	{ "OpenGroup", "S.OpenGroup(lpszGroupName) -> (Status, rpc_status, hGroup)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenGroup_r, (py_data_pack_fn)pack_py_clusapi_OpenGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenGroup_args_out, 41, &ndr_table_clusapi },
+	{ "CreateGroup", "S.CreateGroup(lpszGroupName) -> (Status, rpc_status, hGroup)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateGroup_r, (py_data_pack_fn)pack_py_clusapi_CreateGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateGroup_args_out, 42, &ndr_table_clusapi },
+	{ "DeleteGroup", "S.DeleteGroup(Group, force) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_DeleteGroup_r, (py_data_pack_fn)pack_py_clusapi_DeleteGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_DeleteGroup_args_out, 43, &ndr_table_clusapi },
+	{ "CloseGroup", "S.CloseGroup(Group) -> Group", (py_dcerpc_call_fn)dcerpc_clusapi_CloseGroup_r, (py_data_pack_fn)pack_py_clusapi_CloseGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseGroup_args_out, 44, &ndr_table_clusapi },
+	{ "GetGroupState", "S.GetGroupState(hGroup) -> (State, NodeName, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetGroupState_r, (py_data_pack_fn)pack_py_clusapi_GetGroupState_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetGroupState_args_out, 45, &ndr_table_clusapi },
+	{ "SetGroupName", "S.SetGroupName(hGroup, lpszGroupName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetGroupName_r, (py_data_pack_fn)pack_py_clusapi_SetGroupName_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetGroupName_args_out, 46, &ndr_table_clusapi },
+	{ "GetGroupId", "S.GetGroupId(hGroup) -> (pGuid, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetGroupId_r, (py_data_pack_fn)pack_py_clusapi_GetGroupId_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetGroupId_args_out, 47, &ndr_table_clusapi },
+	{ "GetNodeId", "S.GetNodeId(hNode) -> (pGuid, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNodeId_r, (py_data_pack_fn)pack_py_clusapi_GetNodeId_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNodeId_args_out, 48, &ndr_table_clusapi },
+	{ "OnlineGroup", "S.OnlineGroup(hGroup) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OnlineGroup_r, (py_data_pack_fn)pack_py_clusapi_OnlineGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_OnlineGroup_args_out, 49, &ndr_table_clusapi },
+	{ "OfflineGroup", "S.OfflineGroup(hGroup) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OfflineGroup_r, (py_data_pack_fn)pack_py_clusapi_OfflineGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_OfflineGroup_args_out, 50, &ndr_table_clusapi },
+	{ "MoveGroup", "S.MoveGroup(hGroup) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_MoveGroup_r, (py_data_pack_fn)pack_py_clusapi_MoveGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_MoveGroup_args_out, 51, &ndr_table_clusapi },
+	{ "MoveGroupToNode", "S.MoveGroupToNode(hGroup, hNode) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_MoveGroupToNode_r, (py_data_pack_fn)pack_py_clusapi_MoveGroupToNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_MoveGroupToNode_args_out, 52, &ndr_table_clusapi },
+	{ "CreateGroupResourceEnum", "S.CreateGroupResourceEnum(hGroup, dwType) -> (ReturnEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateGroupResourceEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateGroupResourceEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateGroupResourceEnum_args_out, 53, &ndr_table_clusapi },
+	{ "SetGroupNodeList", "S.SetGroupNodeList(hGroup, multiSzNodeList) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetGroupNodeList_r, (py_data_pack_fn)pack_py_clusapi_SetGroupNodeList_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetGroupNodeList_args_out, 54, &ndr_table_clusapi },
+	{ "CreateNotify", "S.CreateNotify() -> (Status, rpc_status, hNotify)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateNotify_r, (py_data_pack_fn)pack_py_clusapi_CreateNotify_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateNotify_args_out, 55, &ndr_table_clusapi },
+	{ "CloseNotify", "S.CloseNotify(Notify) -> Notify", (py_dcerpc_call_fn)dcerpc_clusapi_CloseNotify_r, (py_data_pack_fn)pack_py_clusapi_CloseNotify_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseNotify_args_out, 56, &ndr_table_clusapi },
+	{ "AddNotifyCluster", "S.AddNotifyCluster(hNotify, hCluster, dwFilter, dwNotifyKey) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyCluster_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyCluster_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyCluster_args_out, 57, &ndr_table_clusapi },
+	{ "AddNotifyNode", "S.AddNotifyNode(hNotify, hNode, dwFilter, dwNotifyKey) -> (dwStateSequence, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyNode_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyNode_args_out, 58, &ndr_table_clusapi },
+	{ "AddNotifyGroup", "S.AddNotifyGroup(hNotify, hGroup, dwFilter, dwNotifyKey) -> (dwStateSequence, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyGroup_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyGroup_args_out, 59, &ndr_table_clusapi },
+	{ "AddNotifyResource", "S.AddNotifyResource(hNotify, hResource, dwFilter, dwNotifyKey) -> (dwStateSequence, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyResource_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyResource_args_out, 60, &ndr_table_clusapi },
+	{ "AddNotifyKey", "S.AddNotifyKey(hNotify, hKey, dwNotifyKey, Filter, WatchSubTree) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyKey_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyKey_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyKey_args_out, 61, &ndr_table_clusapi },
+	{ "ReAddNotifyNode", "S.ReAddNotifyNode(hNotify, hNode, dwFilter, dwNotifyKey, StateSequence) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ReAddNotifyNode_r, (py_data_pack_fn)pack_py_clusapi_ReAddNotifyNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_ReAddNotifyNode_args_out, 62, &ndr_table_clusapi },
+	{ "ReAddNotifyGroup", "S.ReAddNotifyGroup(hNotify, hGroup, dwFilter, dwNotifyKey, StateSequence) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ReAddNotifyGroup_r, (py_data_pack_fn)pack_py_clusapi_ReAddNotifyGroup_args_in, (py_data_unpack_fn)unpack_py_clusapi_ReAddNotifyGroup_args_out, 63, &ndr_table_clusapi },
+	{ "ReAddNotifyResource", "S.ReAddNotifyResource(hNotify, hResource, dwFilter, dwNotifyKey, StateSequence) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ReAddNotifyResource_r, (py_data_pack_fn)pack_py_clusapi_ReAddNotifyResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_ReAddNotifyResource_args_out, 64, &ndr_table_clusapi },
+	{ "GetNotify", "S.GetNotify(hNotify) -> (dwNotifyKey, dwFilter, dwStateSequence, Name, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNotify_r, (py_data_pack_fn)pack_py_clusapi_GetNotify_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNotify_args_out, 65, &ndr_table_clusapi },
+	{ "OpenNode", "S.OpenNode(lpszNodeName) -> (Status, rpc_status, hNode)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenNode_r, (py_data_pack_fn)pack_py_clusapi_OpenNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenNode_args_out, 66, &ndr_table_clusapi },
+	{ "CloseNode", "S.CloseNode(Node) -> Node", (py_dcerpc_call_fn)dcerpc_clusapi_CloseNode_r, (py_data_pack_fn)pack_py_clusapi_CloseNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseNode_args_out, 67, &ndr_table_clusapi },
+	{ "GetNodeState", "S.GetNodeState(hNode) -> (State, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNodeState_r, (py_data_pack_fn)pack_py_clusapi_GetNodeState_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNodeState_args_out, 68, &ndr_table_clusapi },
+	{ "PauseNode", "S.PauseNode(hNode) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_PauseNode_r, (py_data_pack_fn)pack_py_clusapi_PauseNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_PauseNode_args_out, 69, &ndr_table_clusapi },
+	{ "ResumeNode", "S.ResumeNode(hNode) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ResumeNode_r, (py_data_pack_fn)pack_py_clusapi_ResumeNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_ResumeNode_args_out, 70, &ndr_table_clusapi },
+	{ "EvictNode", "S.EvictNode(hNode) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_EvictNode_r, (py_data_pack_fn)pack_py_clusapi_EvictNode_args_in, (py_data_unpack_fn)unpack_py_clusapi_EvictNode_args_out, 71, &ndr_table_clusapi },
+	{ "NodeResourceControl", "S.NodeResourceControl(hResource, hNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeResourceControl_r, (py_data_pack_fn)pack_py_clusapi_NodeResourceControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeResourceControl_args_out, 72, &ndr_table_clusapi },
+	{ "ResourceControl", "S.ResourceControl(hResource, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_ResourceControl_r, (py_data_pack_fn)pack_py_clusapi_ResourceControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_ResourceControl_args_out, 73, &ndr_table_clusapi },
+	{ "NodeResourceTypeControl", "S.NodeResourceTypeControl(hCluster, lpszResourceTypeName, hNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeResourceTypeControl_r, (py_data_pack_fn)pack_py_clusapi_NodeResourceTypeControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeResourceTypeControl_args_out, 74, &ndr_table_clusapi },
+	{ "ResourceTypeControl", "S.ResourceTypeControl(hCluster, lpszResourceTypeName, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_ResourceTypeControl_r, (py_data_pack_fn)pack_py_clusapi_ResourceTypeControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_ResourceTypeControl_args_out, 75, &ndr_table_clusapi },
+	{ "NodeGroupControl", "S.NodeGroupControl(hGroup, hNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeGroupControl_r, (py_data_pack_fn)pack_py_clusapi_NodeGroupControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeGroupControl_args_out, 76, &ndr_table_clusapi },
+	{ "GroupControl", "S.GroupControl(hGroup, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GroupControl_r, (py_data_pack_fn)pack_py_clusapi_GroupControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_GroupControl_args_out, 77, &ndr_table_clusapi },
+	{ "NodeNodeControl", "S.NodeNodeControl(hNode, hHostNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeNodeControl_r, (py_data_pack_fn)pack_py_clusapi_NodeNodeControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeNodeControl_args_out, 78, &ndr_table_clusapi },
+	{ "NodeControl", "S.NodeControl(hNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeControl_r, (py_data_pack_fn)pack_py_clusapi_NodeControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeControl_args_out, 79, &ndr_table_clusapi },
+	{ "Opnum80NotUsedOnWire", "S.Opnum80NotUsedOnWire() -> None", (py_dcerpc_call_fn)dcerpc_Opnum80NotUsedOnWire_r, (py_data_pack_fn)pack_py_Opnum80NotUsedOnWire_args_in, (py_data_unpack_fn)unpack_py_Opnum80NotUsedOnWire_args_out, 80, &ndr_table_clusapi },
+	{ "OpenNetwork", "S.OpenNetwork(lpszNetworkName) -> (Status, rpc_status, hNetwork)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenNetwork_r, (py_data_pack_fn)pack_py_clusapi_OpenNetwork_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenNetwork_args_out, 81, &ndr_table_clusapi },
+	{ "CloseNetwork", "S.CloseNetwork(Network) -> Network", (py_dcerpc_call_fn)dcerpc_clusapi_CloseNetwork_r, (py_data_pack_fn)pack_py_clusapi_CloseNetwork_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseNetwork_args_out, 82, &ndr_table_clusapi },
+	{ "GetNetworkState", "S.GetNetworkState(hNetwork) -> (State, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNetworkState_r, (py_data_pack_fn)pack_py_clusapi_GetNetworkState_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNetworkState_args_out, 83, &ndr_table_clusapi },
+	{ "SetNetworkName", "S.SetNetworkName(hNetwork, lpszNetworkName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetNetworkName_r, (py_data_pack_fn)pack_py_clusapi_SetNetworkName_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetNetworkName_args_out, 84, &ndr_table_clusapi },
+	{ "CreateNetworkEnum", "S.CreateNetworkEnum(hNetwork, dwType) -> (ReturnEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateNetworkEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateNetworkEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateNetworkEnum_args_out, 85, &ndr_table_clusapi },
+	{ "GetNetworkId", "S.GetNetworkId(hNetwork) -> (pGuid, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNetworkId_r, (py_data_pack_fn)pack_py_clusapi_GetNetworkId_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNetworkId_args_out, 86, &ndr_table_clusapi },
+	{ "SetNetworkPriorityOrder", "S.SetNetworkPriorityOrder(NetworkIdList) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetNetworkPriorityOrder_r, (py_data_pack_fn)pack_py_clusapi_SetNetworkPriorityOrder_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetNetworkPriorityOrder_args_out, 87, &ndr_table_clusapi },
+	{ "NodeNetworkControl", "S.NodeNetworkControl(hNetwork, hNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeNetworkControl_r, (py_data_pack_fn)pack_py_clusapi_NodeNetworkControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeNetworkControl_args_out, 88, &ndr_table_clusapi },
+	{ "NetworkControl", "S.NetworkControl(hNetwork, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NetworkControl_r, (py_data_pack_fn)pack_py_clusapi_NetworkControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NetworkControl_args_out, 89, &ndr_table_clusapi },
+	{ "AddNotifyNetwork", "S.AddNotifyNetwork(hNotify, hNetwork, dwFilter, dwNotifyKey) -> (dwStateSequence, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyNetwork_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyNetwork_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyNetwork_args_out, 90, &ndr_table_clusapi },
+	{ "ReAddNotifyNetwork", "S.ReAddNotifyNetwork(hNotify, hNetwork, dwFilter, dwNotifyKey, StateSequence) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ReAddNotifyNetwork_r, (py_data_pack_fn)pack_py_clusapi_ReAddNotifyNetwork_args_in, (py_data_unpack_fn)unpack_py_clusapi_ReAddNotifyNetwork_args_out, 91, &ndr_table_clusapi },
+	{ "OpenNetInterface", "S.OpenNetInterface(lpszNetInterfaceName) -> (Status, rpc_status, hNetInterface)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenNetInterface_r, (py_data_pack_fn)pack_py_clusapi_OpenNetInterface_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenNetInterface_args_out, 92, &ndr_table_clusapi },
+	{ "CloseNetInterface", "S.CloseNetInterface(NetInterface) -> NetInterface", (py_dcerpc_call_fn)dcerpc_clusapi_CloseNetInterface_r, (py_data_pack_fn)pack_py_clusapi_CloseNetInterface_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseNetInterface_args_out, 93, &ndr_table_clusapi },
+	{ "GetNetInterfaceState", "S.GetNetInterfaceState(hNetInterface) -> (State, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNetInterfaceState_r, (py_data_pack_fn)pack_py_clusapi_GetNetInterfaceState_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNetInterfaceState_args_out, 94, &ndr_table_clusapi },
+	{ "GetNetInterface", "S.GetNetInterface(lpszNodeName, lpszNetworkName) -> (lppszInterfaceName, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNetInterface_r, (py_data_pack_fn)pack_py_clusapi_GetNetInterface_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNetInterface_args_out, 95, &ndr_table_clusapi },
+	{ "GetNetInterfaceId", "S.GetNetInterfaceId(hNetInterface) -> (pGuid, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNetInterfaceId_r, (py_data_pack_fn)pack_py_clusapi_GetNetInterfaceId_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNetInterfaceId_args_out, 96, &ndr_table_clusapi },
+	{ "NodeNetInterfaceControl", "S.NodeNetInterfaceControl(hNetInterface, hNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeNetInterfaceControl_r, (py_data_pack_fn)pack_py_clusapi_NodeNetInterfaceControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeNetInterfaceControl_args_out, 97, &ndr_table_clusapi },
+	{ "NetInterfaceControl", "S.NetInterfaceControl(hNetInterface, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NetInterfaceControl_r, (py_data_pack_fn)pack_py_clusapi_NetInterfaceControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NetInterfaceControl_args_out, 98, &ndr_table_clusapi },
+	{ "AddNotifyNetInterface", "S.AddNotifyNetInterface(hNotify, hNetInterface, dwFilter, dwNotifyKey) -> (dwStateSequence, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyNetInterface_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyNetInterface_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyNetInterface_args_out, 99, &ndr_table_clusapi },
+	{ "ReAddNotifyNetInterface", "S.ReAddNotifyNetInterface(hNotify, hNetInterface, dwFilter, dwNotifyKey, StateSequence) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ReAddNotifyNetInterface_r, (py_data_pack_fn)pack_py_clusapi_ReAddNotifyNetInterface_args_in, (py_data_unpack_fn)unpack_py_clusapi_ReAddNotifyNetInterface_args_out, 100, &ndr_table_clusapi },
+	{ "CreateNodeEnum", "S.CreateNodeEnum(hNode, dwType) -> (ReturnEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateNodeEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateNodeEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateNodeEnum_args_out, 101, &ndr_table_clusapi },
+	{ "GetClusterVersion2", "S.GetClusterVersion2() -> (lpwMajorVersion, lpwMinorVersion, lpwBuildNumber, lpszVendorId, lpszCSDVersion, ppClusterOpVerInfo, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetClusterVersion2_r, (py_data_pack_fn)pack_py_clusapi_GetClusterVersion2_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetClusterVersion2_args_out, 102, &ndr_table_clusapi },
+	{ "CreateResTypeEnum", "S.CreateResTypeEnum(lpszTypeName, dwType) -> (ReturnEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateResTypeEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateResTypeEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateResTypeEnum_args_out, 103, &ndr_table_clusapi },
+	{ "BackupClusterDatabase", "S.BackupClusterDatabase(lpszPathName) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_BackupClusterDatabase_r, (py_data_pack_fn)pack_py_clusapi_BackupClusterDatabase_args_in, (py_data_unpack_fn)unpack_py_clusapi_BackupClusterDatabase_args_out, 104, &ndr_table_clusapi },
+	{ "NodeClusterControl", "S.NodeClusterControl(hCluster, hHostNode, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_NodeClusterControl_r, (py_data_pack_fn)pack_py_clusapi_NodeClusterControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_NodeClusterControl_args_out, 105, &ndr_table_clusapi },
+	{ "ClusterControl", "S.ClusterControl(hCluster, dwControlCode, lpInBuffer, nOutBufferSize) -> (lpOutBuffer, lpcbRequired, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_ClusterControl_r, (py_data_pack_fn)pack_py_clusapi_ClusterControl_args_in, (py_data_unpack_fn)unpack_py_clusapi_ClusterControl_args_out, 106, &ndr_table_clusapi },
+	{ "UnblockGetNotifyCall", "S.UnblockGetNotifyCall(hNotify) -> None", (py_dcerpc_call_fn)dcerpc_clusapi_UnblockGetNotifyCall_r, (py_data_pack_fn)pack_py_clusapi_UnblockGetNotifyCall_args_in, (py_data_unpack_fn)unpack_py_clusapi_UnblockGetNotifyCall_args_out, 107, &ndr_table_clusapi },
+	{ "SetServiceAccountPassword", "S.SetServiceAccountPassword(lpszNewPassword, dwFlags, ReturnStatusBufferSize) -> (ReturnStatusBufferPtr, ExpectedBufferSize)", (py_dcerpc_call_fn)dcerpc_clusapi_SetServiceAccountPassword_r, (py_data_pack_fn)pack_py_clusapi_SetServiceAccountPassword_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetServiceAccountPassword_args_out, 108, &ndr_table_clusapi },
+	{ "SetResourceDependencyExpression", "S.SetResourceDependencyExpression(hResource, lpszDependencyExpression) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_SetResourceDependencyExpression_r, (py_data_pack_fn)pack_py_clusapi_SetResourceDependencyExpression_args_in, (py_data_unpack_fn)unpack_py_clusapi_SetResourceDependencyExpression_args_out, 109, &ndr_table_clusapi },
+	{ "GetResourceDependencyExpression", "S.GetResourceDependencyExpression(hResource) -> (lpszDependencyExpression, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetResourceDependencyExpression_r, (py_data_pack_fn)pack_py_clusapi_GetResourceDependencyExpression_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetResourceDependencyExpression_args_out, 110, &ndr_table_clusapi },
+	{ "Opnum111NotUsedOnWire", "S.Opnum111NotUsedOnWire() -> None", (py_dcerpc_call_fn)dcerpc_Opnum111NotUsedOnWire_r, (py_data_pack_fn)pack_py_Opnum111NotUsedOnWire_args_in, (py_data_unpack_fn)unpack_py_Opnum111NotUsedOnWire_args_out, 111, &ndr_table_clusapi },
+	{ "GetResourceNetworkName", "S.GetResourceNetworkName(hResource) -> (lpszName, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_GetResourceNetworkName_r, (py_data_pack_fn)pack_py_clusapi_GetResourceNetworkName_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetResourceNetworkName_args_out, 112, &ndr_table_clusapi },
+	{ "ExecuteBatch", "S.ExecuteBatch(hKey, lpData) -> (pdwFailedCommand, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_ExecuteBatch_r, (py_data_pack_fn)pack_py_clusapi_ExecuteBatch_args_in, (py_data_unpack_fn)unpack_py_clusapi_ExecuteBatch_args_out, 113, &ndr_table_clusapi },
+	{ "CreateBatchPort", "S.CreateBatchPort(hKey) -> (phBatchPort, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateBatchPort_r, (py_data_pack_fn)pack_py_clusapi_CreateBatchPort_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateBatchPort_args_out, 114, &ndr_table_clusapi },
+	{ "GetBatchNotification", "S.GetBatchNotification(hBatchNotify) -> (cbData, lpData)", (py_dcerpc_call_fn)dcerpc_clusapi_GetBatchNotification_r, (py_data_pack_fn)pack_py_clusapi_GetBatchNotification_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetBatchNotification_args_out, 115, &ndr_table_clusapi },
+	{ "CloseBatchPort", "S.CloseBatchPort(phBatchPort) -> phBatchPort", (py_dcerpc_call_fn)dcerpc_clusapi_CloseBatchPort_r, (py_data_pack_fn)pack_py_clusapi_CloseBatchPort_args_in, (py_data_unpack_fn)unpack_py_clusapi_CloseBatchPort_args_out, 116, &ndr_table_clusapi },
+	{ "OpenClusterEx", "S.OpenClusterEx(dwDesiredAccess) -> (lpdwGrantedAccess, Status, hCluster)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenClusterEx_r, (py_data_pack_fn)pack_py_clusapi_OpenClusterEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenClusterEx_args_out, 117, &ndr_table_clusapi },
+	{ "OpenNodeEx", "S.OpenNodeEx(lpszNodeName, dwDesiredAccess) -> (lpdwGrantedAccess, Status, rpc_status, hNode)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenNodeEx_r, (py_data_pack_fn)pack_py_clusapi_OpenNodeEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenNodeEx_args_out, 118, &ndr_table_clusapi },
+	{ "OpenGroupEx", "S.OpenGroupEx(lpszGroupName, dwDesiredAccess) -> (lpdwGrantedAccess, Status, rpc_status, hGroup)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenGroupEx_r, (py_data_pack_fn)pack_py_clusapi_OpenGroupEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenGroupEx_args_out, 119, &ndr_table_clusapi },
+	{ "OpenResourceEx", "S.OpenResourceEx(lpszResourceName, dwDesiredAccess) -> (lpdwGrantedAccess, Status, rpc_status, hResource)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenResourceEx_r, (py_data_pack_fn)pack_py_clusapi_OpenResourceEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenResourceEx_args_out, 120, &ndr_table_clusapi },
+	{ "OpenNetworkEx", "S.OpenNetworkEx(lpszNetworkName, dwDesiredAccess) -> (lpdwGrantedAccess, Status, rpc_status, hNetwork)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenNetworkEx_r, (py_data_pack_fn)pack_py_clusapi_OpenNetworkEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenNetworkEx_args_out, 121, &ndr_table_clusapi },
+	{ "OpenNetInterfaceEx", "S.OpenNetInterfaceEx(lpszNetInterfaceName, dwDesiredAccess) -> (lpdwGrantedAccess, Status, rpc_status, hNetInterface)", (py_dcerpc_call_fn)dcerpc_clusapi_OpenNetInterfaceEx_r, (py_data_pack_fn)pack_py_clusapi_OpenNetInterfaceEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OpenNetInterfaceEx_args_out, 122, &ndr_table_clusapi },
+	{ "ChangeCsvState", "S.ChangeCsvState(hResource, dwState) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ChangeCsvState_r, (py_data_pack_fn)pack_py_clusapi_ChangeCsvState_args_in, (py_data_unpack_fn)unpack_py_clusapi_ChangeCsvState_args_out, 123, &ndr_table_clusapi },
+	{ "CreateNodeEnumEx", "S.CreateNodeEnumEx(hNode, dwType, dwOptions) -> (ReturnIdEnum, ReturnNameEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateNodeEnumEx_r, (py_data_pack_fn)pack_py_clusapi_CreateNodeEnumEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateNodeEnumEx_args_out, 124, &ndr_table_clusapi },
+	{ "CreateEnumEx", "S.CreateEnumEx(hCluster, dwType, dwOptions) -> (ReturnIdEnum, ReturnNameEnum, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateEnumEx_r, (py_data_pack_fn)pack_py_clusapi_CreateEnumEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateEnumEx_args_out, 125, &ndr_table_clusapi },
+	{ "PauseNodeEx", "S.PauseNodeEx(hNode, bDrainNode, dwPauseFlags) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_PauseNodeEx_r, (py_data_pack_fn)pack_py_clusapi_PauseNodeEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_PauseNodeEx_args_out, 126, &ndr_table_clusapi },
+	{ "PauseNodeWithDrainTarget", "S.PauseNodeWithDrainTarget(hNode, dwPauseFlags, hNodeDrainTarget) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_PauseNodeWithDrainTarget_r, (py_data_pack_fn)pack_py_clusapi_PauseNodeWithDrainTarget_args_in, (py_data_unpack_fn)unpack_py_clusapi_PauseNodeWithDrainTarget_args_out, 127, &ndr_table_clusapi },
+	{ "ResumeNodeEx", "S.ResumeNodeEx(hNode, dwResumeFailbackType, dwResumeFlagsReserved) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_ResumeNodeEx_r, (py_data_pack_fn)pack_py_clusapi_ResumeNodeEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_ResumeNodeEx_args_out, 128, &ndr_table_clusapi },
+	{ "CreateGroupEx", "S.CreateGroupEx(lpszGroupName, pGroupInfo) -> (Status, rpc_status, hGroup)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateGroupEx_r, (py_data_pack_fn)pack_py_clusapi_CreateGroupEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateGroupEx_args_out, 129, &ndr_table_clusapi },
+	{ "OnlineGroupEx", "S.OnlineGroupEx(hGroup, dwOnlineFlags, lpInBuffer) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OnlineGroupEx_r, (py_data_pack_fn)pack_py_clusapi_OnlineGroupEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OnlineGroupEx_args_out, 130, &ndr_table_clusapi },
+	{ "OfflineGroupEx", "S.OfflineGroupEx(hGroup, dwOfflineFlags, lpInBuffer) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OfflineGroupEx_r, (py_data_pack_fn)pack_py_clusapi_OfflineGroupEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OfflineGroupEx_args_out, 131, &ndr_table_clusapi },
+	{ "MoveGroupEx", "S.MoveGroupEx(hGroup, dwMoveFlags, lpInBuffer) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_MoveGroupEx_r, (py_data_pack_fn)pack_py_clusapi_MoveGroupEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_MoveGroupEx_args_out, 132, &ndr_table_clusapi },
+	{ "MoveGroupToNodeEx", "S.MoveGroupToNodeEx(hGroup, hNode, dwMoveFlags, lpInBuffer) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_MoveGroupToNodeEx_r, (py_data_pack_fn)pack_py_clusapi_MoveGroupToNodeEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_MoveGroupToNodeEx_args_out, 133, &ndr_table_clusapi },
+	{ "CancelClusterGroupOperation", "S.CancelClusterGroupOperation(hGroup, dwCancelFlags) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_CancelClusterGroupOperation_r, (py_data_pack_fn)pack_py_clusapi_CancelClusterGroupOperation_args_in, (py_data_unpack_fn)unpack_py_clusapi_CancelClusterGroupOperation_args_out, 134, &ndr_table_clusapi },
+	{ "OnlineResourceEx", "S.OnlineResourceEx(hResource, dwOnlineFlags, lpInBuffer) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OnlineResourceEx_r, (py_data_pack_fn)pack_py_clusapi_OnlineResourceEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OnlineResourceEx_args_out, 135, &ndr_table_clusapi },
+	{ "OfflineResourceEx", "S.OfflineResourceEx(hResource, dwOfflineFlags, lpInBuffer) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_OfflineResourceEx_r, (py_data_pack_fn)pack_py_clusapi_OfflineResourceEx_args_in, (py_data_unpack_fn)unpack_py_clusapi_OfflineResourceEx_args_out, 136, &ndr_table_clusapi },
+	{ "CreateNotifyV2", "S.CreateNotifyV2() -> (rpc_error, rpc_status, hNotify)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateNotifyV2_r, (py_data_pack_fn)pack_py_clusapi_CreateNotifyV2_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateNotifyV2_args_out, 137, &ndr_table_clusapi },
+	{ "AddNotifyV2", "S.AddNotifyV2(hNotify, hObject, filter, dwNotifyKey, dwVersion, isTargetedAtObject) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_AddNotifyV2_r, (py_data_pack_fn)pack_py_clusapi_AddNotifyV2_args_in, (py_data_unpack_fn)unpack_py_clusapi_AddNotifyV2_args_out, 138, &ndr_table_clusapi },
+	{ "GetNotifyV2", "S.GetNotifyV2(hNotify) -> (Notifications, dwNumNotifications)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNotifyV2_r, (py_data_pack_fn)pack_py_clusapi_GetNotifyV2_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNotifyV2_args_out, 139, &ndr_table_clusapi },
+	{ "QueryAllValues", "S.QueryAllValues(hKey) -> (pcbData, ppData, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_QueryAllValues_r, (py_data_pack_fn)pack_py_clusapi_QueryAllValues_args_in, (py_data_unpack_fn)unpack_py_clusapi_QueryAllValues_args_out, 140, &ndr_table_clusapi },
+	{ "StmFindDisk", "S.StmFindDisk(hCluster, dwFlags, pDiskId, pUniqueId) -> (pDiskId, ppszDeviceName, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_StmFindDisk_r, (py_data_pack_fn)pack_py_clusapi_StmFindDisk_args_in, (py_data_unpack_fn)unpack_py_clusapi_StmFindDisk_args_out, 141, &ndr_table_clusapi },
+	{ "ClusterMrr", "S.ClusterMrr(hCluster, fExcludeSelf, nodeSet, dwTimeout, dwComponent, dwControlCode, pInData) -> (ppInfo, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_ClusterMrr_r, (py_data_pack_fn)pack_py_clusapi_ClusterMrr_args_in, (py_data_unpack_fn)unpack_py_clusapi_ClusterMrr_args_out, 142, &ndr_table_clusapi },
+	{ "CreateGroupEnum", "S.CreateGroupEnum(hCluster, pProperties, pRoProperties) -> (ppResultList, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateGroupEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateGroupEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateGroupEnum_args_out, 143, &ndr_table_clusapi },
+	{ "CreateResourceEnum", "S.CreateResourceEnum(hCluster, pProperties, pRoProperties) -> (ppResultList, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_CreateResourceEnum_r, (py_data_pack_fn)pack_py_clusapi_CreateResourceEnum_args_in, (py_data_unpack_fn)unpack_py_clusapi_CreateResourceEnum_args_out, 144, &ndr_table_clusapi },
+	{ "ExecuteReadBatch", "S.ExecuteReadBatch(hKey, lpInData) -> (cbOutData, lpOutData, rpc_status)", (py_dcerpc_call_fn)dcerpc_clusapi_ExecuteReadBatch_r, (py_data_pack_fn)pack_py_clusapi_ExecuteReadBatch_args_in, (py_data_unpack_fn)unpack_py_clusapi_ExecuteReadBatch_args_out, 145, &ndr_table_clusapi },
+	{ "RestartResource", "S.RestartResource(hResource, dwFlags) -> rpc_status", (py_dcerpc_call_fn)dcerpc_clusapi_RestartResource_r, (py_data_pack_fn)pack_py_clusapi_RestartResource_args_in, (py_data_unpack_fn)unpack_py_clusapi_RestartResource_args_out, 146, &ndr_table_clusapi },
+	{ "GetNotifyAsync", "S.GetNotifyAsync(hNotify) -> (Notifications, dwNumNotifications)", (py_dcerpc_call_fn)dcerpc_clusapi_GetNotifyAsync_r, (py_data_pack_fn)pack_py_clusapi_GetNotifyAsync_args_in, (py_data_unpack_fn)unpack_py_clusapi_GetNotifyAsync_args_out, 147, &ndr_table_clusapi },
+	{ NULL }
+};
+
+static PyObject *interface_clusapi_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_clusapi);
+}
+
+#define PY_DOC_CLUSAPI "Failover Cluster Management API (clusapi)"
+static PyTypeObject clusapi_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.clusapi",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "clusapi(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_CLUSAPI,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_clusapi_new,
+};
+
+static PyObject *syntax_clusapi_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_clusapi.syntax_id);
+}
+
+#define PY_DOC_CLUSAPI_SYNTAX "Failover Cluster Management API (clusapi)"
+static PyTypeObject clusapi_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "clusapi.clusapi",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_CLUSAPI_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_clusapi_new,
+};
+
+static PyMethodDef clusapi_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initclusapi(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_winreg;
+	PyObject *dep_samba_dcerpc_misc;
+	PyObject *dep_talloc;
+	PyObject *dep_samba_dcerpc_base;
+
+	dep_samba_dcerpc_winreg = PyImport_ImportModule("samba.dcerpc.winreg");
+	if (dep_samba_dcerpc_winreg == NULL)
+		return;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	dep_talloc = PyImport_ImportModule("talloc");
+	if (dep_talloc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	BaseObject_Type = (PyTypeObject *)PyObject_GetAttrString(dep_talloc, "BaseObject");
+	if (BaseObject_Type == NULL)
+		return;
+
+	policy_handle_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "policy_handle");
+	if (policy_handle_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	RPC_SECURITY_DESCRIPTOR_Type.tp_base = BaseObject_Type;
+	RPC_SECURITY_DESCRIPTOR_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	RPC_SECURITY_ATTRIBUTES_Type.tp_base = BaseObject_Type;
+	RPC_SECURITY_ATTRIBUTES_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	CLUSTER_OPERATIONAL_VERSION_INFO_Type.tp_base = BaseObject_Type;
+	CLUSTER_OPERATIONAL_VERSION_INFO_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	IDL_CLUSTER_SET_PASSWORD_STATUS_Type.tp_base = BaseObject_Type;
+	IDL_CLUSTER_SET_PASSWORD_STATUS_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	CLUSTER_CREATE_GROUP_INFO_RPC_Type.tp_base = BaseObject_Type;
+	CLUSTER_CREATE_GROUP_INFO_RPC_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	ENUM_ENTRY_Type.tp_base = BaseObject_Type;
+	ENUM_ENTRY_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	ENUM_LIST_Type.tp_base = BaseObject_Type;
+	ENUM_LIST_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	GROUP_ENUM_ENTRY_Type.tp_base = BaseObject_Type;
+	GROUP_ENUM_ENTRY_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	RESOURCE_ENUM_ENTRY_Type.tp_base = BaseObject_Type;
+	RESOURCE_ENUM_ENTRY_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	GROUP_ENUM_LIST_Type.tp_base = BaseObject_Type;
+	GROUP_ENUM_LIST_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	RESOURCE_ENUM_LIST_Type.tp_base = BaseObject_Type;
+	RESOURCE_ENUM_LIST_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	clusapi_propertyValues_Type.tp_base = BaseObject_Type;
+	clusapi_propertyValues_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	clusapi_propertyValue_Type.tp_base = BaseObject_Type;
+	clusapi_propertyValue_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	clusapi_PROPERTY_LIST_Type.tp_base = BaseObject_Type;
+	clusapi_PROPERTY_LIST_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	NOTIFY_FILTER_AND_TYPE_RPC_Type.tp_base = BaseObject_Type;
+	NOTIFY_FILTER_AND_TYPE_RPC_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	NOTIFICATION_DATA_RPC_Type.tp_base = BaseObject_Type;
+	NOTIFICATION_DATA_RPC_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	NOTIFICATION_RPC_Type.tp_base = BaseObject_Type;
+	NOTIFICATION_RPC_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	CLUSTER_DISKID_Type.tp_base = BaseObject_Type;
+	CLUSTER_DISKID_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	CLUSTER_MRR_NODE_RESPONSE_Type.tp_base = BaseObject_Type;
+	CLUSTER_MRR_NODE_RESPONSE_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	CLUSTER_MRR_RESPONSE_Type.tp_base = BaseObject_Type;
+	CLUSTER_MRR_RESPONSE_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	NOTIFICATION_DATA_ASYNC_RPC_Type.tp_base = BaseObject_Type;
+	NOTIFICATION_DATA_ASYNC_RPC_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	clusapi_InterfaceType.tp_base = ClientConnection_Type;
+
+	clusapi_SyntaxType.tp_base = ndr_syntax_id_Type;
+	clusapi_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&RPC_SECURITY_DESCRIPTOR_Type) < 0)
+		return;
+	if (PyType_Ready(&RPC_SECURITY_ATTRIBUTES_Type) < 0)
+		return;
+	if (PyType_Ready(&CLUSTER_OPERATIONAL_VERSION_INFO_Type) < 0)
+		return;
+	if (PyType_Ready(&IDL_CLUSTER_SET_PASSWORD_STATUS_Type) < 0)
+		return;
+	if (PyType_Ready(&CLUSTER_CREATE_GROUP_INFO_RPC_Type) < 0)
+		return;
+	if (PyType_Ready(&ENUM_ENTRY_Type) < 0)
+		return;
+	if (PyType_Ready(&ENUM_LIST_Type) < 0)
+		return;
+	if (PyType_Ready(&GROUP_ENUM_ENTRY_Type) < 0)
+		return;
+	if (PyType_Ready(&RESOURCE_ENUM_ENTRY_Type) < 0)
+		return;
+	if (PyType_Ready(&GROUP_ENUM_LIST_Type) < 0)
+		return;
+	if (PyType_Ready(&RESOURCE_ENUM_LIST_Type) < 0)
+		return;
+	if (PyType_Ready(&clusapi_propertyValues_Type) < 0)
+		return;
+	if (PyType_Ready(&clusapi_propertyValue_Type) < 0)
+		return;
+	if (PyType_Ready(&clusapi_PROPERTY_LIST_Type) < 0)
+		return;
+	if (PyType_Ready(&NOTIFY_FILTER_AND_TYPE_RPC_Type) < 0)
+		return;
+	if (PyType_Ready(&NOTIFICATION_DATA_RPC_Type) < 0)
+		return;
+	if (PyType_Ready(&NOTIFICATION_RPC_Type) < 0)
+		return;
+	if (PyType_Ready(&CLUSTER_DISKID_Type) < 0)
+		return;
+	if (PyType_Ready(&CLUSTER_MRR_NODE_RESPONSE_Type) < 0)
+		return;
+	if (PyType_Ready(&CLUSTER_MRR_RESPONSE_Type) < 0)
+		return;
+	if (PyType_Ready(&NOTIFICATION_DATA_ASYNC_RPC_Type) < 0)
+		return;
+	if (PyType_Ready(&clusapi_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&clusapi_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&clusapi_InterfaceType, py_ndr_clusapi_methods))
+		return;
+
+#ifdef PY_RPC_SECURITY_DESCRIPTOR_PATCH
+	PY_RPC_SECURITY_DESCRIPTOR_PATCH(&RPC_SECURITY_DESCRIPTOR_Type);
+#endif
+#ifdef PY_RPC_SECURITY_ATTRIBUTES_PATCH
+	PY_RPC_SECURITY_ATTRIBUTES_PATCH(&RPC_SECURITY_ATTRIBUTES_Type);
+#endif
+#ifdef PY_CLUSTER_OPERATIONAL_VERSION_INFO_PATCH
+	PY_CLUSTER_OPERATIONAL_VERSION_INFO_PATCH(&CLUSTER_OPERATIONAL_VERSION_INFO_Type);
+#endif
+#ifdef PY_IDL_CLUSTER_SET_PASSWORD_STATUS_PATCH
+	PY_IDL_CLUSTER_SET_PASSWORD_STATUS_PATCH(&IDL_CLUSTER_SET_PASSWORD_STATUS_Type);
+#endif
+#ifdef PY_CLUSTER_CREATE_GROUP_INFO_RPC_PATCH
+	PY_CLUSTER_CREATE_GROUP_INFO_RPC_PATCH(&CLUSTER_CREATE_GROUP_INFO_RPC_Type);
+#endif
+#ifdef PY_ENUM_ENTRY_PATCH
+	PY_ENUM_ENTRY_PATCH(&ENUM_ENTRY_Type);
+#endif
+#ifdef PY_ENUM_LIST_PATCH
+	PY_ENUM_LIST_PATCH(&ENUM_LIST_Type);
+#endif
+#ifdef PY_GROUP_ENUM_ENTRY_PATCH
+	PY_GROUP_ENUM_ENTRY_PATCH(&GROUP_ENUM_ENTRY_Type);
+#endif
+#ifdef PY_RESOURCE_ENUM_ENTRY_PATCH
+	PY_RESOURCE_ENUM_ENTRY_PATCH(&RESOURCE_ENUM_ENTRY_Type);
+#endif
+#ifdef PY_GROUP_ENUM_LIST_PATCH
+	PY_GROUP_ENUM_LIST_PATCH(&GROUP_ENUM_LIST_Type);
+#endif
+#ifdef PY_RESOURCE_ENUM_LIST_PATCH
+	PY_RESOURCE_ENUM_LIST_PATCH(&RESOURCE_ENUM_LIST_Type);
+#endif
+#ifdef PY_PROPERTYVALUES_PATCH
+	PY_PROPERTYVALUES_PATCH(&clusapi_propertyValues_Type);
+#endif
+#ifdef PY_PROPERTYVALUE_PATCH
+	PY_PROPERTYVALUE_PATCH(&clusapi_propertyValue_Type);
+#endif
+#ifdef PY_PROPERTY_LIST_PATCH
+	PY_PROPERTY_LIST_PATCH(&clusapi_PROPERTY_LIST_Type);
+#endif
+#ifdef PY_NOTIFY_FILTER_AND_TYPE_RPC_PATCH
+	PY_NOTIFY_FILTER_AND_TYPE_RPC_PATCH(&NOTIFY_FILTER_AND_TYPE_RPC_Type);
+#endif
+#ifdef PY_NOTIFICATION_DATA_RPC_PATCH
+	PY_NOTIFICATION_DATA_RPC_PATCH(&NOTIFICATION_DATA_RPC_Type);
+#endif
+#ifdef PY_NOTIFICATION_RPC_PATCH
+	PY_NOTIFICATION_RPC_PATCH(&NOTIFICATION_RPC_Type);
+#endif
+#ifdef PY_CLUSTER_DISKID_PATCH
+	PY_CLUSTER_DISKID_PATCH(&CLUSTER_DISKID_Type);
+#endif
+#ifdef PY_CLUSTER_MRR_NODE_RESPONSE_PATCH
+	PY_CLUSTER_MRR_NODE_RESPONSE_PATCH(&CLUSTER_MRR_NODE_RESPONSE_Type);
+#endif
+#ifdef PY_CLUSTER_MRR_RESPONSE_PATCH
+	PY_CLUSTER_MRR_RESPONSE_PATCH(&CLUSTER_MRR_RESPONSE_Type);
+#endif
+#ifdef PY_NOTIFICATION_DATA_ASYNC_RPC_PATCH
+	PY_NOTIFICATION_DATA_ASYNC_RPC_PATCH(&NOTIFICATION_DATA_ASYNC_RPC_Type);
+#endif
+#ifdef PY_CLUSAPI_PATCH
+	PY_CLUSAPI_PATCH(&clusapi_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&clusapi_SyntaxType);
+#endif
+
+	m = Py_InitModule3("clusapi", clusapi_methods, "clusapi DCE/RPC");
+	if (m == NULL)
+		return;
+
+	PyModule_AddObject(m, "IDL_CLUSTER_SET_PASSWORD_IGNORE_DOWN_NODES", PyInt_FromLong((uint16_t)IDL_CLUSTER_SET_PASSWORD_IGNORE_DOWN_NODES));
+	PyModule_AddObject(m, "CLUSTER_ENUM_NODE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_NODE));
+	PyModule_AddObject(m, "CLUSTER_ENUM_RESTYPE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_RESTYPE));
+	PyModule_AddObject(m, "CLUSTER_ENUM_RESOURCE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_RESOURCE));
+	PyModule_AddObject(m, "CLUSTER_ENUM_GROUP", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_GROUP));
+	PyModule_AddObject(m, "CLUSTER_ENUM_NETWORK", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_NETWORK));
+	PyModule_AddObject(m, "CLUSTER_ENUM_NETINTERFACE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_NETINTERFACE));
+	PyModule_AddObject(m, "CLUSTER_ENUM_INTERNAL_NETWORK", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_INTERNAL_NETWORK));
+	PyModule_AddObject(m, "CLUSTER_ENUM_SHARED_VOLUME_RESOURCE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_ENUM_SHARED_VOLUME_RESOURCE));
+	PyModule_AddObject(m, "CLUSTER_RESOURCE_DEFAULT_MONITOR", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_RESOURCE_DEFAULT_MONITOR));
+	PyModule_AddObject(m, "CLUSTER_RESOURCE_SEPARATE_MONITOR", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSTER_RESOURCE_SEPARATE_MONITOR));
+	PyModule_AddObject(m, "ClusterResourceInitializing", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceInitializing));
+	PyModule_AddObject(m, "ClusterResourceOnline", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceOnline));
+	PyModule_AddObject(m, "ClusterResourceOffline", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceOffline));
+	PyModule_AddObject(m, "ClusterResourceFailed", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceFailed));
+	PyModule_AddObject(m, "ClusterResourceOnlinePending", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceOnlinePending));
+	PyModule_AddObject(m, "ClusterResourceOfflinePending", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceOfflinePending));
+	PyModule_AddObject(m, "ClusterResourceStateUnknown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterResourceStateUnknown));
+	PyModule_AddObject(m, "ClusterGroupOnline", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterGroupOnline));
+	PyModule_AddObject(m, "ClusterGroupOffline", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterGroupOffline));
+	PyModule_AddObject(m, "ClusterGroupFailed", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterGroupFailed));
+	PyModule_AddObject(m, "ClusterGroupPartialOnline", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterGroupPartialOnline));
+	PyModule_AddObject(m, "ClusterGroupPending", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterGroupPending));
+	PyModule_AddObject(m, "ClusterGroupStateUnknown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterGroupStateUnknown));
+	PyModule_AddObject(m, "ClusterNodeUp", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNodeUp));
+	PyModule_AddObject(m, "ClusterNodeDown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNodeDown));
+	PyModule_AddObject(m, "ClusterNodePaused", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNodePaused));
+	PyModule_AddObject(m, "ClusterNodeJoining", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNodeJoining));
+	PyModule_AddObject(m, "ClusterNodeStateUnknown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNodeStateUnknown));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_UNKNOWN", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_UNKNOWN));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_CHARACTERISTICS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_CHARACTERISTICS));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_FLAGS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_FLAGS));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_NAME", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_NAME));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_ID", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_ID));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_ENUM_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_ENUM_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_RO_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_RO_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_SET_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_SET_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_VALIDATE_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_VALIDATE_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_COMMON_PROPERTY_FMTS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_COMMON_PROPERTY_FMTS));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_ENUM_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_ENUM_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_RO_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_RO_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_GET_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_GET_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_SET_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_SET_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_GROUP_VALIDATE_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_GROUP_VALIDATE_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_UNKNOWN", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_UNKNOWN));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_CHARACTERISTICS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_CHARACTERISTICS));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_FLAGS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_FLAGS));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_NAME", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_NAME));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_ID", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_ID));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_CLUSTER_SERVICE_ACCOUNT_NAME", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_CLUSTER_SERVICE_ACCOUNT_NAME));
+	PyModule_AddObject(m, "CLUSCTL_NODE_ENUM_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_ENUM_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_RO_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_RO_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_SET_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_SET_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_VALIDATE_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_VALIDATE_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_ENUM_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_ENUM_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_RO_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_RO_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_GET_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_GET_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_SET_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_SET_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_NODE_VALIDATE_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_NODE_VALIDATE_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "ClusterNetworkUnavailable", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetworkUnavailable));
+	PyModule_AddObject(m, "ClusterNetworkDown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetworkDown));
+	PyModule_AddObject(m, "ClusterNetworkPartitioned", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetworkPartitioned));
+	PyModule_AddObject(m, "ClusterNetworkUp", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetworkUp));
+	PyModule_AddObject(m, "ClusterNetworkStateUnknown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetworkStateUnknown));
+	PyModule_AddObject(m, "ClusterNetInterfaceFailed", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetInterfaceFailed));
+	PyModule_AddObject(m, "ClusterNetInterfaceUnreachable", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetInterfaceUnreachable));
+	PyModule_AddObject(m, "ClusterNetInterfaceUnavailable", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetInterfaceUnavailable));
+	PyModule_AddObject(m, "ClusterNetInterfaceUp", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetInterfaceUp));
+	PyModule_AddObject(m, "ClusterNetInterfaceStateUnknown", ndr_PyLong_FromUnsignedLongLong((uint32_t)ClusterNetInterfaceStateUnknown));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_UNKNOWN", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_UNKNOWN));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_FQDN", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_FQDN));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_CHECK_VOTER_EVICT", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_CHECK_VOTER_EVICT));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_CHECK_VOTER_DOWN", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_CHECK_VOTER_DOWN));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_SHUTDOWN", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_SHUTDOWN));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_ENUM_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_ENUM_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_RO_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_RO_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_SET_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_SET_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_VALIDATE_COMMON_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_VALIDATE_COMMON_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_COMMON_PROPERTY_FMTS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_COMMON_PROPERTY_FMTS));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_ENUM_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_ENUM_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_RO_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_RO_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_SET_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_SET_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_VALIDATE_PRIVATE_PROPERTIES", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_VALIDATE_PRIVATE_PROPERTIES));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_GET_SHARED_VOLUME_ID", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_GET_SHARED_VOLUME_ID));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_UPGRADE_CLUSTER_VERSION", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_UPGRADE_CLUSTER_VERSION));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_CLEAR_UPGRADE_IN_PROGRESS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_CLEAR_UPGRADE_IN_PROGRESS));
+	PyModule_AddObject(m, "CLUSCTL_CLUSTER_IS_READY_FOR_UPGRADE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSCTL_CLUSTER_IS_READY_FOR_UPGRADE));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_ENDMARK", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_ENDMARK));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_NAME", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_NAME));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_RESCLASS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_RESCLASS));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_SZ", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_SZ));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_EXPAND_SZ", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_EXPAND_SZ));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_DWORD", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_DWORD));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_BINARY", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_BINARY));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_MULTI_SZ", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_MULTI_SZ));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_LONG", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_LONG));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_EXPANDED_SZ", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_EXPANDED_SZ));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_SECURITY_DESCRIPTOR", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_SECURITY_DESCRIPTOR));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_LARGE_INTEGER", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_LARGE_INTEGER));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_ULARGE_INTEGER", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_ULARGE_INTEGER));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_WORD", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_WORD));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_LIST_VALUE_FILETIME", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_LIST_VALUE_FILETIME));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_DISK_SIGNATURE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_DISK_SIGNATURE));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_SCSI_ADDRESS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_SCSI_ADDRESS));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_DISK_NUMBER", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_DISK_NUMBER));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_PARTITION_INFO", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_PARTITION_INFO));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_DISK_SERIALNUMBER", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_DISK_SERIALNUMBER));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_DISK_GUID", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_DISK_GUID));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_DISK_SIZE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_DISK_SIZE));
+	PyModule_AddObject(m, "CLUSPROP_SYNTAX_PARTITION_INFO_EX", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSPROP_SYNTAX_PARTITION_INFO_EX));
+	PyModule_AddObject(m, "CLUSAPI_READ_ACCESS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_READ_ACCESS));
+	PyModule_AddObject(m, "CLUSAPI_CHANGE_ACCESS", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_CHANGE_ACCESS));
+	PyModule_AddObject(m, "CLUSAPI_GENERIC_READ", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_GENERIC_READ));
+	PyModule_AddObject(m, "CLUSAPI_GENERIC_WRITE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_GENERIC_WRITE));
+	PyModule_AddObject(m, "CLUSAPI_GENERIC_EXECUTE", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_GENERIC_EXECUTE));
+	PyModule_AddObject(m, "CLUSAPI_GENERIC_ALL", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_GENERIC_ALL));
+	PyModule_AddObject(m, "CLUSAPI_MAXIMUM_ALLOWED", ndr_PyLong_FromUnsignedLongLong((uint32_t)CLUSAPI_MAXIMUM_ALLOWED));
+	PyModule_AddObject(m, "DiskIdSignature", PyInt_FromLong((uint16_t)DiskIdSignature));
+	PyModule_AddObject(m, "DiskIdGuid", PyInt_FromLong((uint16_t)DiskIdGuid));
+	PyModule_AddObject(m, "DiskIdUnKnown", PyInt_FromLong((uint16_t)DiskIdUnKnown));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_ENDMARK", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_ENDMARK));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_LIST_VALUE", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_LIST_VALUE));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_RESCLASS", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_RESCLASS));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_NAME", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_NAME));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_SIGNATURE", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_SIGNATURE));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_SCSIADDRESS", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_SCSIADDRESS));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_DISK_NUMBER", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_DISK_NUMBER));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_PARTITION_INFO", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_PARTITION_INFO));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_DISK_SERIALNUMBER", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_DISK_SERIALNUMBER));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_DISK_GUID", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_DISK_GUID));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_DISK_SIZE", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_DISK_SIZE));
+	PyModule_AddObject(m, "CLUSPROP_TYPE_PARTITION_INFO_EX", PyInt_FromLong((uint16_t)CLUSPROP_TYPE_PARTITION_INFO_EX));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_UNKNOWN", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_UNKNOWN));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_BINARY", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_BINARY));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_DWORD", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_DWORD));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_SZ", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_SZ));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_EXPAND_SZ", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_EXPAND_SZ));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_MULTI_SZ", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_MULTI_SZ));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_ULARGE_INTEGER", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_ULARGE_INTEGER));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_LONG", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_LONG));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_EXPANDED_SZ", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_EXPANDED_SZ));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_SECURITY_DESCRIPTOR", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_SECURITY_DESCRIPTOR));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_LARGE_INTEGER", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_LARGE_INTEGER));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_WORD", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_WORD));
+	PyModule_AddObject(m, "CLUSPROP_FORMAT_FILETIME", PyInt_FromLong((uint16_t)CLUSPROP_FORMAT_FILETIME));
+	PyModule_AddObject(m, "CLUS_CHAR_UNKNOWN", PyInt_FromLong((uint16_t)CLUS_CHAR_UNKNOWN));
+	PyModule_AddObject(m, "CLUS_CHAR_QUORUM", PyInt_FromLong((uint16_t)CLUS_CHAR_QUORUM));
+	PyModule_AddObject(m, "CLUS_CHAR_DELETE_REQUIRES_ALL_NODES", PyInt_FromLong((uint16_t)CLUS_CHAR_DELETE_REQUIRES_ALL_NODES));
+	PyModule_AddObject(m, "CLUS_CHAR_LOCAL_QUORUM", PyInt_FromLong((uint16_t)CLUS_CHAR_LOCAL_QUORUM));
+	PyModule_AddObject(m, "CLUS_CHAR_BROADCAST_DELETE", PyInt_FromLong((uint16_t)CLUS_CHAR_BROADCAST_DELETE));
+	PyModule_AddObject(m, "CLUS_CHAR_SINGLE_CLUSTER_INSTANCE", PyInt_FromLong((uint16_t)CLUS_CHAR_SINGLE_CLUSTER_INSTANCE));
+	PyModule_AddObject(m, "CLUS_CHAR_SINGLE_GROUP_INSTANCE", PyInt_FromLong((uint16_t)CLUS_CHAR_SINGLE_GROUP_INSTANCE));
+	PyModule_AddObject(m, "CLUS_CHAR_COEXIST_IN_SHARED_VOLUME_GROUP", PyInt_FromLong((uint16_t)CLUS_CHAR_COEXIST_IN_SHARED_VOLUME_GROUP));
+	PyModule_AddObject(m, "CLUS_CHAR_RESERVED1", PyInt_FromLong((uint16_t)CLUS_CHAR_RESERVED1));
+	PyModule_AddObject(m, "CLUS_CHAR_MONITOR_DETACH", PyInt_FromLong((uint16_t)CLUS_CHAR_MONITOR_DETACH));
+	PyModule_AddObject(m, "CLUS_CHAR_RESERVED2", PyInt_FromLong((uint16_t)CLUS_CHAR_RESERVED2));
+	PyModule_AddObject(m, "CLUS_CHAR_RESERVED3", PyInt_FromLong((uint16_t)CLUS_CHAR_RESERVED3));
+	PyModule_AddObject(m, "CLUS_CHAR_RESERVED4", PyInt_FromLong((uint16_t)CLUS_CHAR_RESERVED4));
+	PyModule_AddObject(m, "CLUS_FLAG_CORE", PyInt_FromLong((uint16_t)CLUS_FLAG_CORE));
+	PyModule_AddObject(m, "MaintenanceModeTypeDisableIsAliveCheck", PyInt_FromLong((uint16_t)MaintenanceModeTypeDisableIsAliveCheck));
+	PyModule_AddObject(m, "MaintenanceModeTypeOfflineResource", PyInt_FromLong((uint16_t)MaintenanceModeTypeOfflineResource));
+	PyModule_AddObject(m, "MaintenanceModeTypeUnclusterResource", PyInt_FromLong((uint16_t)MaintenanceModeTypeUnclusterResource));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_DELETED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_DELETED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_ADDED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_ADDED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_NAME", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_NAME));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_ATTRIBUTES", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_ATTRIBUTES));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_VALUE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_VALUE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_SUBTREE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_SUBTREE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_DELETED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_DELETED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_ADDED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_ADDED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_DELETED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_DELETED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_ADDED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_ADDED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_DELETED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_DELETED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_ADDED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_ADDED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_RECONNECT", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_RECONNECT));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_DELETED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_DELETED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_ADDED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_ADDED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_DELETED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_DELETED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_ADDED", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_ADDED));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_QUORUM_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_QUORUM_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_STATE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_STATE));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_PROPERTY", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_PROPERTY));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_HANDLE_CLOSE", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_HANDLE_CLOSE));
+	PyModule_AddObject(m, "CLUSREG_SET_VALUE", PyInt_FromLong((uint16_t)CLUSREG_SET_VALUE));
+	PyModule_AddObject(m, "CLUSREG_CREATE_KEY", PyInt_FromLong((uint16_t)CLUSREG_CREATE_KEY));
+	PyModule_AddObject(m, "CLUSREG_DELETE_KEY", PyInt_FromLong((uint16_t)CLUSREG_DELETE_KEY));
+	PyModule_AddObject(m, "CLUSREG_DELETE_VALUE", PyInt_FromLong((uint16_t)CLUSREG_DELETE_VALUE));
+	PyModule_AddObject(m, "CLUSREG_VALUE_DELETED", PyInt_FromLong((uint16_t)CLUSREG_VALUE_DELETED));
+	PyModule_AddObject(m, "CLUSREG_READ_KEY", PyInt_FromLong((uint16_t)CLUSREG_READ_KEY));
+	PyModule_AddObject(m, "CLUSREG_READ_VALUE", PyInt_FromLong((uint16_t)CLUSREG_READ_VALUE));
+	PyModule_AddObject(m, "CLUSREG_READ_ERROR", PyInt_FromLong((uint16_t)CLUSREG_READ_ERROR));
+	PyModule_AddObject(m, "CLUSTER_QUORUM_MAINTAINED", PyInt_FromLong((uint16_t)CLUSTER_QUORUM_MAINTAINED));
+	PyModule_AddObject(m, "CLUSTER_QUORUM_LOST", PyInt_FromLong((uint16_t)CLUSTER_QUORUM_LOST));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_CLUSTER", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_CLUSTER));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_GROUP", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_GROUP));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_RESOURCE", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_RESOURCE));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_RESOURCE_TYPE", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_RESOURCE_TYPE));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_NETWORK_INTERFACE", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_NETWORK_INTERFACE));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_NETWORK", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_NETWORK));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_NODE", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_NODE));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_REGISTRY", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_REGISTRY));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_QUORUM", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_QUORUM));
+	PyModule_AddObject(m, "CLUSTER_OBJECT_TYPE_SHARED_VOLUME", PyInt_FromLong((uint16_t)CLUSTER_OBJECT_TYPE_SHARED_VOLUME));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_RECONNECT_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_RECONNECT_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_GROUP_ADDED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_GROUP_ADDED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_NETWORK_ADDED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_NETWORK_ADDED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_NODE_ADDED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_NODE_ADDED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_RESOURCE_TYPE_ADDED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_RESOURCE_TYPE_ADDED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_LOST_NOTIFICATIONS_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_LOST_NOTIFICATIONS_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_CLUSTER_RENAME_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_CLUSTER_RENAME_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_DELETED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_DELETED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_OWNER_NODE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_OWNER_NODE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_PREFERRED_OWNERS_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_PREFERRED_OWNERS_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_RESOURCE_ADDED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_RESOURCE_ADDED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_RESOURCE_GAINED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_RESOURCE_GAINED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_RESOURCE_LOST_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_RESOURCE_LOST_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_GROUP_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_GROUP_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_OWNER_GROUP_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_OWNER_GROUP_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_DEPENDENCIES_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_DEPENDENCIES_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_DEPENDENTS_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_DEPENDENTS_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_POSSIBLE_OWNERS_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_POSSIBLE_OWNERS_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_DELETED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_DELETED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_DLL_UPGRADED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_DLL_UPGRADED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_DELETED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_DELETED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_POSSIBLE_OWNERS_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_POSSIBLE_OWNERS_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_RESOURCE_TYPE_DLL_UPGRADED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_RESOURCE_TYPE_DLL_UPGRADED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_DELETED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_DELETED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETINTERFACE_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETINTERFACE_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_DELETED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_DELETED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NETWORK_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NETWORK_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_NETINTERFACE_ADDED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_NETINTERFACE_ADDED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_DELETED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_DELETED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_COMMON_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_COMMON_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_PRIVATE_PROPERTY_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_PRIVATE_PROPERTY_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_GROUP_GAINED_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_GROUP_GAINED_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_GROUP_LOST_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_GROUP_LOST_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_NODE_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_NODE_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_ATTRIBUTES_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_ATTRIBUTES_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_NAME_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_NAME_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_SUBTREE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_SUBTREE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_VALUE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_VALUE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_REGISTRY_HANDLE_CLOSE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_REGISTRY_HANDLE_CLOSE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_QUORUM_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_QUORUM_STATE_V2));
+	PyModule_AddObject(m, "CLUSTER_CHANGE_SHARED_VOLUME_STATE_V2", PyInt_FromLong((uint16_t)CLUSTER_CHANGE_SHARED_VOLUME_STATE_V2));
+	Py_INCREF((PyObject *)(void *)&RPC_SECURITY_DESCRIPTOR_Type);
+	PyModule_AddObject(m, "RPC_SECURITY_DESCRIPTOR", (PyObject *)(void *)&RPC_SECURITY_DESCRIPTOR_Type);
+	Py_INCREF((PyObject *)(void *)&RPC_SECURITY_ATTRIBUTES_Type);
+	PyModule_AddObject(m, "RPC_SECURITY_ATTRIBUTES", (PyObject *)(void *)&RPC_SECURITY_ATTRIBUTES_Type);
+	Py_INCREF((PyObject *)(void *)&CLUSTER_OPERATIONAL_VERSION_INFO_Type);
+	PyModule_AddObject(m, "CLUSTER_OPERATIONAL_VERSION_INFO", (PyObject *)(void *)&CLUSTER_OPERATIONAL_VERSION_INFO_Type);
+	Py_INCREF((PyObject *)(void *)&IDL_CLUSTER_SET_PASSWORD_STATUS_Type);
+	PyModule_AddObject(m, "IDL_CLUSTER_SET_PASSWORD_STATUS", (PyObject *)(void *)&IDL_CLUSTER_SET_PASSWORD_STATUS_Type);
+	Py_INCREF((PyObject *)(void *)&CLUSTER_CREATE_GROUP_INFO_RPC_Type);
+	PyModule_AddObject(m, "CLUSTER_CREATE_GROUP_INFO_RPC", (PyObject *)(void *)&CLUSTER_CREATE_GROUP_INFO_RPC_Type);
+	Py_INCREF((PyObject *)(void *)&ENUM_ENTRY_Type);
+	PyModule_AddObject(m, "ENUM_ENTRY", (PyObject *)(void *)&ENUM_ENTRY_Type);
+	Py_INCREF((PyObject *)(void *)&ENUM_LIST_Type);
+	PyModule_AddObject(m, "ENUM_LIST", (PyObject *)(void *)&ENUM_LIST_Type);
+	Py_INCREF((PyObject *)(void *)&GROUP_ENUM_ENTRY_Type);
+	PyModule_AddObject(m, "GROUP_ENUM_ENTRY", (PyObject *)(void *)&GROUP_ENUM_ENTRY_Type);
+	Py_INCREF((PyObject *)(void *)&RESOURCE_ENUM_ENTRY_Type);
+	PyModule_AddObject(m, "RESOURCE_ENUM_ENTRY", (PyObject *)(void *)&RESOURCE_ENUM_ENTRY_Type);
+	Py_INCREF((PyObject *)(void *)&GROUP_ENUM_LIST_Type);
+	PyModule_AddObject(m, "GROUP_ENUM_LIST", (PyObject *)(void *)&GROUP_ENUM_LIST_Type);
+	Py_INCREF((PyObject *)(void *)&RESOURCE_ENUM_LIST_Type);
+	PyModule_AddObject(m, "RESOURCE_ENUM_LIST", (PyObject *)(void *)&RESOURCE_ENUM_LIST_Type);
+	Py_INCREF((PyObject *)(void *)&clusapi_propertyValues_Type);
+	PyModule_AddObject(m, "propertyValues", (PyObject *)(void *)&clusapi_propertyValues_Type);
+	Py_INCREF((PyObject *)(void *)&clusapi_propertyValue_Type);
+	PyModule_AddObject(m, "propertyValue", (PyObject *)(void *)&clusapi_propertyValue_Type);
+	Py_INCREF((PyObject *)(void *)&clusapi_PROPERTY_LIST_Type);
+	PyModule_AddObject(m, "PROPERTY_LIST", (PyObject *)(void *)&clusapi_PROPERTY_LIST_Type);
+	Py_INCREF((PyObject *)(void *)&NOTIFY_FILTER_AND_TYPE_RPC_Type);
+	PyModule_AddObject(m, "NOTIFY_FILTER_AND_TYPE_RPC", (PyObject *)(void *)&NOTIFY_FILTER_AND_TYPE_RPC_Type);
+	Py_INCREF((PyObject *)(void *)&NOTIFICATION_DATA_RPC_Type);
+	PyModule_AddObject(m, "NOTIFICATION_DATA_RPC", (PyObject *)(void *)&NOTIFICATION_DATA_RPC_Type);
+	Py_INCREF((PyObject *)(void *)&NOTIFICATION_RPC_Type);
+	PyModule_AddObject(m, "NOTIFICATION_RPC", (PyObject *)(void *)&NOTIFICATION_RPC_Type);
+	Py_INCREF((PyObject *)(void *)&CLUSTER_DISKID_Type);
+	PyModule_AddObject(m, "CLUSTER_DISKID", (PyObject *)(void *)&CLUSTER_DISKID_Type);
+	Py_INCREF((PyObject *)(void *)&CLUSTER_MRR_NODE_RESPONSE_Type);
+	PyModule_AddObject(m, "CLUSTER_MRR_NODE_RESPONSE", (PyObject *)(void *)&CLUSTER_MRR_NODE_RESPONSE_Type);
+	Py_INCREF((PyObject *)(void *)&CLUSTER_MRR_RESPONSE_Type);
+	PyModule_AddObject(m, "CLUSTER_MRR_RESPONSE", (PyObject *)(void *)&CLUSTER_MRR_RESPONSE_Type);
+	Py_INCREF((PyObject *)(void *)&NOTIFICATION_DATA_ASYNC_RPC_Type);
+	PyModule_AddObject(m, "NOTIFICATION_DATA_ASYNC_RPC", (PyObject *)(void *)&NOTIFICATION_DATA_ASYNC_RPC_Type);
+	Py_INCREF((PyObject *)(void *)&clusapi_InterfaceType);
+	PyModule_AddObject(m, "clusapi", (PyObject *)(void *)&clusapi_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&clusapi_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&clusapi_SyntaxType);
+#ifdef PY_MOD_CLUSAPI_PATCH
+	PY_MOD_CLUSAPI_PATCH(m);
+#endif
+
+}
@@ -0,0 +1,2175 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_echo.h"
+#include "bin/default/librpc/gen_ndr/ndr_echo_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static PyTypeObject echo_info1_Type;
+static PyTypeObject echo_info2_Type;
+static PyTypeObject echo_info3_Type;
+static PyTypeObject echo_info4_Type;
+static PyTypeObject echo_info5_Type;
+static PyTypeObject echo_info6_Type;
+static PyTypeObject echo_info7_Type;
+PyObject *py_import_echo_Info(TALLOC_CTX *mem_ctx, int level, union echo_Info *in);
+union echo_Info *py_export_echo_Info(TALLOC_CTX *mem_ctx, int level, PyObject *in);
+static PyTypeObject echo_Enum2_Type;
+PyObject *py_import_echo_Enum3(TALLOC_CTX *mem_ctx, int level, union echo_Enum3 *in);
+union echo_Enum3 *py_export_echo_Enum3(TALLOC_CTX *mem_ctx, int level, PyObject *in);
+static PyTypeObject echo_Surrounding_Type;
+static PyTypeObject rpcecho_InterfaceType;
+
+void initecho(void);static PyTypeObject *BaseObject_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static PyObject *py_echo_info1_get_v(PyObject *obj, void *closure)
+{
+	struct echo_info1 *object = (struct echo_info1 *)pytalloc_get_ptr(obj);
+	PyObject *py_v;
+	py_v = PyInt_FromLong((uint16_t)object->v);
+	return py_v;
+}
+
+static int py_echo_info1_set_v(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info1 *object = (struct echo_info1 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_info1_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v"),
+		.get = py_echo_info1_get_v,
+		.set = py_echo_info1_set_v,
+		.doc = discard_const_p(char, "PIDL-generated element v")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info1_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info1, type);
+}
+
+static PyObject *py_echo_info1_ndr_pack(PyObject *py_obj)
+{
+	struct echo_info1 *object = (struct echo_info1 *)pytalloc_get_ptr(py_obj);
+	PyObject *ret = NULL;
+	DATA_BLOB blob;
+	enum ndr_err_code err;
+	TALLOC_CTX *tmp_ctx = talloc_new(pytalloc_get_mem_ctx(py_obj));
+	if (tmp_ctx == NULL) {
+		PyErr_SetNdrError(NDR_ERR_ALLOC);
+		return NULL;
+	}
+	err = ndr_push_struct_blob(&blob, tmp_ctx, object, (ndr_push_flags_fn_t)ndr_push_echo_info1);
+	if (err != NDR_ERR_SUCCESS) {
+		TALLOC_FREE(tmp_ctx);
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	ret = PyString_FromStringAndSize((char *)blob.data, blob.length);
+	TALLOC_FREE(tmp_ctx);
+	return ret;
+}
+
+static PyObject *py_echo_info1_ndr_unpack(PyObject *py_obj, PyObject *args, PyObject *kwargs)
+{
+	struct echo_info1 *object = (struct echo_info1 *)pytalloc_get_ptr(py_obj);
+	DATA_BLOB blob;
+	Py_ssize_t blob_length = 0;
+	enum ndr_err_code err;
+	const char * const kwnames[] = { "data_blob", "allow_remaining", NULL };
+	PyObject *allow_remaining_obj = NULL;
+	bool allow_remaining = false;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s#|O:__ndr_unpack__",
+		discard_const_p(char *, kwnames),
+		&blob.data, &blob_length,
+		&allow_remaining_obj)) {
+		return NULL;
+	}
+	blob.length = blob_length;
+
+	if (allow_remaining_obj && PyObject_IsTrue(allow_remaining_obj)) {
+		allow_remaining = true;
+	}
+
+	if (allow_remaining) {
+		err = ndr_pull_struct_blob(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_echo_info1);
+	} else {
+		err = ndr_pull_struct_blob_all(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_echo_info1);
+	}
+	if (err != NDR_ERR_SUCCESS) {
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_echo_info1_ndr_print(PyObject *py_obj)
+{
+	struct echo_info1 *object = (struct echo_info1 *)pytalloc_get_ptr(py_obj);
+	PyObject *ret;
+	char *retstr;
+
+	retstr = ndr_print_struct_string(pytalloc_get_mem_ctx(py_obj), (ndr_print_fn_t)ndr_print_echo_info1, "echo_info1", object);
+	ret = PyString_FromString(retstr);
+	talloc_free(retstr);
+
+	return ret;
+}
+
+static PyMethodDef py_echo_info1_methods[] = {
+	{ "__ndr_pack__", (PyCFunction)py_echo_info1_ndr_pack, METH_NOARGS, "S.ndr_pack(object) -> blob\nNDR pack" },
+	{ "__ndr_unpack__", (PyCFunction)py_echo_info1_ndr_unpack, METH_VARARGS|METH_KEYWORDS, "S.ndr_unpack(class, blob, allow_remaining=False) -> None\nNDR unpack" },
+	{ "__ndr_print__", (PyCFunction)py_echo_info1_ndr_print, METH_VARARGS, "S.ndr_print(object) -> None\nNDR print" },
+	{ NULL, NULL, 0, NULL }
+};
+
+
+static PyTypeObject echo_info1_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info1",
+	.tp_getset = py_echo_info1_getsetters,
+	.tp_methods = py_echo_info1_methods,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info1_new,
+};
+
+
+static PyObject *py_echo_info2_get_v(PyObject *obj, void *closure)
+{
+	struct echo_info2 *object = (struct echo_info2 *)pytalloc_get_ptr(obj);
+	PyObject *py_v;
+	py_v = PyInt_FromLong((uint16_t)object->v);
+	return py_v;
+}
+
+static int py_echo_info2_set_v(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info2 *object = (struct echo_info2 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_info2_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v"),
+		.get = py_echo_info2_get_v,
+		.set = py_echo_info2_set_v,
+		.doc = discard_const_p(char, "PIDL-generated element v")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info2_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info2, type);
+}
+
+
+static PyTypeObject echo_info2_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info2",
+	.tp_getset = py_echo_info2_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info2_new,
+};
+
+
+static PyObject *py_echo_info3_get_v(PyObject *obj, void *closure)
+{
+	struct echo_info3 *object = (struct echo_info3 *)pytalloc_get_ptr(obj);
+	PyObject *py_v;
+	py_v = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->v);
+	return py_v;
+}
+
+static int py_echo_info3_set_v(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info3 *object = (struct echo_info3 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_info3_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v"),
+		.get = py_echo_info3_get_v,
+		.set = py_echo_info3_set_v,
+		.doc = discard_const_p(char, "PIDL-generated element v")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info3_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info3, type);
+}
+
+
+static PyTypeObject echo_info3_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info3",
+	.tp_getset = py_echo_info3_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info3_new,
+};
+
+
+static PyObject *py_echo_info4_get_v(PyObject *obj, void *closure)
+{
+	struct echo_info4 *object = (struct echo_info4 *)pytalloc_get_ptr(obj);
+	PyObject *py_v;
+	py_v = ndr_PyLong_FromUnsignedLongLong(object->v);
+	return py_v;
+}
+
+static int py_echo_info4_set_v(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info4 *object = (struct echo_info4 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_info4_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v"),
+		.get = py_echo_info4_get_v,
+		.set = py_echo_info4_set_v,
+		.doc = discard_const_p(char, "PIDL-generated element v")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info4_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info4, type);
+}
+
+
+static PyTypeObject echo_info4_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info4",
+	.tp_getset = py_echo_info4_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info4_new,
+};
+
+
+static PyObject *py_echo_info5_get_v1(PyObject *obj, void *closure)
+{
+	struct echo_info5 *object = (struct echo_info5 *)pytalloc_get_ptr(obj);
+	PyObject *py_v1;
+	py_v1 = PyInt_FromLong((uint16_t)object->v1);
+	return py_v1;
+}
+
+static int py_echo_info5_set_v1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info5 *object = (struct echo_info5 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_echo_info5_get_v2(PyObject *obj, void *closure)
+{
+	struct echo_info5 *object = (struct echo_info5 *)pytalloc_get_ptr(obj);
+	PyObject *py_v2;
+	py_v2 = ndr_PyLong_FromUnsignedLongLong(object->v2);
+	return py_v2;
+}
+
+static int py_echo_info5_set_v2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info5 *object = (struct echo_info5 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_info5_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v1"),
+		.get = py_echo_info5_get_v1,
+		.set = py_echo_info5_set_v1,
+		.doc = discard_const_p(char, "PIDL-generated element v1")
+	},
+	{
+		.name = discard_const_p(char, "v2"),
+		.get = py_echo_info5_get_v2,
+		.set = py_echo_info5_set_v2,
+		.doc = discard_const_p(char, "PIDL-generated element v2")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info5_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info5, type);
+}
+
+
+static PyTypeObject echo_info5_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info5",
+	.tp_getset = py_echo_info5_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info5_new,
+};
+
+
+static PyObject *py_echo_info6_get_v1(PyObject *obj, void *closure)
+{
+	struct echo_info6 *object = (struct echo_info6 *)pytalloc_get_ptr(obj);
+	PyObject *py_v1;
+	py_v1 = PyInt_FromLong((uint16_t)object->v1);
+	return py_v1;
+}
+
+static int py_echo_info6_set_v1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info6 *object = (struct echo_info6 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_echo_info6_get_info1(PyObject *obj, void *closure)
+{
+	struct echo_info6 *object = (struct echo_info6 *)pytalloc_get_ptr(obj);
+	PyObject *py_info1;
+	py_info1 = pytalloc_reference_ex(&echo_info1_Type, pytalloc_get_mem_ctx(obj), &object->info1);
+	return py_info1;
+}
+
+static int py_echo_info6_set_info1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info6 *object = (struct echo_info6 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->info1");
+		return -1;
+	}
+	PY_CHECK_TYPE(&echo_info1_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->info1 = *(struct echo_info1 *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyGetSetDef py_echo_info6_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v1"),
+		.get = py_echo_info6_get_v1,
+		.set = py_echo_info6_set_v1,
+		.doc = discard_const_p(char, "PIDL-generated element v1")
+	},
+	{
+		.name = discard_const_p(char, "info1"),
+		.get = py_echo_info6_get_info1,
+		.set = py_echo_info6_set_info1,
+		.doc = discard_const_p(char, "PIDL-generated element info1")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info6_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info6, type);
+}
+
+
+static PyTypeObject echo_info6_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info6",
+	.tp_getset = py_echo_info6_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info6_new,
+};
+
+
+static PyObject *py_echo_info7_get_v1(PyObject *obj, void *closure)
+{
+	struct echo_info7 *object = (struct echo_info7 *)pytalloc_get_ptr(obj);
+	PyObject *py_v1;
+	py_v1 = PyInt_FromLong((uint16_t)object->v1);
+	return py_v1;
+}
+
+static int py_echo_info7_set_v1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info7 *object = (struct echo_info7 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->v1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->v1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->v1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_echo_info7_get_info4(PyObject *obj, void *closure)
+{
+	struct echo_info7 *object = (struct echo_info7 *)pytalloc_get_ptr(obj);
+	PyObject *py_info4;
+	py_info4 = pytalloc_reference_ex(&echo_info4_Type, pytalloc_get_mem_ctx(obj), &object->info4);
+	return py_info4;
+}
+
+static int py_echo_info7_set_info4(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_info7 *object = (struct echo_info7 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->info4");
+		return -1;
+	}
+	PY_CHECK_TYPE(&echo_info4_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->info4 = *(struct echo_info4 *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyGetSetDef py_echo_info7_getsetters[] = {
+	{
+		.name = discard_const_p(char, "v1"),
+		.get = py_echo_info7_get_v1,
+		.set = py_echo_info7_set_v1,
+		.doc = discard_const_p(char, "PIDL-generated element v1")
+	},
+	{
+		.name = discard_const_p(char, "info4"),
+		.get = py_echo_info7_get_info4,
+		.set = py_echo_info7_set_info4,
+		.doc = discard_const_p(char, "PIDL-generated element info4")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_info7_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_info7, type);
+}
+
+
+static PyTypeObject echo_info7_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.info7",
+	.tp_getset = py_echo_info7_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_info7_new,
+};
+
+PyObject *py_import_echo_Info(TALLOC_CTX *mem_ctx, int level, union echo_Info *in)
+{
+	PyObject *ret;
+
+	switch (level) {
+		case 1:
+			ret = pytalloc_reference_ex(&echo_info1_Type, mem_ctx, &in->info1);
+			return ret;
+
+		case 2:
+			ret = pytalloc_reference_ex(&echo_info2_Type, mem_ctx, &in->info2);
+			return ret;
+
+		case 3:
+			ret = pytalloc_reference_ex(&echo_info3_Type, mem_ctx, &in->info3);
+			return ret;
+
+		case 4:
+			ret = pytalloc_reference_ex(&echo_info4_Type, mem_ctx, &in->info4);
+			return ret;
+
+		case 5:
+			ret = pytalloc_reference_ex(&echo_info5_Type, mem_ctx, &in->info5);
+			return ret;
+
+		case 6:
+			ret = pytalloc_reference_ex(&echo_info6_Type, mem_ctx, &in->info6);
+			return ret;
+
+		case 7:
+			ret = pytalloc_reference_ex(&echo_info7_Type, mem_ctx, &in->info7);
+			return ret;
+
+	}
+	PyErr_SetString(PyExc_TypeError, "unknown union level");
+	return NULL;
+}
+
+union echo_Info *py_export_echo_Info(TALLOC_CTX *mem_ctx, int level, PyObject *in)
+{
+	union echo_Info *ret = talloc_zero(mem_ctx, union echo_Info);
+	switch (level) {
+		case 1:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info1");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info1_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info1 = *(struct echo_info1 *)pytalloc_get_ptr(in);
+			break;
+
+		case 2:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info2");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info2_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info2 = *(struct echo_info2 *)pytalloc_get_ptr(in);
+			break;
+
+		case 3:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info3");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info3_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info3 = *(struct echo_info3 *)pytalloc_get_ptr(in);
+			break;
+
+		case 4:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info4");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info4_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info4 = *(struct echo_info4 *)pytalloc_get_ptr(in);
+			break;
+
+		case 5:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info5");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info5_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info5 = *(struct echo_info5 *)pytalloc_get_ptr(in);
+			break;
+
+		case 6:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info6");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info6_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info6 = *(struct echo_info6 *)pytalloc_get_ptr(in);
+			break;
+
+		case 7:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->info7");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_info7_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->info7 = *(struct echo_info7 *)pytalloc_get_ptr(in);
+			break;
+
+		default:
+			PyErr_SetString(PyExc_TypeError, "invalid union level value");
+			talloc_free(ret);
+			ret = NULL;
+	}
+
+	return ret;
+}
+
+
+static PyObject *py_echo_Enum2_get_e1(PyObject *obj, void *closure)
+{
+	struct echo_Enum2 *object = (struct echo_Enum2 *)pytalloc_get_ptr(obj);
+	PyObject *py_e1;
+	py_e1 = PyInt_FromLong((uint16_t)object->e1);
+	return py_e1;
+}
+
+static int py_echo_Enum2_set_e1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_Enum2 *object = (struct echo_Enum2 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->e1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->e1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->e1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->e1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_echo_Enum2_get_e2(PyObject *obj, void *closure)
+{
+	struct echo_Enum2 *object = (struct echo_Enum2 *)pytalloc_get_ptr(obj);
+	PyObject *py_e2;
+	py_e2 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->e2);
+	return py_e2;
+}
+
+static int py_echo_Enum2_set_e2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_Enum2 *object = (struct echo_Enum2 *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->e2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->e2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->e2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->e2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_Enum2_getsetters[] = {
+	{
+		.name = discard_const_p(char, "e1"),
+		.get = py_echo_Enum2_get_e1,
+		.set = py_echo_Enum2_set_e1,
+		.doc = discard_const_p(char, "PIDL-generated element e1")
+	},
+	{
+		.name = discard_const_p(char, "e2"),
+		.get = py_echo_Enum2_get_e2,
+		.set = py_echo_Enum2_set_e2,
+		.doc = discard_const_p(char, "PIDL-generated element e2")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_Enum2_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_Enum2, type);
+}
+
+
+static PyTypeObject echo_Enum2_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.Enum2",
+	.tp_getset = py_echo_Enum2_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_Enum2_new,
+};
+
+PyObject *py_import_echo_Enum3(TALLOC_CTX *mem_ctx, int level, union echo_Enum3 *in)
+{
+	PyObject *ret;
+
+	switch (level) {
+		case ECHO_ENUM1:
+			ret = PyInt_FromLong((uint16_t)in->e1);
+			return ret;
+
+		case ECHO_ENUM2:
+			ret = pytalloc_reference_ex(&echo_Enum2_Type, mem_ctx, &in->e2);
+			return ret;
+
+	}
+	PyErr_SetString(PyExc_TypeError, "unknown union level");
+	return NULL;
+}
+
+union echo_Enum3 *py_export_echo_Enum3(TALLOC_CTX *mem_ctx, int level, PyObject *in)
+{
+	union echo_Enum3 *ret = talloc_zero(mem_ctx, union echo_Enum3);
+	switch (level) {
+		case ECHO_ENUM1:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->e1");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->e1));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->e1 = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->e1 = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case ECHO_ENUM2:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->e2");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&echo_Enum2_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->e2 = *(struct echo_Enum2 *)pytalloc_get_ptr(in);
+			break;
+
+		default:
+			PyErr_SetString(PyExc_TypeError, "invalid union level value");
+			talloc_free(ret);
+			ret = NULL;
+	}
+
+	return ret;
+}
+
+
+static PyObject *py_echo_Surrounding_get_x(PyObject *obj, void *closure)
+{
+	struct echo_Surrounding *object = (struct echo_Surrounding *)pytalloc_get_ptr(obj);
+	PyObject *py_x;
+	py_x = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->x);
+	return py_x;
+}
+
+static int py_echo_Surrounding_set_x(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_Surrounding *object = (struct echo_Surrounding *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->x");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->x));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->x = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->x = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_echo_Surrounding_get_surrounding(PyObject *obj, void *closure)
+{
+	struct echo_Surrounding *object = (struct echo_Surrounding *)pytalloc_get_ptr(obj);
+	PyObject *py_surrounding;
+	py_surrounding = PyList_New(object->x);
+	if (py_surrounding == NULL) {
+		return NULL;
+	}
+	{
+		int surrounding_cntr_0;
+		for (surrounding_cntr_0 = 0; surrounding_cntr_0 < (object->x); surrounding_cntr_0++) {
+			PyObject *py_surrounding_0;
+			py_surrounding_0 = PyInt_FromLong((uint16_t)object->surrounding[surrounding_cntr_0]);
+			PyList_SetItem(py_surrounding, surrounding_cntr_0, py_surrounding_0);
+		}
+	}
+	return py_surrounding;
+}
+
+static int py_echo_Surrounding_set_surrounding(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct echo_Surrounding *object = (struct echo_Surrounding *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->surrounding");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int surrounding_cntr_0;
+		object->surrounding = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->surrounding, PyList_GET_SIZE(value));
+		if (!object->surrounding) { return -1;; }
+		talloc_set_name_const(object->surrounding, "ARRAY: object->surrounding");
+		for (surrounding_cntr_0 = 0; surrounding_cntr_0 < PyList_GET_SIZE(value); surrounding_cntr_0++) {
+			if (PyList_GET_ITEM(value, surrounding_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->surrounding[surrounding_cntr_0]");
+				return -1;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->surrounding[surrounding_cntr_0]));
+				if (PyLong_Check(PyList_GET_ITEM(value, surrounding_cntr_0))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, surrounding_cntr_0));
+					if (PyErr_Occurred() != NULL) {
+						return -1;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->surrounding[surrounding_cntr_0] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(value, surrounding_cntr_0))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(value, surrounding_cntr_0));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->surrounding[surrounding_cntr_0] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return -1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_echo_Surrounding_getsetters[] = {
+	{
+		.name = discard_const_p(char, "x"),
+		.get = py_echo_Surrounding_get_x,
+		.set = py_echo_Surrounding_set_x,
+		.doc = discard_const_p(char, "PIDL-generated element x")
+	},
+	{
+		.name = discard_const_p(char, "surrounding"),
+		.get = py_echo_Surrounding_get_surrounding,
+		.set = py_echo_Surrounding_set_surrounding,
+		.doc = discard_const_p(char, "PIDL-generated element surrounding")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_echo_Surrounding_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct echo_Surrounding, type);
+}
+
+
+static PyTypeObject echo_Surrounding_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.Surrounding",
+	.tp_getset = py_echo_Surrounding_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_echo_Surrounding_new,
+};
+
+
+static bool pack_py_echo_AddOne_args_in(PyObject *args, PyObject *kwargs, struct echo_AddOne *r)
+{
+	PyObject *py_in_data;
+	const char *kwnames[] = {
+		"in_data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_AddOne", discard_const_p(char *, kwnames), &py_in_data)) {
+		return false;
+	}
+
+	if (py_in_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.in_data");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.in_data));
+		if (PyLong_Check(py_in_data)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_in_data);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.in_data = test_var;
+		} else if (PyInt_Check(py_in_data)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_in_data);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.in_data = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_AddOne_args_out(struct echo_AddOne *r)
+{
+	PyObject *result;
+	PyObject *py_out_data;
+	py_out_data = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.out_data);
+	result = py_out_data;
+	return result;
+}
+
+static bool pack_py_echo_EchoData_args_in(PyObject *args, PyObject *kwargs, struct echo_EchoData *r)
+{
+	PyObject *py_in_data;
+	const char *kwnames[] = {
+		"in_data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_EchoData", discard_const_p(char *, kwnames), &py_in_data)) {
+		return false;
+	}
+
+	PY_CHECK_TYPE(&PyList_Type, py_in_data, return false;);
+	r->in.len = PyList_GET_SIZE(py_in_data);
+	if (py_in_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.in_data");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_in_data, return false;);
+	{
+		int in_data_cntr_0;
+		r->in.in_data = talloc_array_ptrtype(r, r->in.in_data, PyList_GET_SIZE(py_in_data));
+		if (!r->in.in_data) { return false;; }
+		talloc_set_name_const(r->in.in_data, "ARRAY: r->in.in_data");
+		for (in_data_cntr_0 = 0; in_data_cntr_0 < PyList_GET_SIZE(py_in_data); in_data_cntr_0++) {
+			if (PyList_GET_ITEM(py_in_data, in_data_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.in_data[in_data_cntr_0]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.in_data[in_data_cntr_0]));
+				if (PyLong_Check(PyList_GET_ITEM(py_in_data, in_data_cntr_0))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_in_data, in_data_cntr_0));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.in_data[in_data_cntr_0] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_in_data, in_data_cntr_0))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_in_data, in_data_cntr_0));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.in_data[in_data_cntr_0] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_EchoData_args_out(struct echo_EchoData *r)
+{
+	PyObject *result;
+	PyObject *py_out_data;
+	py_out_data = PyList_New(r->in.len);
+	if (py_out_data == NULL) {
+		return NULL;
+	}
+	{
+		int out_data_cntr_0;
+		for (out_data_cntr_0 = 0; out_data_cntr_0 < (r->in.len); out_data_cntr_0++) {
+			PyObject *py_out_data_0;
+			py_out_data_0 = PyInt_FromLong((uint16_t)r->out.out_data[out_data_cntr_0]);
+			PyList_SetItem(py_out_data, out_data_cntr_0, py_out_data_0);
+		}
+	}
+	result = py_out_data;
+	return result;
+}
+
+static bool pack_py_echo_SinkData_args_in(PyObject *args, PyObject *kwargs, struct echo_SinkData *r)
+{
+	PyObject *py_data;
+	const char *kwnames[] = {
+		"data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_SinkData", discard_const_p(char *, kwnames), &py_data)) {
+		return false;
+	}
+
+	PY_CHECK_TYPE(&PyList_Type, py_data, return false;);
+	r->in.len = PyList_GET_SIZE(py_data);
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.data");
+		return false;
+	}
+	PY_CHECK_TYPE(&PyList_Type, py_data, return false;);
+	{
+		int data_cntr_0;
+		r->in.data = talloc_array_ptrtype(r, r->in.data, PyList_GET_SIZE(py_data));
+		if (!r->in.data) { return false;; }
+		talloc_set_name_const(r->in.data, "ARRAY: r->in.data");
+		for (data_cntr_0 = 0; data_cntr_0 < PyList_GET_SIZE(py_data); data_cntr_0++) {
+			if (PyList_GET_ITEM(py_data, data_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.data[data_cntr_0]");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.data[data_cntr_0]));
+				if (PyLong_Check(PyList_GET_ITEM(py_data, data_cntr_0))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(py_data, data_cntr_0));
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.data[data_cntr_0] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(py_data, data_cntr_0))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(py_data, data_cntr_0));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					r->in.data[data_cntr_0] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_SinkData_args_out(struct echo_SinkData *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	return result;
+}
+
+static bool pack_py_echo_SourceData_args_in(PyObject *args, PyObject *kwargs, struct echo_SourceData *r)
+{
+	PyObject *py_len;
+	const char *kwnames[] = {
+		"len", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_SourceData", discard_const_p(char *, kwnames), &py_len)) {
+		return false;
+	}
+
+	if (py_len == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.len");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.len));
+		if (PyLong_Check(py_len)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_len);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.len = test_var;
+		} else if (PyInt_Check(py_len)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_len);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.len = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_SourceData_args_out(struct echo_SourceData *r)
+{
+	PyObject *result;
+	PyObject *py_data;
+	py_data = PyList_New(r->in.len);
+	if (py_data == NULL) {
+		return NULL;
+	}
+	{
+		int data_cntr_0;
+		for (data_cntr_0 = 0; data_cntr_0 < (r->in.len); data_cntr_0++) {
+			PyObject *py_data_0;
+			py_data_0 = PyInt_FromLong((uint16_t)r->out.data[data_cntr_0]);
+			PyList_SetItem(py_data, data_cntr_0, py_data_0);
+		}
+	}
+	result = py_data;
+	return result;
+}
+
+static bool pack_py_echo_TestCall_args_in(PyObject *args, PyObject *kwargs, struct echo_TestCall *r)
+{
+	PyObject *py_s1;
+	const char *kwnames[] = {
+		"s1", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_TestCall", discard_const_p(char *, kwnames), &py_s1)) {
+		return false;
+	}
+
+	if (py_s1 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.s1");
+		return false;
+	}
+	r->in.s1 = talloc_ptrtype(r, r->in.s1);
+	if (py_s1 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.s1");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_s1)) {
+			unicode = PyUnicode_AsEncodedString(py_s1, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_s1)) {
+			test_str = PyString_AS_STRING(py_s1);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_s1)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.s1 = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_TestCall_args_out(struct echo_TestCall *r)
+{
+	PyObject *result;
+	PyObject *py_s2;
+	if (*r->out.s2 == NULL) {
+		py_s2 = Py_None;
+		Py_INCREF(py_s2);
+	} else {
+		if (*r->out.s2 == NULL) {
+			py_s2 = Py_None;
+			Py_INCREF(py_s2);
+		} else {
+			py_s2 = PyUnicode_Decode(*r->out.s2, strlen(*r->out.s2), "utf-8", "ignore");
+		}
+	}
+	result = py_s2;
+	return result;
+}
+
+static bool pack_py_echo_TestCall2_args_in(PyObject *args, PyObject *kwargs, struct echo_TestCall2 *r)
+{
+	PyObject *py_level;
+	const char *kwnames[] = {
+		"level", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_TestCall2", discard_const_p(char *, kwnames), &py_level)) {
+		return false;
+	}
+
+	if (py_level == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.level");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.level));
+		if (PyLong_Check(py_level)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_level);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.level = test_var;
+		} else if (PyInt_Check(py_level)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_level);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.level = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_TestCall2_args_out(struct echo_TestCall2 *r)
+{
+	PyObject *result;
+	PyObject *py_info;
+	py_info = py_import_echo_Info(r->out.info, r->in.level, r->out.info);
+	if (py_info == NULL) {
+		return NULL;
+	}
+	result = py_info;
+	if (NT_STATUS_IS_ERR(r->out.result)) {
+		PyErr_SetNTSTATUS(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_echo_TestSleep_args_in(PyObject *args, PyObject *kwargs, struct echo_TestSleep *r)
+{
+	PyObject *py_seconds;
+	const char *kwnames[] = {
+		"seconds", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_TestSleep", discard_const_p(char *, kwnames), &py_seconds)) {
+		return false;
+	}
+
+	if (py_seconds == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.seconds");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.seconds));
+		if (PyLong_Check(py_seconds)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_seconds);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.seconds = test_var;
+		} else if (PyInt_Check(py_seconds)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_seconds);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.seconds = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_TestSleep_args_out(struct echo_TestSleep *r)
+{
+	PyObject *result;
+	result = ndr_PyLong_FromUnsignedLongLong((uint32_t)r->out.result);
+	return result;
+}
+
+static bool pack_py_echo_TestEnum_args_in(PyObject *args, PyObject *kwargs, struct echo_TestEnum *r)
+{
+	PyObject *py_foo1;
+	PyObject *py_foo2;
+	PyObject *py_foo3;
+	const char *kwnames[] = {
+		"foo1", "foo2", "foo3", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:echo_TestEnum", discard_const_p(char *, kwnames), &py_foo1, &py_foo2, &py_foo3)) {
+		return false;
+	}
+
+	if (py_foo1 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.foo1");
+		return false;
+	}
+	r->in.foo1 = talloc_ptrtype(r, r->in.foo1);
+	if (py_foo1 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.foo1");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(*r->in.foo1));
+		if (PyLong_Check(py_foo1)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_foo1);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			*r->in.foo1 = test_var;
+		} else if (PyInt_Check(py_foo1)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_foo1);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			*r->in.foo1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_foo2 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.foo2");
+		return false;
+	}
+	r->in.foo2 = talloc_ptrtype(r, r->in.foo2);
+	if (py_foo2 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.foo2");
+		return false;
+	}
+	PY_CHECK_TYPE(&echo_Enum2_Type, py_foo2, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_foo2)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.foo2 = (struct echo_Enum2 *)pytalloc_get_ptr(py_foo2);
+	if (py_foo3 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.foo3");
+		return false;
+	}
+	r->in.foo3 = talloc_ptrtype(r, r->in.foo3);
+	if (py_foo3 == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.foo3");
+		return false;
+	}
+	{
+		union echo_Enum3 *foo3_switch_1;
+		foo3_switch_1 = py_export_echo_Enum3(r, *r->in.foo1, py_foo3);
+		if (foo3_switch_1 == NULL) {
+			return false;
+		}
+		r->in.foo3 = foo3_switch_1;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_TestEnum_args_out(struct echo_TestEnum *r)
+{
+	PyObject *result;
+	PyObject *py_foo1;
+	PyObject *py_foo2;
+	PyObject *py_foo3;
+	result = PyTuple_New(3);
+	py_foo1 = PyInt_FromLong((uint16_t)*r->out.foo1);
+	PyTuple_SetItem(result, 0, py_foo1);
+	py_foo2 = pytalloc_reference_ex(&echo_Enum2_Type, r->out.foo2, r->out.foo2);
+	PyTuple_SetItem(result, 1, py_foo2);
+	py_foo3 = py_import_echo_Enum3(r->out.foo3, *r->out.foo1, r->out.foo3);
+	if (py_foo3 == NULL) {
+		return NULL;
+	}
+	PyTuple_SetItem(result, 2, py_foo3);
+	return result;
+}
+
+static bool pack_py_echo_TestSurrounding_args_in(PyObject *args, PyObject *kwargs, struct echo_TestSurrounding *r)
+{
+	PyObject *py_data;
+	const char *kwnames[] = {
+		"data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_TestSurrounding", discard_const_p(char *, kwnames), &py_data)) {
+		return false;
+	}
+
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.data");
+		return false;
+	}
+	r->in.data = talloc_ptrtype(r, r->in.data);
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.data");
+		return false;
+	}
+	PY_CHECK_TYPE(&echo_Surrounding_Type, py_data, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_data)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.data = (struct echo_Surrounding *)pytalloc_get_ptr(py_data);
+	return true;
+}
+
+static PyObject *unpack_py_echo_TestSurrounding_args_out(struct echo_TestSurrounding *r)
+{
+	PyObject *result;
+	PyObject *py_data;
+	py_data = pytalloc_reference_ex(&echo_Surrounding_Type, r->out.data, r->out.data);
+	result = py_data;
+	return result;
+}
+
+static bool pack_py_echo_TestDoublePointer_args_in(PyObject *args, PyObject *kwargs, struct echo_TestDoublePointer *r)
+{
+	PyObject *py_data;
+	const char *kwnames[] = {
+		"data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:echo_TestDoublePointer", discard_const_p(char *, kwnames), &py_data)) {
+		return false;
+	}
+
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.data");
+		return false;
+	}
+	r->in.data = talloc_ptrtype(r, r->in.data);
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.data");
+		return false;
+	}
+	if (py_data == Py_None) {
+		*r->in.data = NULL;
+	} else {
+		*r->in.data = NULL;
+		if (py_data == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct **r->in.data");
+			return false;
+		}
+		if (py_data == Py_None) {
+			**r->in.data = NULL;
+		} else {
+			**r->in.data = talloc_ptrtype(r, **r->in.data);
+			if (py_data == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ***r->in.data");
+				return false;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(***r->in.data));
+				if (PyLong_Check(py_data)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(py_data);
+					if (PyErr_Occurred() != NULL) {
+						return false;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					***r->in.data = test_var;
+				} else if (PyInt_Check(py_data)) {
+					long test_var;
+					test_var = PyInt_AsLong(py_data);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return false;
+					}
+					***r->in.data = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return false;
+				}
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_echo_TestDoublePointer_args_out(struct echo_TestDoublePointer *r)
+{
+	PyObject *result;
+	result = PyInt_FromLong((uint16_t)r->out.result);
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_rpcecho_methods[] = {
+	{ "AddOne", "S.AddOne(in_data) -> out_data", (py_dcerpc_call_fn)dcerpc_echo_AddOne_r, (py_data_pack_fn)pack_py_echo_AddOne_args_in, (py_data_unpack_fn)unpack_py_echo_AddOne_args_out, 0, &ndr_table_rpcecho },
+	{ "EchoData", "S.EchoData(in_data) -> out_data", (py_dcerpc_call_fn)dcerpc_echo_EchoData_r, (py_data_pack_fn)pack_py_echo_EchoData_args_in, (py_data_unpack_fn)unpack_py_echo_EchoData_args_out, 1, &ndr_table_rpcecho },
+	{ "SinkData", "S.SinkData(data) -> None", (py_dcerpc_call_fn)dcerpc_echo_SinkData_r, (py_data_pack_fn)pack_py_echo_SinkData_args_in, (py_data_unpack_fn)unpack_py_echo_SinkData_args_out, 2, &ndr_table_rpcecho },
+	{ "SourceData", "S.SourceData(len) -> data", (py_dcerpc_call_fn)dcerpc_echo_SourceData_r, (py_data_pack_fn)pack_py_echo_SourceData_args_in, (py_data_unpack_fn)unpack_py_echo_SourceData_args_out, 3, &ndr_table_rpcecho },
+	{ "TestCall", "S.TestCall(s1) -> s2", (py_dcerpc_call_fn)dcerpc_echo_TestCall_r, (py_data_pack_fn)pack_py_echo_TestCall_args_in, (py_data_unpack_fn)unpack_py_echo_TestCall_args_out, 4, &ndr_table_rpcecho },
+	{ "TestCall2", "S.TestCall2(level) -> info", (py_dcerpc_call_fn)dcerpc_echo_TestCall2_r, (py_data_pack_fn)pack_py_echo_TestCall2_args_in, (py_data_unpack_fn)unpack_py_echo_TestCall2_args_out, 5, &ndr_table_rpcecho },
+	{ "TestSleep", "S.TestSleep(seconds) -> result", (py_dcerpc_call_fn)dcerpc_echo_TestSleep_r, (py_data_pack_fn)pack_py_echo_TestSleep_args_in, (py_data_unpack_fn)unpack_py_echo_TestSleep_args_out, 6, &ndr_table_rpcecho },
+	{ "TestEnum", "S.TestEnum(foo1, foo2, foo3) -> (foo1, foo2, foo3)", (py_dcerpc_call_fn)dcerpc_echo_TestEnum_r, (py_data_pack_fn)pack_py_echo_TestEnum_args_in, (py_data_unpack_fn)unpack_py_echo_TestEnum_args_out, 7, &ndr_table_rpcecho },
+	{ "TestSurrounding", "S.TestSurrounding(data) -> data", (py_dcerpc_call_fn)dcerpc_echo_TestSurrounding_r, (py_data_pack_fn)pack_py_echo_TestSurrounding_args_in, (py_data_unpack_fn)unpack_py_echo_TestSurrounding_args_out, 8, &ndr_table_rpcecho },
+	{ "TestDoublePointer", "S.TestDoublePointer(data) -> result", (py_dcerpc_call_fn)dcerpc_echo_TestDoublePointer_r, (py_data_pack_fn)pack_py_echo_TestDoublePointer_args_in, (py_data_unpack_fn)unpack_py_echo_TestDoublePointer_args_out, 9, &ndr_table_rpcecho },
+	{ NULL }
+};
+
+static PyObject *interface_rpcecho_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_rpcecho);
+}
+
+#define PY_DOC_RPCECHO "Simple echo pipe"
+static PyTypeObject rpcecho_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.rpcecho",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "rpcecho(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_RPCECHO,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_rpcecho_new,
+};
+
+static PyObject *syntax_rpcecho_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_rpcecho.syntax_id);
+}
+
+#define PY_DOC_RPCECHO_SYNTAX "Simple echo pipe"
+static PyTypeObject rpcecho_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "echo.rpcecho",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_RPCECHO_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_rpcecho_new,
+};
+
+static PyMethodDef echo_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initecho(void)
+{
+	PyObject *m;
+	PyObject *dep_talloc;
+	PyObject *dep_samba_dcerpc_base;
+	PyObject *dep_samba_dcerpc_misc;
+
+	dep_talloc = PyImport_ImportModule("talloc");
+	if (dep_talloc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	BaseObject_Type = (PyTypeObject *)PyObject_GetAttrString(dep_talloc, "BaseObject");
+	if (BaseObject_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	echo_info1_Type.tp_base = BaseObject_Type;
+	echo_info1_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_info2_Type.tp_base = BaseObject_Type;
+	echo_info2_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_info3_Type.tp_base = BaseObject_Type;
+	echo_info3_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_info4_Type.tp_base = BaseObject_Type;
+	echo_info4_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_info5_Type.tp_base = BaseObject_Type;
+	echo_info5_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_info6_Type.tp_base = BaseObject_Type;
+	echo_info6_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_info7_Type.tp_base = BaseObject_Type;
+	echo_info7_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_Enum2_Type.tp_base = BaseObject_Type;
+	echo_Enum2_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	echo_Surrounding_Type.tp_base = BaseObject_Type;
+	echo_Surrounding_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	rpcecho_InterfaceType.tp_base = ClientConnection_Type;
+
+	rpcecho_SyntaxType.tp_base = ndr_syntax_id_Type;
+	rpcecho_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&echo_info1_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_info2_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_info3_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_info4_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_info5_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_info6_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_info7_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_Enum2_Type) < 0)
+		return;
+	if (PyType_Ready(&echo_Surrounding_Type) < 0)
+		return;
+	if (PyType_Ready(&rpcecho_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&rpcecho_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&rpcecho_InterfaceType, py_ndr_rpcecho_methods))
+		return;
+
+#ifdef PY_INFO1_PATCH
+	PY_INFO1_PATCH(&echo_info1_Type);
+#endif
+#ifdef PY_INFO2_PATCH
+	PY_INFO2_PATCH(&echo_info2_Type);
+#endif
+#ifdef PY_INFO3_PATCH
+	PY_INFO3_PATCH(&echo_info3_Type);
+#endif
+#ifdef PY_INFO4_PATCH
+	PY_INFO4_PATCH(&echo_info4_Type);
+#endif
+#ifdef PY_INFO5_PATCH
+	PY_INFO5_PATCH(&echo_info5_Type);
+#endif
+#ifdef PY_INFO6_PATCH
+	PY_INFO6_PATCH(&echo_info6_Type);
+#endif
+#ifdef PY_INFO7_PATCH
+	PY_INFO7_PATCH(&echo_info7_Type);
+#endif
+#ifdef PY_ENUM2_PATCH
+	PY_ENUM2_PATCH(&echo_Enum2_Type);
+#endif
+#ifdef PY_SURROUNDING_PATCH
+	PY_SURROUNDING_PATCH(&echo_Surrounding_Type);
+#endif
+#ifdef PY_RPCECHO_PATCH
+	PY_RPCECHO_PATCH(&rpcecho_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&rpcecho_SyntaxType);
+#endif
+
+	m = Py_InitModule3("echo", echo_methods, "echo DCE/RPC");
+	if (m == NULL)
+		return;
+
+	PyModule_AddObject(m, "ECHO_ENUM1", PyInt_FromLong((uint16_t)ECHO_ENUM1));
+	PyModule_AddObject(m, "ECHO_ENUM2", PyInt_FromLong((uint16_t)ECHO_ENUM2));
+	PyModule_AddObject(m, "ECHO_ENUM1_32", ndr_PyLong_FromUnsignedLongLong((uint32_t)ECHO_ENUM1_32));
+	PyModule_AddObject(m, "ECHO_ENUM2_32", ndr_PyLong_FromUnsignedLongLong((uint32_t)ECHO_ENUM2_32));
+	Py_INCREF((PyObject *)(void *)&echo_info1_Type);
+	PyModule_AddObject(m, "info1", (PyObject *)(void *)&echo_info1_Type);
+	Py_INCREF((PyObject *)(void *)&echo_info2_Type);
+	PyModule_AddObject(m, "info2", (PyObject *)(void *)&echo_info2_Type);
+	Py_INCREF((PyObject *)(void *)&echo_info3_Type);
+	PyModule_AddObject(m, "info3", (PyObject *)(void *)&echo_info3_Type);
+	Py_INCREF((PyObject *)(void *)&echo_info4_Type);
+	PyModule_AddObject(m, "info4", (PyObject *)(void *)&echo_info4_Type);
+	Py_INCREF((PyObject *)(void *)&echo_info5_Type);
+	PyModule_AddObject(m, "info5", (PyObject *)(void *)&echo_info5_Type);
+	Py_INCREF((PyObject *)(void *)&echo_info6_Type);
+	PyModule_AddObject(m, "info6", (PyObject *)(void *)&echo_info6_Type);
+	Py_INCREF((PyObject *)(void *)&echo_info7_Type);
+	PyModule_AddObject(m, "info7", (PyObject *)(void *)&echo_info7_Type);
+	Py_INCREF((PyObject *)(void *)&echo_Enum2_Type);
+	PyModule_AddObject(m, "Enum2", (PyObject *)(void *)&echo_Enum2_Type);
+	Py_INCREF((PyObject *)(void *)&echo_Surrounding_Type);
+	PyModule_AddObject(m, "Surrounding", (PyObject *)(void *)&echo_Surrounding_Type);
+	Py_INCREF((PyObject *)(void *)&rpcecho_InterfaceType);
+	PyModule_AddObject(m, "rpcecho", (PyObject *)(void *)&rpcecho_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&rpcecho_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&rpcecho_SyntaxType);
+#ifdef PY_MOD_ECHO_PATCH
+	PY_MOD_ECHO_PATCH(m);
+#endif
+
+}
@@ -0,0 +1,1627 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_efs.h"
+#include "bin/default/librpc/gen_ndr/ndr_efs_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/security.h"
+static PyTypeObject EFS_HASH_BLOB_Type;
+static PyTypeObject ENCRYPTION_CERTIFICATE_HASH_Type;
+static PyTypeObject ENCRYPTION_CERTIFICATE_HASH_LIST_Type;
+static PyTypeObject EFS_CERTIFICATE_BLOB_Type;
+static PyTypeObject ENCRYPTION_CERTIFICATE_Type;
+static PyTypeObject efs_InterfaceType;
+
+void initefs(void);static PyTypeObject *BaseObject_Type;
+static PyTypeObject *dom_sid_Type;
+static PyTypeObject *policy_handle_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static PyObject *py_EFS_HASH_BLOB_get_cbData(PyObject *obj, void *closure)
+{
+	struct EFS_HASH_BLOB *object = (struct EFS_HASH_BLOB *)pytalloc_get_ptr(obj);
+	PyObject *py_cbData;
+	py_cbData = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbData);
+	return py_cbData;
+}
+
+static int py_EFS_HASH_BLOB_set_cbData(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct EFS_HASH_BLOB *object = (struct EFS_HASH_BLOB *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbData");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbData));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbData = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbData = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_EFS_HASH_BLOB_get_pbData(PyObject *obj, void *closure)
+{
+	struct EFS_HASH_BLOB *object = (struct EFS_HASH_BLOB *)pytalloc_get_ptr(obj);
+	PyObject *py_pbData;
+	if (object->pbData == NULL) {
+		py_pbData = Py_None;
+		Py_INCREF(py_pbData);
+	} else {
+		py_pbData = PyList_New(object->cbData);
+		if (py_pbData == NULL) {
+			return NULL;
+		}
+		{
+			int pbData_cntr_1;
+			for (pbData_cntr_1 = 0; pbData_cntr_1 < (object->cbData); pbData_cntr_1++) {
+				PyObject *py_pbData_1;
+				py_pbData_1 = PyInt_FromLong((uint16_t)object->pbData[pbData_cntr_1]);
+				PyList_SetItem(py_pbData, pbData_cntr_1, py_pbData_1);
+			}
+		}
+	}
+	return py_pbData;
+}
+
+static int py_EFS_HASH_BLOB_set_pbData(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct EFS_HASH_BLOB *object = (struct EFS_HASH_BLOB *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pbData));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pbData");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pbData = NULL;
+	} else {
+		object->pbData = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pbData");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int pbData_cntr_1;
+			object->pbData = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->pbData, PyList_GET_SIZE(value));
+			if (!object->pbData) { return -1;; }
+			talloc_set_name_const(object->pbData, "ARRAY: object->pbData");
+			for (pbData_cntr_1 = 0; pbData_cntr_1 < PyList_GET_SIZE(value); pbData_cntr_1++) {
+				if (PyList_GET_ITEM(value, pbData_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pbData[pbData_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->pbData[pbData_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, pbData_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, pbData_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->pbData[pbData_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, pbData_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, pbData_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->pbData[pbData_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_EFS_HASH_BLOB_getsetters[] = {
+	{
+		.name = discard_const_p(char, "cbData"),
+		.get = py_EFS_HASH_BLOB_get_cbData,
+		.set = py_EFS_HASH_BLOB_set_cbData,
+		.doc = discard_const_p(char, "PIDL-generated element cbData")
+	},
+	{
+		.name = discard_const_p(char, "pbData"),
+		.get = py_EFS_HASH_BLOB_get_pbData,
+		.set = py_EFS_HASH_BLOB_set_pbData,
+		.doc = discard_const_p(char, "PIDL-generated element pbData")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_EFS_HASH_BLOB_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct EFS_HASH_BLOB, type);
+}
+
+
+static PyTypeObject EFS_HASH_BLOB_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.EFS_HASH_BLOB",
+	.tp_getset = py_EFS_HASH_BLOB_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_EFS_HASH_BLOB_new,
+};
+
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_get_cbTotalLength(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(obj);
+	PyObject *py_cbTotalLength;
+	py_cbTotalLength = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbTotalLength);
+	return py_cbTotalLength;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_HASH_set_cbTotalLength(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbTotalLength");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbTotalLength));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbTotalLength = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbTotalLength = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_get_pUserSid(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(obj);
+	PyObject *py_pUserSid;
+	if (object->pUserSid == NULL) {
+		py_pUserSid = Py_None;
+		Py_INCREF(py_pUserSid);
+	} else {
+		py_pUserSid = pytalloc_reference_ex(dom_sid_Type, object->pUserSid, object->pUserSid);
+	}
+	return py_pUserSid;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_HASH_set_pUserSid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pUserSid));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pUserSid");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pUserSid = NULL;
+	} else {
+		object->pUserSid = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pUserSid");
+			return -1;
+		}
+		PY_CHECK_TYPE(dom_sid_Type, value, return -1;);
+		if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->pUserSid = (struct dom_sid *)pytalloc_get_ptr(value);
+	}
+	return 0;
+}
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_get_pHash(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(obj);
+	PyObject *py_pHash;
+	if (object->pHash == NULL) {
+		py_pHash = Py_None;
+		Py_INCREF(py_pHash);
+	} else {
+		py_pHash = pytalloc_reference_ex(&EFS_HASH_BLOB_Type, object->pHash, object->pHash);
+	}
+	return py_pHash;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_HASH_set_pHash(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pHash));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pHash");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pHash = NULL;
+	} else {
+		object->pHash = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pHash");
+			return -1;
+		}
+		PY_CHECK_TYPE(&EFS_HASH_BLOB_Type, value, return -1;);
+		if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->pHash = (struct EFS_HASH_BLOB *)pytalloc_get_ptr(value);
+	}
+	return 0;
+}
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_get_lpDisplayInformation(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(obj);
+	PyObject *py_lpDisplayInformation;
+	if (object->lpDisplayInformation == NULL) {
+		py_lpDisplayInformation = Py_None;
+		Py_INCREF(py_lpDisplayInformation);
+	} else {
+		if (object->lpDisplayInformation == NULL) {
+			py_lpDisplayInformation = Py_None;
+			Py_INCREF(py_lpDisplayInformation);
+		} else {
+			py_lpDisplayInformation = PyUnicode_Decode(object->lpDisplayInformation, strlen(object->lpDisplayInformation), "utf-8", "ignore");
+		}
+	}
+	return py_lpDisplayInformation;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_HASH_set_lpDisplayInformation(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH *object = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->lpDisplayInformation");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->lpDisplayInformation = NULL;
+	} else {
+		object->lpDisplayInformation = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->lpDisplayInformation");
+			return -1;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(value)) {
+				unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(value)) {
+				test_str = PyString_AS_STRING(value);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+				return -1;
+			}
+			talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->lpDisplayInformation = talloc_str;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_ENCRYPTION_CERTIFICATE_HASH_getsetters[] = {
+	{
+		.name = discard_const_p(char, "cbTotalLength"),
+		.get = py_ENCRYPTION_CERTIFICATE_HASH_get_cbTotalLength,
+		.set = py_ENCRYPTION_CERTIFICATE_HASH_set_cbTotalLength,
+		.doc = discard_const_p(char, "PIDL-generated element cbTotalLength")
+	},
+	{
+		.name = discard_const_p(char, "pUserSid"),
+		.get = py_ENCRYPTION_CERTIFICATE_HASH_get_pUserSid,
+		.set = py_ENCRYPTION_CERTIFICATE_HASH_set_pUserSid,
+		.doc = discard_const_p(char, "PIDL-generated element pUserSid")
+	},
+	{
+		.name = discard_const_p(char, "pHash"),
+		.get = py_ENCRYPTION_CERTIFICATE_HASH_get_pHash,
+		.set = py_ENCRYPTION_CERTIFICATE_HASH_set_pHash,
+		.doc = discard_const_p(char, "PIDL-generated element pHash")
+	},
+	{
+		.name = discard_const_p(char, "lpDisplayInformation"),
+		.get = py_ENCRYPTION_CERTIFICATE_HASH_get_lpDisplayInformation,
+		.set = py_ENCRYPTION_CERTIFICATE_HASH_set_lpDisplayInformation,
+		.doc = discard_const_p(char, "PIDL-generated element lpDisplayInformation")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct ENCRYPTION_CERTIFICATE_HASH, type);
+}
+
+
+static PyTypeObject ENCRYPTION_CERTIFICATE_HASH_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.ENCRYPTION_CERTIFICATE_HASH",
+	.tp_getset = py_ENCRYPTION_CERTIFICATE_HASH_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_ENCRYPTION_CERTIFICATE_HASH_new,
+};
+
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_LIST_get_nCert_Hash(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH_LIST *object = (struct ENCRYPTION_CERTIFICATE_HASH_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_nCert_Hash;
+	py_nCert_Hash = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->nCert_Hash);
+	return py_nCert_Hash;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_HASH_LIST_set_nCert_Hash(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH_LIST *object = (struct ENCRYPTION_CERTIFICATE_HASH_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->nCert_Hash");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->nCert_Hash));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->nCert_Hash = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->nCert_Hash = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_LIST_get_pUsers(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH_LIST *object = (struct ENCRYPTION_CERTIFICATE_HASH_LIST *)pytalloc_get_ptr(obj);
+	PyObject *py_pUsers;
+	py_pUsers = PyList_New(object->nCert_Hash);
+	if (py_pUsers == NULL) {
+		return NULL;
+	}
+	{
+		int pUsers_cntr_0;
+		for (pUsers_cntr_0 = 0; pUsers_cntr_0 < (object->nCert_Hash); pUsers_cntr_0++) {
+			PyObject *py_pUsers_0;
+			if (object->pUsers[pUsers_cntr_0] == NULL) {
+				py_pUsers_0 = Py_None;
+				Py_INCREF(py_pUsers_0);
+			} else {
+				py_pUsers_0 = pytalloc_reference_ex(&ENCRYPTION_CERTIFICATE_HASH_Type, object->pUsers[pUsers_cntr_0], object->pUsers[pUsers_cntr_0]);
+			}
+			PyList_SetItem(py_pUsers, pUsers_cntr_0, py_pUsers_0);
+		}
+	}
+	return py_pUsers;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_HASH_LIST_set_pUsers(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE_HASH_LIST *object = (struct ENCRYPTION_CERTIFICATE_HASH_LIST *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pUsers");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int pUsers_cntr_0;
+		object->pUsers = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->pUsers, PyList_GET_SIZE(value));
+		if (!object->pUsers) { return -1;; }
+		talloc_set_name_const(object->pUsers, "ARRAY: object->pUsers");
+		for (pUsers_cntr_0 = 0; pUsers_cntr_0 < PyList_GET_SIZE(value); pUsers_cntr_0++) {
+			if (PyList_GET_ITEM(value, pUsers_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pUsers[pUsers_cntr_0]");
+				return -1;
+			}
+			if (PyList_GET_ITEM(value, pUsers_cntr_0) == Py_None) {
+				object->pUsers[pUsers_cntr_0] = NULL;
+			} else {
+				object->pUsers[pUsers_cntr_0] = NULL;
+				if (PyList_GET_ITEM(value, pUsers_cntr_0) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pUsers[pUsers_cntr_0]");
+					return -1;
+				}
+				PY_CHECK_TYPE(&ENCRYPTION_CERTIFICATE_HASH_Type, PyList_GET_ITEM(value, pUsers_cntr_0), return -1;);
+				if (talloc_reference(object->pUsers, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, pUsers_cntr_0))) == NULL) {
+					PyErr_NoMemory();
+					return -1;
+				}
+				object->pUsers[pUsers_cntr_0] = (struct ENCRYPTION_CERTIFICATE_HASH *)pytalloc_get_ptr(PyList_GET_ITEM(value, pUsers_cntr_0));
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_ENCRYPTION_CERTIFICATE_HASH_LIST_getsetters[] = {
+	{
+		.name = discard_const_p(char, "nCert_Hash"),
+		.get = py_ENCRYPTION_CERTIFICATE_HASH_LIST_get_nCert_Hash,
+		.set = py_ENCRYPTION_CERTIFICATE_HASH_LIST_set_nCert_Hash,
+		.doc = discard_const_p(char, "PIDL-generated element nCert_Hash")
+	},
+	{
+		.name = discard_const_p(char, "pUsers"),
+		.get = py_ENCRYPTION_CERTIFICATE_HASH_LIST_get_pUsers,
+		.set = py_ENCRYPTION_CERTIFICATE_HASH_LIST_set_pUsers,
+		.doc = discard_const_p(char, "PIDL-generated element pUsers")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_HASH_LIST_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct ENCRYPTION_CERTIFICATE_HASH_LIST, type);
+}
+
+
+static PyTypeObject ENCRYPTION_CERTIFICATE_HASH_LIST_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.ENCRYPTION_CERTIFICATE_HASH_LIST",
+	.tp_getset = py_ENCRYPTION_CERTIFICATE_HASH_LIST_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_ENCRYPTION_CERTIFICATE_HASH_LIST_new,
+};
+
+
+static PyObject *py_EFS_CERTIFICATE_BLOB_get_dwCertEncodingType(PyObject *obj, void *closure)
+{
+	struct EFS_CERTIFICATE_BLOB *object = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(obj);
+	PyObject *py_dwCertEncodingType;
+	py_dwCertEncodingType = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dwCertEncodingType);
+	return py_dwCertEncodingType;
+}
+
+static int py_EFS_CERTIFICATE_BLOB_set_dwCertEncodingType(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct EFS_CERTIFICATE_BLOB *object = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dwCertEncodingType");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dwCertEncodingType));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwCertEncodingType = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dwCertEncodingType = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_EFS_CERTIFICATE_BLOB_get_cbData(PyObject *obj, void *closure)
+{
+	struct EFS_CERTIFICATE_BLOB *object = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(obj);
+	PyObject *py_cbData;
+	py_cbData = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cbData);
+	return py_cbData;
+}
+
+static int py_EFS_CERTIFICATE_BLOB_set_cbData(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct EFS_CERTIFICATE_BLOB *object = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cbData");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cbData));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbData = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cbData = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_EFS_CERTIFICATE_BLOB_get_pbData(PyObject *obj, void *closure)
+{
+	struct EFS_CERTIFICATE_BLOB *object = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(obj);
+	PyObject *py_pbData;
+	if (object->pbData == NULL) {
+		py_pbData = Py_None;
+		Py_INCREF(py_pbData);
+	} else {
+		py_pbData = PyList_New(object->cbData);
+		if (py_pbData == NULL) {
+			return NULL;
+		}
+		{
+			int pbData_cntr_1;
+			for (pbData_cntr_1 = 0; pbData_cntr_1 < (object->cbData); pbData_cntr_1++) {
+				PyObject *py_pbData_1;
+				py_pbData_1 = PyInt_FromLong((uint16_t)object->pbData[pbData_cntr_1]);
+				PyList_SetItem(py_pbData, pbData_cntr_1, py_pbData_1);
+			}
+		}
+	}
+	return py_pbData;
+}
+
+static int py_EFS_CERTIFICATE_BLOB_set_pbData(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct EFS_CERTIFICATE_BLOB *object = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pbData));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pbData");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pbData = NULL;
+	} else {
+		object->pbData = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pbData");
+			return -1;
+		}
+		PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+		{
+			int pbData_cntr_1;
+			object->pbData = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->pbData, PyList_GET_SIZE(value));
+			if (!object->pbData) { return -1;; }
+			talloc_set_name_const(object->pbData, "ARRAY: object->pbData");
+			for (pbData_cntr_1 = 0; pbData_cntr_1 < PyList_GET_SIZE(value); pbData_cntr_1++) {
+				if (PyList_GET_ITEM(value, pbData_cntr_1) == NULL) {
+					PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pbData[pbData_cntr_1]");
+					return -1;
+				}
+				{
+					const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->pbData[pbData_cntr_1]));
+					if (PyLong_Check(PyList_GET_ITEM(value, pbData_cntr_1))) {
+						unsigned long long test_var;
+						test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, pbData_cntr_1));
+						if (PyErr_Occurred() != NULL) {
+							return -1;
+						}
+						if (test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->pbData[pbData_cntr_1] = test_var;
+					} else if (PyInt_Check(PyList_GET_ITEM(value, pbData_cntr_1))) {
+						long test_var;
+						test_var = PyInt_AsLong(PyList_GET_ITEM(value, pbData_cntr_1));
+						if (test_var < 0 || test_var > uint_max) {
+							PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+							  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+							return -1;
+						}
+						object->pbData[pbData_cntr_1] = test_var;
+					} else {
+						PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name);
+						return -1;
+					}
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_EFS_CERTIFICATE_BLOB_getsetters[] = {
+	{
+		.name = discard_const_p(char, "dwCertEncodingType"),
+		.get = py_EFS_CERTIFICATE_BLOB_get_dwCertEncodingType,
+		.set = py_EFS_CERTIFICATE_BLOB_set_dwCertEncodingType,
+		.doc = discard_const_p(char, "PIDL-generated element dwCertEncodingType")
+	},
+	{
+		.name = discard_const_p(char, "cbData"),
+		.get = py_EFS_CERTIFICATE_BLOB_get_cbData,
+		.set = py_EFS_CERTIFICATE_BLOB_set_cbData,
+		.doc = discard_const_p(char, "PIDL-generated element cbData")
+	},
+	{
+		.name = discard_const_p(char, "pbData"),
+		.get = py_EFS_CERTIFICATE_BLOB_get_pbData,
+		.set = py_EFS_CERTIFICATE_BLOB_set_pbData,
+		.doc = discard_const_p(char, "PIDL-generated element pbData")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_EFS_CERTIFICATE_BLOB_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct EFS_CERTIFICATE_BLOB, type);
+}
+
+
+static PyTypeObject EFS_CERTIFICATE_BLOB_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.EFS_CERTIFICATE_BLOB",
+	.tp_getset = py_EFS_CERTIFICATE_BLOB_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_EFS_CERTIFICATE_BLOB_new,
+};
+
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_get_TotalLength(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE *object = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(obj);
+	PyObject *py_TotalLength;
+	py_TotalLength = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->TotalLength);
+	return py_TotalLength;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_set_TotalLength(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE *object = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->TotalLength");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->TotalLength));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->TotalLength = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->TotalLength = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_get_pUserSid(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE *object = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(obj);
+	PyObject *py_pUserSid;
+	if (object->pUserSid == NULL) {
+		py_pUserSid = Py_None;
+		Py_INCREF(py_pUserSid);
+	} else {
+		py_pUserSid = pytalloc_reference_ex(dom_sid_Type, object->pUserSid, object->pUserSid);
+	}
+	return py_pUserSid;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_set_pUserSid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE *object = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pUserSid));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pUserSid");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pUserSid = NULL;
+	} else {
+		object->pUserSid = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pUserSid");
+			return -1;
+		}
+		PY_CHECK_TYPE(dom_sid_Type, value, return -1;);
+		if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->pUserSid = (struct dom_sid *)pytalloc_get_ptr(value);
+	}
+	return 0;
+}
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_get_pCertBlob(PyObject *obj, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE *object = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(obj);
+	PyObject *py_pCertBlob;
+	if (object->pCertBlob == NULL) {
+		py_pCertBlob = Py_None;
+		Py_INCREF(py_pCertBlob);
+	} else {
+		py_pCertBlob = pytalloc_reference_ex(&EFS_CERTIFICATE_BLOB_Type, object->pCertBlob, object->pCertBlob);
+	}
+	return py_pCertBlob;
+}
+
+static int py_ENCRYPTION_CERTIFICATE_set_pCertBlob(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct ENCRYPTION_CERTIFICATE *object = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->pCertBlob));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pCertBlob");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->pCertBlob = NULL;
+	} else {
+		object->pCertBlob = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->pCertBlob");
+			return -1;
+		}
+		PY_CHECK_TYPE(&EFS_CERTIFICATE_BLOB_Type, value, return -1;);
+		if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->pCertBlob = (struct EFS_CERTIFICATE_BLOB *)pytalloc_get_ptr(value);
+	}
+	return 0;
+}
+
+static PyGetSetDef py_ENCRYPTION_CERTIFICATE_getsetters[] = {
+	{
+		.name = discard_const_p(char, "TotalLength"),
+		.get = py_ENCRYPTION_CERTIFICATE_get_TotalLength,
+		.set = py_ENCRYPTION_CERTIFICATE_set_TotalLength,
+		.doc = discard_const_p(char, "PIDL-generated element TotalLength")
+	},
+	{
+		.name = discard_const_p(char, "pUserSid"),
+		.get = py_ENCRYPTION_CERTIFICATE_get_pUserSid,
+		.set = py_ENCRYPTION_CERTIFICATE_set_pUserSid,
+		.doc = discard_const_p(char, "PIDL-generated element pUserSid")
+	},
+	{
+		.name = discard_const_p(char, "pCertBlob"),
+		.get = py_ENCRYPTION_CERTIFICATE_get_pCertBlob,
+		.set = py_ENCRYPTION_CERTIFICATE_set_pCertBlob,
+		.doc = discard_const_p(char, "PIDL-generated element pCertBlob")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_ENCRYPTION_CERTIFICATE_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct ENCRYPTION_CERTIFICATE, type);
+}
+
+
+static PyTypeObject ENCRYPTION_CERTIFICATE_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.ENCRYPTION_CERTIFICATE",
+	.tp_getset = py_ENCRYPTION_CERTIFICATE_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_ENCRYPTION_CERTIFICATE_new,
+};
+
+
+static bool pack_py_EfsRpcOpenFileRaw_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcOpenFileRaw *r)
+{
+	PyObject *py_FileName;
+	PyObject *py_Flags;
+	const char *kwnames[] = {
+		"FileName", "Flags", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EfsRpcOpenFileRaw", discard_const_p(char *, kwnames), &py_FileName, &py_Flags)) {
+		return false;
+	}
+
+	if (py_FileName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.FileName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_FileName)) {
+			unicode = PyUnicode_AsEncodedString(py_FileName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_FileName)) {
+			test_str = PyString_AS_STRING(py_FileName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_FileName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.FileName = talloc_str;
+	}
+	if (py_Flags == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Flags");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.Flags));
+		if (PyLong_Check(py_Flags)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_Flags);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.Flags = test_var;
+		} else if (PyInt_Check(py_Flags)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_Flags);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.Flags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcOpenFileRaw_args_out(struct EfsRpcOpenFileRaw *r)
+{
+	PyObject *result;
+	PyObject *py_pvContext;
+	py_pvContext = pytalloc_reference_ex(policy_handle_Type, r->out.pvContext, r->out.pvContext);
+	result = py_pvContext;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_EfsRpcCloseRaw_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcCloseRaw *r)
+{
+	PyObject *py_pvContext;
+	const char *kwnames[] = {
+		"pvContext", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:EfsRpcCloseRaw", discard_const_p(char *, kwnames), &py_pvContext)) {
+		return false;
+	}
+
+	if (py_pvContext == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pvContext");
+		return false;
+	}
+	r->in.pvContext = talloc_ptrtype(r, r->in.pvContext);
+	if (py_pvContext == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pvContext");
+		return false;
+	}
+	PY_CHECK_TYPE(policy_handle_Type, py_pvContext, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_pvContext)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.pvContext = (struct policy_handle *)pytalloc_get_ptr(py_pvContext);
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcCloseRaw_args_out(struct EfsRpcCloseRaw *r)
+{
+	PyObject *result;
+	PyObject *py_pvContext;
+	py_pvContext = pytalloc_reference_ex(policy_handle_Type, r->out.pvContext, r->out.pvContext);
+	result = py_pvContext;
+	return result;
+}
+
+static bool pack_py_EfsRpcEncryptFileSrv_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcEncryptFileSrv *r)
+{
+	PyObject *py_Filename;
+	const char *kwnames[] = {
+		"Filename", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:EfsRpcEncryptFileSrv", discard_const_p(char *, kwnames), &py_Filename)) {
+		return false;
+	}
+
+	if (py_Filename == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Filename");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_Filename)) {
+			unicode = PyUnicode_AsEncodedString(py_Filename, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_Filename)) {
+			test_str = PyString_AS_STRING(py_Filename);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_Filename)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.Filename = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcEncryptFileSrv_args_out(struct EfsRpcEncryptFileSrv *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_EfsRpcDecryptFileSrv_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcDecryptFileSrv *r)
+{
+	PyObject *py_FileName;
+	PyObject *py_Reserved;
+	const char *kwnames[] = {
+		"FileName", "Reserved", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:EfsRpcDecryptFileSrv", discard_const_p(char *, kwnames), &py_FileName, &py_Reserved)) {
+		return false;
+	}
+
+	if (py_FileName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.FileName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_FileName)) {
+			unicode = PyUnicode_AsEncodedString(py_FileName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_FileName)) {
+			test_str = PyString_AS_STRING(py_FileName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_FileName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.FileName = talloc_str;
+	}
+	if (py_Reserved == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.Reserved");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.Reserved));
+		if (PyLong_Check(py_Reserved)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_Reserved);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.Reserved = test_var;
+		} else if (PyInt_Check(py_Reserved)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_Reserved);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.Reserved = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcDecryptFileSrv_args_out(struct EfsRpcDecryptFileSrv *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_EfsRpcQueryUsersOnFile_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcQueryUsersOnFile *r)
+{
+	PyObject *py_FileName;
+	const char *kwnames[] = {
+		"FileName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:EfsRpcQueryUsersOnFile", discard_const_p(char *, kwnames), &py_FileName)) {
+		return false;
+	}
+
+	if (py_FileName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.FileName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_FileName)) {
+			unicode = PyUnicode_AsEncodedString(py_FileName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_FileName)) {
+			test_str = PyString_AS_STRING(py_FileName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_FileName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.FileName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcQueryUsersOnFile_args_out(struct EfsRpcQueryUsersOnFile *r)
+{
+	PyObject *result;
+	PyObject *py_pUsers;
+	if (*r->out.pUsers == NULL) {
+		py_pUsers = Py_None;
+		Py_INCREF(py_pUsers);
+	} else {
+		py_pUsers = pytalloc_reference_ex(&ENCRYPTION_CERTIFICATE_HASH_LIST_Type, *r->out.pUsers, *r->out.pUsers);
+	}
+	result = py_pUsers;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_EfsRpcQueryRecoveryAgents_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcQueryRecoveryAgents *r)
+{
+	PyObject *py_FileName;
+	const char *kwnames[] = {
+		"FileName", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:EfsRpcQueryRecoveryAgents", discard_const_p(char *, kwnames), &py_FileName)) {
+		return false;
+	}
+
+	if (py_FileName == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.FileName");
+		return false;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(py_FileName)) {
+			unicode = PyUnicode_AsEncodedString(py_FileName, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(py_FileName)) {
+			test_str = PyString_AS_STRING(py_FileName);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_FileName)->tp_name);
+			return false;
+		}
+		talloc_str = talloc_strdup(r, test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.FileName = talloc_str;
+	}
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcQueryRecoveryAgents_args_out(struct EfsRpcQueryRecoveryAgents *r)
+{
+	PyObject *result;
+	PyObject *py_pRecoveryAgents;
+	if (*r->out.pRecoveryAgents == NULL) {
+		py_pRecoveryAgents = Py_None;
+		Py_INCREF(py_pRecoveryAgents);
+	} else {
+		py_pRecoveryAgents = pytalloc_reference_ex(&ENCRYPTION_CERTIFICATE_HASH_LIST_Type, *r->out.pRecoveryAgents, *r->out.pRecoveryAgents);
+	}
+	result = py_pRecoveryAgents;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_EfsRpcSetFileEncryptionKey_args_in(PyObject *args, PyObject *kwargs, struct EfsRpcSetFileEncryptionKey *r)
+{
+	PyObject *py_pEncryptionCertificate;
+	const char *kwnames[] = {
+		"pEncryptionCertificate", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:EfsRpcSetFileEncryptionKey", discard_const_p(char *, kwnames), &py_pEncryptionCertificate)) {
+		return false;
+	}
+
+	if (py_pEncryptionCertificate == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.pEncryptionCertificate");
+		return false;
+	}
+	if (py_pEncryptionCertificate == Py_None) {
+		r->in.pEncryptionCertificate = NULL;
+	} else {
+		r->in.pEncryptionCertificate = NULL;
+		if (py_pEncryptionCertificate == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.pEncryptionCertificate");
+			return false;
+		}
+		PY_CHECK_TYPE(&ENCRYPTION_CERTIFICATE_Type, py_pEncryptionCertificate, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_pEncryptionCertificate)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.pEncryptionCertificate = (struct ENCRYPTION_CERTIFICATE *)pytalloc_get_ptr(py_pEncryptionCertificate);
+	}
+	return true;
+}
+
+static PyObject *unpack_py_EfsRpcSetFileEncryptionKey_args_out(struct EfsRpcSetFileEncryptionKey *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_efs_methods[] = {
+	{ "EfsRpcOpenFileRaw", "S.EfsRpcOpenFileRaw(FileName, Flags) -> pvContext", (py_dcerpc_call_fn)dcerpc_EfsRpcOpenFileRaw_r, (py_data_pack_fn)pack_py_EfsRpcOpenFileRaw_args_in, (py_data_unpack_fn)unpack_py_EfsRpcOpenFileRaw_args_out, 0, &ndr_table_efs },
+	{ "EfsRpcCloseRaw", "S.EfsRpcCloseRaw(pvContext) -> pvContext", (py_dcerpc_call_fn)dcerpc_EfsRpcCloseRaw_r, (py_data_pack_fn)pack_py_EfsRpcCloseRaw_args_in, (py_data_unpack_fn)unpack_py_EfsRpcCloseRaw_args_out, 3, &ndr_table_efs },
+	{ "EfsRpcEncryptFileSrv", "S.EfsRpcEncryptFileSrv(Filename) -> None", (py_dcerpc_call_fn)dcerpc_EfsRpcEncryptFileSrv_r, (py_data_pack_fn)pack_py_EfsRpcEncryptFileSrv_args_in, (py_data_unpack_fn)unpack_py_EfsRpcEncryptFileSrv_args_out, 4, &ndr_table_efs },
+	{ "EfsRpcDecryptFileSrv", "S.EfsRpcDecryptFileSrv(FileName, Reserved) -> None", (py_dcerpc_call_fn)dcerpc_EfsRpcDecryptFileSrv_r, (py_data_pack_fn)pack_py_EfsRpcDecryptFileSrv_args_in, (py_data_unpack_fn)unpack_py_EfsRpcDecryptFileSrv_args_out, 5, &ndr_table_efs },
+	{ "EfsRpcQueryUsersOnFile", "S.EfsRpcQueryUsersOnFile(FileName) -> pUsers", (py_dcerpc_call_fn)dcerpc_EfsRpcQueryUsersOnFile_r, (py_data_pack_fn)pack_py_EfsRpcQueryUsersOnFile_args_in, (py_data_unpack_fn)unpack_py_EfsRpcQueryUsersOnFile_args_out, 6, &ndr_table_efs },
+	{ "EfsRpcQueryRecoveryAgents", "S.EfsRpcQueryRecoveryAgents(FileName) -> pRecoveryAgents", (py_dcerpc_call_fn)dcerpc_EfsRpcQueryRecoveryAgents_r, (py_data_pack_fn)pack_py_EfsRpcQueryRecoveryAgents_args_in, (py_data_unpack_fn)unpack_py_EfsRpcQueryRecoveryAgents_args_out, 7, &ndr_table_efs },
+	{ "EfsRpcSetFileEncryptionKey", "S.EfsRpcSetFileEncryptionKey(pEncryptionCertificate) -> None", (py_dcerpc_call_fn)dcerpc_EfsRpcSetFileEncryptionKey_r, (py_data_pack_fn)pack_py_EfsRpcSetFileEncryptionKey_args_in, (py_data_unpack_fn)unpack_py_EfsRpcSetFileEncryptionKey_args_out, 10, &ndr_table_efs },
+	{ NULL }
+};
+
+static PyObject *interface_efs_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_efs);
+}
+
+static PyTypeObject efs_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.efs",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "efs(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n",
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_efs_new,
+};
+
+static PyObject *syntax_efs_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_efs.syntax_id);
+}
+
+static PyTypeObject efs_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "efs.efs",
+	.tp_doc = "abstract_syntax()\n",
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_efs_new,
+};
+
+static PyMethodDef efs_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initefs(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_security;
+	PyObject *dep_talloc;
+	PyObject *dep_samba_dcerpc_misc;
+	PyObject *dep_samba_dcerpc_base;
+
+	dep_samba_dcerpc_security = PyImport_ImportModule("samba.dcerpc.security");
+	if (dep_samba_dcerpc_security == NULL)
+		return;
+
+	dep_talloc = PyImport_ImportModule("talloc");
+	if (dep_talloc == NULL)
+		return;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	BaseObject_Type = (PyTypeObject *)PyObject_GetAttrString(dep_talloc, "BaseObject");
+	if (BaseObject_Type == NULL)
+		return;
+
+	dom_sid_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_security, "dom_sid");
+	if (dom_sid_Type == NULL)
+		return;
+
+	policy_handle_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "policy_handle");
+	if (policy_handle_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	EFS_HASH_BLOB_Type.tp_base = BaseObject_Type;
+	EFS_HASH_BLOB_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	ENCRYPTION_CERTIFICATE_HASH_Type.tp_base = BaseObject_Type;
+	ENCRYPTION_CERTIFICATE_HASH_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	ENCRYPTION_CERTIFICATE_HASH_LIST_Type.tp_base = BaseObject_Type;
+	ENCRYPTION_CERTIFICATE_HASH_LIST_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	EFS_CERTIFICATE_BLOB_Type.tp_base = BaseObject_Type;
+	EFS_CERTIFICATE_BLOB_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	ENCRYPTION_CERTIFICATE_Type.tp_base = BaseObject_Type;
+	ENCRYPTION_CERTIFICATE_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	efs_InterfaceType.tp_base = ClientConnection_Type;
+
+	efs_SyntaxType.tp_base = ndr_syntax_id_Type;
+	efs_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&EFS_HASH_BLOB_Type) < 0)
+		return;
+	if (PyType_Ready(&ENCRYPTION_CERTIFICATE_HASH_Type) < 0)
+		return;
+	if (PyType_Ready(&ENCRYPTION_CERTIFICATE_HASH_LIST_Type) < 0)
+		return;
+	if (PyType_Ready(&EFS_CERTIFICATE_BLOB_Type) < 0)
+		return;
+	if (PyType_Ready(&ENCRYPTION_CERTIFICATE_Type) < 0)
+		return;
+	if (PyType_Ready(&efs_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&efs_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&efs_InterfaceType, py_ndr_efs_methods))
+		return;
+
+#ifdef PY_EFS_HASH_BLOB_PATCH
+	PY_EFS_HASH_BLOB_PATCH(&EFS_HASH_BLOB_Type);
+#endif
+#ifdef PY_ENCRYPTION_CERTIFICATE_HASH_PATCH
+	PY_ENCRYPTION_CERTIFICATE_HASH_PATCH(&ENCRYPTION_CERTIFICATE_HASH_Type);
+#endif
+#ifdef PY_ENCRYPTION_CERTIFICATE_HASH_LIST_PATCH
+	PY_ENCRYPTION_CERTIFICATE_HASH_LIST_PATCH(&ENCRYPTION_CERTIFICATE_HASH_LIST_Type);
+#endif
+#ifdef PY_EFS_CERTIFICATE_BLOB_PATCH
+	PY_EFS_CERTIFICATE_BLOB_PATCH(&EFS_CERTIFICATE_BLOB_Type);
+#endif
+#ifdef PY_ENCRYPTION_CERTIFICATE_PATCH
+	PY_ENCRYPTION_CERTIFICATE_PATCH(&ENCRYPTION_CERTIFICATE_Type);
+#endif
+#ifdef PY_EFS_PATCH
+	PY_EFS_PATCH(&efs_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&efs_SyntaxType);
+#endif
+
+	m = Py_InitModule3("efs", efs_methods, "efs DCE/RPC");
+	if (m == NULL)
+		return;
+
+	Py_INCREF((PyObject *)(void *)&EFS_HASH_BLOB_Type);
+	PyModule_AddObject(m, "EFS_HASH_BLOB", (PyObject *)(void *)&EFS_HASH_BLOB_Type);
+	Py_INCREF((PyObject *)(void *)&ENCRYPTION_CERTIFICATE_HASH_Type);
+	PyModule_AddObject(m, "ENCRYPTION_CERTIFICATE_HASH", (PyObject *)(void *)&ENCRYPTION_CERTIFICATE_HASH_Type);
+	Py_INCREF((PyObject *)(void *)&ENCRYPTION_CERTIFICATE_HASH_LIST_Type);
+	PyModule_AddObject(m, "ENCRYPTION_CERTIFICATE_HASH_LIST", (PyObject *)(void *)&ENCRYPTION_CERTIFICATE_HASH_LIST_Type);
+	Py_INCREF((PyObject *)(void *)&EFS_CERTIFICATE_BLOB_Type);
+	PyModule_AddObject(m, "EFS_CERTIFICATE_BLOB", (PyObject *)(void *)&EFS_CERTIFICATE_BLOB_Type);
+	Py_INCREF((PyObject *)(void *)&ENCRYPTION_CERTIFICATE_Type);
+	PyModule_AddObject(m, "ENCRYPTION_CERTIFICATE", (PyObject *)(void *)&ENCRYPTION_CERTIFICATE_Type);
+	Py_INCREF((PyObject *)(void *)&efs_InterfaceType);
+	PyModule_AddObject(m, "efs", (PyObject *)(void *)&efs_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&efs_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&efs_SyntaxType);
+#ifdef PY_MOD_EFS_PATCH
+	PY_MOD_EFS_PATCH(m);
+#endif
+
+}
@@ -0,0 +1,1285 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_frsapi.h"
+#include "bin/default/librpc/gen_ndr/ndr_frsapi_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/misc.h"
+static PyTypeObject frsapi_Info_Type;
+static PyTypeObject frsapi_InterfaceType;
+
+void initfrsapi(void);static PyTypeObject *GUID_Type;
+static PyTypeObject *BaseObject_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static PyObject *py_frsapi_Info_get_length(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_length;
+	py_length = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->length);
+	return py_length;
+}
+
+static int py_frsapi_Info_set_length(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->length");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->length));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->length = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->length = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_guid(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_guid;
+	py_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->guid);
+	return py_guid;
+}
+
+static int py_frsapi_Info_set_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_length2(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_length2;
+	py_length2 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->length2);
+	return py_length2;
+}
+
+static int py_frsapi_Info_set_length2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->length2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->length2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->length2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->length2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_unknown1(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_unknown1;
+	py_unknown1 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->unknown1);
+	return py_unknown1;
+}
+
+static int py_frsapi_Info_set_unknown1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->unknown1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->unknown1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->unknown1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->unknown1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_level(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_level;
+	py_level = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->level);
+	return py_level;
+}
+
+static int py_frsapi_Info_set_level(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->level");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->level));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->level = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->level = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_query_counter(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_query_counter;
+	py_query_counter = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->query_counter);
+	return py_query_counter;
+}
+
+static int py_frsapi_Info_set_query_counter(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->query_counter");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->query_counter));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->query_counter = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->query_counter = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_unknown2(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_unknown2;
+	py_unknown2 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->unknown2);
+	return py_unknown2;
+}
+
+static int py_frsapi_Info_set_unknown2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->unknown2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->unknown2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->unknown2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->unknown2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_offset(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_offset;
+	py_offset = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->offset);
+	return py_offset;
+}
+
+static int py_frsapi_Info_set_offset(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_blob_len(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_blob_len;
+	py_blob_len = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->blob_len);
+	return py_blob_len;
+}
+
+static int py_frsapi_Info_set_blob_len(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->blob_len");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->blob_len));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->blob_len = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->blob_len = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsapi_Info_get_blob(PyObject *obj, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(obj);
+	PyObject *py_blob;
+	py_blob = PyString_FromStringAndSize((char *)(object->blob).data, (object->blob).length);
+	return py_blob;
+}
+
+static int py_frsapi_Info_set_blob(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsapi_Info *object = (struct frsapi_Info *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->blob");
+		return -1;
+	}
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->blob");
+		return -1;
+	}
+	object->blob = data_blob_talloc(pytalloc_get_mem_ctx(py_obj), PyString_AS_STRING(value), PyString_GET_SIZE(value));
+	return 0;
+}
+
+static PyGetSetDef py_frsapi_Info_getsetters[] = {
+	{
+		.name = discard_const_p(char, "length"),
+		.get = py_frsapi_Info_get_length,
+		.set = py_frsapi_Info_set_length,
+		.doc = discard_const_p(char, "PIDL-generated element length")
+	},
+	{
+		.name = discard_const_p(char, "guid"),
+		.get = py_frsapi_Info_get_guid,
+		.set = py_frsapi_Info_set_guid,
+		.doc = discard_const_p(char, "PIDL-generated element guid")
+	},
+	{
+		.name = discard_const_p(char, "length2"),
+		.get = py_frsapi_Info_get_length2,
+		.set = py_frsapi_Info_set_length2,
+		.doc = discard_const_p(char, "PIDL-generated element length2")
+	},
+	{
+		.name = discard_const_p(char, "unknown1"),
+		.get = py_frsapi_Info_get_unknown1,
+		.set = py_frsapi_Info_set_unknown1,
+		.doc = discard_const_p(char, "PIDL-generated element unknown1")
+	},
+	{
+		.name = discard_const_p(char, "level"),
+		.get = py_frsapi_Info_get_level,
+		.set = py_frsapi_Info_set_level,
+		.doc = discard_const_p(char, "PIDL-generated element level")
+	},
+	{
+		.name = discard_const_p(char, "query_counter"),
+		.get = py_frsapi_Info_get_query_counter,
+		.set = py_frsapi_Info_set_query_counter,
+		.doc = discard_const_p(char, "PIDL-generated element query_counter")
+	},
+	{
+		.name = discard_const_p(char, "unknown2"),
+		.get = py_frsapi_Info_get_unknown2,
+		.set = py_frsapi_Info_set_unknown2,
+		.doc = discard_const_p(char, "PIDL-generated element unknown2")
+	},
+	{
+		.name = discard_const_p(char, "offset"),
+		.get = py_frsapi_Info_get_offset,
+		.set = py_frsapi_Info_set_offset,
+		.doc = discard_const_p(char, "PIDL-generated element offset")
+	},
+	{
+		.name = discard_const_p(char, "blob_len"),
+		.get = py_frsapi_Info_get_blob_len,
+		.set = py_frsapi_Info_set_blob_len,
+		.doc = discard_const_p(char, "PIDL-generated element blob_len")
+	},
+	{
+		.name = discard_const_p(char, "blob"),
+		.get = py_frsapi_Info_get_blob,
+		.set = py_frsapi_Info_set_blob,
+		.doc = discard_const_p(char, "PIDL-generated element blob")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsapi_Info_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsapi_Info, type);
+}
+
+
+static PyTypeObject frsapi_Info_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsapi.Info",
+	.tp_getset = py_frsapi_Info_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsapi_Info_new,
+};
+
+
+static bool pack_py_frsapi_SetDsPollingIntervalW_args_in(PyObject *args, PyObject *kwargs, struct frsapi_SetDsPollingIntervalW *r)
+{
+	PyObject *py_CurrentInterval;
+	PyObject *py_DsPollingLongInterval;
+	PyObject *py_DsPollingShortInterval;
+	const char *kwnames[] = {
+		"CurrentInterval", "DsPollingLongInterval", "DsPollingShortInterval", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOO:frsapi_SetDsPollingIntervalW", discard_const_p(char *, kwnames), &py_CurrentInterval, &py_DsPollingLongInterval, &py_DsPollingShortInterval)) {
+		return false;
+	}
+
+	if (py_CurrentInterval == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.CurrentInterval");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.CurrentInterval));
+		if (PyLong_Check(py_CurrentInterval)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_CurrentInterval);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.CurrentInterval = test_var;
+		} else if (PyInt_Check(py_CurrentInterval)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_CurrentInterval);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.CurrentInterval = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_DsPollingLongInterval == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.DsPollingLongInterval");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.DsPollingLongInterval));
+		if (PyLong_Check(py_DsPollingLongInterval)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_DsPollingLongInterval);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.DsPollingLongInterval = test_var;
+		} else if (PyInt_Check(py_DsPollingLongInterval)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_DsPollingLongInterval);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.DsPollingLongInterval = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_DsPollingShortInterval == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.DsPollingShortInterval");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.DsPollingShortInterval));
+		if (PyLong_Check(py_DsPollingShortInterval)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_DsPollingShortInterval);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.DsPollingShortInterval = test_var;
+		} else if (PyInt_Check(py_DsPollingShortInterval)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_DsPollingShortInterval);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.DsPollingShortInterval = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsapi_SetDsPollingIntervalW_args_out(struct frsapi_SetDsPollingIntervalW *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsapi_GetDsPollingIntervalW_args_in(PyObject *args, PyObject *kwargs, struct frsapi_GetDsPollingIntervalW *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":frsapi_GetDsPollingIntervalW", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_frsapi_GetDsPollingIntervalW_args_out(struct frsapi_GetDsPollingIntervalW *r)
+{
+	PyObject *result;
+	PyObject *py_CurrentInterval;
+	PyObject *py_DsPollingLongInterval;
+	PyObject *py_DsPollingShortInterval;
+	result = PyTuple_New(3);
+	py_CurrentInterval = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.CurrentInterval);
+	PyTuple_SetItem(result, 0, py_CurrentInterval);
+	py_DsPollingLongInterval = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.DsPollingLongInterval);
+	PyTuple_SetItem(result, 1, py_DsPollingLongInterval);
+	py_DsPollingShortInterval = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.DsPollingShortInterval);
+	PyTuple_SetItem(result, 2, py_DsPollingShortInterval);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsapi_InfoW_args_in(PyObject *args, PyObject *kwargs, struct frsapi_InfoW *r)
+{
+	PyObject *py_length;
+	PyObject *py_info;
+	const char *kwnames[] = {
+		"length", "info", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:frsapi_InfoW", discard_const_p(char *, kwnames), &py_length, &py_info)) {
+		return false;
+	}
+
+	if (py_length == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.length");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.length));
+		if (PyLong_Check(py_length)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_length);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.length = test_var;
+		} else if (PyInt_Check(py_length)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_length);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.length = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_info == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.info");
+		return false;
+	}
+	if (py_info == Py_None) {
+		r->in.info = NULL;
+	} else {
+		r->in.info = NULL;
+		if (py_info == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.info");
+			return false;
+		}
+		PY_CHECK_TYPE(&frsapi_Info_Type, py_info, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_info)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.info = (struct frsapi_Info *)pytalloc_get_ptr(py_info);
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsapi_InfoW_args_out(struct frsapi_InfoW *r)
+{
+	PyObject *result;
+	PyObject *py_info;
+	if (r->out.info == NULL) {
+		py_info = Py_None;
+		Py_INCREF(py_info);
+	} else {
+		py_info = pytalloc_reference_ex(&frsapi_Info_Type, r->out.info, r->out.info);
+	}
+	result = py_info;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsapi_IsPathReplicated_args_in(PyObject *args, PyObject *kwargs, struct frsapi_IsPathReplicated *r)
+{
+	PyObject *py_path;
+	PyObject *py_replica_set_type;
+	const char *kwnames[] = {
+		"path", "replica_set_type", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:frsapi_IsPathReplicated", discard_const_p(char *, kwnames), &py_path, &py_replica_set_type)) {
+		return false;
+	}
+
+	if (py_path == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.path");
+		return false;
+	}
+	if (py_path == Py_None) {
+		r->in.path = NULL;
+	} else {
+		r->in.path = NULL;
+		if (py_path == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.path");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_path)) {
+				unicode = PyUnicode_AsEncodedString(py_path, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_path)) {
+				test_str = PyString_AS_STRING(py_path);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_path)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.path = talloc_str;
+		}
+	}
+	if (py_replica_set_type == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_type");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.replica_set_type));
+		if (PyLong_Check(py_replica_set_type)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_replica_set_type);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.replica_set_type = test_var;
+		} else if (PyInt_Check(py_replica_set_type)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_replica_set_type);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.replica_set_type = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsapi_IsPathReplicated_args_out(struct frsapi_IsPathReplicated *r)
+{
+	PyObject *result;
+	PyObject *py_replicated;
+	PyObject *py_primary;
+	PyObject *py_root;
+	PyObject *py_replica_set_guid;
+	result = PyTuple_New(4);
+	py_replicated = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.replicated);
+	PyTuple_SetItem(result, 0, py_replicated);
+	py_primary = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.primary);
+	PyTuple_SetItem(result, 1, py_primary);
+	py_root = ndr_PyLong_FromUnsignedLongLong((uint32_t)*r->out.root);
+	PyTuple_SetItem(result, 2, py_root);
+	py_replica_set_guid = pytalloc_reference_ex(GUID_Type, r->out.replica_set_guid, r->out.replica_set_guid);
+	PyTuple_SetItem(result, 3, py_replica_set_guid);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsapi_WriterCommand_args_in(PyObject *args, PyObject *kwargs, struct frsapi_WriterCommand *r)
+{
+	PyObject *py_command;
+	const char *kwnames[] = {
+		"command", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:frsapi_WriterCommand", discard_const_p(char *, kwnames), &py_command)) {
+		return false;
+	}
+
+	if (py_command == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.command");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.command));
+		if (PyLong_Check(py_command)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_command);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.command = test_var;
+		} else if (PyInt_Check(py_command)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_command);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.command = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsapi_WriterCommand_args_out(struct frsapi_WriterCommand *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsapi_ForceReplication_args_in(PyObject *args, PyObject *kwargs, struct frsapi_ForceReplication *r)
+{
+	PyObject *py_replica_set_guid;
+	PyObject *py_connection_guid;
+	PyObject *py_replica_set_name;
+	PyObject *py_partner_dns_name;
+	const char *kwnames[] = {
+		"replica_set_guid", "connection_guid", "replica_set_name", "partner_dns_name", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOO:frsapi_ForceReplication", discard_const_p(char *, kwnames), &py_replica_set_guid, &py_connection_guid, &py_replica_set_name, &py_partner_dns_name)) {
+		return false;
+	}
+
+	if (py_replica_set_guid == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_guid");
+		return false;
+	}
+	if (py_replica_set_guid == Py_None) {
+		r->in.replica_set_guid = NULL;
+	} else {
+		r->in.replica_set_guid = NULL;
+		if (py_replica_set_guid == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.replica_set_guid");
+			return false;
+		}
+		PY_CHECK_TYPE(GUID_Type, py_replica_set_guid, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_replica_set_guid)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.replica_set_guid = (struct GUID *)pytalloc_get_ptr(py_replica_set_guid);
+	}
+	if (py_connection_guid == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.connection_guid");
+		return false;
+	}
+	if (py_connection_guid == Py_None) {
+		r->in.connection_guid = NULL;
+	} else {
+		r->in.connection_guid = NULL;
+		if (py_connection_guid == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.connection_guid");
+			return false;
+		}
+		PY_CHECK_TYPE(GUID_Type, py_connection_guid, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_connection_guid)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.connection_guid = (struct GUID *)pytalloc_get_ptr(py_connection_guid);
+	}
+	if (py_replica_set_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_name");
+		return false;
+	}
+	if (py_replica_set_name == Py_None) {
+		r->in.replica_set_name = NULL;
+	} else {
+		r->in.replica_set_name = NULL;
+		if (py_replica_set_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.replica_set_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_replica_set_name)) {
+				unicode = PyUnicode_AsEncodedString(py_replica_set_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_replica_set_name)) {
+				test_str = PyString_AS_STRING(py_replica_set_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_replica_set_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.replica_set_name = talloc_str;
+		}
+	}
+	if (py_partner_dns_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.partner_dns_name");
+		return false;
+	}
+	if (py_partner_dns_name == Py_None) {
+		r->in.partner_dns_name = NULL;
+	} else {
+		r->in.partner_dns_name = NULL;
+		if (py_partner_dns_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.partner_dns_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_partner_dns_name)) {
+				unicode = PyUnicode_AsEncodedString(py_partner_dns_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_partner_dns_name)) {
+				test_str = PyString_AS_STRING(py_partner_dns_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_partner_dns_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.partner_dns_name = talloc_str;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsapi_ForceReplication_args_out(struct frsapi_ForceReplication *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_frsapi_methods[] = {
+	{ "SetDsPollingIntervalW", "S.SetDsPollingIntervalW(CurrentInterval, DsPollingLongInterval, DsPollingShortInterval) -> None", (py_dcerpc_call_fn)dcerpc_frsapi_SetDsPollingIntervalW_r, (py_data_pack_fn)pack_py_frsapi_SetDsPollingIntervalW_args_in, (py_data_unpack_fn)unpack_py_frsapi_SetDsPollingIntervalW_args_out, 4, &ndr_table_frsapi },
+	{ "GetDsPollingIntervalW", "S.GetDsPollingIntervalW() -> (CurrentInterval, DsPollingLongInterval, DsPollingShortInterval)", (py_dcerpc_call_fn)dcerpc_frsapi_GetDsPollingIntervalW_r, (py_data_pack_fn)pack_py_frsapi_GetDsPollingIntervalW_args_in, (py_data_unpack_fn)unpack_py_frsapi_GetDsPollingIntervalW_args_out, 5, &ndr_table_frsapi },
+	{ "InfoW", "S.InfoW(length, info) -> info", (py_dcerpc_call_fn)dcerpc_frsapi_InfoW_r, (py_data_pack_fn)pack_py_frsapi_InfoW_args_in, (py_data_unpack_fn)unpack_py_frsapi_InfoW_args_out, 7, &ndr_table_frsapi },
+	{ "IsPathReplicated", "S.IsPathReplicated(path, replica_set_type) -> (replicated, primary, root, replica_set_guid)", (py_dcerpc_call_fn)dcerpc_frsapi_IsPathReplicated_r, (py_data_pack_fn)pack_py_frsapi_IsPathReplicated_args_in, (py_data_unpack_fn)unpack_py_frsapi_IsPathReplicated_args_out, 8, &ndr_table_frsapi },
+	{ "WriterCommand", "S.WriterCommand(command) -> None", (py_dcerpc_call_fn)dcerpc_frsapi_WriterCommand_r, (py_data_pack_fn)pack_py_frsapi_WriterCommand_args_in, (py_data_unpack_fn)unpack_py_frsapi_WriterCommand_args_out, 9, &ndr_table_frsapi },
+	{ "ForceReplication", "S.ForceReplication(replica_set_guid, connection_guid, replica_set_name, partner_dns_name) -> None", (py_dcerpc_call_fn)dcerpc_frsapi_ForceReplication_r, (py_data_pack_fn)pack_py_frsapi_ForceReplication_args_in, (py_data_unpack_fn)unpack_py_frsapi_ForceReplication_args_out, 10, &ndr_table_frsapi },
+	{ NULL }
+};
+
+static PyObject *interface_frsapi_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_frsapi);
+}
+
+#define PY_DOC_FRSAPI "File Replication API"
+static PyTypeObject frsapi_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsapi.frsapi",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "frsapi(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_FRSAPI,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_frsapi_new,
+};
+
+static PyObject *syntax_frsapi_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_frsapi.syntax_id);
+}
+
+#define PY_DOC_FRSAPI_SYNTAX "File Replication API"
+static PyTypeObject frsapi_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsapi.frsapi",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_FRSAPI_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_frsapi_new,
+};
+
+static PyMethodDef frsapi_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initfrsapi(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_misc;
+	PyObject *dep_talloc;
+	PyObject *dep_samba_dcerpc_base;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	dep_talloc = PyImport_ImportModule("talloc");
+	if (dep_talloc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	GUID_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "GUID");
+	if (GUID_Type == NULL)
+		return;
+
+	BaseObject_Type = (PyTypeObject *)PyObject_GetAttrString(dep_talloc, "BaseObject");
+	if (BaseObject_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	frsapi_Info_Type.tp_base = BaseObject_Type;
+	frsapi_Info_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsapi_InterfaceType.tp_base = ClientConnection_Type;
+
+	frsapi_SyntaxType.tp_base = ndr_syntax_id_Type;
+	frsapi_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&frsapi_Info_Type) < 0)
+		return;
+	if (PyType_Ready(&frsapi_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&frsapi_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&frsapi_InterfaceType, py_ndr_frsapi_methods))
+		return;
+
+#ifdef PY_INFO_PATCH
+	PY_INFO_PATCH(&frsapi_Info_Type);
+#endif
+#ifdef PY_FRSAPI_PATCH
+	PY_FRSAPI_PATCH(&frsapi_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&frsapi_SyntaxType);
+#endif
+
+	m = Py_InitModule3("frsapi", frsapi_methods, "frsapi DCE/RPC");
+	if (m == NULL)
+		return;
+
+	PyModule_AddObject(m, "FRSAPI_INFO_VERSION", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_VERSION));
+	PyModule_AddObject(m, "FRSAPI_INFO_SETS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_SETS));
+	PyModule_AddObject(m, "FRSAPI_INFO_DS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_DS));
+	PyModule_AddObject(m, "FRSAPI_INFO_MEMORY", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_MEMORY));
+	PyModule_AddObject(m, "FRSAPI_INFO_IDTABLE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_IDTABLE));
+	PyModule_AddObject(m, "FRSAPI_INFO_OUTLOG", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_OUTLOG));
+	PyModule_AddObject(m, "FRSAPI_INFO_INLOG", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_INLOG));
+	PyModule_AddObject(m, "FRSAPI_INFO_THREADS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_THREADS));
+	PyModule_AddObject(m, "FRSAPI_INFO_STAGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_STAGE));
+	PyModule_AddObject(m, "FRSAPI_INFO_CONFIGTABLE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_INFO_CONFIGTABLE));
+	PyModule_AddObject(m, "FRSAPI_REPLICA_SET_TYPE_0", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_REPLICA_SET_TYPE_0));
+	PyModule_AddObject(m, "FRSAPI_REPLICA_SET_TYPE_DOMAIN", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_REPLICA_SET_TYPE_DOMAIN));
+	PyModule_AddObject(m, "FRSAPI_REPLICA_SET_TYPE_DFS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_REPLICA_SET_TYPE_DFS));
+	PyModule_AddObject(m, "FRSAPI_WRITER_COMMAND_FREEZE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_WRITER_COMMAND_FREEZE));
+	PyModule_AddObject(m, "FRSAPI_WRITER_COMMAND_THAW", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSAPI_WRITER_COMMAND_THAW));
+	Py_INCREF((PyObject *)(void *)&frsapi_Info_Type);
+	PyModule_AddObject(m, "Info", (PyObject *)(void *)&frsapi_Info_Type);
+	Py_INCREF((PyObject *)(void *)&frsapi_InterfaceType);
+	PyModule_AddObject(m, "frsapi", (PyObject *)(void *)&frsapi_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&frsapi_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&frsapi_SyntaxType);
+#ifdef PY_MOD_FRSAPI_PATCH
+	PY_MOD_FRSAPI_PATCH(m);
+#endif
+
+}
@@ -0,0 +1,316 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_frsblobs.h"
+#include "bin/default/librpc/gen_ndr/ndr_frsblobs_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/misc.h"
+#include "librpc/gen_ndr/security.h"
+#include "librpc/gen_ndr/frsrpc.h"
+#include "librpc/gen_ndr/bkupblobs.h"
+#include "librpc/gen_ndr/fscc.h"
+static PyTypeObject frsblobs_InterfaceType;
+
+void initfrsblobs(void);static PyTypeObject *bkup_NTBackupFile_Type;
+static PyTypeObject *frsrpc_StageHeader_Type;
+static PyTypeObject *fscc_FileNetworkOpenInformation_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static bool pack_py_decode_nt_backup_file_args_in(PyObject *args, PyObject *kwargs, struct decode_nt_backup_file *r)
+{
+	PyObject *py_file;
+	const char *kwnames[] = {
+		"file", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:decode_nt_backup_file", discard_const_p(char *, kwnames), &py_file)) {
+		return false;
+	}
+
+	if (py_file == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.file");
+		return false;
+	}
+	PY_CHECK_TYPE(bkup_NTBackupFile_Type, py_file, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_file)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.file = *(struct bkup_NTBackupFile *)pytalloc_get_ptr(py_file);
+	return true;
+}
+
+static PyObject *unpack_py_decode_nt_backup_file_args_out(struct decode_nt_backup_file *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	return result;
+}
+
+static bool pack_py_decode_frsrpc_StageHeader_args_in(PyObject *args, PyObject *kwargs, struct decode_frsrpc_StageHeader *r)
+{
+	PyObject *py_header;
+	PyObject *py_data;
+	const char *kwnames[] = {
+		"header", "data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OO:decode_frsrpc_StageHeader", discard_const_p(char *, kwnames), &py_header, &py_data)) {
+		return false;
+	}
+
+	if (py_header == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.header");
+		return false;
+	}
+	PY_CHECK_TYPE(frsrpc_StageHeader_Type, py_header, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_header)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.header = *(struct frsrpc_StageHeader *)pytalloc_get_ptr(py_header);
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.data");
+		return false;
+	}
+	PY_CHECK_TYPE(bkup_NTBackupFile_Type, py_data, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_data)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.data = *(struct bkup_NTBackupFile *)pytalloc_get_ptr(py_data);
+	return true;
+}
+
+static PyObject *unpack_py_decode_frsrpc_StageHeader_args_out(struct decode_frsrpc_StageHeader *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	return result;
+}
+
+static bool pack_py_decode_FileNetworkOpenInformation_args_in(PyObject *args, PyObject *kwargs, struct decode_FileNetworkOpenInformation *r)
+{
+	PyObject *py_data;
+	const char *kwnames[] = {
+		"data", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:decode_FileNetworkOpenInformation", discard_const_p(char *, kwnames), &py_data)) {
+		return false;
+	}
+
+	if (py_data == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.data");
+		return false;
+	}
+	PY_CHECK_TYPE(fscc_FileNetworkOpenInformation_Type, py_data, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_data)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.data = *(struct fscc_FileNetworkOpenInformation *)pytalloc_get_ptr(py_data);
+	return true;
+}
+
+static PyObject *unpack_py_decode_FileNetworkOpenInformation_args_out(struct decode_FileNetworkOpenInformation *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_frsblobs_methods[] = {
+	{ "decode_nt_backup_file", "S.decode_nt_backup_file(file) -> None", (py_dcerpc_call_fn)dcerpc_decode_nt_backup_file_r, (py_data_pack_fn)pack_py_decode_nt_backup_file_args_in, (py_data_unpack_fn)unpack_py_decode_nt_backup_file_args_out, 0, &ndr_table_frsblobs },
+	{ "decode_frsrpc_StageHeader", "S.decode_frsrpc_StageHeader(header, data) -> None", (py_dcerpc_call_fn)dcerpc_decode_frsrpc_StageHeader_r, (py_data_pack_fn)pack_py_decode_frsrpc_StageHeader_args_in, (py_data_unpack_fn)unpack_py_decode_frsrpc_StageHeader_args_out, 1, &ndr_table_frsblobs },
+	{ "decode_FileNetworkOpenInformation", "S.decode_FileNetworkOpenInformation(data) -> None", (py_dcerpc_call_fn)dcerpc_decode_FileNetworkOpenInformation_r, (py_data_pack_fn)pack_py_decode_FileNetworkOpenInformation_args_in, (py_data_unpack_fn)unpack_py_decode_FileNetworkOpenInformation_args_out, 2, &ndr_table_frsblobs },
+	{ NULL }
+};
+
+static PyObject *interface_frsblobs_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_frsblobs);
+}
+
+#define PY_DOC_FRSBLOBS "bkup blobs"
+static PyTypeObject frsblobs_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsblobs.frsblobs",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "frsblobs(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_FRSBLOBS,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_frsblobs_new,
+};
+
+static PyObject *syntax_frsblobs_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_frsblobs.syntax_id);
+}
+
+#define PY_DOC_FRSBLOBS_SYNTAX "bkup blobs"
+static PyTypeObject frsblobs_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsblobs.frsblobs",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_FRSBLOBS_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_frsblobs_new,
+};
+
+static PyMethodDef frsblobs_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initfrsblobs(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_misc;
+	PyObject *dep_samba_dcerpc_security;
+	PyObject *dep_samba_dcerpc_frsrpc;
+	PyObject *dep_samba_dcerpc_bkupblobs;
+	PyObject *dep_samba_dcerpc_fscc;
+	PyObject *dep_samba_dcerpc_base;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	dep_samba_dcerpc_security = PyImport_ImportModule("samba.dcerpc.security");
+	if (dep_samba_dcerpc_security == NULL)
+		return;
+
+	dep_samba_dcerpc_frsrpc = PyImport_ImportModule("samba.dcerpc.frsrpc");
+	if (dep_samba_dcerpc_frsrpc == NULL)
+		return;
+
+	dep_samba_dcerpc_bkupblobs = PyImport_ImportModule("samba.dcerpc.bkupblobs");
+	if (dep_samba_dcerpc_bkupblobs == NULL)
+		return;
+
+	dep_samba_dcerpc_fscc = PyImport_ImportModule("samba.dcerpc.fscc");
+	if (dep_samba_dcerpc_fscc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	bkup_NTBackupFile_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_bkupblobs, "bkup_NTBackupFile");
+	if (bkup_NTBackupFile_Type == NULL)
+		return;
+
+	frsrpc_StageHeader_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_frsrpc, "StageHeader");
+	if (frsrpc_StageHeader_Type == NULL)
+		return;
+
+	fscc_FileNetworkOpenInformation_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_fscc, "FileNetworkOpenInformation");
+	if (fscc_FileNetworkOpenInformation_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	frsblobs_InterfaceType.tp_base = ClientConnection_Type;
+
+	frsblobs_SyntaxType.tp_base = ndr_syntax_id_Type;
+	frsblobs_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&frsblobs_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&frsblobs_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&frsblobs_InterfaceType, py_ndr_frsblobs_methods))
+		return;
+
+#ifdef PY_FRSBLOBS_PATCH
+	PY_FRSBLOBS_PATCH(&frsblobs_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&frsblobs_SyntaxType);
+#endif
+
+	m = Py_InitModule3("frsblobs", frsblobs_methods, "frsblobs DCE/RPC");
+	if (m == NULL)
+		return;
+
+	Py_INCREF((PyObject *)(void *)&frsblobs_InterfaceType);
+	PyModule_AddObject(m, "frsblobs", (PyObject *)(void *)&frsblobs_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&frsblobs_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&frsblobs_SyntaxType);
+#ifdef PY_MOD_FRSBLOBS_PATCH
+	PY_MOD_FRSBLOBS_PATCH(m);
+#endif
+
+}
@@ -0,0 +1,7177 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_frsrpc.h"
+#include "bin/default/librpc/gen_ndr/ndr_frsrpc_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/misc.h"
+#include "librpc/gen_ndr/fscc.h"
+#include "librpc/gen_ndr/bkupblobs.h"
+static PyTypeObject frsrpc_CommPktChunkGuidName_Type;
+static PyTypeObject frsrpc_CommPktGSVN_Type;
+static PyTypeObject frsrpc_CommPktChangeOrderCommand_Type;
+static PyTypeObject frsrpc_CommPktDataExtensionChecksum_Type;
+static PyTypeObject frsrpc_CommPktDataExtensionRetryTimeout_Type;
+static PyTypeObject frsrpc_CommPktCoRecordExtensionWin2k_Type;
+static PyTypeObject frsrpc_CommPktChangeOrderRecordExtension_Type;
+PyObject *py_import_frsrpc_CommPktChunkData(TALLOC_CTX *mem_ctx, int level, union frsrpc_CommPktChunkData *in);
+union frsrpc_CommPktChunkData *py_export_frsrpc_CommPktChunkData(TALLOC_CTX *mem_ctx, int level, PyObject *in);
+static PyTypeObject frsrpc_CommPktChunk_Type;
+static PyTypeObject frsrpc_CommPktChunkCtr_Type;
+static PyTypeObject frsrpc_FrsSendCommPktReq_Type;
+static PyTypeObject frsrpc_StageHeader_Type;
+static PyTypeObject frsrpc_InterfaceType;
+
+void initfrsrpc(void);static PyTypeObject *GUID_Type;
+static PyTypeObject *BaseObject_Type;
+static PyTypeObject *fscc_FileNetworkOpenInformation_Type;
+static PyTypeObject *fscc_FileObjectIdBuffer_2_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static PyObject *py_frsrpc_CommPktChunkGuidName_get_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChunkGuidName *object = (struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(obj);
+	PyObject *py_guid;
+	py_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->guid);
+	return py_guid;
+}
+
+static int py_frsrpc_CommPktChunkGuidName_set_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChunkGuidName *object = (struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->guid");
+		return -1;
+	}
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChunkGuidName_get_name(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChunkGuidName *object = (struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(obj);
+	PyObject *py_name;
+	py_name = PyString_FromStringOrNULL(object->name);
+	return py_name;
+}
+
+static int py_frsrpc_CommPktChunkGuidName_set_name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChunkGuidName *object = (struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->name");
+		return -1;
+	}
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->name");
+		return -1;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(value)) {
+			unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(value)) {
+			test_str = PyString_AS_STRING(value);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+			return -1;
+		}
+		talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->name = talloc_str;
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktChunkGuidName_getsetters[] = {
+	{
+		.name = discard_const_p(char, "guid"),
+		.get = py_frsrpc_CommPktChunkGuidName_get_guid,
+		.set = py_frsrpc_CommPktChunkGuidName_set_guid,
+		.doc = discard_const_p(char, "PIDL-generated element guid")
+	},
+	{
+		.name = discard_const_p(char, "name"),
+		.get = py_frsrpc_CommPktChunkGuidName_get_name,
+		.set = py_frsrpc_CommPktChunkGuidName_set_name,
+		.doc = discard_const_p(char, "PIDL-generated element name")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktChunkGuidName_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktChunkGuidName, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktChunkGuidName_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktChunkGuidName",
+	.tp_getset = py_frsrpc_CommPktChunkGuidName_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktChunkGuidName_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktGSVN_get_vsn(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktGSVN *object = (struct frsrpc_CommPktGSVN *)pytalloc_get_ptr(obj);
+	PyObject *py_vsn;
+	py_vsn = ndr_PyLong_FromUnsignedLongLong(object->vsn);
+	return py_vsn;
+}
+
+static int py_frsrpc_CommPktGSVN_set_vsn(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktGSVN *object = (struct frsrpc_CommPktGSVN *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->vsn");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->vsn));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->vsn = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->vsn = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktGSVN_get_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktGSVN *object = (struct frsrpc_CommPktGSVN *)pytalloc_get_ptr(obj);
+	PyObject *py_guid;
+	py_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->guid);
+	return py_guid;
+}
+
+static int py_frsrpc_CommPktGSVN_set_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktGSVN *object = (struct frsrpc_CommPktGSVN *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktGSVN_getsetters[] = {
+	{
+		.name = discard_const_p(char, "vsn"),
+		.get = py_frsrpc_CommPktGSVN_get_vsn,
+		.set = py_frsrpc_CommPktGSVN_set_vsn,
+		.doc = discard_const_p(char, "PIDL-generated element vsn")
+	},
+	{
+		.name = discard_const_p(char, "guid"),
+		.get = py_frsrpc_CommPktGSVN_get_guid,
+		.set = py_frsrpc_CommPktGSVN_set_guid,
+		.doc = discard_const_p(char, "PIDL-generated element guid")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktGSVN_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktGSVN, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktGSVN_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktGSVN",
+	.tp_getset = py_frsrpc_CommPktGSVN_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktGSVN_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_sequence_number(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_sequence_number;
+	py_sequence_number = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->sequence_number);
+	return py_sequence_number;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_sequence_number(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->sequence_number");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->sequence_number));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->sequence_number = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->sequence_number = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_flags(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_flags;
+	py_flags = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->flags);
+	return py_flags;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_flags(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->flags");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->flags));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->flags = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->flags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_iflags(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_iflags;
+	py_iflags = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->iflags);
+	return py_iflags;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_iflags(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->iflags");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->iflags));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->iflags = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->iflags = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_status(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_status;
+	py_status = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->status);
+	return py_status;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_status(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->status");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->status));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->status = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->status = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_content_cmd(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_content_cmd;
+	py_content_cmd = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->content_cmd);
+	return py_content_cmd;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_content_cmd(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->content_cmd");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->content_cmd));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->content_cmd = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->content_cmd = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_location_cmd(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_location_cmd;
+	py_location_cmd = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->location_cmd);
+	return py_location_cmd;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_location_cmd(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->location_cmd");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->location_cmd));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->location_cmd = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->location_cmd = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_attributes(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_attributes;
+	py_file_attributes = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->file_attributes);
+	return py_file_attributes;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_attributes(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_attributes");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->file_attributes));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_attributes = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_attributes = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_version_number(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_version_number;
+	py_file_version_number = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->file_version_number);
+	return py_file_version_number;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_version_number(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_version_number");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->file_version_number));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_version_number = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_version_number = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_partern_ack_sequence_number(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_partern_ack_sequence_number;
+	py_partern_ack_sequence_number = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->partern_ack_sequence_number);
+	return py_partern_ack_sequence_number;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_partern_ack_sequence_number(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->partern_ack_sequence_number");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->partern_ack_sequence_number));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->partern_ack_sequence_number = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->partern_ack_sequence_number = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_not_used(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_not_used;
+	py_not_used = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->not_used);
+	return py_not_used;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_not_used(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->not_used");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->not_used));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->not_used = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->not_used = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_size(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_size;
+	py_file_size = ndr_PyLong_FromUnsignedLongLong(object->file_size);
+	return py_file_size;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->file_size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_offset(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_offset;
+	py_file_offset = ndr_PyLong_FromUnsignedLongLong(object->file_offset);
+	return py_file_offset;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_offset(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_offset");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->file_offset));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_offset = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_offset = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_frs_vsn(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_frs_vsn;
+	py_frs_vsn = ndr_PyLong_FromUnsignedLongLong(object->frs_vsn);
+	return py_frs_vsn;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_frs_vsn(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->frs_vsn");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->frs_vsn));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->frs_vsn = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->frs_vsn = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_usn(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_usn;
+	py_file_usn = ndr_PyLong_FromUnsignedLongLong(object->file_usn);
+	return py_file_usn;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_usn(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_usn");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->file_usn));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_usn = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_usn = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_jrnl_usn(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_jrnl_usn;
+	py_jrnl_usn = ndr_PyLong_FromUnsignedLongLong(object->jrnl_usn);
+	return py_jrnl_usn;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_jrnl_usn(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->jrnl_usn");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->jrnl_usn));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->jrnl_usn = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->jrnl_usn = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_jrnl_first_usn(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_jrnl_first_usn;
+	py_jrnl_first_usn = ndr_PyLong_FromUnsignedLongLong(object->jrnl_first_usn);
+	return py_jrnl_first_usn;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_jrnl_first_usn(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->jrnl_first_usn");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->jrnl_first_usn));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->jrnl_first_usn = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->jrnl_first_usn = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_original_replica_num(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_original_replica_num;
+	py_original_replica_num = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->original_replica_num);
+	return py_original_replica_num;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_original_replica_num(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->original_replica_num");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->original_replica_num));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->original_replica_num = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->original_replica_num = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_new_replica_num(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_new_replica_num;
+	py_new_replica_num = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->new_replica_num);
+	return py_new_replica_num;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_new_replica_num(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->new_replica_num");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->new_replica_num));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->new_replica_num = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->new_replica_num = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_change_order_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_change_order_guid;
+	py_change_order_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->change_order_guid);
+	return py_change_order_guid;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_change_order_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->change_order_guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->change_order_guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_originator_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_originator_guid;
+	py_originator_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->originator_guid);
+	return py_originator_guid;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_originator_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->originator_guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->originator_guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_guid;
+	py_file_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->file_guid);
+	return py_file_guid;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->file_guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_old_parent_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_old_parent_guid;
+	py_old_parent_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->old_parent_guid);
+	return py_old_parent_guid;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_old_parent_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->old_parent_guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->old_parent_guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_new_parent_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_new_parent_guid;
+	py_new_parent_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->new_parent_guid);
+	return py_new_parent_guid;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_new_parent_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->new_parent_guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->new_parent_guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_connection_guid(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_connection_guid;
+	py_connection_guid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->connection_guid);
+	return py_connection_guid;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_connection_guid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->connection_guid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->connection_guid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_ack_version(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_ack_version;
+	py_ack_version = ndr_PyLong_FromUnsignedLongLong(object->ack_version);
+	return py_ack_version;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_ack_version(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ack_version");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->ack_version));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->ack_version = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->ack_version = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare2ul1(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare2ul1;
+	py_spare2ul1 = ndr_PyLong_FromUnsignedLongLong(object->spare2ul1);
+	return py_spare2ul1;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare2ul1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare2ul1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare2ul1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2ul1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2ul1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare1guid_p1(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare1guid_p1;
+	py_spare1guid_p1 = ndr_PyLong_FromUnsignedLongLong(object->spare1guid_p1);
+	return py_spare1guid_p1;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare1guid_p1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare1guid_p1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare1guid_p1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare1guid_p1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare1guid_p1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare1guid_p2(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare1guid_p2;
+	py_spare1guid_p2 = ndr_PyLong_FromUnsignedLongLong(object->spare1guid_p2);
+	return py_spare1guid_p2;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare1guid_p2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare1guid_p2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare1guid_p2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare1guid_p2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare1guid_p2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare2guid_p1(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare2guid_p1;
+	py_spare2guid_p1 = ndr_PyLong_FromUnsignedLongLong(object->spare2guid_p1);
+	return py_spare2guid_p1;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare2guid_p1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare2guid_p1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare2guid_p1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2guid_p1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2guid_p1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare3guid_p2(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare3guid_p2;
+	py_spare3guid_p2 = ndr_PyLong_FromUnsignedLongLong(object->spare3guid_p2);
+	return py_spare3guid_p2;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare3guid_p2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare3guid_p2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare3guid_p2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare3guid_p2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare3guid_p2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare1wcs(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare1wcs;
+	py_spare1wcs = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->spare1wcs);
+	return py_spare1wcs;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare1wcs(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare1wcs");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare1wcs));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare1wcs = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare1wcs = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare2wcs(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare2wcs;
+	py_spare2wcs = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->spare2wcs);
+	return py_spare2wcs;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare2wcs(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare2wcs");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare2wcs));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2wcs = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2wcs = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_extension(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_extension;
+	py_extension = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->extension);
+	return py_extension;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_extension(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->extension");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->extension));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->extension = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->extension = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_spare2bin(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_spare2bin;
+	py_spare2bin = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->spare2bin);
+	return py_spare2bin;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_spare2bin(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->spare2bin");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->spare2bin));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2bin = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->spare2bin = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_event_time(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_event_time;
+	py_event_time = ndr_PyLong_FromUnsignedLongLong(object->event_time);
+	return py_event_time;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_event_time(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->event_time");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->event_time));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->event_time = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->event_time = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_name_length(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_name_length;
+	py_file_name_length = PyInt_FromLong((uint16_t)object->file_name_length);
+	return py_file_name_length;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_name_length(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_name_length");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->file_name_length));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_name_length = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->file_name_length = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_file_name(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_file_name;
+	if (object->file_name == NULL) {
+		py_file_name = Py_None;
+		Py_INCREF(py_file_name);
+	} else {
+		py_file_name = PyUnicode_Decode(object->file_name, strlen(object->file_name), "utf-8", "ignore");
+	}
+	return py_file_name;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_file_name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->file_name");
+		return -1;
+	}
+	{
+		const char *test_str;
+		const char *talloc_str;
+		PyObject *unicode = NULL;
+		if (PyUnicode_Check(value)) {
+			unicode = PyUnicode_AsEncodedString(value, "utf-8", "ignore");
+			if (unicode == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			test_str = PyString_AS_STRING(unicode);
+		} else if (PyString_Check(value)) {
+			test_str = PyString_AS_STRING(value);
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(value)->tp_name);
+			return -1;
+		}
+		talloc_str = talloc_strdup(pytalloc_get_mem_ctx(py_obj), test_str);
+		if (unicode != NULL) {
+			Py_DECREF(unicode);
+		}
+		if (talloc_str == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->file_name = talloc_str;
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_padding1(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_padding1;
+	py_padding1 = PyInt_FromLong((uint16_t)object->padding1);
+	return py_padding1;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_padding1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->padding1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->padding1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_padding2(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_padding2;
+	py_padding2 = PyInt_FromLong((uint16_t)object->padding2);
+	return py_padding2;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_padding2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->padding2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->padding2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_padding3(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_padding3;
+	py_padding3 = PyInt_FromLong((uint16_t)object->padding3);
+	return py_padding3;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_padding3(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->padding3");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->padding3));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding3 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding3 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_get_padding4(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(obj);
+	PyObject *py_padding4;
+	py_padding4 = PyInt_FromLong((uint16_t)object->padding4);
+	return py_padding4;
+}
+
+static int py_frsrpc_CommPktChangeOrderCommand_set_padding4(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderCommand *object = (struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->padding4");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->padding4));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding4 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding4 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktChangeOrderCommand_getsetters[] = {
+	{
+		.name = discard_const_p(char, "sequence_number"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_sequence_number,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_sequence_number,
+		.doc = discard_const_p(char, "PIDL-generated element sequence_number")
+	},
+	{
+		.name = discard_const_p(char, "flags"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_flags,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_flags,
+		.doc = discard_const_p(char, "PIDL-generated element flags")
+	},
+	{
+		.name = discard_const_p(char, "iflags"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_iflags,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_iflags,
+		.doc = discard_const_p(char, "PIDL-generated element iflags")
+	},
+	{
+		.name = discard_const_p(char, "status"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_status,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_status,
+		.doc = discard_const_p(char, "PIDL-generated element status")
+	},
+	{
+		.name = discard_const_p(char, "content_cmd"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_content_cmd,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_content_cmd,
+		.doc = discard_const_p(char, "PIDL-generated element content_cmd")
+	},
+	{
+		.name = discard_const_p(char, "location_cmd"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_location_cmd,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_location_cmd,
+		.doc = discard_const_p(char, "PIDL-generated element location_cmd")
+	},
+	{
+		.name = discard_const_p(char, "file_attributes"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_attributes,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_attributes,
+		.doc = discard_const_p(char, "PIDL-generated element file_attributes")
+	},
+	{
+		.name = discard_const_p(char, "file_version_number"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_version_number,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_version_number,
+		.doc = discard_const_p(char, "PIDL-generated element file_version_number")
+	},
+	{
+		.name = discard_const_p(char, "partern_ack_sequence_number"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_partern_ack_sequence_number,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_partern_ack_sequence_number,
+		.doc = discard_const_p(char, "PIDL-generated element partern_ack_sequence_number")
+	},
+	{
+		.name = discard_const_p(char, "not_used"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_not_used,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_not_used,
+		.doc = discard_const_p(char, "PIDL-generated element not_used")
+	},
+	{
+		.name = discard_const_p(char, "file_size"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_size,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_size,
+		.doc = discard_const_p(char, "PIDL-generated element file_size")
+	},
+	{
+		.name = discard_const_p(char, "file_offset"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_offset,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_offset,
+		.doc = discard_const_p(char, "PIDL-generated element file_offset")
+	},
+	{
+		.name = discard_const_p(char, "frs_vsn"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_frs_vsn,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_frs_vsn,
+		.doc = discard_const_p(char, "PIDL-generated element frs_vsn")
+	},
+	{
+		.name = discard_const_p(char, "file_usn"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_usn,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_usn,
+		.doc = discard_const_p(char, "PIDL-generated element file_usn")
+	},
+	{
+		.name = discard_const_p(char, "jrnl_usn"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_jrnl_usn,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_jrnl_usn,
+		.doc = discard_const_p(char, "PIDL-generated element jrnl_usn")
+	},
+	{
+		.name = discard_const_p(char, "jrnl_first_usn"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_jrnl_first_usn,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_jrnl_first_usn,
+		.doc = discard_const_p(char, "PIDL-generated element jrnl_first_usn")
+	},
+	{
+		.name = discard_const_p(char, "original_replica_num"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_original_replica_num,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_original_replica_num,
+		.doc = discard_const_p(char, "PIDL-generated element original_replica_num")
+	},
+	{
+		.name = discard_const_p(char, "new_replica_num"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_new_replica_num,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_new_replica_num,
+		.doc = discard_const_p(char, "PIDL-generated element new_replica_num")
+	},
+	{
+		.name = discard_const_p(char, "change_order_guid"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_change_order_guid,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_change_order_guid,
+		.doc = discard_const_p(char, "PIDL-generated element change_order_guid")
+	},
+	{
+		.name = discard_const_p(char, "originator_guid"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_originator_guid,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_originator_guid,
+		.doc = discard_const_p(char, "PIDL-generated element originator_guid")
+	},
+	{
+		.name = discard_const_p(char, "file_guid"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_guid,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_guid,
+		.doc = discard_const_p(char, "PIDL-generated element file_guid")
+	},
+	{
+		.name = discard_const_p(char, "old_parent_guid"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_old_parent_guid,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_old_parent_guid,
+		.doc = discard_const_p(char, "PIDL-generated element old_parent_guid")
+	},
+	{
+		.name = discard_const_p(char, "new_parent_guid"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_new_parent_guid,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_new_parent_guid,
+		.doc = discard_const_p(char, "PIDL-generated element new_parent_guid")
+	},
+	{
+		.name = discard_const_p(char, "connection_guid"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_connection_guid,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_connection_guid,
+		.doc = discard_const_p(char, "PIDL-generated element connection_guid")
+	},
+	{
+		.name = discard_const_p(char, "ack_version"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_ack_version,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_ack_version,
+		.doc = discard_const_p(char, "PIDL-generated element ack_version")
+	},
+	{
+		.name = discard_const_p(char, "spare2ul1"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare2ul1,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare2ul1,
+		.doc = discard_const_p(char, "PIDL-generated element spare2ul1")
+	},
+	{
+		.name = discard_const_p(char, "spare1guid_p1"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare1guid_p1,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare1guid_p1,
+		.doc = discard_const_p(char, "PIDL-generated element spare1guid_p1")
+	},
+	{
+		.name = discard_const_p(char, "spare1guid_p2"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare1guid_p2,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare1guid_p2,
+		.doc = discard_const_p(char, "PIDL-generated element spare1guid_p2")
+	},
+	{
+		.name = discard_const_p(char, "spare2guid_p1"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare2guid_p1,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare2guid_p1,
+		.doc = discard_const_p(char, "PIDL-generated element spare2guid_p1")
+	},
+	{
+		.name = discard_const_p(char, "spare3guid_p2"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare3guid_p2,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare3guid_p2,
+		.doc = discard_const_p(char, "PIDL-generated element spare3guid_p2")
+	},
+	{
+		.name = discard_const_p(char, "spare1wcs"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare1wcs,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare1wcs,
+		.doc = discard_const_p(char, "PIDL-generated element spare1wcs")
+	},
+	{
+		.name = discard_const_p(char, "spare2wcs"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare2wcs,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare2wcs,
+		.doc = discard_const_p(char, "PIDL-generated element spare2wcs")
+	},
+	{
+		.name = discard_const_p(char, "extension"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_extension,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_extension,
+		.doc = discard_const_p(char, "PIDL-generated element extension")
+	},
+	{
+		.name = discard_const_p(char, "spare2bin"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_spare2bin,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_spare2bin,
+		.doc = discard_const_p(char, "PIDL-generated element spare2bin")
+	},
+	{
+		.name = discard_const_p(char, "event_time"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_event_time,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_event_time,
+		.doc = discard_const_p(char, "PIDL-generated element event_time")
+	},
+	{
+		.name = discard_const_p(char, "file_name_length"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_name_length,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_name_length,
+		.doc = discard_const_p(char, "PIDL-generated element file_name_length")
+	},
+	{
+		.name = discard_const_p(char, "file_name"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_file_name,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_file_name,
+		.doc = discard_const_p(char, "PIDL-generated element file_name")
+	},
+	{
+		.name = discard_const_p(char, "padding1"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_padding1,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_padding1,
+		.doc = discard_const_p(char, "PIDL-generated element padding1")
+	},
+	{
+		.name = discard_const_p(char, "padding2"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_padding2,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_padding2,
+		.doc = discard_const_p(char, "PIDL-generated element padding2")
+	},
+	{
+		.name = discard_const_p(char, "padding3"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_padding3,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_padding3,
+		.doc = discard_const_p(char, "PIDL-generated element padding3")
+	},
+	{
+		.name = discard_const_p(char, "padding4"),
+		.get = py_frsrpc_CommPktChangeOrderCommand_get_padding4,
+		.set = py_frsrpc_CommPktChangeOrderCommand_set_padding4,
+		.doc = discard_const_p(char, "PIDL-generated element padding4")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktChangeOrderCommand_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktChangeOrderCommand, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktChangeOrderCommand_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktChangeOrderCommand",
+	.tp_getset = py_frsrpc_CommPktChangeOrderCommand_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktChangeOrderCommand_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktDataExtensionChecksum_get_prefix_size(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionChecksum *object = (struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(obj);
+	PyObject *py_prefix_size;
+	py_prefix_size = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->prefix_size);
+	return py_prefix_size;
+}
+
+static int py_frsrpc_CommPktDataExtensionChecksum_set_prefix_size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionChecksum *object = (struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->prefix_size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->prefix_size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktDataExtensionChecksum_get_prefix_type(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionChecksum *object = (struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(obj);
+	PyObject *py_prefix_type;
+	py_prefix_type = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->prefix_type);
+	return py_prefix_type;
+}
+
+static int py_frsrpc_CommPktDataExtensionChecksum_set_prefix_type(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionChecksum *object = (struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->prefix_type");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->prefix_type));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_type = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_type = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktDataExtensionChecksum_get_data(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionChecksum *object = (struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(obj);
+	PyObject *py_data;
+	py_data = PyList_New(16);
+	if (py_data == NULL) {
+		return NULL;
+	}
+	{
+		int data_cntr_0;
+		for (data_cntr_0 = 0; data_cntr_0 < (16); data_cntr_0++) {
+			PyObject *py_data_0;
+			py_data_0 = PyInt_FromLong((uint16_t)object->data[data_cntr_0]);
+			PyList_SetItem(py_data, data_cntr_0, py_data_0);
+		}
+	}
+	return py_data;
+}
+
+static int py_frsrpc_CommPktDataExtensionChecksum_set_data(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionChecksum *object = (struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int data_cntr_0;
+		if (ARRAY_SIZE(object->data) != PyList_GET_SIZE(value)) {
+			PyErr_Format(PyExc_TypeError, "Expected list of type %s, length %zu, got %zd", Py_TYPE(value)->tp_name, ARRAY_SIZE(object->data),  PyList_GET_SIZE(value));
+			return -1;
+		}
+		for (data_cntr_0 = 0; data_cntr_0 < PyList_GET_SIZE(value); data_cntr_0++) {
+			if (PyList_GET_ITEM(value, data_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data[data_cntr_0]");
+				return -1;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->data[data_cntr_0]));
+				if (PyLong_Check(PyList_GET_ITEM(value, data_cntr_0))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, data_cntr_0));
+					if (PyErr_Occurred() != NULL) {
+						return -1;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->data[data_cntr_0] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(value, data_cntr_0))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(value, data_cntr_0));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->data[data_cntr_0] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return -1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktDataExtensionChecksum_getsetters[] = {
+	{
+		.name = discard_const_p(char, "prefix_size"),
+		.get = py_frsrpc_CommPktDataExtensionChecksum_get_prefix_size,
+		.set = py_frsrpc_CommPktDataExtensionChecksum_set_prefix_size,
+		.doc = discard_const_p(char, "PIDL-generated element prefix_size")
+	},
+	{
+		.name = discard_const_p(char, "prefix_type"),
+		.get = py_frsrpc_CommPktDataExtensionChecksum_get_prefix_type,
+		.set = py_frsrpc_CommPktDataExtensionChecksum_set_prefix_type,
+		.doc = discard_const_p(char, "PIDL-generated element prefix_type")
+	},
+	{
+		.name = discard_const_p(char, "data"),
+		.get = py_frsrpc_CommPktDataExtensionChecksum_get_data,
+		.set = py_frsrpc_CommPktDataExtensionChecksum_set_data,
+		.doc = discard_const_p(char, "PIDL-generated element data")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktDataExtensionChecksum_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktDataExtensionChecksum, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktDataExtensionChecksum_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktDataExtensionChecksum",
+	.tp_getset = py_frsrpc_CommPktDataExtensionChecksum_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktDataExtensionChecksum_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktDataExtensionRetryTimeout_get_prefix_size(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(obj);
+	PyObject *py_prefix_size;
+	py_prefix_size = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->prefix_size);
+	return py_prefix_size;
+}
+
+static int py_frsrpc_CommPktDataExtensionRetryTimeout_set_prefix_size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->prefix_size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->prefix_size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktDataExtensionRetryTimeout_get_prefix_type(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(obj);
+	PyObject *py_prefix_type;
+	py_prefix_type = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->prefix_type);
+	return py_prefix_type;
+}
+
+static int py_frsrpc_CommPktDataExtensionRetryTimeout_set_prefix_type(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->prefix_type");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->prefix_type));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_type = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->prefix_type = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktDataExtensionRetryTimeout_get_count(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(obj);
+	PyObject *py_count;
+	py_count = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->count);
+	return py_count;
+}
+
+static int py_frsrpc_CommPktDataExtensionRetryTimeout_set_count(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->count");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->count));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->count = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->count = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktDataExtensionRetryTimeout_get_not_used(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(obj);
+	PyObject *py_not_used;
+	py_not_used = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->not_used);
+	return py_not_used;
+}
+
+static int py_frsrpc_CommPktDataExtensionRetryTimeout_set_not_used(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->not_used");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->not_used));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->not_used = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->not_used = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktDataExtensionRetryTimeout_get_first_try_time(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(obj);
+	PyObject *py_first_try_time;
+	py_first_try_time = ndr_PyLong_FromUnsignedLongLong(object->first_try_time);
+	return py_first_try_time;
+}
+
+static int py_frsrpc_CommPktDataExtensionRetryTimeout_set_first_try_time(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktDataExtensionRetryTimeout *object = (struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->first_try_time");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->first_try_time));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->first_try_time = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->first_try_time = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktDataExtensionRetryTimeout_getsetters[] = {
+	{
+		.name = discard_const_p(char, "prefix_size"),
+		.get = py_frsrpc_CommPktDataExtensionRetryTimeout_get_prefix_size,
+		.set = py_frsrpc_CommPktDataExtensionRetryTimeout_set_prefix_size,
+		.doc = discard_const_p(char, "PIDL-generated element prefix_size")
+	},
+	{
+		.name = discard_const_p(char, "prefix_type"),
+		.get = py_frsrpc_CommPktDataExtensionRetryTimeout_get_prefix_type,
+		.set = py_frsrpc_CommPktDataExtensionRetryTimeout_set_prefix_type,
+		.doc = discard_const_p(char, "PIDL-generated element prefix_type")
+	},
+	{
+		.name = discard_const_p(char, "count"),
+		.get = py_frsrpc_CommPktDataExtensionRetryTimeout_get_count,
+		.set = py_frsrpc_CommPktDataExtensionRetryTimeout_set_count,
+		.doc = discard_const_p(char, "PIDL-generated element count")
+	},
+	{
+		.name = discard_const_p(char, "not_used"),
+		.get = py_frsrpc_CommPktDataExtensionRetryTimeout_get_not_used,
+		.set = py_frsrpc_CommPktDataExtensionRetryTimeout_set_not_used,
+		.doc = discard_const_p(char, "PIDL-generated element not_used")
+	},
+	{
+		.name = discard_const_p(char, "first_try_time"),
+		.get = py_frsrpc_CommPktDataExtensionRetryTimeout_get_first_try_time,
+		.set = py_frsrpc_CommPktDataExtensionRetryTimeout_set_first_try_time,
+		.doc = discard_const_p(char, "PIDL-generated element first_try_time")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktDataExtensionRetryTimeout_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktDataExtensionRetryTimeout, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktDataExtensionRetryTimeout_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktDataExtensionRetryTimeout",
+	.tp_getset = py_frsrpc_CommPktDataExtensionRetryTimeout_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktDataExtensionRetryTimeout_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_get_field_size(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(obj);
+	PyObject *py_field_size;
+	py_field_size = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->field_size);
+	return py_field_size;
+}
+
+static int py_frsrpc_CommPktCoRecordExtensionWin2k_set_field_size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->field_size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->field_size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->field_size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->field_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_get_major(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(obj);
+	PyObject *py_major;
+	py_major = PyInt_FromLong((uint16_t)object->major);
+	return py_major;
+}
+
+static int py_frsrpc_CommPktCoRecordExtensionWin2k_set_major(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->major");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->major));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_get_offset_count(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(obj);
+	PyObject *py_offset_count;
+	py_offset_count = PyInt_FromLong((uint16_t)object->offset_count);
+	return py_offset_count;
+}
+
+static int py_frsrpc_CommPktCoRecordExtensionWin2k_set_offset_count(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset_count");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset_count));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_count = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_count = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_get_offset(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(obj);
+	PyObject *py_offset;
+	py_offset = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->offset);
+	return py_offset;
+}
+
+static int py_frsrpc_CommPktCoRecordExtensionWin2k_set_offset(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_get_offset_last(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(obj);
+	PyObject *py_offset_last;
+	py_offset_last = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->offset_last);
+	return py_offset_last;
+}
+
+static int py_frsrpc_CommPktCoRecordExtensionWin2k_set_offset_last(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset_last");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset_last));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_last = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_last = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_get_data_checksum(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(obj);
+	PyObject *py_data_checksum;
+	py_data_checksum = pytalloc_reference_ex(&frsrpc_CommPktDataExtensionChecksum_Type, pytalloc_get_mem_ctx(obj), &object->data_checksum);
+	return py_data_checksum;
+}
+
+static int py_frsrpc_CommPktCoRecordExtensionWin2k_set_data_checksum(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktCoRecordExtensionWin2k *object = (struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data_checksum");
+		return -1;
+	}
+	PY_CHECK_TYPE(&frsrpc_CommPktDataExtensionChecksum_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->data_checksum = *(struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktCoRecordExtensionWin2k_getsetters[] = {
+	{
+		.name = discard_const_p(char, "field_size"),
+		.get = py_frsrpc_CommPktCoRecordExtensionWin2k_get_field_size,
+		.set = py_frsrpc_CommPktCoRecordExtensionWin2k_set_field_size,
+		.doc = discard_const_p(char, "PIDL-generated element field_size")
+	},
+	{
+		.name = discard_const_p(char, "major"),
+		.get = py_frsrpc_CommPktCoRecordExtensionWin2k_get_major,
+		.set = py_frsrpc_CommPktCoRecordExtensionWin2k_set_major,
+		.doc = discard_const_p(char, "PIDL-generated element major")
+	},
+	{
+		.name = discard_const_p(char, "offset_count"),
+		.get = py_frsrpc_CommPktCoRecordExtensionWin2k_get_offset_count,
+		.set = py_frsrpc_CommPktCoRecordExtensionWin2k_set_offset_count,
+		.doc = discard_const_p(char, "PIDL-generated element offset_count")
+	},
+	{
+		.name = discard_const_p(char, "offset"),
+		.get = py_frsrpc_CommPktCoRecordExtensionWin2k_get_offset,
+		.set = py_frsrpc_CommPktCoRecordExtensionWin2k_set_offset,
+		.doc = discard_const_p(char, "PIDL-generated element offset")
+	},
+	{
+		.name = discard_const_p(char, "offset_last"),
+		.get = py_frsrpc_CommPktCoRecordExtensionWin2k_get_offset_last,
+		.set = py_frsrpc_CommPktCoRecordExtensionWin2k_set_offset_last,
+		.doc = discard_const_p(char, "PIDL-generated element offset_last")
+	},
+	{
+		.name = discard_const_p(char, "data_checksum"),
+		.get = py_frsrpc_CommPktCoRecordExtensionWin2k_get_data_checksum,
+		.set = py_frsrpc_CommPktCoRecordExtensionWin2k_set_data_checksum,
+		.doc = discard_const_p(char, "PIDL-generated element data_checksum")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktCoRecordExtensionWin2k_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktCoRecordExtensionWin2k, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktCoRecordExtensionWin2k_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktCoRecordExtensionWin2k",
+	.tp_getset = py_frsrpc_CommPktCoRecordExtensionWin2k_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktCoRecordExtensionWin2k_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_field_size(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_field_size;
+	py_field_size = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->field_size);
+	return py_field_size;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_field_size(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->field_size");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->field_size));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->field_size = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->field_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_major(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_major;
+	py_major = PyInt_FromLong((uint16_t)object->major);
+	return py_major;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_major(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->major");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->major));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_offset_count(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_offset_count;
+	py_offset_count = PyInt_FromLong((uint16_t)object->offset_count);
+	return py_offset_count;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_offset_count(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset_count");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset_count));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_count = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_count = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_offset0(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_offset0;
+	py_offset0 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->offset0);
+	return py_offset0;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_offset0(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset0");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset0));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset0 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset0 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_offset1(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_offset1;
+	py_offset1 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->offset1);
+	return py_offset1;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_offset1(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset1");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset1));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset1 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset1 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_offset_last(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_offset_last;
+	py_offset_last = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->offset_last);
+	return py_offset_last;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_offset_last(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->offset_last");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->offset_last));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_last = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->offset_last = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_not_used(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_not_used;
+	py_not_used = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->not_used);
+	return py_not_used;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_not_used(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->not_used");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->not_used));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->not_used = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->not_used = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_data_checksum(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_data_checksum;
+	py_data_checksum = pytalloc_reference_ex(&frsrpc_CommPktDataExtensionChecksum_Type, pytalloc_get_mem_ctx(obj), &object->data_checksum);
+	return py_data_checksum;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_data_checksum(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data_checksum");
+		return -1;
+	}
+	PY_CHECK_TYPE(&frsrpc_CommPktDataExtensionChecksum_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->data_checksum = *(struct frsrpc_CommPktDataExtensionChecksum *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_get_data_retry_timeout(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(obj);
+	PyObject *py_data_retry_timeout;
+	py_data_retry_timeout = pytalloc_reference_ex(&frsrpc_CommPktDataExtensionRetryTimeout_Type, pytalloc_get_mem_ctx(obj), &object->data_retry_timeout);
+	return py_data_retry_timeout;
+}
+
+static int py_frsrpc_CommPktChangeOrderRecordExtension_set_data_retry_timeout(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChangeOrderRecordExtension *object = (struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data_retry_timeout");
+		return -1;
+	}
+	PY_CHECK_TYPE(&frsrpc_CommPktDataExtensionRetryTimeout_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->data_retry_timeout = *(struct frsrpc_CommPktDataExtensionRetryTimeout *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktChangeOrderRecordExtension_getsetters[] = {
+	{
+		.name = discard_const_p(char, "field_size"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_field_size,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_field_size,
+		.doc = discard_const_p(char, "PIDL-generated element field_size")
+	},
+	{
+		.name = discard_const_p(char, "major"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_major,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_major,
+		.doc = discard_const_p(char, "PIDL-generated element major")
+	},
+	{
+		.name = discard_const_p(char, "offset_count"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_offset_count,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_offset_count,
+		.doc = discard_const_p(char, "PIDL-generated element offset_count")
+	},
+	{
+		.name = discard_const_p(char, "offset0"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_offset0,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_offset0,
+		.doc = discard_const_p(char, "PIDL-generated element offset0")
+	},
+	{
+		.name = discard_const_p(char, "offset1"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_offset1,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_offset1,
+		.doc = discard_const_p(char, "PIDL-generated element offset1")
+	},
+	{
+		.name = discard_const_p(char, "offset_last"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_offset_last,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_offset_last,
+		.doc = discard_const_p(char, "PIDL-generated element offset_last")
+	},
+	{
+		.name = discard_const_p(char, "not_used"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_not_used,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_not_used,
+		.doc = discard_const_p(char, "PIDL-generated element not_used")
+	},
+	{
+		.name = discard_const_p(char, "data_checksum"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_data_checksum,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_data_checksum,
+		.doc = discard_const_p(char, "PIDL-generated element data_checksum")
+	},
+	{
+		.name = discard_const_p(char, "data_retry_timeout"),
+		.get = py_frsrpc_CommPktChangeOrderRecordExtension_get_data_retry_timeout,
+		.set = py_frsrpc_CommPktChangeOrderRecordExtension_set_data_retry_timeout,
+		.doc = discard_const_p(char, "PIDL-generated element data_retry_timeout")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktChangeOrderRecordExtension_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktChangeOrderRecordExtension, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktChangeOrderRecordExtension_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktChangeOrderRecordExtension",
+	.tp_getset = py_frsrpc_CommPktChangeOrderRecordExtension_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktChangeOrderRecordExtension_new,
+};
+
+PyObject *py_import_frsrpc_CommPktChunkData(TALLOC_CTX *mem_ctx, int level, union frsrpc_CommPktChunkData *in)
+{
+	PyObject *ret;
+
+	switch (level) {
+		default:
+			ret = PyString_FromStringAndSize((char *)(in->blob).data, (in->blob).length);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_BOP:
+			ret = ndr_PyLong_FromUnsignedLongLong((uint32_t)in->bop);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_COMMAND:
+			ret = ndr_PyLong_FromUnsignedLongLong((uint32_t)in->command);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_TO:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktChunkGuidName_Type, mem_ctx, &in->to);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_FROM:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktChunkGuidName_Type, mem_ctx, &in->from);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_REPLICA:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktChunkGuidName_Type, mem_ctx, &in->replica);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_CONNECTION:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktChunkGuidName_Type, mem_ctx, &in->connection);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_JOIN_GUID:
+			ret = pytalloc_reference_ex(GUID_Type, mem_ctx, &in->join_guid);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_LAST_JOIN_TIME:
+			ret = ndr_PyLong_FromUnsignedLongLong(in->last_join_time);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_VVECTOR:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktGSVN_Type, mem_ctx, &in->vvector);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_JOIN_TIME:
+			ret = ndr_PyLong_FromUnsignedLongLong(in->join_time);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_REPLICA_VERSION_GUID:
+			ret = pytalloc_reference_ex(GUID_Type, mem_ctx, &in->replica_version_guid);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_COMPRESSION_GUID:
+			ret = pytalloc_reference_ex(GUID_Type, mem_ctx, &in->compression_guid);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_BLOCK:
+			ret = PyString_FromStringAndSize((char *)(in->block).data, (in->block).length);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_BLOCK_SIZE:
+			ret = ndr_PyLong_FromUnsignedLongLong(in->block_size);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_FILE_SIZE:
+			ret = ndr_PyLong_FromUnsignedLongLong(in->file_size);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_FILE_OFFSET:
+			ret = ndr_PyLong_FromUnsignedLongLong(in->file_offset);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_GVSN:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktGSVN_Type, mem_ctx, &in->gvsn);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_GUID:
+			ret = pytalloc_reference_ex(GUID_Type, mem_ctx, &in->co_guid);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_SEQUENCE_NUMBER:
+			ret = ndr_PyLong_FromUnsignedLongLong((uint32_t)in->co_sequence_number);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_REMOTE_CO:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktChangeOrderCommand_Type, mem_ctx, &in->remote_co);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_EXT_WIN2K:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktCoRecordExtensionWin2k_Type, mem_ctx, &in->co_ext_win2k);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_EXTENTION_2:
+			ret = pytalloc_reference_ex(&frsrpc_CommPktChangeOrderRecordExtension_Type, mem_ctx, &in->co_extension2);
+			return ret;
+
+		case FRSRPC_COMM_PKT_CHUNK_EOP:
+			ret = ndr_PyLong_FromUnsignedLongLong((uint32_t)in->bopend);
+			return ret;
+
+	}
+	PyErr_SetString(PyExc_TypeError, "unknown union level");
+	return NULL;
+}
+
+union frsrpc_CommPktChunkData *py_export_frsrpc_CommPktChunkData(TALLOC_CTX *mem_ctx, int level, PyObject *in)
+{
+	union frsrpc_CommPktChunkData *ret = talloc_zero(mem_ctx, union frsrpc_CommPktChunkData);
+	switch (level) {
+		default:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->blob");
+				talloc_free(ret); return NULL;
+			}
+			ret->blob = data_blob_talloc(mem_ctx, PyString_AS_STRING(in), PyString_GET_SIZE(in));
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_BOP:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->bop");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->bop));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->bop = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->bop = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_COMMAND:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->command");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->command));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->command = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->command = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_TO:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->to");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChunkGuidName_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->to = *(struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_FROM:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->from");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChunkGuidName_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->from = *(struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_REPLICA:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->replica");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChunkGuidName_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->replica = *(struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_CONNECTION:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->connection");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChunkGuidName_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->connection = *(struct frsrpc_CommPktChunkGuidName *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_JOIN_GUID:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->join_guid");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->join_guid");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(GUID_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->join_guid = *(struct GUID *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_LAST_JOIN_TIME:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->last_join_time");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->last_join_time));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->last_join_time = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->last_join_time = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_VVECTOR:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->vvector");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->vvector");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktGSVN_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->vvector = *(struct frsrpc_CommPktGSVN *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_JOIN_TIME:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->join_time");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->join_time");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->join_time));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->join_time = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->join_time = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_REPLICA_VERSION_GUID:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->replica_version_guid");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->replica_version_guid");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(GUID_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->replica_version_guid = *(struct GUID *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_COMPRESSION_GUID:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->compression_guid");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(GUID_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->compression_guid = *(struct GUID *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_BLOCK:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->block");
+				talloc_free(ret); return NULL;
+			}
+			ret->block = data_blob_talloc(mem_ctx, PyString_AS_STRING(in), PyString_GET_SIZE(in));
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_BLOCK_SIZE:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->block_size");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->block_size));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->block_size = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->block_size = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_FILE_SIZE:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->file_size");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->file_size));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->file_size = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->file_size = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_FILE_OFFSET:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->file_offset");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->file_offset));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->file_offset = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->file_offset = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_GVSN:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->gvsn");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->gvsn");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktGSVN_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->gvsn = *(struct frsrpc_CommPktGSVN *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_GUID:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->co_guid");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->co_guid");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(GUID_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->co_guid = *(struct GUID *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_SEQUENCE_NUMBER:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->co_sequence_number");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->co_sequence_number));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->co_sequence_number = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->co_sequence_number = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_REMOTE_CO:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->remote_co");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->remote_co");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChangeOrderCommand_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->remote_co = *(struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_EXT_WIN2K:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->co_ext_win2k");
+				talloc_free(ret); return NULL;
+			}
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->co_ext_win2k");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktCoRecordExtensionWin2k_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->co_ext_win2k = *(struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_CO_EXTENTION_2:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->co_extension2");
+				talloc_free(ret); return NULL;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChangeOrderRecordExtension_Type, in, talloc_free(ret); return NULL;);
+			if (talloc_reference(mem_ctx, pytalloc_get_mem_ctx(in)) == NULL) {
+				PyErr_NoMemory();
+				talloc_free(ret); return NULL;
+			}
+			ret->co_extension2 = *(struct frsrpc_CommPktChangeOrderRecordExtension *)pytalloc_get_ptr(in);
+			break;
+
+		case FRSRPC_COMM_PKT_CHUNK_EOP:
+			if (in == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct ret->bopend");
+				talloc_free(ret); return NULL;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(ret->bopend));
+				if (PyLong_Check(in)) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(in);
+					if (PyErr_Occurred() != NULL) {
+						talloc_free(ret); return NULL;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->bopend = test_var;
+				} else if (PyInt_Check(in)) {
+					long test_var;
+					test_var = PyInt_AsLong(in);
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						talloc_free(ret); return NULL;
+					}
+					ret->bopend = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					talloc_free(ret); return NULL;
+				}
+			}
+			break;
+
+	}
+
+	return ret;
+}
+
+
+static PyObject *py_frsrpc_CommPktChunk_get_type(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(obj);
+	PyObject *py_type;
+	py_type = PyInt_FromLong((uint16_t)object->type);
+	return py_type;
+}
+
+static int py_frsrpc_CommPktChunk_set_type(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->type");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->type));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->type = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->type = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChunk_get_data(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(obj);
+	PyObject *py_data;
+	py_data = py_import_frsrpc_CommPktChunkData(pytalloc_get_mem_ctx(obj), object->type, &object->data);
+	if (py_data == NULL) {
+		return NULL;
+	}
+	return py_data;
+}
+
+static int py_frsrpc_CommPktChunk_set_data(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data");
+		return -1;
+	}
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data");
+		return -1;
+	}
+	{
+		union frsrpc_CommPktChunkData *data_switch_1;
+		data_switch_1 = py_export_frsrpc_CommPktChunkData(pytalloc_get_mem_ctx(py_obj), object->type, value);
+		if (data_switch_1 == NULL) {
+			return -1;
+		}
+		object->data = *data_switch_1;
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktChunk_getsetters[] = {
+	{
+		.name = discard_const_p(char, "type"),
+		.get = py_frsrpc_CommPktChunk_get_type,
+		.set = py_frsrpc_CommPktChunk_set_type,
+		.doc = discard_const_p(char, "PIDL-generated element type")
+	},
+	{
+		.name = discard_const_p(char, "data"),
+		.get = py_frsrpc_CommPktChunk_get_data,
+		.set = py_frsrpc_CommPktChunk_set_data,
+		.doc = discard_const_p(char, "PIDL-generated element data")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktChunk_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktChunk, type);
+}
+
+static PyObject *py_frsrpc_CommPktChunk_ndr_pack(PyObject *py_obj)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(py_obj);
+	PyObject *ret = NULL;
+	DATA_BLOB blob;
+	enum ndr_err_code err;
+	TALLOC_CTX *tmp_ctx = talloc_new(pytalloc_get_mem_ctx(py_obj));
+	if (tmp_ctx == NULL) {
+		PyErr_SetNdrError(NDR_ERR_ALLOC);
+		return NULL;
+	}
+	err = ndr_push_struct_blob(&blob, tmp_ctx, object, (ndr_push_flags_fn_t)ndr_push_frsrpc_CommPktChunk);
+	if (err != NDR_ERR_SUCCESS) {
+		TALLOC_FREE(tmp_ctx);
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	ret = PyString_FromStringAndSize((char *)blob.data, blob.length);
+	TALLOC_FREE(tmp_ctx);
+	return ret;
+}
+
+static PyObject *py_frsrpc_CommPktChunk_ndr_unpack(PyObject *py_obj, PyObject *args, PyObject *kwargs)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(py_obj);
+	DATA_BLOB blob;
+	Py_ssize_t blob_length = 0;
+	enum ndr_err_code err;
+	const char * const kwnames[] = { "data_blob", "allow_remaining", NULL };
+	PyObject *allow_remaining_obj = NULL;
+	bool allow_remaining = false;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s#|O:__ndr_unpack__",
+		discard_const_p(char *, kwnames),
+		&blob.data, &blob_length,
+		&allow_remaining_obj)) {
+		return NULL;
+	}
+	blob.length = blob_length;
+
+	if (allow_remaining_obj && PyObject_IsTrue(allow_remaining_obj)) {
+		allow_remaining = true;
+	}
+
+	if (allow_remaining) {
+		err = ndr_pull_struct_blob(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_frsrpc_CommPktChunk);
+	} else {
+		err = ndr_pull_struct_blob_all(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_frsrpc_CommPktChunk);
+	}
+	if (err != NDR_ERR_SUCCESS) {
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_frsrpc_CommPktChunk_ndr_print(PyObject *py_obj)
+{
+	struct frsrpc_CommPktChunk *object = (struct frsrpc_CommPktChunk *)pytalloc_get_ptr(py_obj);
+	PyObject *ret;
+	char *retstr;
+
+	retstr = ndr_print_struct_string(pytalloc_get_mem_ctx(py_obj), (ndr_print_fn_t)ndr_print_frsrpc_CommPktChunk, "frsrpc_CommPktChunk", object);
+	ret = PyString_FromString(retstr);
+	talloc_free(retstr);
+
+	return ret;
+}
+
+static PyMethodDef py_frsrpc_CommPktChunk_methods[] = {
+	{ "__ndr_pack__", (PyCFunction)py_frsrpc_CommPktChunk_ndr_pack, METH_NOARGS, "S.ndr_pack(object) -> blob\nNDR pack" },
+	{ "__ndr_unpack__", (PyCFunction)py_frsrpc_CommPktChunk_ndr_unpack, METH_VARARGS|METH_KEYWORDS, "S.ndr_unpack(class, blob, allow_remaining=False) -> None\nNDR unpack" },
+	{ "__ndr_print__", (PyCFunction)py_frsrpc_CommPktChunk_ndr_print, METH_VARARGS, "S.ndr_print(object) -> None\nNDR print" },
+	{ NULL, NULL, 0, NULL }
+};
+
+
+static PyTypeObject frsrpc_CommPktChunk_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktChunk",
+	.tp_getset = py_frsrpc_CommPktChunk_getsetters,
+	.tp_methods = py_frsrpc_CommPktChunk_methods,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktChunk_new,
+};
+
+
+static PyObject *py_frsrpc_CommPktChunkCtr_get_num_chunks(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChunkCtr *object = (struct frsrpc_CommPktChunkCtr *)pytalloc_get_ptr(obj);
+	PyObject *py_num_chunks;
+	py_num_chunks = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->num_chunks);
+	return py_num_chunks;
+}
+
+static int py_frsrpc_CommPktChunkCtr_set_num_chunks(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChunkCtr *object = (struct frsrpc_CommPktChunkCtr *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->num_chunks");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->num_chunks));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->num_chunks = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->num_chunks = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_CommPktChunkCtr_get_chunks(PyObject *obj, void *closure)
+{
+	struct frsrpc_CommPktChunkCtr *object = (struct frsrpc_CommPktChunkCtr *)pytalloc_get_ptr(obj);
+	PyObject *py_chunks;
+	py_chunks = PyList_New(object->num_chunks);
+	if (py_chunks == NULL) {
+		return NULL;
+	}
+	{
+		int chunks_cntr_0;
+		for (chunks_cntr_0 = 0; chunks_cntr_0 < (object->num_chunks); chunks_cntr_0++) {
+			PyObject *py_chunks_0;
+			py_chunks_0 = pytalloc_reference_ex(&frsrpc_CommPktChunk_Type, object->chunks, &object->chunks[chunks_cntr_0]);
+			PyList_SetItem(py_chunks, chunks_cntr_0, py_chunks_0);
+		}
+	}
+	return py_chunks;
+}
+
+static int py_frsrpc_CommPktChunkCtr_set_chunks(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_CommPktChunkCtr *object = (struct frsrpc_CommPktChunkCtr *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->chunks");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int chunks_cntr_0;
+		object->chunks = talloc_array_ptrtype(pytalloc_get_mem_ctx(py_obj), object->chunks, PyList_GET_SIZE(value));
+		if (!object->chunks) { return -1;; }
+		talloc_set_name_const(object->chunks, "ARRAY: object->chunks");
+		for (chunks_cntr_0 = 0; chunks_cntr_0 < PyList_GET_SIZE(value); chunks_cntr_0++) {
+			if (PyList_GET_ITEM(value, chunks_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->chunks[chunks_cntr_0]");
+				return -1;
+			}
+			PY_CHECK_TYPE(&frsrpc_CommPktChunk_Type, PyList_GET_ITEM(value, chunks_cntr_0), return -1;);
+			if (talloc_reference(object->chunks, pytalloc_get_mem_ctx(PyList_GET_ITEM(value, chunks_cntr_0))) == NULL) {
+				PyErr_NoMemory();
+				return -1;
+			}
+			object->chunks[chunks_cntr_0] = *(struct frsrpc_CommPktChunk *)pytalloc_get_ptr(PyList_GET_ITEM(value, chunks_cntr_0));
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_CommPktChunkCtr_getsetters[] = {
+	{
+		.name = discard_const_p(char, "num_chunks"),
+		.get = py_frsrpc_CommPktChunkCtr_get_num_chunks,
+		.set = py_frsrpc_CommPktChunkCtr_set_num_chunks,
+		.doc = discard_const_p(char, "PIDL-generated element num_chunks")
+	},
+	{
+		.name = discard_const_p(char, "chunks"),
+		.get = py_frsrpc_CommPktChunkCtr_get_chunks,
+		.set = py_frsrpc_CommPktChunkCtr_set_chunks,
+		.doc = discard_const_p(char, "PIDL-generated element chunks")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_CommPktChunkCtr_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_CommPktChunkCtr, type);
+}
+
+
+static PyTypeObject frsrpc_CommPktChunkCtr_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.CommPktChunkCtr",
+	.tp_getset = py_frsrpc_CommPktChunkCtr_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_CommPktChunkCtr_new,
+};
+
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_major(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_major;
+	py_major = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->major);
+	return py_major;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_major(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->major");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->major));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_minor(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_minor;
+	py_minor = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->minor);
+	return py_minor;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_minor(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->minor");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->minor));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->minor = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->minor = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_cs_id(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_cs_id;
+	py_cs_id = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->cs_id);
+	return py_cs_id;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_cs_id(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cs_id");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->cs_id));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cs_id = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->cs_id = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_memory_len(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_memory_len;
+	py_memory_len = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->memory_len);
+	return py_memory_len;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_memory_len(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->memory_len");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->memory_len));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->memory_len = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->memory_len = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_pkt_len(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_pkt_len;
+	py_pkt_len = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->pkt_len);
+	return py_pkt_len;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_pkt_len(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->pkt_len");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->pkt_len));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->pkt_len = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->pkt_len = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_upk_len(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_upk_len;
+	py_upk_len = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->upk_len);
+	return py_upk_len;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_upk_len(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->upk_len");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->upk_len));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->upk_len = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->upk_len = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_ctr(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_ctr;
+	if (object->ctr == NULL) {
+		py_ctr = Py_None;
+		Py_INCREF(py_ctr);
+	} else {
+		py_ctr = pytalloc_reference_ex(&frsrpc_CommPktChunkCtr_Type, object->ctr, object->ctr);
+	}
+	return py_ctr;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_ctr(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	talloc_unlink(pytalloc_get_mem_ctx(py_obj), discard_const(object->ctr));
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->ctr");
+		return -1;
+	}
+	if (value == Py_None) {
+		object->ctr = NULL;
+	} else {
+		object->ctr = NULL;
+		if (value == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *object->ctr");
+			return -1;
+		}
+		PY_CHECK_TYPE(&frsrpc_CommPktChunkCtr_Type, value, return -1;);
+		if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+			PyErr_NoMemory();
+			return -1;
+		}
+		object->ctr = (struct frsrpc_CommPktChunkCtr *)pytalloc_get_ptr(value);
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_data_name(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_data_name;
+	py_data_name = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->data_name);
+	return py_data_name;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_data_name(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data_name");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->data_name));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->data_name = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->data_name = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_get_data_handle(PyObject *obj, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(obj);
+	PyObject *py_data_handle;
+	py_data_handle = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->data_handle);
+	return py_data_handle;
+}
+
+static int py_frsrpc_FrsSendCommPktReq_set_data_handle(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_FrsSendCommPktReq *object = (struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->data_handle");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->data_handle));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->data_handle = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->data_handle = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_FrsSendCommPktReq_getsetters[] = {
+	{
+		.name = discard_const_p(char, "major"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_major,
+		.set = py_frsrpc_FrsSendCommPktReq_set_major,
+		.doc = discard_const_p(char, "PIDL-generated element major")
+	},
+	{
+		.name = discard_const_p(char, "minor"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_minor,
+		.set = py_frsrpc_FrsSendCommPktReq_set_minor,
+		.doc = discard_const_p(char, "PIDL-generated element minor")
+	},
+	{
+		.name = discard_const_p(char, "cs_id"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_cs_id,
+		.set = py_frsrpc_FrsSendCommPktReq_set_cs_id,
+		.doc = discard_const_p(char, "PIDL-generated element cs_id")
+	},
+	{
+		.name = discard_const_p(char, "memory_len"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_memory_len,
+		.set = py_frsrpc_FrsSendCommPktReq_set_memory_len,
+		.doc = discard_const_p(char, "PIDL-generated element memory_len")
+	},
+	{
+		.name = discard_const_p(char, "pkt_len"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_pkt_len,
+		.set = py_frsrpc_FrsSendCommPktReq_set_pkt_len,
+		.doc = discard_const_p(char, "PIDL-generated element pkt_len")
+	},
+	{
+		.name = discard_const_p(char, "upk_len"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_upk_len,
+		.set = py_frsrpc_FrsSendCommPktReq_set_upk_len,
+		.doc = discard_const_p(char, "PIDL-generated element upk_len")
+	},
+	{
+		.name = discard_const_p(char, "ctr"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_ctr,
+		.set = py_frsrpc_FrsSendCommPktReq_set_ctr,
+		.doc = discard_const_p(char, "PIDL-generated element ctr")
+	},
+	{
+		.name = discard_const_p(char, "data_name"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_data_name,
+		.set = py_frsrpc_FrsSendCommPktReq_set_data_name,
+		.doc = discard_const_p(char, "PIDL-generated element data_name")
+	},
+	{
+		.name = discard_const_p(char, "data_handle"),
+		.get = py_frsrpc_FrsSendCommPktReq_get_data_handle,
+		.set = py_frsrpc_FrsSendCommPktReq_set_data_handle,
+		.doc = discard_const_p(char, "PIDL-generated element data_handle")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_FrsSendCommPktReq_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_FrsSendCommPktReq, type);
+}
+
+
+static PyTypeObject frsrpc_FrsSendCommPktReq_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.FrsSendCommPktReq",
+	.tp_getset = py_frsrpc_FrsSendCommPktReq_getsetters,
+	.tp_methods = NULL,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_FrsSendCommPktReq_new,
+};
+
+
+static PyObject *py_frsrpc_StageHeader_get_major(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_major;
+	py_major = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->major);
+	return py_major;
+}
+
+static int py_frsrpc_StageHeader_set_major(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->major");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->major));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->major = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_minor(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_minor;
+	py_minor = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->minor);
+	return py_minor;
+}
+
+static int py_frsrpc_StageHeader_set_minor(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->minor");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->minor));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->minor = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->minor = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_dataHigh(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_dataHigh;
+	py_dataHigh = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dataHigh);
+	return py_dataHigh;
+}
+
+static int py_frsrpc_StageHeader_set_dataHigh(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dataHigh");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dataHigh));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dataHigh = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dataHigh = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_dataLow(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_dataLow;
+	py_dataLow = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->dataLow);
+	return py_dataLow;
+}
+
+static int py_frsrpc_StageHeader_set_dataLow(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dataLow");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dataLow));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dataLow = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dataLow = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_compression(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_compression;
+	py_compression = PyInt_FromLong((uint16_t)object->compression);
+	return py_compression;
+}
+
+static int py_frsrpc_StageHeader_set_compression(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->compression");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->compression));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->compression = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->compression = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_unused(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_unused;
+	py_unused = PyList_New(6);
+	if (py_unused == NULL) {
+		return NULL;
+	}
+	{
+		int unused_cntr_0;
+		for (unused_cntr_0 = 0; unused_cntr_0 < (6); unused_cntr_0++) {
+			PyObject *py_unused_0;
+			py_unused_0 = PyInt_FromLong((uint16_t)object->unused[unused_cntr_0]);
+			PyList_SetItem(py_unused, unused_cntr_0, py_unused_0);
+		}
+	}
+	return py_unused;
+}
+
+static int py_frsrpc_StageHeader_set_unused(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->unused");
+		return -1;
+	}
+	PY_CHECK_TYPE(&PyList_Type, value, return -1;);
+	{
+		int unused_cntr_0;
+		if (ARRAY_SIZE(object->unused) != PyList_GET_SIZE(value)) {
+			PyErr_Format(PyExc_TypeError, "Expected list of type %s, length %zu, got %zd", Py_TYPE(value)->tp_name, ARRAY_SIZE(object->unused),  PyList_GET_SIZE(value));
+			return -1;
+		}
+		for (unused_cntr_0 = 0; unused_cntr_0 < PyList_GET_SIZE(value); unused_cntr_0++) {
+			if (PyList_GET_ITEM(value, unused_cntr_0) == NULL) {
+				PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->unused[unused_cntr_0]");
+				return -1;
+			}
+			{
+				const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->unused[unused_cntr_0]));
+				if (PyLong_Check(PyList_GET_ITEM(value, unused_cntr_0))) {
+					unsigned long long test_var;
+					test_var = PyLong_AsUnsignedLongLong(PyList_GET_ITEM(value, unused_cntr_0));
+					if (PyErr_Occurred() != NULL) {
+						return -1;
+					}
+					if (test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->unused[unused_cntr_0] = test_var;
+				} else if (PyInt_Check(PyList_GET_ITEM(value, unused_cntr_0))) {
+					long test_var;
+					test_var = PyInt_AsLong(PyList_GET_ITEM(value, unused_cntr_0));
+					if (test_var < 0 || test_var > uint_max) {
+						PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+						  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+						return -1;
+					}
+					object->unused[unused_cntr_0] = test_var;
+				} else {
+					PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name);
+					return -1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_attributes(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_attributes;
+	py_attributes = pytalloc_reference_ex(fscc_FileNetworkOpenInformation_Type, pytalloc_get_mem_ctx(obj), &object->attributes);
+	return py_attributes;
+}
+
+static int py_frsrpc_StageHeader_set_attributes(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->attributes");
+		return -1;
+	}
+	PY_CHECK_TYPE(fscc_FileNetworkOpenInformation_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->attributes = *(struct fscc_FileNetworkOpenInformation *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_command(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_command;
+	py_command = pytalloc_reference_ex(&frsrpc_CommPktChangeOrderCommand_Type, pytalloc_get_mem_ctx(obj), &object->command);
+	return py_command;
+}
+
+static int py_frsrpc_StageHeader_set_command(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->command");
+		return -1;
+	}
+	PY_CHECK_TYPE(&frsrpc_CommPktChangeOrderCommand_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->command = *(struct frsrpc_CommPktChangeOrderCommand *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_fileObjId(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_fileObjId;
+	py_fileObjId = pytalloc_reference_ex(fscc_FileObjectIdBuffer_2_Type, pytalloc_get_mem_ctx(obj), &object->fileObjId);
+	return py_fileObjId;
+}
+
+static int py_frsrpc_StageHeader_set_fileObjId(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->fileObjId");
+		return -1;
+	}
+	PY_CHECK_TYPE(fscc_FileObjectIdBuffer_2_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->fileObjId = *(struct fscc_FileObjectIdBuffer_2 *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_cocExt(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_cocExt;
+	py_cocExt = pytalloc_reference_ex(&frsrpc_CommPktCoRecordExtensionWin2k_Type, pytalloc_get_mem_ctx(obj), &object->cocExt);
+	return py_cocExt;
+}
+
+static int py_frsrpc_StageHeader_set_cocExt(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->cocExt");
+		return -1;
+	}
+	PY_CHECK_TYPE(&frsrpc_CommPktCoRecordExtensionWin2k_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->cocExt = *(struct frsrpc_CommPktCoRecordExtensionWin2k *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_compressionGuid(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_compressionGuid;
+	py_compressionGuid = pytalloc_reference_ex(GUID_Type, pytalloc_get_mem_ctx(obj), &object->compressionGuid);
+	return py_compressionGuid;
+}
+
+static int py_frsrpc_StageHeader_set_compressionGuid(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->compressionGuid");
+		return -1;
+	}
+	PY_CHECK_TYPE(GUID_Type, value, return -1;);
+	if (talloc_reference(pytalloc_get_mem_ctx(py_obj), pytalloc_get_mem_ctx(value)) == NULL) {
+		PyErr_NoMemory();
+		return -1;
+	}
+	object->compressionGuid = *(struct GUID *)pytalloc_get_ptr(value);
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_encDataHigh(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_encDataHigh;
+	py_encDataHigh = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->encDataHigh);
+	return py_encDataHigh;
+}
+
+static int py_frsrpc_StageHeader_set_encDataHigh(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->encDataHigh");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->encDataHigh));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->encDataHigh = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->encDataHigh = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_encDataLow(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_encDataLow;
+	py_encDataLow = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->encDataLow);
+	return py_encDataLow;
+}
+
+static int py_frsrpc_StageHeader_set_encDataLow(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->encDataLow");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->encDataLow));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->encDataLow = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->encDataLow = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_dataSize(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_dataSize;
+	py_dataSize = ndr_PyLong_FromUnsignedLongLong(object->dataSize);
+	return py_dataSize;
+}
+
+static int py_frsrpc_StageHeader_set_dataSize(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->dataSize");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->dataSize));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dataSize = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->dataSize = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_reparseDataPresent(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_reparseDataPresent;
+	py_reparseDataPresent = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->reparseDataPresent);
+	return py_reparseDataPresent;
+}
+
+static int py_frsrpc_StageHeader_set_reparseDataPresent(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->reparseDataPresent");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->reparseDataPresent));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->reparseDataPresent = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->reparseDataPresent = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_reparseDataHigh(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_reparseDataHigh;
+	py_reparseDataHigh = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->reparseDataHigh);
+	return py_reparseDataHigh;
+}
+
+static int py_frsrpc_StageHeader_set_reparseDataHigh(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->reparseDataHigh");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->reparseDataHigh));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->reparseDataHigh = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->reparseDataHigh = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_reparseDataLow(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_reparseDataLow;
+	py_reparseDataLow = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->reparseDataLow);
+	return py_reparseDataLow;
+}
+
+static int py_frsrpc_StageHeader_set_reparseDataLow(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->reparseDataLow");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->reparseDataLow));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->reparseDataLow = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->reparseDataLow = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyObject *py_frsrpc_StageHeader_get_padding2(PyObject *obj, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(obj);
+	PyObject *py_padding2;
+	py_padding2 = ndr_PyLong_FromUnsignedLongLong((uint32_t)object->padding2);
+	return py_padding2;
+}
+
+static int py_frsrpc_StageHeader_set_padding2(PyObject *py_obj, PyObject *value, void *closure)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	if (value == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct object->padding2");
+		return -1;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(object->padding2));
+		if (PyLong_Check(value)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(value);
+			if (PyErr_Occurred() != NULL) {
+				return -1;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding2 = test_var;
+		} else if (PyInt_Check(value)) {
+			long test_var;
+			test_var = PyInt_AsLong(value);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return -1;
+			}
+			object->padding2 = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return -1;
+		}
+	}
+	return 0;
+}
+
+static PyGetSetDef py_frsrpc_StageHeader_getsetters[] = {
+	{
+		.name = discard_const_p(char, "major"),
+		.get = py_frsrpc_StageHeader_get_major,
+		.set = py_frsrpc_StageHeader_set_major,
+		.doc = discard_const_p(char, "PIDL-generated element major")
+	},
+	{
+		.name = discard_const_p(char, "minor"),
+		.get = py_frsrpc_StageHeader_get_minor,
+		.set = py_frsrpc_StageHeader_set_minor,
+		.doc = discard_const_p(char, "PIDL-generated element minor")
+	},
+	{
+		.name = discard_const_p(char, "dataHigh"),
+		.get = py_frsrpc_StageHeader_get_dataHigh,
+		.set = py_frsrpc_StageHeader_set_dataHigh,
+		.doc = discard_const_p(char, "PIDL-generated element dataHigh")
+	},
+	{
+		.name = discard_const_p(char, "dataLow"),
+		.get = py_frsrpc_StageHeader_get_dataLow,
+		.set = py_frsrpc_StageHeader_set_dataLow,
+		.doc = discard_const_p(char, "PIDL-generated element dataLow")
+	},
+	{
+		.name = discard_const_p(char, "compression"),
+		.get = py_frsrpc_StageHeader_get_compression,
+		.set = py_frsrpc_StageHeader_set_compression,
+		.doc = discard_const_p(char, "PIDL-generated element compression")
+	},
+	{
+		.name = discard_const_p(char, "unused"),
+		.get = py_frsrpc_StageHeader_get_unused,
+		.set = py_frsrpc_StageHeader_set_unused,
+		.doc = discard_const_p(char, "PIDL-generated element unused")
+	},
+	{
+		.name = discard_const_p(char, "attributes"),
+		.get = py_frsrpc_StageHeader_get_attributes,
+		.set = py_frsrpc_StageHeader_set_attributes,
+		.doc = discard_const_p(char, "PIDL-generated element attributes")
+	},
+	{
+		.name = discard_const_p(char, "command"),
+		.get = py_frsrpc_StageHeader_get_command,
+		.set = py_frsrpc_StageHeader_set_command,
+		.doc = discard_const_p(char, "PIDL-generated element command")
+	},
+	{
+		.name = discard_const_p(char, "fileObjId"),
+		.get = py_frsrpc_StageHeader_get_fileObjId,
+		.set = py_frsrpc_StageHeader_set_fileObjId,
+		.doc = discard_const_p(char, "PIDL-generated element fileObjId")
+	},
+	{
+		.name = discard_const_p(char, "cocExt"),
+		.get = py_frsrpc_StageHeader_get_cocExt,
+		.set = py_frsrpc_StageHeader_set_cocExt,
+		.doc = discard_const_p(char, "PIDL-generated element cocExt")
+	},
+	{
+		.name = discard_const_p(char, "compressionGuid"),
+		.get = py_frsrpc_StageHeader_get_compressionGuid,
+		.set = py_frsrpc_StageHeader_set_compressionGuid,
+		.doc = discard_const_p(char, "PIDL-generated element compressionGuid")
+	},
+	{
+		.name = discard_const_p(char, "encDataHigh"),
+		.get = py_frsrpc_StageHeader_get_encDataHigh,
+		.set = py_frsrpc_StageHeader_set_encDataHigh,
+		.doc = discard_const_p(char, "PIDL-generated element encDataHigh")
+	},
+	{
+		.name = discard_const_p(char, "encDataLow"),
+		.get = py_frsrpc_StageHeader_get_encDataLow,
+		.set = py_frsrpc_StageHeader_set_encDataLow,
+		.doc = discard_const_p(char, "PIDL-generated element encDataLow")
+	},
+	{
+		.name = discard_const_p(char, "dataSize"),
+		.get = py_frsrpc_StageHeader_get_dataSize,
+		.set = py_frsrpc_StageHeader_set_dataSize,
+		.doc = discard_const_p(char, "PIDL-generated element dataSize")
+	},
+	{
+		.name = discard_const_p(char, "reparseDataPresent"),
+		.get = py_frsrpc_StageHeader_get_reparseDataPresent,
+		.set = py_frsrpc_StageHeader_set_reparseDataPresent,
+		.doc = discard_const_p(char, "PIDL-generated element reparseDataPresent")
+	},
+	{
+		.name = discard_const_p(char, "reparseDataHigh"),
+		.get = py_frsrpc_StageHeader_get_reparseDataHigh,
+		.set = py_frsrpc_StageHeader_set_reparseDataHigh,
+		.doc = discard_const_p(char, "PIDL-generated element reparseDataHigh")
+	},
+	{
+		.name = discard_const_p(char, "reparseDataLow"),
+		.get = py_frsrpc_StageHeader_get_reparseDataLow,
+		.set = py_frsrpc_StageHeader_set_reparseDataLow,
+		.doc = discard_const_p(char, "PIDL-generated element reparseDataLow")
+	},
+	{
+		.name = discard_const_p(char, "padding2"),
+		.get = py_frsrpc_StageHeader_get_padding2,
+		.set = py_frsrpc_StageHeader_set_padding2,
+		.doc = discard_const_p(char, "PIDL-generated element padding2")
+	},
+	{ .name = NULL }
+};
+
+static PyObject *py_frsrpc_StageHeader_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return pytalloc_new(struct frsrpc_StageHeader, type);
+}
+
+static PyObject *py_frsrpc_StageHeader_ndr_pack(PyObject *py_obj)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	PyObject *ret = NULL;
+	DATA_BLOB blob;
+	enum ndr_err_code err;
+	TALLOC_CTX *tmp_ctx = talloc_new(pytalloc_get_mem_ctx(py_obj));
+	if (tmp_ctx == NULL) {
+		PyErr_SetNdrError(NDR_ERR_ALLOC);
+		return NULL;
+	}
+	err = ndr_push_struct_blob(&blob, tmp_ctx, object, (ndr_push_flags_fn_t)ndr_push_frsrpc_StageHeader);
+	if (err != NDR_ERR_SUCCESS) {
+		TALLOC_FREE(tmp_ctx);
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	ret = PyString_FromStringAndSize((char *)blob.data, blob.length);
+	TALLOC_FREE(tmp_ctx);
+	return ret;
+}
+
+static PyObject *py_frsrpc_StageHeader_ndr_unpack(PyObject *py_obj, PyObject *args, PyObject *kwargs)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	DATA_BLOB blob;
+	Py_ssize_t blob_length = 0;
+	enum ndr_err_code err;
+	const char * const kwnames[] = { "data_blob", "allow_remaining", NULL };
+	PyObject *allow_remaining_obj = NULL;
+	bool allow_remaining = false;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s#|O:__ndr_unpack__",
+		discard_const_p(char *, kwnames),
+		&blob.data, &blob_length,
+		&allow_remaining_obj)) {
+		return NULL;
+	}
+	blob.length = blob_length;
+
+	if (allow_remaining_obj && PyObject_IsTrue(allow_remaining_obj)) {
+		allow_remaining = true;
+	}
+
+	if (allow_remaining) {
+		err = ndr_pull_struct_blob(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_frsrpc_StageHeader);
+	} else {
+		err = ndr_pull_struct_blob_all(&blob, pytalloc_get_mem_ctx(py_obj), object, (ndr_pull_flags_fn_t)ndr_pull_frsrpc_StageHeader);
+	}
+	if (err != NDR_ERR_SUCCESS) {
+		PyErr_SetNdrError(err);
+		return NULL;
+	}
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_frsrpc_StageHeader_ndr_print(PyObject *py_obj)
+{
+	struct frsrpc_StageHeader *object = (struct frsrpc_StageHeader *)pytalloc_get_ptr(py_obj);
+	PyObject *ret;
+	char *retstr;
+
+	retstr = ndr_print_struct_string(pytalloc_get_mem_ctx(py_obj), (ndr_print_fn_t)ndr_print_frsrpc_StageHeader, "frsrpc_StageHeader", object);
+	ret = PyString_FromString(retstr);
+	talloc_free(retstr);
+
+	return ret;
+}
+
+static PyMethodDef py_frsrpc_StageHeader_methods[] = {
+	{ "__ndr_pack__", (PyCFunction)py_frsrpc_StageHeader_ndr_pack, METH_NOARGS, "S.ndr_pack(object) -> blob\nNDR pack" },
+	{ "__ndr_unpack__", (PyCFunction)py_frsrpc_StageHeader_ndr_unpack, METH_VARARGS|METH_KEYWORDS, "S.ndr_unpack(class, blob, allow_remaining=False) -> None\nNDR unpack" },
+	{ "__ndr_print__", (PyCFunction)py_frsrpc_StageHeader_ndr_print, METH_VARARGS, "S.ndr_print(object) -> None\nNDR print" },
+	{ NULL, NULL, 0, NULL }
+};
+
+
+static PyTypeObject frsrpc_StageHeader_Type = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.StageHeader",
+	.tp_getset = py_frsrpc_StageHeader_getsetters,
+	.tp_methods = py_frsrpc_StageHeader_methods,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = py_frsrpc_StageHeader_new,
+};
+
+
+static bool pack_py_frsrpc_FrsSendCommPkt_args_in(PyObject *args, PyObject *kwargs, struct frsrpc_FrsSendCommPkt *r)
+{
+	PyObject *py_req;
+	const char *kwnames[] = {
+		"req", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:frsrpc_FrsSendCommPkt", discard_const_p(char *, kwnames), &py_req)) {
+		return false;
+	}
+
+	if (py_req == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.req");
+		return false;
+	}
+	PY_CHECK_TYPE(&frsrpc_FrsSendCommPktReq_Type, py_req, return false;);
+	if (talloc_reference(r, pytalloc_get_mem_ctx(py_req)) == NULL) {
+		PyErr_NoMemory();
+		return false;
+	}
+	r->in.req = *(struct frsrpc_FrsSendCommPktReq *)pytalloc_get_ptr(py_req);
+	return true;
+}
+
+static PyObject *unpack_py_frsrpc_FrsSendCommPkt_args_out(struct frsrpc_FrsSendCommPkt *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsrpc_FrsVerifyPromotionParent_args_in(PyObject *args, PyObject *kwargs, struct frsrpc_FrsVerifyPromotionParent *r)
+{
+	PyObject *py_parent_account;
+	PyObject *py_parent_password;
+	PyObject *py_replica_set_name;
+	PyObject *py_replica_set_type;
+	PyObject *py_partner_auth_level;
+	PyObject *py___ndr_guid_size;
+	const char *kwnames[] = {
+		"parent_account", "parent_password", "replica_set_name", "replica_set_type", "partner_auth_level", "__ndr_guid_size", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:frsrpc_FrsVerifyPromotionParent", discard_const_p(char *, kwnames), &py_parent_account, &py_parent_password, &py_replica_set_name, &py_replica_set_type, &py_partner_auth_level, &py___ndr_guid_size)) {
+		return false;
+	}
+
+	if (py_parent_account == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.parent_account");
+		return false;
+	}
+	if (py_parent_account == Py_None) {
+		r->in.parent_account = NULL;
+	} else {
+		r->in.parent_account = NULL;
+		if (py_parent_account == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.parent_account");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_parent_account)) {
+				unicode = PyUnicode_AsEncodedString(py_parent_account, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_parent_account)) {
+				test_str = PyString_AS_STRING(py_parent_account);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_parent_account)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.parent_account = talloc_str;
+		}
+	}
+	if (py_parent_password == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.parent_password");
+		return false;
+	}
+	if (py_parent_password == Py_None) {
+		r->in.parent_password = NULL;
+	} else {
+		r->in.parent_password = NULL;
+		if (py_parent_password == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.parent_password");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_parent_password)) {
+				unicode = PyUnicode_AsEncodedString(py_parent_password, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_parent_password)) {
+				test_str = PyString_AS_STRING(py_parent_password);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_parent_password)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.parent_password = talloc_str;
+		}
+	}
+	if (py_replica_set_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_name");
+		return false;
+	}
+	if (py_replica_set_name == Py_None) {
+		r->in.replica_set_name = NULL;
+	} else {
+		r->in.replica_set_name = NULL;
+		if (py_replica_set_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.replica_set_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_replica_set_name)) {
+				unicode = PyUnicode_AsEncodedString(py_replica_set_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_replica_set_name)) {
+				test_str = PyString_AS_STRING(py_replica_set_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_replica_set_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.replica_set_name = talloc_str;
+		}
+	}
+	if (py_replica_set_type == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_type");
+		return false;
+	}
+	if (py_replica_set_type == Py_None) {
+		r->in.replica_set_type = NULL;
+	} else {
+		r->in.replica_set_type = NULL;
+		if (py_replica_set_type == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.replica_set_type");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_replica_set_type)) {
+				unicode = PyUnicode_AsEncodedString(py_replica_set_type, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_replica_set_type)) {
+				test_str = PyString_AS_STRING(py_replica_set_type);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_replica_set_type)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.replica_set_type = talloc_str;
+		}
+	}
+	if (py_partner_auth_level == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.partner_auth_level");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.partner_auth_level));
+		if (PyLong_Check(py_partner_auth_level)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_partner_auth_level);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.partner_auth_level = test_var;
+		} else if (PyInt_Check(py_partner_auth_level)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_partner_auth_level);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.partner_auth_level = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py___ndr_guid_size == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.__ndr_guid_size");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.__ndr_guid_size));
+		if (PyLong_Check(py___ndr_guid_size)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py___ndr_guid_size);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.__ndr_guid_size = test_var;
+		} else if (PyInt_Check(py___ndr_guid_size)) {
+			long test_var;
+			test_var = PyInt_AsLong(py___ndr_guid_size);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.__ndr_guid_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsrpc_FrsVerifyPromotionParent_args_out(struct frsrpc_FrsVerifyPromotionParent *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsrpc_FrsStartPromotionParent_args_in(PyObject *args, PyObject *kwargs, struct frsrpc_FrsStartPromotionParent *r)
+{
+	PyObject *py_parent_account;
+	PyObject *py_parent_password;
+	PyObject *py_replica_set_name;
+	PyObject *py_replica_set_type;
+	PyObject *py_connection_name;
+	PyObject *py_partner_name;
+	PyObject *py_partner_princ_name;
+	PyObject *py_partner_auth_level;
+	PyObject *py___ndr_guid_size;
+	PyObject *py_connection_guid;
+	PyObject *py_partner_guid;
+	PyObject *py_parent_guid;
+	const char *kwnames[] = {
+		"parent_account", "parent_password", "replica_set_name", "replica_set_type", "connection_name", "partner_name", "partner_princ_name", "partner_auth_level", "__ndr_guid_size", "connection_guid", "partner_guid", "parent_guid", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOOOOOOOO:frsrpc_FrsStartPromotionParent", discard_const_p(char *, kwnames), &py_parent_account, &py_parent_password, &py_replica_set_name, &py_replica_set_type, &py_connection_name, &py_partner_name, &py_partner_princ_name, &py_partner_auth_level, &py___ndr_guid_size, &py_connection_guid, &py_partner_guid, &py_parent_guid)) {
+		return false;
+	}
+
+	if (py_parent_account == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.parent_account");
+		return false;
+	}
+	if (py_parent_account == Py_None) {
+		r->in.parent_account = NULL;
+	} else {
+		r->in.parent_account = NULL;
+		if (py_parent_account == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.parent_account");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_parent_account)) {
+				unicode = PyUnicode_AsEncodedString(py_parent_account, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_parent_account)) {
+				test_str = PyString_AS_STRING(py_parent_account);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_parent_account)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.parent_account = talloc_str;
+		}
+	}
+	if (py_parent_password == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.parent_password");
+		return false;
+	}
+	if (py_parent_password == Py_None) {
+		r->in.parent_password = NULL;
+	} else {
+		r->in.parent_password = NULL;
+		if (py_parent_password == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.parent_password");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_parent_password)) {
+				unicode = PyUnicode_AsEncodedString(py_parent_password, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_parent_password)) {
+				test_str = PyString_AS_STRING(py_parent_password);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_parent_password)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.parent_password = talloc_str;
+		}
+	}
+	if (py_replica_set_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_name");
+		return false;
+	}
+	if (py_replica_set_name == Py_None) {
+		r->in.replica_set_name = NULL;
+	} else {
+		r->in.replica_set_name = NULL;
+		if (py_replica_set_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.replica_set_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_replica_set_name)) {
+				unicode = PyUnicode_AsEncodedString(py_replica_set_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_replica_set_name)) {
+				test_str = PyString_AS_STRING(py_replica_set_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_replica_set_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.replica_set_name = talloc_str;
+		}
+	}
+	if (py_replica_set_type == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.replica_set_type");
+		return false;
+	}
+	if (py_replica_set_type == Py_None) {
+		r->in.replica_set_type = NULL;
+	} else {
+		r->in.replica_set_type = NULL;
+		if (py_replica_set_type == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.replica_set_type");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_replica_set_type)) {
+				unicode = PyUnicode_AsEncodedString(py_replica_set_type, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_replica_set_type)) {
+				test_str = PyString_AS_STRING(py_replica_set_type);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_replica_set_type)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.replica_set_type = talloc_str;
+		}
+	}
+	if (py_connection_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.connection_name");
+		return false;
+	}
+	if (py_connection_name == Py_None) {
+		r->in.connection_name = NULL;
+	} else {
+		r->in.connection_name = NULL;
+		if (py_connection_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.connection_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_connection_name)) {
+				unicode = PyUnicode_AsEncodedString(py_connection_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_connection_name)) {
+				test_str = PyString_AS_STRING(py_connection_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_connection_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.connection_name = talloc_str;
+		}
+	}
+	if (py_partner_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.partner_name");
+		return false;
+	}
+	if (py_partner_name == Py_None) {
+		r->in.partner_name = NULL;
+	} else {
+		r->in.partner_name = NULL;
+		if (py_partner_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.partner_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_partner_name)) {
+				unicode = PyUnicode_AsEncodedString(py_partner_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_partner_name)) {
+				test_str = PyString_AS_STRING(py_partner_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_partner_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.partner_name = talloc_str;
+		}
+	}
+	if (py_partner_princ_name == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.partner_princ_name");
+		return false;
+	}
+	if (py_partner_princ_name == Py_None) {
+		r->in.partner_princ_name = NULL;
+	} else {
+		r->in.partner_princ_name = NULL;
+		if (py_partner_princ_name == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.partner_princ_name");
+			return false;
+		}
+		{
+			const char *test_str;
+			const char *talloc_str;
+			PyObject *unicode = NULL;
+			if (PyUnicode_Check(py_partner_princ_name)) {
+				unicode = PyUnicode_AsEncodedString(py_partner_princ_name, "utf-8", "ignore");
+				if (unicode == NULL) {
+					PyErr_NoMemory();
+					return false;
+				}
+				test_str = PyString_AS_STRING(unicode);
+			} else if (PyString_Check(py_partner_princ_name)) {
+				test_str = PyString_AS_STRING(py_partner_princ_name);
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected string or unicode object, got %s", Py_TYPE(py_partner_princ_name)->tp_name);
+				return false;
+			}
+			talloc_str = talloc_strdup(r, test_str);
+			if (unicode != NULL) {
+				Py_DECREF(unicode);
+			}
+			if (talloc_str == NULL) {
+				PyErr_NoMemory();
+				return false;
+			}
+			r->in.partner_princ_name = talloc_str;
+		}
+	}
+	if (py_partner_auth_level == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.partner_auth_level");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.partner_auth_level));
+		if (PyLong_Check(py_partner_auth_level)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_partner_auth_level);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.partner_auth_level = test_var;
+		} else if (PyInt_Check(py_partner_auth_level)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_partner_auth_level);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.partner_auth_level = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py___ndr_guid_size == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.__ndr_guid_size");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.__ndr_guid_size));
+		if (PyLong_Check(py___ndr_guid_size)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py___ndr_guid_size);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.__ndr_guid_size = test_var;
+		} else if (PyInt_Check(py___ndr_guid_size)) {
+			long test_var;
+			test_var = PyInt_AsLong(py___ndr_guid_size);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.__ndr_guid_size = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_connection_guid == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.connection_guid");
+		return false;
+	}
+	if (py_connection_guid == Py_None) {
+		r->in.connection_guid = NULL;
+	} else {
+		r->in.connection_guid = NULL;
+		if (py_connection_guid == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.connection_guid");
+			return false;
+		}
+		PY_CHECK_TYPE(GUID_Type, py_connection_guid, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_connection_guid)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.connection_guid = (struct GUID *)pytalloc_get_ptr(py_connection_guid);
+	}
+	if (py_partner_guid == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.partner_guid");
+		return false;
+	}
+	if (py_partner_guid == Py_None) {
+		r->in.partner_guid = NULL;
+	} else {
+		r->in.partner_guid = NULL;
+		if (py_partner_guid == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.partner_guid");
+			return false;
+		}
+		PY_CHECK_TYPE(GUID_Type, py_partner_guid, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_partner_guid)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.partner_guid = (struct GUID *)pytalloc_get_ptr(py_partner_guid);
+	}
+	if (py_parent_guid == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.parent_guid");
+		return false;
+	}
+	if (py_parent_guid == Py_None) {
+		r->in.parent_guid = NULL;
+	} else {
+		r->in.parent_guid = NULL;
+		if (py_parent_guid == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.parent_guid");
+			return false;
+		}
+		PY_CHECK_TYPE(GUID_Type, py_parent_guid, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_parent_guid)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.parent_guid = (struct GUID *)pytalloc_get_ptr(py_parent_guid);
+	}
+	return true;
+}
+
+static PyObject *unpack_py_frsrpc_FrsStartPromotionParent_args_out(struct frsrpc_FrsStartPromotionParent *r)
+{
+	PyObject *result;
+	PyObject *py_parent_guid;
+	if (r->out.parent_guid == NULL) {
+		py_parent_guid = Py_None;
+		Py_INCREF(py_parent_guid);
+	} else {
+		py_parent_guid = pytalloc_reference_ex(GUID_Type, r->out.parent_guid, r->out.parent_guid);
+	}
+	result = py_parent_guid;
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_frsrpc_FrsNOP_args_in(PyObject *args, PyObject *kwargs, struct frsrpc_FrsNOP *r)
+{
+	const char *kwnames[] = {
+		NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, ":frsrpc_FrsNOP", discard_const_p(char *, kwnames))) {
+		return false;
+	}
+
+	return true;
+}
+
+static PyObject *unpack_py_frsrpc_FrsNOP_args_out(struct frsrpc_FrsNOP *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_frsrpc_methods[] = {
+	{ "FrsSendCommPkt", "S.FrsSendCommPkt(req) -> None", (py_dcerpc_call_fn)dcerpc_frsrpc_FrsSendCommPkt_r, (py_data_pack_fn)pack_py_frsrpc_FrsSendCommPkt_args_in, (py_data_unpack_fn)unpack_py_frsrpc_FrsSendCommPkt_args_out, 0, &ndr_table_frsrpc },
+	{ "FrsVerifyPromotionParent", "S.FrsVerifyPromotionParent(parent_account, parent_password, replica_set_name, replica_set_type, partner_auth_level, __ndr_guid_size) -> None", (py_dcerpc_call_fn)dcerpc_frsrpc_FrsVerifyPromotionParent_r, (py_data_pack_fn)pack_py_frsrpc_FrsVerifyPromotionParent_args_in, (py_data_unpack_fn)unpack_py_frsrpc_FrsVerifyPromotionParent_args_out, 1, &ndr_table_frsrpc },
+	{ "FrsStartPromotionParent", "S.FrsStartPromotionParent(parent_account, parent_password, replica_set_name, replica_set_type, connection_name, partner_name, partner_princ_name, partner_auth_level, __ndr_guid_size, connection_guid, partner_guid, parent_guid) -> parent_guid", (py_dcerpc_call_fn)dcerpc_frsrpc_FrsStartPromotionParent_r, (py_data_pack_fn)pack_py_frsrpc_FrsStartPromotionParent_args_in, (py_data_unpack_fn)unpack_py_frsrpc_FrsStartPromotionParent_args_out, 2, &ndr_table_frsrpc },
+	{ "FrsNOP", "S.FrsNOP() -> None", (py_dcerpc_call_fn)dcerpc_frsrpc_FrsNOP_r, (py_data_pack_fn)pack_py_frsrpc_FrsNOP_args_in, (py_data_unpack_fn)unpack_py_frsrpc_FrsNOP_args_out, 3, &ndr_table_frsrpc },
+	{ NULL }
+};
+
+static PyObject *interface_frsrpc_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_frsrpc);
+}
+
+#define PY_DOC_FRSRPC "File Replication Service"
+static PyTypeObject frsrpc_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.frsrpc",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "frsrpc(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_FRSRPC,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_frsrpc_new,
+};
+
+static PyObject *syntax_frsrpc_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_frsrpc.syntax_id);
+}
+
+#define PY_DOC_FRSRPC_SYNTAX "File Replication Service"
+static PyTypeObject frsrpc_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "frsrpc.frsrpc",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_FRSRPC_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_frsrpc_new,
+};
+
+static PyMethodDef frsrpc_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initfrsrpc(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_misc;
+	PyObject *dep_samba_dcerpc_fscc;
+	PyObject *dep_samba_dcerpc_bkupblobs;
+	PyObject *dep_talloc;
+	PyObject *dep_samba_dcerpc_base;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	dep_samba_dcerpc_fscc = PyImport_ImportModule("samba.dcerpc.fscc");
+	if (dep_samba_dcerpc_fscc == NULL)
+		return;
+
+	dep_samba_dcerpc_bkupblobs = PyImport_ImportModule("samba.dcerpc.bkupblobs");
+	if (dep_samba_dcerpc_bkupblobs == NULL)
+		return;
+
+	dep_talloc = PyImport_ImportModule("talloc");
+	if (dep_talloc == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	GUID_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "GUID");
+	if (GUID_Type == NULL)
+		return;
+
+	BaseObject_Type = (PyTypeObject *)PyObject_GetAttrString(dep_talloc, "BaseObject");
+	if (BaseObject_Type == NULL)
+		return;
+
+	fscc_FileNetworkOpenInformation_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_fscc, "FileNetworkOpenInformation");
+	if (fscc_FileNetworkOpenInformation_Type == NULL)
+		return;
+
+	fscc_FileObjectIdBuffer_2_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_fscc, "FileObjectIdBuffer_2");
+	if (fscc_FileObjectIdBuffer_2_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	frsrpc_CommPktChunkGuidName_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktChunkGuidName_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktGSVN_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktGSVN_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktChangeOrderCommand_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktChangeOrderCommand_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktDataExtensionChecksum_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktDataExtensionChecksum_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktDataExtensionRetryTimeout_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktDataExtensionRetryTimeout_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktCoRecordExtensionWin2k_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktCoRecordExtensionWin2k_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktChangeOrderRecordExtension_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktChangeOrderRecordExtension_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktChunk_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktChunk_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_CommPktChunkCtr_Type.tp_base = BaseObject_Type;
+	frsrpc_CommPktChunkCtr_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_FrsSendCommPktReq_Type.tp_base = BaseObject_Type;
+	frsrpc_FrsSendCommPktReq_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_StageHeader_Type.tp_base = BaseObject_Type;
+	frsrpc_StageHeader_Type.tp_basicsize = pytalloc_BaseObject_size();
+
+	frsrpc_InterfaceType.tp_base = ClientConnection_Type;
+
+	frsrpc_SyntaxType.tp_base = ndr_syntax_id_Type;
+	frsrpc_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&frsrpc_CommPktChunkGuidName_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktGSVN_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktChangeOrderCommand_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktDataExtensionChecksum_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktDataExtensionRetryTimeout_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktCoRecordExtensionWin2k_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktChangeOrderRecordExtension_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktChunk_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_CommPktChunkCtr_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_FrsSendCommPktReq_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_StageHeader_Type) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&frsrpc_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&frsrpc_InterfaceType, py_ndr_frsrpc_methods))
+		return;
+
+#ifdef PY_COMMPKTCHUNKGUIDNAME_PATCH
+	PY_COMMPKTCHUNKGUIDNAME_PATCH(&frsrpc_CommPktChunkGuidName_Type);
+#endif
+#ifdef PY_COMMPKTGSVN_PATCH
+	PY_COMMPKTGSVN_PATCH(&frsrpc_CommPktGSVN_Type);
+#endif
+#ifdef PY_COMMPKTCHANGEORDERCOMMAND_PATCH
+	PY_COMMPKTCHANGEORDERCOMMAND_PATCH(&frsrpc_CommPktChangeOrderCommand_Type);
+#endif
+#ifdef PY_COMMPKTDATAEXTENSIONCHECKSUM_PATCH
+	PY_COMMPKTDATAEXTENSIONCHECKSUM_PATCH(&frsrpc_CommPktDataExtensionChecksum_Type);
+#endif
+#ifdef PY_COMMPKTDATAEXTENSIONRETRYTIMEOUT_PATCH
+	PY_COMMPKTDATAEXTENSIONRETRYTIMEOUT_PATCH(&frsrpc_CommPktDataExtensionRetryTimeout_Type);
+#endif
+#ifdef PY_COMMPKTCORECORDEXTENSIONWIN2K_PATCH
+	PY_COMMPKTCORECORDEXTENSIONWIN2K_PATCH(&frsrpc_CommPktCoRecordExtensionWin2k_Type);
+#endif
+#ifdef PY_COMMPKTCHANGEORDERRECORDEXTENSION_PATCH
+	PY_COMMPKTCHANGEORDERRECORDEXTENSION_PATCH(&frsrpc_CommPktChangeOrderRecordExtension_Type);
+#endif
+#ifdef PY_COMMPKTCHUNK_PATCH
+	PY_COMMPKTCHUNK_PATCH(&frsrpc_CommPktChunk_Type);
+#endif
+#ifdef PY_COMMPKTCHUNKCTR_PATCH
+	PY_COMMPKTCHUNKCTR_PATCH(&frsrpc_CommPktChunkCtr_Type);
+#endif
+#ifdef PY_FRSSENDCOMMPKTREQ_PATCH
+	PY_FRSSENDCOMMPKTREQ_PATCH(&frsrpc_FrsSendCommPktReq_Type);
+#endif
+#ifdef PY_STAGEHEADER_PATCH
+	PY_STAGEHEADER_PATCH(&frsrpc_StageHeader_Type);
+#endif
+#ifdef PY_FRSRPC_PATCH
+	PY_FRSRPC_PATCH(&frsrpc_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&frsrpc_SyntaxType);
+#endif
+
+	m = Py_InitModule3("frsrpc", frsrpc_methods, "frsrpc DCE/RPC");
+	if (m == NULL)
+		return;
+
+	PyModule_AddObject(m, "FRSRPC_CO_IFLAG_NONE", ndr_PyLong_FromUnsignedLongLong(0x0000000));
+	PyModule_AddObject(m, "FRSRPC_COMPRESSION_GUID", PyString_FromString("64d2f7d2-2695-436d-8830-8d3c58701e15"));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_ABORT_CO", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_ABORT_CO));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_VV_ACTIVATED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_VV_ACTIVATED));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_CONTENT_CMD", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_CONTENT_CMD));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_LOCATION_CMD", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_LOCATION_CMD));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_ONLIST", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_ONLIST));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_LOCALCO", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_LOCALCO));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_RETRY", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_RETRY));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_INST_INCOMPLETE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_INST_INCOMPLETE));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_OUT_OF_ORDER", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_OUT_OF_ORDER));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_NEW_FILE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_NEW_FILE));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_CONTROL", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_CONTROL));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_DIRECTED_CO", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_DIRECTED_CO));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_VVJOIN_TO_ORIG", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_VVJOIN_TO_ORIG));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_SKIP_ORIG_REC_C", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_SKIP_ORIG_REC_C));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_MOVEIN_GEN", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_MOVEIN_GEN));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_MORPH_GEN_HEAD", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_MORPH_GEN_HEAD));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_JUST_OID_RESET", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_JUST_OID_RESET));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_COMPRESSED_STAGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_COMPRESSED_STAGE));
+	PyModule_AddObject(m, "FRSRPC_CO_FLAG_SKIP_VV_UPDATE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_FLAG_SKIP_VV_UPDATE));
+	PyModule_AddObject(m, "FRSRPC_CO_IFLAG_VVRETIRE_EXEC", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_IFLAG_VVRETIRE_EXEC));
+	PyModule_AddObject(m, "FRSRPC_CO_IFLAG_CO_ABORT", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_IFLAG_CO_ABORT));
+	PyModule_AddObject(m, "FRSRPC_CO_IFLAG_DIR_ENUM_PENDING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_IFLAG_DIR_ENUM_PENDING));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_CO_ENTERED_LOG", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_CO_ENTERED_LOG));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_ALLOC_STAGING_LOCAL_CO", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_ALLOC_STAGING_LOCAL_CO));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_LOCAL_CO_STAGING_STARTED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_LOCAL_CO_STAGING_STARTED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_LOCAL_CO_STAGING_COMPLETED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_LOCAL_CO_STAGING_COMPLETED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_WAIT_RETRY_LOCAL_CO_STAGING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_WAIT_RETRY_LOCAL_CO_STAGING));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_ALLOC_STAGING_REMOTE_CO", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_ALLOC_STAGING_REMOTE_CO));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_REMOTE_CO_STAGING_STARTED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_REMOTE_CO_STAGING_STARTED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_REMOTE_CO_STAGING_COMPLETED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_REMOTE_CO_STAGING_COMPLETED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_WAIT_RETRY_REMOTE_CO_STAGING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_WAIT_RETRY_REMOTE_CO_STAGING));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_REQUESTED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_REQUESTED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_STARTED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_STARTED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_COMPLETED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_COMPLETED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_WAIT_RETRY", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_WAIT_RETRY));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_RETRYING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_RETRYING));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_RENAME_RETRYING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_RENAME_RETRYING));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_FILE_INSTALL_DELETE_RETRYING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_FILE_INSTALL_DELETE_RETRYING));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_CO_RECYCLED_FOR_ENUM", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_CO_RECYCLED_FOR_ENUM));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_REQUEST_OUTBOUND_PROPAGATION", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_REQUEST_OUTBOUND_PROPAGATION));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_REQUEST_ACCEPTED_OUTBOUND_LOG", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_REQUEST_ACCEPTED_OUTBOUND_LOG));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_DB_STATE_UPDATE_STARTED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_DB_STATE_UPDATE_STARTED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_DB_STATE_UPDATE_COMPLETED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_DB_STATE_UPDATE_COMPLETED));
+	PyModule_AddObject(m, "FRSRPC_CO_STATUS_CO_ABORTED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_STATUS_CO_ABORTED));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_DATA_OVERWRITE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_DATA_OVERWRITE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_DATA_EXTEND", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_DATA_EXTEND));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_DATA_TRUNCATION", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_DATA_TRUNCATION));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_NAMED_DATA_OVERWRITE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_NAMED_DATA_OVERWRITE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_NAMED_DATA_EXTEND", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_NAMED_DATA_EXTEND));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_NAMED_DATA_TRUNCATION", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_NAMED_DATA_TRUNCATION));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_FILE_CREATE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_FILE_CREATE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_FILE_DELETE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_FILE_DELETE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_EA_CHANGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_EA_CHANGE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_SECURITY_CHANGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_SECURITY_CHANGE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_OLD_NAME", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_OLD_NAME));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_NEW_NAME", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_NEW_NAME));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_BASIC_INFO_CHANGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_BASIC_INFO_CHANGE));
+	PyModule_AddObject(m, "FRSRPC_CONTENT_REASON_COMPRESSION_CHANGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CONTENT_REASON_COMPRESSION_CHANGE));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_CREATE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_CREATE));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_CREATE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_CREATE));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_DELETE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_DELETE));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_DELETE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_DELETE));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_MOVEIN", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_MOVEIN));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_MOVEIN", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_MOVEIN));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_MOVEIN2", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_MOVEIN2));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_MOVEIN2", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_MOVEIN2));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_MOVEOUT", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_MOVEOUT));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_MOVEOUT", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_MOVEOUT));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_MOVERS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_MOVERS));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_MOVERS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_MOVERS));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_MOVEDIR", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_MOVEDIR));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_MOVEDIR", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_MOVEDIR));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_FILE_NO_CMD", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_FILE_NO_CMD));
+	PyModule_AddObject(m, "FRSRPC_CO_LOCATION_DIR_NO_CMD", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_CO_LOCATION_DIR_NO_CMD));
+	PyModule_AddObject(m, "FRSRPC_DATA_EXTENSION_TERMINATOR", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_DATA_EXTENSION_TERMINATOR));
+	PyModule_AddObject(m, "FRSRPC_DATA_EXTENSION_MD5_CHECKSUM", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_DATA_EXTENSION_MD5_CHECKSUM));
+	PyModule_AddObject(m, "FRSRPC_DATA_EXTENSION_RETRY_TIMEOUT", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_DATA_EXTENSION_RETRY_TIMEOUT));
+	PyModule_AddObject(m, "FRSRPC_CO_RECORD_EXTENSION_VERSION_WIN2K", PyInt_FromLong((uint16_t)FRSRPC_CO_RECORD_EXTENSION_VERSION_WIN2K));
+	PyModule_AddObject(m, "FRSRPC_CO_RECORD_EXTENSION_VERSION_1", PyInt_FromLong((uint16_t)FRSRPC_CO_RECORD_EXTENSION_VERSION_1));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_REMOTE_CO", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_REMOTE_CO));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_RECEIVING_STATE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_RECEIVING_STATE));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_REMOTE_CO_DONE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_REMOTE_CO_DONE));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_ABORT_FETCH", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_ABORT_FETCH));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_RETRY_FETCH", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_RETRY_FETCH));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_NEED_JOIN", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_NEED_JOIN));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_START_JOIN", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_START_JOIN));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_JOINING", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_JOINING));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_JOINED", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_JOINED));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_UNJOIN_REMOTE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_UNJOIN_REMOTE));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_VVJOIN_DONE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_VVJOIN_DONE));
+	PyModule_AddObject(m, "FRSRPC_COMMAND_SEND_STAGE", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMMAND_SEND_STAGE));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_BOP", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_BOP));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_COMMAND", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_COMMAND));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_TO", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_TO));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_FROM", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_FROM));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_REPLICA", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_REPLICA));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_CONNECTION", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_CONNECTION));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_JOIN_GUID", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_JOIN_GUID));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_LAST_JOIN_TIME", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_LAST_JOIN_TIME));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_VVECTOR", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_VVECTOR));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_JOIN_TIME", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_JOIN_TIME));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_REPLICA_VERSION_GUID", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_REPLICA_VERSION_GUID));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_COMPRESSION_GUID", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_COMPRESSION_GUID));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_BLOCK", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_BLOCK));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_BLOCK_SIZE", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_BLOCK_SIZE));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_FILE_SIZE", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_FILE_SIZE));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_FILE_OFFSET", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_FILE_OFFSET));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_GVSN", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_GVSN));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_CO_GUID", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_CO_GUID));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_CO_SEQUENCE_NUMBER", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_CO_SEQUENCE_NUMBER));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_REMOTE_CO", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_REMOTE_CO));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_CO_EXT_WIN2K", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_CO_EXT_WIN2K));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_CO_EXTENTION_2", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_CO_EXTENTION_2));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_CHUNK_EOP", PyInt_FromLong((uint16_t)FRSRPC_COMM_PKT_CHUNK_EOP));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MAJOR_0", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MAJOR_0));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_0", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_0));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_1", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_1));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_2", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_2));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_3", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_3));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_4", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_4));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_5", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_5));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_6", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_6));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_7", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_7));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_8", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_8));
+	PyModule_AddObject(m, "FRSRPC_COMM_PKT_MINOR_9", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_COMM_PKT_MINOR_9));
+	PyModule_AddObject(m, "FRSRPC_PARENT_AUTH_LEVEL_ENCRYPTED_KERBEROS", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_PARENT_AUTH_LEVEL_ENCRYPTED_KERBEROS));
+	PyModule_AddObject(m, "FRSRPC_PARENT_AUTH_LEVEL_NO_AUTHENTICATION", ndr_PyLong_FromUnsignedLongLong((uint32_t)FRSRPC_PARENT_AUTH_LEVEL_NO_AUTHENTICATION));
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktChunkGuidName_Type);
+	PyModule_AddObject(m, "CommPktChunkGuidName", (PyObject *)(void *)&frsrpc_CommPktChunkGuidName_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktGSVN_Type);
+	PyModule_AddObject(m, "CommPktGSVN", (PyObject *)(void *)&frsrpc_CommPktGSVN_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktChangeOrderCommand_Type);
+	PyModule_AddObject(m, "CommPktChangeOrderCommand", (PyObject *)(void *)&frsrpc_CommPktChangeOrderCommand_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktDataExtensionChecksum_Type);
+	PyModule_AddObject(m, "CommPktDataExtensionChecksum", (PyObject *)(void *)&frsrpc_CommPktDataExtensionChecksum_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktDataExtensionRetryTimeout_Type);
+	PyModule_AddObject(m, "CommPktDataExtensionRetryTimeout", (PyObject *)(void *)&frsrpc_CommPktDataExtensionRetryTimeout_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktCoRecordExtensionWin2k_Type);
+	PyModule_AddObject(m, "CommPktCoRecordExtensionWin2k", (PyObject *)(void *)&frsrpc_CommPktCoRecordExtensionWin2k_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktChangeOrderRecordExtension_Type);
+	PyModule_AddObject(m, "CommPktChangeOrderRecordExtension", (PyObject *)(void *)&frsrpc_CommPktChangeOrderRecordExtension_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktChunk_Type);
+	PyModule_AddObject(m, "CommPktChunk", (PyObject *)(void *)&frsrpc_CommPktChunk_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_CommPktChunkCtr_Type);
+	PyModule_AddObject(m, "CommPktChunkCtr", (PyObject *)(void *)&frsrpc_CommPktChunkCtr_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_FrsSendCommPktReq_Type);
+	PyModule_AddObject(m, "FrsSendCommPktReq", (PyObject *)(void *)&frsrpc_FrsSendCommPktReq_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_StageHeader_Type);
+	PyModule_AddObject(m, "StageHeader", (PyObject *)(void *)&frsrpc_StageHeader_Type);
+	Py_INCREF((PyObject *)(void *)&frsrpc_InterfaceType);
+	PyModule_AddObject(m, "frsrpc", (PyObject *)(void *)&frsrpc_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&frsrpc_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&frsrpc_SyntaxType);
+#ifdef PY_MOD_FRSRPC_PATCH
+	PY_MOD_FRSRPC_PATCH(m);
+#endif
+
+}
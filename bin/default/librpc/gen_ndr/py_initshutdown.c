@@ -0,0 +1,702 @@
+
+/* Python wrapper functions auto-generated by pidl */
+#define PY_SSIZE_T_CLEAN 1 /* We use Py_ssize_t for PyArg_ParseTupleAndKeywords */
+#include <Python.h>
+#include "includes.h"
+#include <pytalloc.h>
+#include "librpc/rpc/pyrpc.h"
+#include "librpc/rpc/pyrpc_util.h"
+#include "bin/default/librpc/gen_ndr/ndr_initshutdown.h"
+#include "bin/default/librpc/gen_ndr/ndr_initshutdown_c.h"
+
+/*
+ * These functions are here to ensure they can be optimized out by
+ * the compiler based on the constant input values
+ */
+
+static inline unsigned long long ndr_sizeof2uintmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return UINT64_MAX;
+	case 4:
+		return UINT32_MAX;
+	case 2:
+		return UINT16_MAX;
+	case 1:
+		return UINT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline long long ndr_sizeof2intmax(size_t var_size)
+{
+	switch (var_size) {
+	case 8:
+		return INT64_MAX;
+	case 4:
+		return INT32_MAX;
+	case 2:
+		return INT16_MAX;
+	case 1:
+		return INT8_MAX;
+	}
+
+	return 0;
+}
+
+static inline PyObject *ndr_PyLong_FromLongLong(long long v)
+{
+	if (v > LONG_MAX || v < LONG_MIN) {
+		return PyLong_FromLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+static inline PyObject *ndr_PyLong_FromUnsignedLongLong(unsigned long long v)
+{
+	if (v > LONG_MAX) {
+		return PyLong_FromUnsignedLongLong(v);
+	} else {
+		return PyInt_FromLong(v);
+	}
+}
+
+#include "librpc/gen_ndr/lsa.h"
+static PyTypeObject initshutdown_InterfaceType;
+
+void initinitshutdown(void);static PyTypeObject *lsa_StringLarge_Type;
+static PyTypeObject *ClientConnection_Type;
+static PyTypeObject *ndr_syntax_id_Type;
+
+static bool pack_py_initshutdown_Init_args_in(PyObject *args, PyObject *kwargs, struct initshutdown_Init *r)
+{
+	PyObject *py_hostname;
+	PyObject *py_message;
+	PyObject *py_timeout;
+	PyObject *py_force_apps;
+	PyObject *py_do_reboot;
+	const char *kwnames[] = {
+		"hostname", "message", "timeout", "force_apps", "do_reboot", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOO:initshutdown_Init", discard_const_p(char *, kwnames), &py_hostname, &py_message, &py_timeout, &py_force_apps, &py_do_reboot)) {
+		return false;
+	}
+
+	if (py_hostname == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hostname");
+		return false;
+	}
+	if (py_hostname == Py_None) {
+		r->in.hostname = NULL;
+	} else {
+		r->in.hostname = talloc_ptrtype(r, r->in.hostname);
+		if (py_hostname == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.hostname");
+			return false;
+		}
+		{
+			const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(*r->in.hostname));
+			if (PyLong_Check(py_hostname)) {
+				unsigned long long test_var;
+				test_var = PyLong_AsUnsignedLongLong(py_hostname);
+				if (PyErr_Occurred() != NULL) {
+					return false;
+				}
+				if (test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return false;
+				}
+				*r->in.hostname = test_var;
+			} else if (PyInt_Check(py_hostname)) {
+				long test_var;
+				test_var = PyInt_AsLong(py_hostname);
+				if (test_var < 0 || test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return false;
+				}
+				*r->in.hostname = test_var;
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name);
+				return false;
+			}
+		}
+	}
+	if (py_message == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.message");
+		return false;
+	}
+	if (py_message == Py_None) {
+		r->in.message = NULL;
+	} else {
+		r->in.message = NULL;
+		if (py_message == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.message");
+			return false;
+		}
+		PY_CHECK_TYPE(lsa_StringLarge_Type, py_message, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_message)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.message = (struct lsa_StringLarge *)pytalloc_get_ptr(py_message);
+	}
+	if (py_timeout == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.timeout");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.timeout));
+		if (PyLong_Check(py_timeout)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_timeout);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.timeout = test_var;
+		} else if (PyInt_Check(py_timeout)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_timeout);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.timeout = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_force_apps == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.force_apps");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.force_apps));
+		if (PyLong_Check(py_force_apps)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_force_apps);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.force_apps = test_var;
+		} else if (PyInt_Check(py_force_apps)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_force_apps);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.force_apps = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_do_reboot == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.do_reboot");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.do_reboot));
+		if (PyLong_Check(py_do_reboot)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_do_reboot);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.do_reboot = test_var;
+		} else if (PyInt_Check(py_do_reboot)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_do_reboot);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.do_reboot = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_initshutdown_Init_args_out(struct initshutdown_Init *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_initshutdown_Abort_args_in(PyObject *args, PyObject *kwargs, struct initshutdown_Abort *r)
+{
+	PyObject *py_server;
+	const char *kwnames[] = {
+		"server", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O:initshutdown_Abort", discard_const_p(char *, kwnames), &py_server)) {
+		return false;
+	}
+
+	if (py_server == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.server");
+		return false;
+	}
+	if (py_server == Py_None) {
+		r->in.server = NULL;
+	} else {
+		r->in.server = talloc_ptrtype(r, r->in.server);
+		if (py_server == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.server");
+			return false;
+		}
+		{
+			const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(*r->in.server));
+			if (PyLong_Check(py_server)) {
+				unsigned long long test_var;
+				test_var = PyLong_AsUnsignedLongLong(py_server);
+				if (PyErr_Occurred() != NULL) {
+					return false;
+				}
+				if (test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return false;
+				}
+				*r->in.server = test_var;
+			} else if (PyInt_Check(py_server)) {
+				long test_var;
+				test_var = PyInt_AsLong(py_server);
+				if (test_var < 0 || test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return false;
+				}
+				*r->in.server = test_var;
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name);
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_initshutdown_Abort_args_out(struct initshutdown_Abort *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+static bool pack_py_initshutdown_InitEx_args_in(PyObject *args, PyObject *kwargs, struct initshutdown_InitEx *r)
+{
+	PyObject *py_hostname;
+	PyObject *py_message;
+	PyObject *py_timeout;
+	PyObject *py_force_apps;
+	PyObject *py_do_reboot;
+	PyObject *py_reason;
+	const char *kwnames[] = {
+		"hostname", "message", "timeout", "force_apps", "do_reboot", "reason", NULL
+	};
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "OOOOOO:initshutdown_InitEx", discard_const_p(char *, kwnames), &py_hostname, &py_message, &py_timeout, &py_force_apps, &py_do_reboot, &py_reason)) {
+		return false;
+	}
+
+	if (py_hostname == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.hostname");
+		return false;
+	}
+	if (py_hostname == Py_None) {
+		r->in.hostname = NULL;
+	} else {
+		r->in.hostname = talloc_ptrtype(r, r->in.hostname);
+		if (py_hostname == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.hostname");
+			return false;
+		}
+		{
+			const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(*r->in.hostname));
+			if (PyLong_Check(py_hostname)) {
+				unsigned long long test_var;
+				test_var = PyLong_AsUnsignedLongLong(py_hostname);
+				if (PyErr_Occurred() != NULL) {
+					return false;
+				}
+				if (test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return false;
+				}
+				*r->in.hostname = test_var;
+			} else if (PyInt_Check(py_hostname)) {
+				long test_var;
+				test_var = PyInt_AsLong(py_hostname);
+				if (test_var < 0 || test_var > uint_max) {
+					PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+					  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+					return false;
+				}
+				*r->in.hostname = test_var;
+			} else {
+				PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name);
+				return false;
+			}
+		}
+	}
+	if (py_message == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.message");
+		return false;
+	}
+	if (py_message == Py_None) {
+		r->in.message = NULL;
+	} else {
+		r->in.message = NULL;
+		if (py_message == NULL) {
+			PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct *r->in.message");
+			return false;
+		}
+		PY_CHECK_TYPE(lsa_StringLarge_Type, py_message, return false;);
+		if (talloc_reference(r, pytalloc_get_mem_ctx(py_message)) == NULL) {
+			PyErr_NoMemory();
+			return false;
+		}
+		r->in.message = (struct lsa_StringLarge *)pytalloc_get_ptr(py_message);
+	}
+	if (py_timeout == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.timeout");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.timeout));
+		if (PyLong_Check(py_timeout)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_timeout);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.timeout = test_var;
+		} else if (PyInt_Check(py_timeout)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_timeout);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.timeout = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_force_apps == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.force_apps");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.force_apps));
+		if (PyLong_Check(py_force_apps)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_force_apps);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.force_apps = test_var;
+		} else if (PyInt_Check(py_force_apps)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_force_apps);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.force_apps = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_do_reboot == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.do_reboot");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.do_reboot));
+		if (PyLong_Check(py_do_reboot)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_do_reboot);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.do_reboot = test_var;
+		} else if (PyInt_Check(py_do_reboot)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_do_reboot);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.do_reboot = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	if (py_reason == NULL) {
+		PyErr_Format(PyExc_AttributeError, "Cannot delete NDR object: struct r->in.reason");
+		return false;
+	}
+	{
+		const unsigned long long uint_max = ndr_sizeof2uintmax(sizeof(r->in.reason));
+		if (PyLong_Check(py_reason)) {
+			unsigned long long test_var;
+			test_var = PyLong_AsUnsignedLongLong(py_reason);
+			if (PyErr_Occurred() != NULL) {
+				return false;
+			}
+			if (test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %llu",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.reason = test_var;
+		} else if (PyInt_Check(py_reason)) {
+			long test_var;
+			test_var = PyInt_AsLong(py_reason);
+			if (test_var < 0 || test_var > uint_max) {
+				PyErr_Format(PyExc_OverflowError, "Expected type %s or %s within range 0 - %llu, got %ld",\
+				  PyInt_Type.tp_name, PyLong_Type.tp_name, uint_max, test_var);
+				return false;
+			}
+			r->in.reason = test_var;
+		} else {
+			PyErr_Format(PyExc_TypeError, "Expected type %s or %s",\
+			  PyInt_Type.tp_name, PyLong_Type.tp_name);
+			return false;
+		}
+	}
+	return true;
+}
+
+static PyObject *unpack_py_initshutdown_InitEx_args_out(struct initshutdown_InitEx *r)
+{
+	PyObject *result;
+	result = Py_None;
+	Py_INCREF(result);
+	if (!W_ERROR_IS_OK(r->out.result)) {
+		PyErr_SetWERROR(r->out.result);
+		return NULL;
+	}
+
+	return result;
+}
+
+const struct PyNdrRpcMethodDef py_ndr_initshutdown_methods[] = {
+	{ "Init", "S.Init(hostname, message, timeout, force_apps, do_reboot) -> None", (py_dcerpc_call_fn)dcerpc_initshutdown_Init_r, (py_data_pack_fn)pack_py_initshutdown_Init_args_in, (py_data_unpack_fn)unpack_py_initshutdown_Init_args_out, 0, &ndr_table_initshutdown },
+	{ "Abort", "S.Abort(server) -> None", (py_dcerpc_call_fn)dcerpc_initshutdown_Abort_r, (py_data_pack_fn)pack_py_initshutdown_Abort_args_in, (py_data_unpack_fn)unpack_py_initshutdown_Abort_args_out, 1, &ndr_table_initshutdown },
+	{ "InitEx", "S.InitEx(hostname, message, timeout, force_apps, do_reboot, reason) -> None", (py_dcerpc_call_fn)dcerpc_initshutdown_InitEx_r, (py_data_pack_fn)pack_py_initshutdown_InitEx_args_in, (py_data_unpack_fn)unpack_py_initshutdown_InitEx_args_out, 2, &ndr_table_initshutdown },
+	{ NULL }
+};
+
+static PyObject *interface_initshutdown_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_interface_init_helper(type, args, kwargs, &ndr_table_initshutdown);
+}
+
+#define PY_DOC_INITSHUTDOWN "Init shutdown service"
+static PyTypeObject initshutdown_InterfaceType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "initshutdown.initshutdown",
+	.tp_basicsize = sizeof(dcerpc_InterfaceObject),
+	.tp_doc = "initshutdown(binding, lp_ctx=None, credentials=None) -> connection\n"
+"\n"
+"binding should be a DCE/RPC binding string (for example: ncacn_ip_tcp:127.0.0.1)\n"
+"lp_ctx should be a path to a smb.conf file or a param.LoadParm object\n"
+"credentials should be a credentials.Credentials object.\n\n"PY_DOC_INITSHUTDOWN,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = interface_initshutdown_new,
+};
+
+static PyObject *syntax_initshutdown_new(PyTypeObject *type, PyObject *args, PyObject *kwargs)
+{
+	return py_dcerpc_syntax_init_helper(type, args, kwargs, &ndr_table_initshutdown.syntax_id);
+}
+
+#define PY_DOC_INITSHUTDOWN_SYNTAX "Init shutdown service"
+static PyTypeObject initshutdown_SyntaxType = {
+	PyObject_HEAD_INIT(NULL) 0,
+	.tp_name = "initshutdown.initshutdown",
+	.tp_doc = "abstract_syntax()\n"PY_DOC_INITSHUTDOWN_SYNTAX,
+	.tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_BASETYPE,
+	.tp_new = syntax_initshutdown_new,
+};
+
+static PyMethodDef initshutdown_methods[] = {
+	{ NULL, NULL, 0, NULL }
+};
+
+void initinitshutdown(void)
+{
+	PyObject *m;
+	PyObject *dep_samba_dcerpc_lsa;
+	PyObject *dep_samba_dcerpc_base;
+	PyObject *dep_samba_dcerpc_misc;
+
+	dep_samba_dcerpc_lsa = PyImport_ImportModule("samba.dcerpc.lsa");
+	if (dep_samba_dcerpc_lsa == NULL)
+		return;
+
+	dep_samba_dcerpc_base = PyImport_ImportModule("samba.dcerpc.base");
+	if (dep_samba_dcerpc_base == NULL)
+		return;
+
+	dep_samba_dcerpc_misc = PyImport_ImportModule("samba.dcerpc.misc");
+	if (dep_samba_dcerpc_misc == NULL)
+		return;
+
+	lsa_StringLarge_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_lsa, "StringLarge");
+	if (lsa_StringLarge_Type == NULL)
+		return;
+
+	ClientConnection_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_base, "ClientConnection");
+	if (ClientConnection_Type == NULL)
+		return;
+
+	ndr_syntax_id_Type = (PyTypeObject *)PyObject_GetAttrString(dep_samba_dcerpc_misc, "ndr_syntax_id");
+	if (ndr_syntax_id_Type == NULL)
+		return;
+
+	initshutdown_InterfaceType.tp_base = ClientConnection_Type;
+
+	initshutdown_SyntaxType.tp_base = ndr_syntax_id_Type;
+	initshutdown_SyntaxType.tp_basicsize = pytalloc_BaseObject_size();
+
+	if (PyType_Ready(&initshutdown_InterfaceType) < 0)
+		return;
+	if (PyType_Ready(&initshutdown_SyntaxType) < 0)
+		return;
+	if (!PyInterface_AddNdrRpcMethods(&initshutdown_InterfaceType, py_ndr_initshutdown_methods))
+		return;
+
+#ifdef PY_INITSHUTDOWN_PATCH
+	PY_INITSHUTDOWN_PATCH(&initshutdown_InterfaceType);
+#endif
+#ifdef PY_ABSTRACT_SYNTAX_PATCH
+	PY_ABSTRACT_SYNTAX_PATCH(&initshutdown_SyntaxType);
+#endif
+
+	m = Py_InitModule3("initshutdown", initshutdown_methods, "initshutdown DCE/RPC");
+	if (m == NULL)
+		return;
+
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_OTHER", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_OTHER));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_HARDWARE", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_HARDWARE));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_OPERATINGSYSTEM", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_OPERATINGSYSTEM));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_SOFTWARE", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_SOFTWARE));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_APPLICATION", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_APPLICATION));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_SYSTEM", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_SYSTEM));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_POWER", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_POWER));
+	PyModule_AddObject(m, "SHTDN_REASON_MAJOR_LEGACY_API", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MAJOR_LEGACY_API));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_OTHER", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_OTHER));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_MAINTENANCE", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_MAINTENANCE));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_INSTALLATION", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_INSTALLATION));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_UPGRADE", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_UPGRADE));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_RECONFIG", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_RECONFIG));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_HUNG", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_HUNG));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_UNSTABLE", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_UNSTABLE));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_DISK", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_DISK));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_PROCESSOR", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_PROCESSOR));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_NETWORKCARD", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_NETWORKCARD));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_POWER_SUPPLY", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_POWER_SUPPLY));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_CORDUNPLUGGED", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_CORDUNPLUGGED));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_ENVIRONMENT", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_ENVIRONMENT));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_HARDWARE_DRIVER", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_HARDWARE_DRIVER));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_OTHERDRIVER", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_OTHERDRIVER));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_BLUESCREEN", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_BLUESCREEN));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_SERVICEPACK", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_SERVICEPACK));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_HOTFIX", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_HOTFIX));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_SECURITYFIX", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_SECURITYFIX));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_SECURITY", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_SECURITY));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_NETWORK_CONNECTIVITY", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_NETWORK_CONNECTIVITY));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_WMI", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_WMI));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_SERVICEPACK_UNINSTALL", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_SERVICEPACK_UNINSTALL));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_HOTFIX_UNINSTALL", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_HOTFIX_UNINSTALL));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_SECURITYFIX_UNINSTALL", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_SECURITYFIX_UNINSTALL));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_MMC", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_MMC));
+	PyModule_AddObject(m, "SHTDN_REASON_MINOR_TERMSRV", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_MINOR_TERMSRV));
+	PyModule_AddObject(m, "SHTDN_REASON_FLAG_USER_DEFINED", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_FLAG_USER_DEFINED));
+	PyModule_AddObject(m, "SHTDN_REASON_FLAG_PLANNED", ndr_PyLong_FromUnsignedLongLong((uint32_t)SHTDN_REASON_FLAG_PLANNED));
+	Py_INCREF((PyObject *)(void *)&initshutdown_InterfaceType);
+	PyModule_AddObject(m, "initshutdown", (PyObject *)(void *)&initshutdown_InterfaceType);
+	Py_INCREF((PyObject *)(void *)&initshutdown_SyntaxType);
+	PyModule_AddObject(m, "abstract_syntax", (PyObject *)(void *)&initshutdown_SyntaxType);
+#ifdef PY_MOD_INITSHUTDOWN_PATCH
+	PY_MOD_INITSHUTDOWN_PATCH(m);
+#endif
+
+}